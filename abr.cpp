@@ -0,0 +1,358 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Adaptive Bitrate (abr.cpp)
+ * =============================================================
+ *  The window accumulators and the decision log share one lock;
+ *  the sensor write itself happens after it is released, so a
+ *  slow SCCB transaction never holds up /abr or /metrics.
+ *  Framesize steps follow a ladder of 4:3 sizes rather than the
+ *  framesize_t order, which mixes in square and CIF shapes.
+ * =============================================================
+ */
+
+#include "abr.h"
+#include "camera_control.h"
+#include "device_state.h"
+#include "events.h"
+#include "metrics.h"
+#include "roi.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <Preferences.h>
+#include <WiFi.h>
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+static const uint8_t ladder[] = {
+  FRAMESIZE_QQVGA, FRAMESIZE_QVGA, FRAMESIZE_HVGA, FRAMESIZE_VGA, FRAMESIZE_SVGA,
+  FRAMESIZE_XGA, FRAMESIZE_HD, FRAMESIZE_SXGA, FRAMESIZE_UXGA
+};
+#define LADDER_LEN (sizeof(ladder) / sizeof(ladder[0]))
+
+typedef struct {
+  uint32_t ms;               // uptime of the decision
+  int8_t dir;                // -1 down, +1 up
+  const char *param;
+  const char *reason;
+  uint8_t quality;           // settings after the step
+  uint8_t framesize;
+  uint16_t fps10;            // measured window that caused it
+  uint16_t sendMs;
+  uint32_t kbps;
+  int8_t rssi;               // 0 = not a station
+} abr_decision_t;
+
+typedef struct {
+  uint16_t fps10;
+  uint16_t sendMs;
+  uint32_t kbps;
+  int8_t rssi;
+  float sendShare;
+} abr_window_t;
+
+static abr_config_t cfg = {
+  ABR_DEFAULT_ENABLED, 12, 200, 10, 40, FRAMESIZE_QQVGA, FRAMESIZE_VGA
+};
+static SemaphoreHandle_t abrLock = NULL;
+
+// Current window
+static uint32_t frames = 0;
+static uint64_t frameUsSum = 0;
+static uint64_t sendUsSum = 0;
+static uint64_t byteSum = 0;
+static int64_t windowStartUs = 0;
+static int64_t holdUntilUs = 0;
+static uint8_t upStreak = 0;
+
+static abr_window_t last = { 0, 0, 0, 0, 0 };
+static abr_decision_t history[ABR_HISTORY];
+static uint32_t decisions = 0;   // total; history[decisions % ABR_HISTORY] is next
+static uint32_t stepsDown = 0;
+static uint32_t stepsUp = 0;
+
+// ==================================================================
+//  Configuration
+// ==================================================================
+static bool valid(const abr_config_t *c) {
+  return c->targetFps >= 1 && c->targetFps <= 30 &&
+         c->maxSendMs >= 20 && c->maxSendMs <= 2000 &&
+         c->qualityBest >= 4 && c->qualityWorst <= 63 && c->qualityBest <= c->qualityWorst &&
+         c->framesizeMin >= 0 && c->framesizeMin <= c->framesizeMax && c->framesizeMax < FRAMESIZE_INVALID;
+}
+
+void abr_init() {
+  if (!abrLock) abrLock = xSemaphoreCreateMutex();
+
+  Preferences prefs;
+  if (!prefs.begin(ABR_NS, true)) return;  // namespace not created yet: defaults
+  abr_config_t c = cfg;
+  c.enabled = prefs.getBool("enabled", c.enabled);
+  c.targetFps = prefs.getInt("fps", c.targetFps);
+  c.maxSendMs = prefs.getInt("send_ms", c.maxSendMs);
+  c.qualityBest = prefs.getInt("q_best", c.qualityBest);
+  c.qualityWorst = prefs.getInt("q_worst", c.qualityWorst);
+  c.framesizeMin = prefs.getInt("fs_min", c.framesizeMin);
+  c.framesizeMax = prefs.getInt("fs_max", c.framesizeMax);
+  prefs.end();
+  if (valid(&c)) cfg = c;
+  log_i("ABR: %s, target %d fps, send budget %d ms", cfg.enabled ? "on" : "off", cfg.targetFps,
+        cfg.maxSendMs);
+}
+
+void abr_get_config(abr_config_t *out) {
+  xSemaphoreTake(abrLock, portMAX_DELAY);
+  *out = cfg;
+  xSemaphoreGive(abrLock);
+}
+
+bool abr_set_config(const abr_config_t *c) {
+  if (!valid(c)) return false;
+  xSemaphoreTake(abrLock, portMAX_DELAY);
+  cfg = *c;
+  frames = 0;          // start measuring afresh under the new rules
+  upStreak = 0;
+  holdUntilUs = 0;
+  xSemaphoreGive(abrLock);
+
+  Preferences prefs;
+  if (prefs.begin(ABR_NS, false)) {
+    prefs.putBool("enabled", c->enabled);
+    prefs.putInt("fps", c->targetFps);
+    prefs.putInt("send_ms", c->maxSendMs);
+    prefs.putInt("q_best", c->qualityBest);
+    prefs.putInt("q_worst", c->qualityWorst);
+    prefs.putInt("fs_min", c->framesizeMin);
+    prefs.putInt("fs_max", c->framesizeMax);
+    prefs.end();
+  }
+  log_i("ABR: %s, target %d fps, send budget %d ms", c->enabled ? "on" : "off", c->targetFps,
+        c->maxSendMs);
+  return true;
+}
+
+// ==================================================================
+//  Steps
+// ==================================================================
+// Next ladder size strictly below/above `fs` within the bounds, or -1
+static int ladder_step(int fs, int dir, const abr_config_t *c) {
+  if (dir < 0) {
+    for (int i = LADDER_LEN - 1; i >= 0; i--) {
+      if (ladder[i] < fs) return ladder[i] >= c->framesizeMin ? ladder[i] : -1;
+    }
+  } else {
+    for (size_t i = 0; i < LADDER_LEN; i++) {
+      if (ladder[i] > fs) return ladder[i] <= c->framesizeMax ? ladder[i] : -1;
+    }
+  }
+  return -1;
+}
+
+// Pick the parameter to move; false when already at the bound.
+// A framesize step would wipe an ROI window, so only quality moves then.
+static bool plan_step(sensor_t *s, int dir, const abr_config_t *c, const char **param, int *value) {
+  int q = s->status.quality;
+  int fs = s->status.framesize;
+  bool sizes = !roi_active();
+  if (dir < 0) {
+    if (q < c->qualityWorst) {
+      *param = "quality";
+      *value = q + ABR_Q_STEP < c->qualityWorst ? q + ABR_Q_STEP : c->qualityWorst;
+      return true;
+    }
+    *param = "framesize";
+    *value = sizes ? ladder_step(fs, -1, c) : -1;
+    return *value >= 0;
+  }
+  if (sizes && (*value = ladder_step(fs, +1, c)) >= 0) {
+    *param = "framesize";
+    return true;
+  }
+  if (q > c->qualityBest) {
+    *param = "quality";
+    *value = q - ABR_Q_STEP > c->qualityBest ? q - ABR_Q_STEP : c->qualityBest;
+    return true;
+  }
+  return false;
+}
+
+static void publish(const abr_decision_t *d) {
+  char json[EVENTS_ALERT_LEN];
+  json_writer_t w;
+  jw_init(&w, json, sizeof(json), NULL);
+  jw_obj_open(&w);
+  jw_str(&w, "dir", d->dir < 0 ? "down" : "up");
+  jw_str(&w, "param", d->param);
+  jw_str(&w, "reason", d->reason);
+  jw_uint(&w, "quality", d->quality);
+  jw_uint(&w, "framesize", d->framesize);
+  jw_float(&w, "fps", d->fps10 / 10.0f, 1);
+  jw_uint(&w, "send_ms", d->sendMs);
+  jw_obj_close(&w);
+  if (jw_result(&w) > 0) events_publish("abr", json);
+}
+
+// ==================================================================
+//  Control loop
+// ==================================================================
+// Called with the lock held; returns the step to take (dir 0 = none)
+static int decide(const abr_config_t *c, const char **reason) {
+  float fps = last.fps10 / 10.0f;
+  if (last.sendMs > c->maxSendMs) {
+    *reason = "send_slow";
+    return -1;
+  }
+  if (fps < c->targetFps * 0.8f && last.sendShare > ABR_SEND_BUSY) {
+    *reason = "fps_low";
+    return -1;
+  }
+  bool roomy = fps >= c->targetFps * 0.9f && last.sendShare < ABR_SEND_IDLE &&
+               last.sendMs < c->maxSendMs / 2 && (last.rssi == 0 || last.rssi >= ABR_RSSI_WEAK);
+  upStreak = roomy ? upStreak + 1 : 0;
+  if (upStreak >= ABR_UP_WINDOWS) {
+    *reason = "headroom";
+    return +1;
+  }
+  return 0;
+}
+
+void abr_observe(uint32_t frameUs, uint32_t sendUs, size_t bytes) {
+  if (!abrLock || !cfg.enabled) return;
+  int64_t now = esp_timer_get_time();
+
+  xSemaphoreTake(abrLock, portMAX_DELAY);
+  // A new stream (or the end of a hold) starts a fresh window
+  if (now < holdUntilUs || frames == 0 || now - windowStartUs > 2LL * ABR_WINDOW_MS * 1000) {
+    frames = 0;
+    frameUsSum = sendUsSum = byteSum = 0;
+    windowStartUs = now;
+    if (now < holdUntilUs) {
+      xSemaphoreGive(abrLock);
+      return;
+    }
+  }
+  frames++;
+  frameUsSum += frameUs;
+  sendUsSum += sendUs;
+  byteSum += bytes;
+  if (now - windowStartUs < ABR_WINDOW_MS * 1000LL || frames < ABR_MIN_FRAMES || !frameUsSum) {
+    xSemaphoreGive(abrLock);
+    return;
+  }
+
+  last.fps10 = (uint16_t)(frames * 10000000ULL / frameUsSum);
+  last.sendMs = (uint16_t)(sendUsSum / frames / 1000);
+  last.kbps = (uint32_t)(byteSum * 8000ULL / frameUsSum);
+  last.sendShare = (float)sendUsSum / frameUsSum;
+  last.rssi = WiFi.status() == WL_CONNECTED ? WiFi.RSSI() : 0;
+  frames = 0;
+
+  abr_config_t c = cfg;
+  const char *reason = NULL;
+  int dir = decide(&c, &reason);
+  abr_window_t seen = last;
+  xSemaphoreGive(abrLock);
+  if (!dir) return;
+
+  sensor_t *s = esp_camera_sensor_get();
+  const char *param = NULL;
+  int value = 0;
+  if (!s || s->pixformat != PIXFORMAT_JPEG || !plan_step(s, dir, &c, &param, &value)) return;
+  if (control_set(param, value) != CONTROL_OK) {
+    log_w("ABR: could not set %s=%d", param, value);
+    return;
+  }
+  device_state_invalidate(STATE_CAMERA);
+
+  abr_decision_t d = { (uint32_t)(now / 1000), (int8_t)dir, param, reason, s->status.quality,
+                       (uint8_t)s->status.framesize, seen.fps10, seen.sendMs, seen.kbps, seen.rssi };
+  xSemaphoreTake(abrLock, portMAX_DELAY);
+  history[decisions++ % ABR_HISTORY] = d;
+  if (dir < 0) stepsDown++;
+  else stepsUp++;
+  upStreak = 0;
+  holdUntilUs = esp_timer_get_time() + ABR_HOLD_MS * 1000LL;
+  xSemaphoreGive(abrLock);
+
+  log_i("ABR: %s %s=%d (%s: %.1f fps, send %u ms, %u kbps, rssi %d)", dir < 0 ? "down" : "up", param,
+        value, reason, seen.fps10 / 10.0f, seen.sendMs, seen.kbps, seen.rssi);
+  publish(&d);
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+void abr_report(json_writer_t *w) {
+  xSemaphoreTake(abrLock, portMAX_DELAY);
+  abr_config_t c = cfg;
+  abr_window_t win = last;
+  uint32_t n = decisions, down = stepsDown, up = stepsUp;
+  abr_decision_t recent[ABR_HISTORY];
+  memcpy(recent, history, sizeof(recent));
+  xSemaphoreGive(abrLock);
+
+  jw_bool(w, "enabled", c.enabled);
+  jw_key(w, "config");
+  jw_obj_open(w);
+  jw_uint(w, "fps", c.targetFps);
+  jw_uint(w, "send_ms", c.maxSendMs);
+  jw_uint(w, "q_best", c.qualityBest);
+  jw_uint(w, "q_worst", c.qualityWorst);
+  jw_uint(w, "fs_min", c.framesizeMin);
+  jw_uint(w, "fs_max", c.framesizeMax);
+  jw_obj_close(w);
+
+  jw_key(w, "window");
+  jw_obj_open(w);
+  jw_float(w, "fps", win.fps10 / 10.0f, 1);
+  jw_uint(w, "send_ms", win.sendMs);
+  jw_float(w, "send_share", win.sendShare);
+  jw_uint(w, "kbps", win.kbps);
+  if (win.rssi) jw_int(w, "rssi", win.rssi);
+  else jw_null(w, "rssi");
+  jw_obj_close(w);
+
+  jw_uint(w, "steps_down", down);
+  jw_uint(w, "steps_up", up);
+
+  // Newest first
+  jw_arr_open(w, "decisions");
+  uint32_t kept = n < ABR_HISTORY ? n : ABR_HISTORY;
+  for (uint32_t i = 0; i < kept; i++) {
+    const abr_decision_t *d = &recent[(n - 1 - i) % ABR_HISTORY];
+    jw_obj_open(w);
+    jw_uint(w, "ms", d->ms);
+    jw_str(w, "dir", d->dir < 0 ? "down" : "up");
+    jw_str(w, "param", d->param);
+    jw_str(w, "reason", d->reason);
+    jw_uint(w, "quality", d->quality);
+    jw_uint(w, "framesize", d->framesize);
+    jw_float(w, "fps", d->fps10 / 10.0f, 1);
+    jw_uint(w, "send_ms", d->sendMs);
+    jw_uint(w, "kbps", d->kbps);
+    if (d->rssi) jw_int(w, "rssi", d->rssi);
+    jw_obj_close(w);
+  }
+  jw_arr_close(w);
+}
+
+void abr_metrics(json_writer_t *w) {
+  xSemaphoreTake(abrLock, portMAX_DELAY);
+  bool enabled = cfg.enabled;
+  uint32_t down = stepsDown, up = stepsUp;
+  uint16_t fps10 = last.fps10;
+  uint32_t kbps = last.kbps;
+  xSemaphoreGive(abrLock);
+
+  metrics_gauge(w, "trinetra_abr_enabled", "1 while adaptive bitrate drives the stream", enabled ? 1 : 0);
+  metrics_family(w, "trinetra_abr_steps_total", "counter", "Adaptive bitrate steps taken");
+  metrics_value(w, "trinetra_abr_steps_total", "direction=\"down\"", down);
+  metrics_value(w, "trinetra_abr_steps_total", "direction=\"up\"", up);
+  metrics_gauge(w, "trinetra_abr_window_fps", "Stream frame rate in the last ABR window", fps10 / 10.0);
+  metrics_gauge(w, "trinetra_abr_window_kbps", "Stream throughput in the last ABR window", kbps);
+}
@@ -0,0 +1,86 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Adaptive Bitrate (abr.h)
+ * =============================================================
+ *  Closed-loop control of the live stream's size on the wire.
+ *  The stream loop reports every frame (interval, time spent in
+ *  send, bytes); every ABR_WINDOW_MS the controller looks at
+ *  frame rate, send time, throughput and RSSI and takes at most
+ *  one step:
+ *
+ *    down  the network is the bottleneck: a frame's send takes
+ *          longer than the latency budget, or the rate is below
+ *          target while most of each frame period goes to send.
+ *          JPEG quality coarsens first, then framesize drops.
+ *    up    the link is mostly idle, the target rate is met and
+ *          the signal is not weak, for ABR_UP_WINDOWS in a row.
+ *          Framesize comes back first, then quality.
+ *
+ *  Down reacts in one window, up needs several, and every step
+ *  is followed by ABR_HOLD_MS of ignored measurements while the
+ *  sensor settles; together that keeps it from oscillating. A
+ *  slow camera (low rate, idle link) is not a network problem
+ *  and causes no step. Steps go through control_apply(), so a
+ *  manual slider change is simply the new starting point. While
+ *  a recording is under rate control (rec_rate.h) the stream's
+ *  frames are not fed in and no step is taken; while an ROI is
+ *  set (roi.h) only quality moves.
+ *
+ *  Configuration lives in NVS (namespace ABR_NS) and survives
+ *  reboots; ABR_DEFAULT_ENABLED decides a fresh device.
+ * =============================================================
+ */
+#ifndef ABR_H
+#define ABR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "json_writer.h"
+
+#ifndef ABR_DEFAULT_ENABLED
+#define ABR_DEFAULT_ENABLED   0
+#endif
+
+#define ABR_NS            "abr"
+#define ABR_WINDOW_MS     2000     // measurement window
+#define ABR_MIN_FRAMES    4        // fewer frames than this extend the window
+#define ABR_HOLD_MS       4000     // ignore measurements after a step
+#define ABR_UP_WINDOWS    3        // consecutive good windows before stepping up
+#define ABR_Q_STEP        5        // JPEG quality step (higher = coarser)
+#define ABR_SEND_BUSY     0.5f     // share of frame time in send: link is the bottleneck
+#define ABR_SEND_IDLE     0.25f    // ...and below this it has room
+#define ABR_RSSI_WEAK     -75      // dBm; no up steps below this
+#define ABR_HISTORY       8        // decisions kept for /abr
+
+typedef struct {
+  bool enabled;
+  int targetFps;             // 1..30
+  int maxSendMs;             // per-frame send (latency) budget, 20..2000
+  int qualityBest;           // lowest quality value used (finest), 4..63
+  int qualityWorst;          // highest quality value used (coarsest)
+  int framesizeMin;          // framesize_t bounds
+  int framesizeMax;
+} abr_config_t;
+
+// Load the configuration from NVS (defaults when absent)
+void abr_init();
+
+// Per streamed frame: time since the previous frame, time spent
+// sending it and its size. Called from the stream loop.
+void abr_observe(uint32_t frameUs, uint32_t sendUs, size_t bytes);
+
+void abr_get_config(abr_config_t *cfg);
+
+// Validate, apply and persist; false (nothing changed) when a
+// value is out of range
+bool abr_set_config(const abr_config_t *cfg);
+
+// Keys for an open object: enabled, config, last window, steps
+// and the recent decisions
+void abr_report(json_writer_t *w);
+
+// Gauges/counters for /metrics
+void abr_metrics(json_writer_t *w);
+
+#endif  // ABR_H
@@ -9,15 +9,32 @@
  *    /          -> Serve HTML UI
  *    /stream    -> MJPEG live stream (port 81)
  *    /capture   -> Capture single JPEG frame
- *    /save-photo-> Capture & save JPEG to SD card
- *    /control   -> Set camera params (framesize, quality, etc.)
+ *    /save-photo-> Capture JPEG, queue it for the SD writer
+ *    /save-status-> Write-behind queue state and recent saves
+ *    /burst     -> N frames at sensor rate into PSRAM, then to SD
+ *    /control   -> Set camera params, many per request (GET or POST)
+ *    /preset    -> Named sensor presets in NVS (list/apply/save/delete)
  *    /status    -> JSON status of camera sensor
+ *    /state     -> Versioned snapshot of all polled state (?since=N)
+ *    /events    -> Server-Sent Events: state deltas + alerts
  *    /led       -> Flash LED on/off
  *    /system-stats -> Real-time system monitoring data
- *    /wifi-scan    -> Scan available WiFi networks
- *    /wifi-connect -> Connect to selected network
+ *    /tasks        -> Per-task CPU use, stack headroom, priority, core
+ *    /metrics      -> Prometheus text: per-URI counters + latency, frame,
+ *                     stream, SD histograms, heap/PSRAM low-water, RSSI
+ *    /wifi-scan    -> Scan available WiFi networks (runs as a job)
+ *    /wifi-connect -> Connect to selected network (runs as a job)
  *    /wifi-status  -> Get WiFi connection status
  *    /wifi-reset   -> Clear saved WiFi credentials
+ *    /download-file   -> Stream a file from SD (read-ahead pipeline)
+ *    /delete-files    -> POST: bulk delete job, GET ?job=: results
+ *    /thumb           -> Cached 1/8-scale gallery thumbnail
+ *    /export          -> Stream selected media as one TAR archive
+ *    /jobs            -> Background jobs: GET list or /jobs/<id>,
+ *                        POST /jobs/wifi-scan|wifi-connect|delete
+ *    /bench/download  -> SD read throughput: old loop vs pipeline
+ *    /bench/fs-create -> File-create latency: flat dir vs sharded
+ *    /bench/sd        -> Card qualification: throughput + latency sweep
  * =============================================================
  */
 
@@ -28,8 +45,34 @@
 #include "fb_gfx.h"
 #include "esp32-hal-ledc.h"
 #include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "camera_index.h"
 #include "board_config.h"
+#include "sd_stream.h"
+#include "thumbs.h"
+#include "bulk_delete.h"
+#include "media_store.h"
+#include "media_export.h"
+#include "sd_writer.h"
+#include "burst.h"
+#include "sd_bench.h"
+#include "device_state.h"
+#include "events.h"
+#include "camera_control.h"
+#include "sensor_params.h"
+#include "json_writer.h"
+#include "jobs.h"
+#include "task_config.h"
+#include "metrics.h"
+#include "mem_track.h"
+#include "mem_pool.h"
+#include "http_workers.h"
+#include "abr.h"
+#include "rec_rate.h"
+#include "motion.h"
+#include "scene.h"
+#include "roi.h"
 
 // WiFi (must come before lwIP socket headers to avoid INADDR_NONE conflict)
 #include <WiFi.h>
@@ -54,6 +97,9 @@ int led_duty = 0;
 bool isStreaming = false;
 #endif
 
+// Open /stream connections (shown in system stats, pushed on change)
+static volatile uint8_t streamViewers = 0;
+
 // =======================
 // SD Card State
 // =======================
@@ -70,10 +116,10 @@ extern unsigned long lastFrameTime;
 // =======================
 // WiFi Manager Functions (from trenetra.ino)
 // =======================
-extern String scanNetworks();
+extern bool scanNetworks(json_writer_t *w);
 extern void saveWiFiCredentials(const char* ssid, const char* password);
 extern void clearWiFiCredentials();
-extern String getWiFiStatus();
+extern void getWiFiStatus(json_writer_t *w);
 extern bool connectToWiFi(const char* ssid, const char* password, int timeoutSeconds);
 extern bool wifiConnected;
 
@@ -88,6 +134,20 @@ static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %
 httpd_handle_t stream_httpd = NULL;
 httpd_handle_t camera_httpd = NULL;
 
+// =======================
+// JSON Responses (json_writer.h; headers are set by each handler)
+// =======================
+static esp_err_t send_json_error(httpd_req_t *req, const char *error) {
+  char buf[128];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", false);
+  jw_str(&w, "error", error);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
+
 // =======================
 // Rolling Average Filter (for FPS logging)
 // =======================
@@ -103,7 +163,7 @@ static ra_filter_t ra_filter;
 
 static ra_filter_t *ra_filter_init(ra_filter_t *filter, size_t sample_size) {
   memset(filter, 0, sizeof(ra_filter_t));
-  filter->values = (int *)malloc(sample_size * sizeof(int));
+  filter->values = (int *)mem_alloc(MEM_STREAM, sample_size * sizeof(int));
   if (!filter->values) return NULL;
   memset(filter->values, 0, sample_size * sizeof(int));
   filter->size = sample_size;
@@ -137,28 +197,182 @@ void enable_led(bool en) {
 }
 #endif
 
-// =======================
-// Photo Counter for SD filenames
-// =======================
-uint32_t photoCounter = 0;
-
 // =======================
 // Video Recording State
 // =======================
 static bool isRecording = false;
 static File recordingFile;
-static uint32_t recordingCounter = 0;
 static unsigned long recordingStartTime = 0;
 static unsigned long recordingFrameCount = 0;
-static char currentRecordingFilename[64];
+static char currentRecordingFilename[64];               // "/video_XXXXX.mjpeg" as shown to clients
+static char currentRecordingPath[MEDIA_PATH_MAX];       // Sharded location on the card
+static SemaphoreHandle_t recLock = NULL;                // File and state: stream loop, motion task, handlers
+static bool motionRecording = false;                    // Started by motion detection, which stops it
+
+// Open a new recording; NULL on success, else the error for the client
+static const char *recording_begin() {
+  if (!sdCardAvailable) return "SD card not available";
+
+  xSemaphoreTake(recLock, portMAX_DELAY);
+  if (isRecording) {
+    xSemaphoreGive(recLock);
+    return "Already recording";
+  }
+
+  // Create filename: /video_XXXXX.mjpeg (stored in its sharded bucket)
+  currentRecordingFilename[0] = '/';
+  bool named = media_next_name("video_", ".mjpeg", currentRecordingFilename + 1,
+                               sizeof(currentRecordingFilename) - 1) &&
+               media_create_path(currentRecordingFilename, currentRecordingPath,
+                                 sizeof(currentRecordingPath));
+
+  // Open file for writing
+  if (named) recordingFile = SD_MMC.open(currentRecordingPath, FILE_WRITE);
+  if (!named || !recordingFile) {
+    xSemaphoreGive(recLock);
+    return "Failed to create recording file";
+  }
+
+  // Write MJPEG header
+  recordingFile.println("--" PART_BOUNDARY);
+
+  // Set recording state
+  isRecording = true;
+  motionRecording = false;
+  recordingStartTime = millis();
+  recordingFrameCount = 0;
+  xSemaphoreGive(recLock);
+
+  device_state_invalidate(STATE_RECORDING);
+  rec_rate_start();
+  log_i("Recording started: %s", currentRecordingFilename);
+  return NULL;
+}
+
+// Close the current recording; false if there was none
+static bool recording_end(unsigned long *fileSize, unsigned long *frames, unsigned long *duration) {
+  xSemaphoreTake(recLock, portMAX_DELAY);
+  if (!isRecording) {
+    xSemaphoreGive(recLock);
+    return false;
+  }
+
+  // Close the file
+  recordingFile.close();
+  isRecording = false;
+  motionRecording = false;
+  *frames = recordingFrameCount;
+  *duration = (millis() - recordingStartTime) / 1000;
+  xSemaphoreGive(recLock);
+
+  // Get file size
+  *fileSize = 0;
+  File checkFile = SD_MMC.open(currentRecordingPath, FILE_READ);
+  if (checkFile) {
+    *fileSize = checkFile.size();
+    checkFile.close();
+  }
+
+  rec_rate_stop();
+  device_state_invalidate(STATE_RECORDING);
+  device_state_invalidate(STATE_SD);
+
+  log_i("Recording stopped: %s (%lu bytes, %lu frames, %lu seconds)",
+        currentRecordingFilename, *fileSize, *frames, *duration);
+  return true;
+}
+
+// Append one JPEG part to the current recording (no-op when not recording)
+static void record_frame(const uint8_t *buf, size_t len) {
+  xSemaphoreTake(recLock, portMAX_DELAY);
+  if (!isRecording) {
+    xSemaphoreGive(recLock);
+    return;
+  }
+  int64_t writeUs = esp_timer_get_time();
+  recordingFile.println("Content-Type: image/jpeg");
+  recordingFile.print("Content-Length: ");
+  recordingFile.println(len);
+  recordingFile.println();
+  recordingFile.write(buf, len);
+  recordingFile.println();
+  recordingFile.println("--" PART_BOUNDARY);
+  recordingFrameCount++;
+  uint32_t writeTime = metrics_us_since(writeUs, esp_timer_get_time());
+  xSemaphoreGive(recLock);
+
+  metrics_observe(&metrics_sd_write_us, writeTime);
+  rec_rate_frame(len, writeTime);
+}
 
 // ==================================================================
 //  HANDLER: Serve the HTML UI
 // ==================================================================
 static esp_err_t index_handler(httpd_req_t *req) {
-  httpd_resp_set_type(req, "text/html");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, index_html, strlen(index_html));
+  httpd_resp_set_hdr(req, "ETag", INDEX_HTML_ETAG);
+  // Revalidate daily; a firmware update changes the ETag
+  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=86400");
+
+  // Browser already has this build: no body
+  char etag[24];
+  size_t etagLen = httpd_req_get_hdr_value_len(req, "If-None-Match");
+  if (etagLen > 0 && etagLen < sizeof(etag) &&
+      httpd_req_get_hdr_value_str(req, "If-None-Match", etag, sizeof(etag)) == ESP_OK &&
+      strcmp(etag, INDEX_HTML_ETAG) == 0) {
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, NULL, 0);
+  }
+
+  // Precompressed at build time (tools/build_ui.py)
+  httpd_resp_set_type(req, "text/html");
+  httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+  httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
+  return httpd_resp_send(req, (const char *)index_html_gz, index_html_gz_len);
+}
+
+// ==================================================================
+//  JPEG conversion for non-JPEG sensor formats
+// ==================================================================
+#define JPEG_POOL_BLOCK   (96 * 1024)   // VGA RGB565 at q80 with room to spare
+#define JPEG_POOL_BLOCKS  2             // stream + capture at once
+
+static mem_pool_t *jpegPool = NULL;
+
+typedef struct {
+  uint8_t *buf;
+  size_t cap;
+  size_t len;
+  bool overflow;
+} jpeg_sink_t;
+
+static size_t jpeg_sink_write(void *arg, size_t index, const void *data, size_t len) {
+  jpeg_sink_t *s = (jpeg_sink_t *)arg;
+  if (s->overflow || index + len > s->cap) {
+    s->overflow = true;   // keep accepting; the result is discarded below
+    return len;
+  }
+  memcpy(s->buf + index, data, len);
+  s->len = index + len;
+  return len;
+}
+
+// Encode into a pooled block; fall back to frame2jpg()'s own growing
+// buffer when the pool is empty or the frame does not fit. Release
+// the result with pool_free(MEM_STREAM, ...).
+static bool frame_to_jpeg(camera_fb_t *fb, uint8_t **out, size_t *len) {
+  jpeg_sink_t sink = { (uint8_t *)mem_pool_get(jpegPool), mem_pool_block_size(jpegPool), 0, false };
+  if (sink.buf) {
+    if (frame2jpg_cb(fb, 80, jpeg_sink_write, &sink) && !sink.overflow) {
+      *out = sink.buf;
+      *len = sink.len;
+      return true;
+    }
+    pool_free(MEM_STREAM, sink.buf);
+  }
+  if (!frame2jpg(fb, 80, out, len)) return false;
+  mem_adopt(MEM_STREAM, *out);
+  return true;
 }
 
 // ==================================================================
@@ -171,14 +385,17 @@ static esp_err_t capture_handler(httpd_req_t *req) {
 #if defined(LED_GPIO_NUM)
   enable_led(true);
   vTaskDelay(150 / portTICK_PERIOD_MS);
+#endif
+  int64_t grabUs = esp_timer_get_time();
   fb = esp_camera_fb_get();
+  metrics_observe(&metrics_capture_us, metrics_us_since(grabUs, esp_timer_get_time()));
+#if defined(LED_GPIO_NUM)
   enable_led(false);
-#else
-  fb = esp_camera_fb_get();
 #endif
 
   if (!fb) {
     log_e("Camera capture failed");
+    metrics_capture_failures.fetch_add(1, std::memory_order_relaxed);
     httpd_resp_send_500(req);
     return ESP_FAIL;
   }
@@ -193,10 +410,10 @@ static esp_err_t capture_handler(httpd_req_t *req) {
     // Convert to JPEG if not already
     uint8_t *jpg_buf = NULL;
     size_t jpg_len = 0;
-    bool converted = frame2jpg(fb, 80, &jpg_buf, &jpg_len);
+    bool converted = frame_to_jpeg(fb, &jpg_buf, &jpg_len);
     if (converted) {
       res = httpd_resp_send(req, (const char *)jpg_buf, jpg_len);
-      free(jpg_buf);
+      pool_free(MEM_STREAM, jpg_buf);
     } else {
       log_e("JPEG conversion failed");
       res = ESP_FAIL;
@@ -212,15 +429,12 @@ static esp_err_t capture_handler(httpd_req_t *req) {
 //  HANDLER: Save photo to SD card
 // ==================================================================
 static esp_err_t save_photo_handler(httpd_req_t *req) {
-  char json_response[256];
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
   // Check if SD card is available
   if (!sdCardAvailable) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"SD card not available\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+    return send_json_error(req, "SD card not available");
   }
 
   // Capture a frame
@@ -236,249 +450,307 @@ static esp_err_t save_photo_handler(httpd_req_t *req) {
 #endif
 
   if (!fb) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Camera capture failed\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+    return send_json_error(req, "Camera capture failed");
   }
 
-  // Build filename: /trinetra_XXXXX.jpg
+  // Build filename: /trinetra_XXXXX.jpg (stored in its sharded bucket)
   char filename[64];
-  photoCounter++;
-  snprintf(filename, sizeof(filename), "/trinetra_%05lu.jpg", (unsigned long)photoCounter);
-
-  // Write to SD card
-  File file = SD_MMC.open(filename, FILE_WRITE);
-  if (!file) {
+  filename[0] = '/';
+  if (!media_next_name("trinetra_", ".jpg", filename + 1, sizeof(filename) - 1)) {
     esp_camera_fb_return(fb);
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Failed to open file on SD\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+    return send_json_error(req, "Failed to allocate filename");
   }
 
-  size_t written = 0;
-  if (fb->format == PIXFORMAT_JPEG) {
-    written = file.write(fb->buf, fb->len);
-  } else {
-    // Convert to JPEG first
-    uint8_t *jpg_buf = NULL;
-    size_t jpg_len = 0;
-    if (frame2jpg(fb, 80, &jpg_buf, &jpg_len)) {
-      written = file.write(jpg_buf, jpg_len);
-      free(jpg_buf);
-    }
-  }
-  file.close();
+  // Hand the JPEG to the background writer; the frame buffer goes back now
+  uint32_t seq = 0;
+  size_t len = 0;
+  bool queued = sd_writer_submit_fb(fb, filename, &seq, &len);
   esp_camera_fb_return(fb);
 
-  if (written > 0) {
-    log_i("Photo saved: %s (%u bytes)", filename, written);
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":true,\"filename\":\"%s\",\"size\":%u}",
-             filename, (unsigned)written);
-  } else {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Write failed\"}");
-  }
-
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  if (!queued) return send_json_error(req, "Save queue full");
+  log_i("Photo queued: %s (%u bytes, #%u)", filename, (unsigned)len, seq);
+
+  char buf[192];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_str(&w, "filename", filename);
+  jw_uint(&w, "size", len);
+  jw_bool(&w, "queued", true);
+  jw_uint(&w, "seq", seq);
+  jw_obj_close(&w);
+  return jw_finish(&w);
 }
 
 // ==================================================================
-//  HANDLER: Get SD Card Information
+//  SD usage (FAT free-cluster count is slow; shared 5 s cache)
 // ==================================================================
-static esp_err_t sd_info_handler(httpd_req_t *req) {
-  char json_response[256];
-  httpd_resp_set_type(req, "application/json");
-  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+#define SD_USAGE_CACHE_MS 5000
+#define SD_LOW_PERCENT    90    // alert subscribers at this fill level
+#define SD_LOW_REARM      85    // ...and again only after dropping below this
+
+// Cache and alert state: control task and the parallel workers (/metrics)
+static SemaphoreHandle_t sdUsageLock = NULL;
+
+// Edge-triggered, so a full card does not repeat the alert every
+// refresh; called with sdUsageLock held
+static void sd_check_low(uint64_t total, uint64_t used) {
+  static bool alerted = false;
+  float percent = total > 0 ? used * 100.0 / total : 0;
+  if (!alerted && percent >= SD_LOW_PERCENT) {
+    char json[96];
+    json_writer_t w;
+    jw_init(&w, json, sizeof(json), NULL);
+    jw_obj_open(&w);
+    jw_str(&w, "type", "sd_low");
+    jw_float(&w, "percent", percent);
+    jw_uint(&w, "free", total - used);
+    jw_obj_close(&w);
+    if (jw_result(&w) > 0) events_publish("alert", json);
+    alerted = true;
+  } else if (alerted && percent < SD_LOW_REARM) {
+    alerted = false;
+  }
+}
 
-  if (!sdCardAvailable) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"available\":false,\"total\":0,\"used\":0,\"free\":0,\"percent\":0}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+static void sd_usage(uint64_t *total, uint64_t *used) {
+  static uint64_t cachedTotal = 0, cachedUsed = 0;
+  static int64_t cachedAt = 0;
+  // Held across a refresh too: callers arriving meanwhile wait for
+  // its result instead of counting free clusters again
+  xSemaphoreTake(sdUsageLock, portMAX_DELAY);
+  int64_t now = esp_timer_get_time();
+  if (!cachedAt || now - cachedAt > SD_USAGE_CACHE_MS * 1000LL) {
+    cachedTotal = SD_MMC.totalBytes();
+    cachedUsed = SD_MMC.usedBytes();
+    cachedAt = now;
+    sd_check_low(cachedTotal, cachedUsed);
   }
+  *total = cachedTotal;
+  *used = cachedUsed;
+  xSemaphoreGive(sdUsageLock);
+}
 
-  uint64_t totalBytes = SD_MMC.totalBytes();
-  uint64_t usedBytes = SD_MMC.usedBytes();
-  uint64_t freeBytes = totalBytes - usedBytes;
+// ==================================================================
+//  HANDLER: Get SD Card Information
+// ==================================================================
+static int render_sd_state(char *buf, size_t len) {
+  uint64_t totalBytes = 0, usedBytes = 0;
+  if (sdCardAvailable) sd_usage(&totalBytes, &usedBytes);
   float percentUsed = totalBytes > 0 ? (usedBytes * 100.0 / totalBytes) : 0;
 
-  snprintf(json_response, sizeof(json_response),
-           "{\"available\":true,\"total\":%llu,\"used\":%llu,\"free\":%llu,\"percent\":%.1f}",
-           totalBytes, usedBytes, freeBytes, percentUsed);
+  json_writer_t w;
+  jw_init(&w, buf, len, NULL);
+  jw_obj_open(&w);
+  jw_bool(&w, "available", sdCardAvailable);
+  jw_uint(&w, "total", totalBytes);
+  jw_uint(&w, "used", usedBytes);
+  jw_uint(&w, "free", totalBytes - usedBytes);
+  jw_float(&w, "percent", percentUsed);
+  jw_obj_close(&w);
+  return jw_result(&w);
+}
 
-  return httpd_resp_send(req, json_response, strlen(json_response));
+static esp_err_t sd_info_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return device_state_send_section(req, STATE_SD);
 }
 
 // ==================================================================
 //  HANDLER: Start Video Recording
 // ==================================================================
 static esp_err_t start_recording_handler(httpd_req_t *req) {
-  char json_response[256];
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
-  // Check if SD card is available
-  if (!sdCardAvailable) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"SD card not available\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
-  }
-
-  // Check if already recording
-  if (isRecording) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Already recording\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
-  }
-
-  // Create filename: /video_XXXXX.mjpeg
-  recordingCounter++;
-  snprintf(currentRecordingFilename, sizeof(currentRecordingFilename), 
-           "/video_%05lu.mjpeg", (unsigned long)recordingCounter);
-
-  // Open file for writing
-  recordingFile = SD_MMC.open(currentRecordingFilename, FILE_WRITE);
-  if (!recordingFile) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Failed to create recording file\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
-  }
-
-  // Write MJPEG header
-  recordingFile.println("--" PART_BOUNDARY);
-
-  // Set recording state
-  isRecording = true;
-  recordingStartTime = millis();
-  recordingFrameCount = 0;
-
-  log_i("Recording started: %s", currentRecordingFilename);
-  snprintf(json_response, sizeof(json_response),
-           "{\"success\":true,\"filename\":\"%s\"}",
-           currentRecordingFilename);
-
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  const char *error = recording_begin();
+  if (error) return send_json_error(req, error);
+
+  char buf[128];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_str(&w, "filename", currentRecordingFilename);
+  jw_obj_close(&w);
+  return jw_finish(&w);
 }
 
 // ==================================================================
 //  HANDLER: Stop Video Recording
 // ==================================================================
 static esp_err_t stop_recording_handler(httpd_req_t *req) {
-  char json_response[512];
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
-  if (!isRecording) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Not recording\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+  unsigned long fileSize = 0, frames = 0, duration = 0;
+  if (!recording_end(&fileSize, &frames, &duration)) {
+    return send_json_error(req, "Not recording");
   }
 
-  // Close the file
-  recordingFile.close();
-
-  // Calculate duration
-  unsigned long duration = (millis() - recordingStartTime) / 1000;
-  unsigned long fileSize = 0;
+  char buf[192];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_str(&w, "filename", currentRecordingFilename);
+  jw_uint(&w, "size", fileSize);
+  jw_uint(&w, "frames", frames);
+  jw_uint(&w, "duration", duration);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
 
-  // Get file size
-  File checkFile = SD_MMC.open(currentRecordingFilename, FILE_READ);
-  if (checkFile) {
-    fileSize = checkFile.size();
-    checkFile.close();
+// ==================================================================
+//  HANDLER: Recording rate control
+//    /recording-rate                      -> config, card cap, live rate
+//    /recording-rate?enabled=1&target=N   -> bytes/s (kept in NVS)
+//    /recording-rate?hours=N              -> target that fills the card in N h
+// ==================================================================
+static esp_err_t recording_rate_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+  uint64_t totalBytes = 0, usedBytes = 0;
+  if (sdCardAvailable) sd_usage(&totalBytes, &usedBytes);
+
+  rec_rate_config_t cfg;
+  rec_rate_get_config(&cfg);
+  bool changed = false;
+  char query[96] = {0};
+  char value[12];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "enabled", value, sizeof(value)) == ESP_OK) {
+      cfg.enabled = atoi(value) != 0;
+      changed = true;
+    }
+    if (httpd_query_key_value(query, "target", value, sizeof(value)) == ESP_OK) {
+      cfg.target = strtoul(value, NULL, 10);
+      changed = true;
+    }
+    if (httpd_query_key_value(query, "hours", value, sizeof(value)) == ESP_OK) {
+      float hours = atof(value);
+      if (!totalBytes || hours <= 0) return send_json_error(req, "hours needs an SD card and a positive value");
+      cfg.target = (uint32_t)(totalBytes / (hours * 3600));
+      changed = true;
+    }
+    if (httpd_query_key_value(query, "q_best", value, sizeof(value)) == ESP_OK) {
+      cfg.qualityBest = atoi(value);
+      changed = true;
+    }
+    if (httpd_query_key_value(query, "q_worst", value, sizeof(value)) == ESP_OK) {
+      cfg.qualityWorst = atoi(value);
+      changed = true;
+    }
+    if (changed && !rec_rate_set_config(&cfg)) {
+      char error[80];
+      snprintf(error, sizeof(error), "target %d-%d B/s, q_best<=q_worst in 4-63", REC_RATE_MIN_TARGET,
+               REC_RATE_MAX_TARGET);
+      httpd_resp_set_status(req, "400 Bad Request");
+      return send_json_error(req, error);
+    }
   }
 
-  isRecording = false;
-
-  log_i("Recording stopped: %s (%lu bytes, %lu frames, %lu seconds)",
-        currentRecordingFilename, fileSize, recordingFrameCount, duration);
-
-  snprintf(json_response, sizeof(json_response),
-           "{\"success\":true,\"filename\":\"%s\",\"size\":%lu,\"frames\":%lu,\"duration\":%lu}",
-           currentRecordingFilename, fileSize, recordingFrameCount, duration);
-
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  char buf[512];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  rec_rate_report(&w, totalBytes, totalBytes - usedBytes);
+  jw_obj_close(&w);
+  return jw_finish(&w);
 }
 
 // ==================================================================
 //  HANDLER: Get Recording Status
 // ==================================================================
-static esp_err_t recording_status_handler(httpd_req_t *req) {
-  char json_response[256];
-  httpd_resp_set_type(req, "application/json");
-  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-
+static int render_recording_state(char *buf, size_t len) {
+  json_writer_t w;
+  jw_init(&w, buf, len, NULL);
+  jw_obj_open(&w);
+  jw_bool(&w, "recording", isRecording);
   if (isRecording) {
-    unsigned long duration = (millis() - recordingStartTime) / 1000;
-    snprintf(json_response, sizeof(json_response),
-             "{\"recording\":true,\"filename\":\"%s\",\"frames\":%lu,\"duration\":%lu}",
-             currentRecordingFilename, recordingFrameCount, duration);
-  } else {
-    snprintf(json_response, sizeof(json_response), "{\"recording\":false}");
+    jw_str(&w, "filename", currentRecordingFilename);
+    jw_uint(&w, "frames", recordingFrameCount);
+    jw_uint(&w, "duration", (millis() - recordingStartTime) / 1000);
+    jw_uint(&w, "rate", rec_rate_current());
   }
+  jw_obj_close(&w);
+  return jw_result(&w);
+}
 
-  return httpd_resp_send(req, json_response, strlen(json_response));
+static esp_err_t recording_status_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return device_state_send_section(req, STATE_RECORDING);
 }
 
 // ==================================================================
 //  HANDLER: List all files on SD card
 // ==================================================================
+// One entry per file, streamed straight into the response
+static bool list_visit(const char *name, const char *path, size_t size, time_t mtime, void *arg) {
+  json_writer_t *w = (json_writer_t *)arg;
+  size_t len = strlen(name);
+  bool photo = len > 4 && strcasecmp(name + len - 4, ".jpg") == 0;
+
+  jw_obj_open(w);
+  jw_str(w, "name", name);
+  jw_uint(w, "size", size);
+  jw_str(w, "type", photo ? "photo" : "video");
+  jw_obj_close(w);
+  return !w->error;  // stop walking once the client is gone
+}
+
 static esp_err_t list_files_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
-  if (!sdCardAvailable) {
-    return httpd_resp_send(req, "{\"success\":false,\"error\":\"SD card not available\"}", HTTPD_RESP_USE_STRLEN);
-  }
+  if (!sdCardAvailable) return send_json_error(req, "SD card not available");
 
-  // Start JSON array
-  String json = "{\"success\":true,\"files\":[";
-  
-  File root = SD_MMC.open("/");
-  if (!root) {
-    return httpd_resp_send(req, "{\"success\":false,\"error\":\"Failed to open root directory\"}", HTTPD_RESP_USE_STRLEN);
-  }
+  char buf[1024];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_arr_open(&w, "files");
 
-  bool firstFile = true;
-  File file = root.openNextFile();
-  
-  while (file) {
-    if (!file.isDirectory()) {
-      String filename = String(file.name());
-      
-      // Strip leading slash if present (SD_MMC returns full path like /filename.jpg)
-      if (filename.startsWith("/")) {
-        filename = filename.substring(1);
-      }
-      
-      // Only include photos (.jpg) and videos (.mjpeg)
-      if (filename.endsWith(".jpg") || filename.endsWith(".mjpeg") || 
-          filename.endsWith(".JPG") || filename.endsWith(".MJPEG")) {
-        
-        if (!firstFile) json += ",";
-        firstFile = false;
-        
-        json += "{";
-        json += "\"name\":\"" + filename + "\",";
-        json += "\"size\":" + String(file.size()) + ",";
-        
-        // Determine type
-        if (filename.endsWith(".jpg") || filename.endsWith(".JPG")) {
-          json += "\"type\":\"photo\"";
-        } else {
-          json += "\"type\":\"video\"";
-        }
-        
-        json += "}";
-      }
+  // Legacy root files and every sharded bucket, with bare names
+  media_for_each(list_visit, &w);
+
+  jw_arr_close(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
+
+// ==================================================================
+//  Helper: URL-decode a file name into an absolute SD path
+//  (bare media names are resolved to their bucket directory)
+// ==================================================================
+static void url_decode_path(const char *src, char *dst, size_t dstLen) {
+  char name[128];
+  size_t j = 0;
+  dst[j++] = '/';
+  for (int i = 0; src[i] && j < dstLen - 1; i++) {
+    if (src[i] == '%' && src[i+1] && src[i+2]) {
+      char hex[3] = {src[i+1], src[i+2], 0};
+      dst[j++] = (char)strtol(hex, NULL, 16);
+      i += 2;
+    } else if (src[i] == '+') {
+      dst[j++] = ' ';  // Handle + as space
+    } else {
+      dst[j++] = src[i];
     }
-    file = root.openNextFile();
   }
-  
-  json += "]}";
-  root.close();
-  
-  return httpd_resp_send(req, json.c_str(), json.length());
+  dst[j] = '\0';
+  // Name already carried its own leading slash
+  if (dst[1] == '/') memmove(dst, dst + 1, j);
+
+  strlcpy(name, dst, sizeof(name));
+  media_resolve(name, dst, dstLen);
 }
 
 // ==================================================================
@@ -506,35 +778,15 @@ static esp_err_t download_file_handler(httpd_req_t *req) {
     return ESP_FAIL;
   }
 
-  // URL decode filename (handles %20, %2F, etc.)
-  char decodedFilename[128] = {0};
-  int j = 0;
-  for (int i = 0; filename[i] && j < 126; i++) {
-    if (filename[i] == '%' && filename[i+1] && filename[i+2]) {
-      char hex[3] = {filename[i+1], filename[i+2], 0};
-      decodedFilename[j++] = (char)strtol(hex, NULL, 16);
-      i += 2;
-    } else if (filename[i] == '+') {
-      decodedFilename[j++] = ' ';  // Handle + as space
-    } else {
-      decodedFilename[j++] = filename[i];
-    }
-  }
-  decodedFilename[j] = '\0';
-  
-  log_i("Requesting file: %s (decoded: %s)", filename, decodedFilename);
-  
-  // Build filepath - ensure leading slash
-  String filepath = String(decodedFilename);
-  if (!filepath.startsWith("/")) {
-    filepath = "/" + filepath;
-  }
-  
-  log_i("Opening file: %s", filepath.c_str());
-  File file = SD_MMC.open(filepath.c_str(), FILE_READ);
+  // URL decode filename (handles %20, %2F, etc.) and ensure leading slash
+  char filepath[130];
+  url_decode_path(filename, filepath, sizeof(filepath));
+
+  log_i("Opening file: %s", filepath);
+  File file = SD_MMC.open(filepath, FILE_READ);
   
   if (!file) {
-    log_e("Failed to open file: %s", filepath.c_str());
+    log_e("Failed to open file: %s", filepath);
     httpd_resp_send_404(req);
     return ESP_FAIL;
   }
@@ -542,12 +794,10 @@ static esp_err_t download_file_handler(httpd_req_t *req) {
   size_t fileSize = file.size();
   log_i("File size: %d bytes", fileSize);
 
-  // Set content type based on file extension
-  if (filepath.endsWith(".jpg") || filepath.endsWith(".JPG") || 
-      filepath.endsWith(".jpeg") || filepath.endsWith(".JPEG")) {
+  // Set content type based on file extension (.mjpeg is forced to download)
+  const char *ext = strrchr(filepath, '.');
+  if (ext && (!strcasecmp(ext, ".jpg") || !strcasecmp(ext, ".jpeg"))) {
     httpd_resp_set_type(req, "image/jpeg");
-  } else if (filepath.endsWith(".mjpeg") || filepath.endsWith(".MJPEG")) {
-    httpd_resp_set_type(req, "application/octet-stream");  // Force download for mjpeg
   } else {
     httpd_resp_set_type(req, "application/octet-stream");
   }
@@ -556,10 +806,10 @@ static esp_err_t download_file_handler(httpd_req_t *req) {
   httpd_resp_set_hdr(req, "Access-Control-Allow-Methods", "GET");
   httpd_resp_set_hdr(req, "Cache-Control", "no-cache, no-store");
   
+  // Header values must live until the response is sent: request arena
   // Set Content-Length so browsers can show download progress
-  static char contentLenBuf[16];
-  snprintf(contentLenBuf, sizeof(contentLenBuf), "%u", fileSize);
-  httpd_resp_set_hdr(req, "Content-Length", contentLenBuf);
+  char *contentLen = req_arena_printf("%u", fileSize);
+  if (contentLen) httpd_resp_set_hdr(req, "Content-Length", contentLen);
   
   // Check if download mode is requested via ?dl=1
   char dlParam[4] = {0};
@@ -568,156 +818,845 @@ static esp_err_t download_file_handler(httpd_req_t *req) {
     forceDownload = (strcmp(dlParam, "1") == 0);
   }
   
-  // Extract display filename (without leading slash)
-  String dispName = filepath;
-  if (dispName.startsWith("/")) dispName = dispName.substring(1);
-  // Use static buffer so pointer stays valid through response
-  static char contentDispBuf[192];
-  if (forceDownload) {
-    snprintf(contentDispBuf, sizeof(contentDispBuf), "attachment; filename=\"%s\"", dispName.c_str());
-  } else {
-    snprintf(contentDispBuf, sizeof(contentDispBuf), "inline; filename=\"%s\"", dispName.c_str());
-  }
-  httpd_resp_set_hdr(req, "Content-Disposition", contentDispBuf);
+  // Display filename: the bare name, without bucket directories
+  const char *dispName = strrchr(filepath, '/');
+  dispName = dispName ? dispName + 1 : filepath;
+  char *contentDisp = req_arena_printf("%s; filename=\"%s\"", forceDownload ? "attachment" : "inline", dispName);
+  if (contentDisp) httpd_resp_set_hdr(req, "Content-Disposition", contentDisp);
 
   // Increase socket send timeout for large files (videos)
   int send_timeout = 30;  // 30 seconds
   if (fileSize > 100000) send_timeout = 120;  // 2 minutes for >100KB
   setsockopt(httpd_req_to_sockfd(req), SOL_SOCKET, SO_SNDTIMEO, &send_timeout, sizeof(send_timeout));
 
-  // Stream file in chunks (8KB for faster transfer)
-  const size_t chunkSize = 8192;
-  uint8_t *buffer = (uint8_t *)malloc(chunkSize);
-  
-  if (!buffer) {
-    log_e("Failed to allocate buffer");
+  // Stream file through the read-ahead pipeline (SD reads overlap WiFi sends)
+  size_t totalSent = 0;
+  int64_t startUs = esp_timer_get_time();
+  esp_err_t res = sd_stream_send(req, file, fileSize, &totalSent);
+  if (res == ESP_ERR_NO_MEM && totalSent == 0) {
+    log_e("Failed to allocate stream buffers");
     file.close();
     httpd_resp_send_500(req);
     return ESP_FAIL;
   }
 
-  esp_err_t res = ESP_OK;
-  size_t bytesRead;
-  size_t totalSent = 0;
-  
-  while ((bytesRead = file.read(buffer, chunkSize)) > 0) {
-    if (httpd_resp_send_chunk(req, (const char *)buffer, bytesRead) != ESP_OK) {
-      log_e("Failed to send chunk at %u/%u bytes", totalSent, fileSize);
-      res = ESP_FAIL;
-      break;
-    }
-    totalSent += bytesRead;
-    // Yield to prevent watchdog timeout on large files
-    vTaskDelay(1);
-  }
-  
   // End chunked response
   httpd_resp_send_chunk(req, NULL, 0);
-  
-  log_i("Sent %d bytes of %d", totalSent, fileSize);
-  
-  free(buffer);
+
+  uint32_t elapsedMs = (uint32_t)((esp_timer_get_time() - startUs) / 1000);
+  log_i("Sent %u bytes of %u in %ums (%.1f KB/s)", totalSent, fileSize, elapsedMs,
+        elapsedMs ? totalSent / (float)elapsedMs : 0);
+
   file.close();
-  
+
   return res;
 }
 
 // ==================================================================
-//  HANDLER: Delete a file from SD card
+//  HANDLER: Gallery thumbnail (1/8 scale, cached on SD)
 // ==================================================================
-static esp_err_t delete_file_handler(httpd_req_t *req) {
-  char json_response[256];
-  httpd_resp_set_type(req, "application/json");
-  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-
+static esp_err_t thumb_handler(httpd_req_t *req) {
   if (!sdCardAvailable) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"SD card not available\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+    httpd_resp_send_404(req);
+    return ESP_FAIL;
   }
 
-  // Parse query string to get filename
-  char query[128];
-  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Missing filename parameter\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
+  char query[256] = {0};
+  char filename[128] = {0};
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+      httpd_query_key_value(query, "name", filename, sizeof(filename)) != ESP_OK) {
+    httpd_resp_send_404(req);
+    return ESP_FAIL;
   }
 
-  char filename[64] = {0};
-  if (httpd_query_key_value(query, "name", filename, sizeof(filename)) != ESP_OK) {
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Invalid filename parameter\"}");
-    return httpd_resp_send(req, json_response, strlen(json_response));
-  }
-
-  // URL decode filename
-  char decodedFilename[64] = {0};
-  int j = 0;
-  for (int i = 0; filename[i] && j < 63; i++) {
-    if (filename[i] == '%' && filename[i+1] && filename[i+2]) {
-      char hex[3] = {filename[i+1], filename[i+2], 0};
-      decodedFilename[j++] = (char)strtol(hex, NULL, 16);
-      i += 2;
-    } else {
-      decodedFilename[j++] = filename[i];
-    }
-  }
-  
-  // Build filepath - add leading slash if not present  
-  String filepath = String(decodedFilename);
-  if (!filepath.startsWith("/")) {
-    filepath = "/" + filepath;
-  }
-  if (SD_MMC.remove(filepath.c_str())) {
-    log_i("Deleted file: %s", filepath.c_str());
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":true,\"filename\":\"%s\"}", filename);
-  } else {
-    log_e("Failed to delete file: %s", filepath.c_str());
-    snprintf(json_response, sizeof(json_response),
-             "{\"success\":false,\"error\":\"Failed to delete file\"}");
+  char filepath[130];
+  url_decode_path(filename, filepath, sizeof(filepath));
+
+  uint8_t *jpg = NULL;
+  size_t jpgLen = 0;
+  if (!thumb_load(filepath, &jpg, &jpgLen)) {
+    httpd_resp_send_404(req);
+    return ESP_FAIL;
   }
 
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  // The gallery versions thumbnail URLs with the file size, so a
+  // rewritten file gets a new URL and the old entry can live forever
+  httpd_resp_set_type(req, "image/jpeg");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=31536000, immutable");
+  esp_err_t res = httpd_resp_send(req, (const char *)jpg, jpgLen);
+  mem_free(MEM_THUMBS, jpg);
+  return res;
 }
 
 // ==================================================================
-//  HANDLER: MJPEG Live Stream
+//  HANDLER: Download throughput benchmark (old loop vs pipeline)
 // ==================================================================
-static esp_err_t stream_handler(httpd_req_t *req) {
-  camera_fb_t *fb = NULL;
-  struct timeval _timestamp;
-  esp_err_t res = ESP_OK;
-  size_t _jpg_buf_len = 0;
-  uint8_t *_jpg_buf = NULL;
-  char *part_buf[128];
+typedef struct {
+  char path[130];
+  char jobHeader[12];       // X-Job-Id value, must outlive the response headers
+} download_bench_args_t;
 
-  static int64_t last_frame = 0;
-  if (!last_frame) last_frame = esp_timer_get_time();
+static void download_bench_release(void *arg) {
+  mem_free(MEM_BENCH, arg);
+}
 
-  res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
-  if (res != ESP_OK) return res;
+// Sends the recording to the requester twice (the client discards the
+// body), so both passes pay the real WiFi cost; timings go to /jobs/<id>
+static bool download_bench_job(job_t *job, void *arg, json_writer_t *out) {
+  download_bench_args_t *a = (download_bench_args_t *)arg;
+  httpd_req_t *req = job_request(job);
 
+  httpd_resp_set_type(req, "application/octet-stream");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  httpd_resp_set_hdr(req, "X-Framerate", "60");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache, no-store");
+  snprintf(a->jobHeader, sizeof(a->jobHeader), "%u", job_id(job));
+  httpd_resp_set_hdr(req, "X-Job-Id", a->jobHeader);
+
+  struct timeval sendTimeout = { 30, 0 };
+  setsockopt(httpd_req_to_sockfd(req), SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+
+  sd_stream_bench_t bench;
+  esp_err_t res = sd_stream_bench(req, a->path, &bench);
+  if (res == ESP_ERR_NOT_FOUND) httpd_resp_send_404(req);
+  else if (res == ESP_ERR_NO_MEM) httpd_resp_send_500(req);
+  if (res != ESP_OK) return false;
+
+  jw_obj_open(out);
+  jw_str(out, "file", a->path);
+  jw_uint(out, "chunk", bench.chunk);
+  jw_obj_open(out, "legacy");
+  jw_uint(out, "bytes", bench.legacy.bytes);
+  jw_uint(out, "ms", bench.legacy.elapsed_ms);
+  jw_float(out, "mbps", bench.legacy.mbps, 2);
+  jw_obj_close(out);
+  jw_obj_open(out, "pipeline");
+  jw_uint(out, "bytes", bench.pipeline.bytes);
+  jw_uint(out, "ms", bench.pipeline.elapsed_ms);
+  jw_float(out, "mbps", bench.pipeline.mbps, 2);
+  jw_obj_close(out);
+  jw_float(out, "speedup", bench.legacy.mbps > 0 ? bench.pipeline.mbps / bench.legacy.mbps : 0, 2);
+  jw_obj_close(out);
+  return true;
+}
 
-#if defined(LED_GPIO_NUM)
-  isStreaming = true;
-#endif
+static esp_err_t bench_download_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
-  while (true) {
-    fb = esp_camera_fb_get();
-    if (!fb) {
-      log_e("Camera capture failed");
-      res = ESP_FAIL;
-    } else {
-      _timestamp.tv_sec = fb->timestamp.tv_sec;
-      _timestamp.tv_usec = fb->timestamp.tv_usec;
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
 
-      if (fb->format != PIXFORMAT_JPEG) {
-        bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-        esp_camera_fb_return(fb);
+  char query[256] = {0};
+  char filename[128] = {0};
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+      httpd_query_key_value(query, "name", filename, sizeof(filename)) != ESP_OK) {
+    return send_json_error(req, "Missing name parameter");
+  }
+
+  download_bench_args_t *args = (download_bench_args_t *)mem_calloc(MEM_BENCH, 1, sizeof(download_bench_args_t));
+  if (!args) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+  url_decode_path(filename, args->path, sizeof(args->path));
+
+  // The file is sent from the job's task; this worker is free again
+  uint32_t jobId;
+  job_spec_t spec = { "bench-download", "bench-sd", download_bench_job, args,
+                      download_bench_release, 0, req, false };
+  jobs_err_t err = jobs_start(&spec, &jobId);
+  if (err != JOBS_OK) {
+    return send_json_error(req, jobs_err_str(err));
+  }
+  return ESP_OK;
+}
+
+// ==================================================================
+//  HANDLER: File-create latency benchmark (flat vs sharded layout)
+// ==================================================================
+#define FS_BENCH_MAX_POINTS 20
+
+typedef struct {
+  uint32_t count;
+  uint32_t window;
+  bool sharded;
+} fs_bench_args_t;
+
+static esp_err_t send_job_started(httpd_req_t *req, jobs_err_t err, uint32_t jobId);
+
+static void fs_bench_release(void *arg) {
+  mem_free(MEM_BENCH, arg);
+}
+
+static void fs_bench_progress(void *arg, uint32_t done, uint32_t total) {
+  job_progress((job_t *)arg, done, total);
+}
+
+// Thousands of creates take minutes on a slow card: a job, not the control task
+static bool fs_bench_job(job_t *job, void *arg, json_writer_t *out) {
+  fs_bench_args_t *a = (fs_bench_args_t *)arg;
+  media_bench_point_t points[FS_BENCH_MAX_POINTS];
+  size_t n = media_bench_create(a->count, a->sharded, a->window, points, FS_BENCH_MAX_POINTS,
+                                fs_bench_progress, job);
+  if (n == 0) return false;
+
+  jw_obj_open(out);
+  jw_str(out, "layout", a->sharded ? "sharded" : "flat");
+  jw_uint(out, "count", a->count);
+  jw_uint(out, "window", a->window);
+  jw_arr_open(out, "points");
+  for (size_t i = 0; i < n; i++) {
+    jw_obj_open(out);
+    jw_uint(out, "files", points[i].files);
+    jw_uint(out, "avg_us", points[i].avg_us);
+    jw_uint(out, "max_us", points[i].max_us);
+    jw_obj_close(out);
+  }
+  jw_arr_close(out);
+  jw_obj_close(out);
+  return true;
+}
+
+static esp_err_t bench_fs_create_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+
+  char query[128] = {0};
+  char value[16];
+  uint32_t count = 2000;
+  uint32_t window = 200;
+  bool sharded = false;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "count", value, sizeof(value)) == ESP_OK) count = atoi(value);
+    if (httpd_query_key_value(query, "window", value, sizeof(value)) == ESP_OK) window = atoi(value);
+    if (httpd_query_key_value(query, "layout", value, sizeof(value)) == ESP_OK) {
+      sharded = strcmp(value, "sharded") == 0;
+    }
+  }
+  if (count < 1 || count > 10000) count = 2000;
+  if (window < 1) window = 1;
+  if (count / window > FS_BENCH_MAX_POINTS) window = (count + FS_BENCH_MAX_POINTS - 1) / FS_BENCH_MAX_POINTS;
+
+  fs_bench_args_t *args = (fs_bench_args_t *)mem_alloc(MEM_BENCH, sizeof(fs_bench_args_t));
+  if (!args) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+  args->count = count;
+  args->window = window;
+  args->sharded = sharded;
+
+  uint32_t jobId = 0;
+  job_spec_t spec = { "bench-fs", "bench-fs", fs_bench_job, args, fs_bench_release, 0, NULL, false };
+  return send_job_started(req, jobs_start(&spec, &jobId), jobId);
+}
+
+// ==================================================================
+//  HANDLER: Allocator benchmark, heap vs pools (?ops=N)
+// ==================================================================
+static void write_alloc_pass(json_writer_t *w, const char *key, const mem_pool_bench_pass_t *p) {
+  jw_obj_open(w, key);
+  jw_uint(w, "alloc_avg_ns", p->allocAvgNs);
+  jw_uint(w, "alloc_max_ns", p->allocMaxNs);
+  jw_uint(w, "free_avg_ns", p->freeAvgNs);
+  jw_uint(w, "free_max_ns", p->freeMaxNs);
+  jw_uint(w, "failures", p->failures);
+  jw_uint(w, "largest_before", p->largestBefore);
+  jw_uint(w, "largest_loaded", p->largestLoaded);
+  jw_uint(w, "free_loaded", p->freeLoaded);
+  jw_float(w, "frag_loaded", p->freeLoaded ? 1.0f - (float)p->largestLoaded / p->freeLoaded : 0, 3);
+  jw_obj_close(w);
+}
+
+static esp_err_t bench_alloc_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  char query[32] = {0};
+  char value[12];
+  uint32_t ops = MEM_POOL_BENCH_OPS;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+      httpd_query_key_value(query, "ops", value, sizeof(value)) == ESP_OK) {
+    ops = strtoul(value, NULL, 10);
+  }
+
+  mem_pool_bench_t report;
+  if (!mem_pool_bench(ops, &report)) {
+    return send_json_error(req, "Benchmark failed");
+  }
+
+  char buf[512];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_uint(&w, "ops", report.ops);
+  write_alloc_pass(&w, "heap", &report.heap);
+  write_alloc_pass(&w, "pool", &report.pool);
+  jw_float(&w, "pool_hit_rate", (float)report.pool.hits / report.ops, 3);
+  mem_pool_report(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
+
+// ==================================================================
+//  HANDLER: SD card benchmark (?size=MB&fps=N&apply=1)
+// ==================================================================
+static void write_bench_pass(json_writer_t *w, const char *key, const sd_bench_pass_t *p) {
+  jw_obj_open(w, key);
+  jw_uint(w, "chunk", p->chunk);
+  jw_uint(w, "align", p->align);
+  jw_uint(w, "ops", p->ops);
+  jw_float(w, "mbps", p->mbps, 2);
+  jw_uint(w, "p50_us", p->p50_us);
+  jw_uint(w, "p99_us", p->p99_us);
+  jw_uint(w, "max_us", p->max_us);
+  jw_obj_close(w);
+}
+
+typedef struct {
+  uint32_t fileBytes;
+  uint32_t fps;
+  size_t frameBytes;      // at the current framesize/quality, for the recording estimate
+  bool apply;
+} sd_bench_args_t;
+
+static void sd_bench_release(void *arg) {
+  mem_free(MEM_BENCH, arg);
+}
+
+static void sd_bench_progress(void *arg, uint32_t done, uint32_t total) {
+  job_progress((job_t *)arg, done, total);
+}
+
+// Up to 16 MB written and read 8 times over: a job, not the control task.
+// At most ~2.1 KB of result (17 passes at their widest), under JOBS_RESULT_LEN.
+static bool sd_bench_job(job_t *job, void *arg, json_writer_t *out) {
+  sd_bench_args_t *a = (sd_bench_args_t *)arg;
+  sd_bench_report_t *report = (sd_bench_report_t *)mem_alloc(MEM_BENCH, sizeof(sd_bench_report_t));
+  if (!report || !sd_bench_run(a->fileBytes, report, sd_bench_progress, job)) {
+    mem_free(MEM_BENCH, report);
+    return false;
+  }
+
+  jw_obj_open(out);
+  jw_uint(out, "file_bytes", report->fileBytes);
+  jw_uint(out, "elapsed_ms", report->elapsedMs);
+  jw_arr_open(out, "seq_write");
+  for (uint8_t i = 0; i < report->passes; i++) write_bench_pass(out, NULL, &report->write[i]);
+  jw_arr_close(out);
+  jw_arr_open(out, "seq_read");
+  for (uint8_t i = 0; i < report->passes; i++) write_bench_pass(out, NULL, &report->read[i]);
+  jw_arr_close(out);
+  write_bench_pass(out, "random_write", &report->random);
+
+  // Recording writes each frame after text part headers, so it sees the
+  // unaligned write path; one stall longer than a frame interval drops frames
+  const sd_bench_pass_t *rec = sd_bench_best(report->write, report->passes, 1);
+  if (rec) rec_rate_set_card_rate((uint32_t)(rec->mbps * 1000000));  // caps the recording rate
+  if (rec && a->frameBytes) {
+    float frameMb = (a->frameBytes + 128) / 1000000.0f;   // JPEG + MJPEG part header
+    float needMbps = frameMb * a->fps;
+    float maxFps = rec->mbps * 0.75f / frameMb;          // keep 25% headroom
+    jw_obj_open(out, "recording");
+    jw_uint(out, "frame_bytes", a->frameBytes);
+    jw_uint(out, "fps", a->fps);
+    jw_float(out, "required_mbps", needMbps, 2);
+    jw_float(out, "write_mbps", rec->mbps, 2);
+    jw_float(out, "worst_stall_ms", rec->max_us / 1000.0f);
+    jw_float(out, "max_fps", maxFps);
+    jw_bool(out, "sustainable", needMbps <= rec->mbps * 0.75f && rec->max_us < 1000000 / a->fps);
+    jw_obj_close(out);
+  }
+
+  // Optionally size the download pipeline for this card
+  if (a->apply && report->bestReadChunk) sd_stream_set_chunk_size(report->bestReadChunk);
+  jw_uint(out, "best_read_chunk", report->bestReadChunk);
+  jw_uint(out, "stream_chunk", sd_stream_chunk_size());
+  jw_bool(out, "applied", a->apply && report->bestReadChunk);
+  jw_obj_close(out);
+  mem_free(MEM_BENCH, report);
+  return true;
+}
+
+static esp_err_t bench_sd_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+  if (isRecording) {
+    return send_json_error(req, "Stop recording first");
+  }
+
+  char query[64] = {0};
+  char value[12];
+  int sizeMb = SD_BENCH_DEFAULT_BYTES / (1024 * 1024);
+  int fps = 15;
+  bool apply = false;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "size", value, sizeof(value)) == ESP_OK) sizeMb = atoi(value);
+    if (httpd_query_key_value(query, "fps", value, sizeof(value)) == ESP_OK) fps = atoi(value);
+    if (httpd_query_key_value(query, "apply", value, sizeof(value)) == ESP_OK) apply = atoi(value) == 1;
+  }
+  if (sizeMb < 1 || sizeMb > SD_BENCH_MAX_BYTES / (1024 * 1024)) {
+    char error[32];
+    snprintf(error, sizeof(error), "size must be 1-%d MB", SD_BENCH_MAX_BYTES / (1024 * 1024));
+    httpd_resp_set_status(req, "400 Bad Request");
+    return send_json_error(req, error);
+  }
+  if (fps < 1 || fps > 60) fps = 15;
+
+  sd_bench_args_t *args = (sd_bench_args_t *)mem_alloc(MEM_BENCH, sizeof(sd_bench_args_t));
+  if (!args) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+  args->fileBytes = (uint32_t)sizeMb * 1024 * 1024;
+  args->fps = fps;
+  args->apply = apply;
+  args->frameBytes = 0;
+  camera_fb_t *fb = esp_camera_fb_get();
+  if (fb) {
+    args->frameBytes = fb->len;
+    esp_camera_fb_return(fb);
+  }
+
+  uint32_t jobId = 0;
+  job_spec_t spec = { "bench-sd", "bench-sd", sd_bench_job, args, sd_bench_release, 0, NULL, false };
+  return send_job_started(req, jobs_start(&spec, &jobId), jobId);
+}
+
+// ==================================================================
+//  HANDLER: Delete a file from SD card
+// ==================================================================
+static esp_err_t delete_file_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+
+  // Parse query string to get filename
+  char query[128];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) {
+    return send_json_error(req, "Missing filename parameter");
+  }
+
+  char filename[64] = {0};
+  if (httpd_query_key_value(query, "name", filename, sizeof(filename)) != ESP_OK) {
+    return send_json_error(req, "Invalid filename parameter");
+  }
+
+  // URL decode filename and find it in its bucket (or the legacy root)
+  char filepath[MEDIA_PATH_MAX];
+  url_decode_path(filename, filepath, sizeof(filepath));
+  if (!SD_MMC.remove(filepath)) {
+    log_e("Failed to delete file: %s", filepath);
+    return send_json_error(req, "Failed to delete file");
+  }
+  thumb_invalidate(filepath);
+  device_state_invalidate(STATE_SD);
+  log_i("Deleted file: %s", filepath);
+
+  char buf[128];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_str(&w, "filename", filename);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
+
+// ==================================================================
+//  HANDLER: Bulk delete (POST starts a background job)
+// ==================================================================
+#define BULK_DELETE_MAX_BODY 16384
+
+// Read a form-encoded POST body, or fall back to the query string
+static char *read_form(httpd_req_t *req) {
+  size_t len = req->content_len;
+  char *buf = NULL;
+  if (len > 0) {
+    if (len > BULK_DELETE_MAX_BODY) return NULL;
+    buf = (char *)pool_alloc(MEM_HTTP, len + 1);
+    if (!buf) return NULL;
+    size_t got = 0;
+    while (got < len) {
+      int r = httpd_req_recv(req, buf + got, len - got);
+      if (r == HTTPD_SOCK_ERR_TIMEOUT) continue;
+      if (r <= 0) {
+        pool_free(MEM_HTTP, buf);
+        return NULL;
+      }
+      got += r;
+    }
+    buf[len] = '\0';
+    return buf;
+  }
+  len = httpd_req_get_url_query_len(req);
+  if (len == 0) return NULL;
+  buf = (char *)pool_alloc(MEM_HTTP, len + 1);
+  if (buf && httpd_req_get_url_query_str(req, buf, len + 1) != ESP_OK) {
+    pool_free(MEM_HTTP, buf);
+    buf = NULL;
+  }
+  return buf;
+}
+
+// Read a form field and URL-decode it in place
+static bool form_value(const char *form, const char *key, char *out, size_t outLen) {
+  if (httpd_query_key_value(form, key, out, outLen) != ESP_OK) return false;
+  char *w = out;
+  for (char *r = out; *r; r++) {
+    if (*r == '%' && r[1] && r[2]) {
+      char hex[3] = {r[1], r[2], 0};
+      *w++ = (char)strtol(hex, NULL, 16);
+      r += 2;
+    } else {
+      *w++ = (*r == '+') ? ' ' : *r;
+    }
+  }
+  *w = '\0';
+  return true;
+}
+
+static esp_err_t delete_files_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+
+  char *form = read_form(req);
+  if (!form) {
+    return send_json_error(req, "Missing names or filter");
+  }
+
+  bulk_request_t breq;
+  memset(&breq, 0, sizeof(breq));
+  char value[32];
+
+  // Explicit list: names=a.jpg,b.jpg (value can be as long as the body)
+  size_t formLen = strlen(form);
+  char *names = (char *)mem_alloc(MEM_DELETE, formLen + 1);
+  if (names && form_value(form, "names", names, formLen + 1)) {
+    breq.names = names;
+  } else {
+    mem_free(MEM_DELETE, names);
+  }
+
+  // Filter: type=photo|video|all, older=<unix time>, from=, to=
+  bool hasFilter = false;
+  if (form_value(form, "type", value, sizeof(value))) {
+    hasFilter = true;
+    if (!strcmp(value, "photo")) breq.type = BULK_TYPE_PHOTO;
+    else if (!strcmp(value, "video")) breq.type = BULK_TYPE_VIDEO;
+  }
+  if (form_value(form, "older", value, sizeof(value))) {
+    hasFilter = true;
+    breq.olderThan = (time_t)strtoul(value, NULL, 10);
+  }
+  if (form_value(form, "from", breq.from, sizeof(breq.from))) hasFilter = true;
+  if (form_value(form, "to", breq.to, sizeof(breq.to))) hasFilter = true;
+  pool_free(MEM_HTTP, form);
+
+  if (!breq.names && !hasFilter) {
+    return send_json_error(req, "Missing names or filter");
+  }
+
+  // Never pull the file out from under an active recording
+  if (isRecording) strlcpy(breq.skip, currentRecordingFilename + 1, sizeof(breq.skip));
+
+  uint32_t jobId = 0;
+  if (!bulk_delete_start(&breq, &jobId)) {
+    mem_free(MEM_DELETE, breq.names);
+    return send_json_error(req, "Delete job already running");
+  }
+
+  char buf[64];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_uint(&w, "job", jobId);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
+
+// GET /delete-files?job=N -> progress and per-file results
+static esp_err_t delete_files_status_handler(httpd_req_t *req) {
+  char query[32] = {0};
+  char jobStr[12] = {0};
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+      httpd_query_key_value(query, "job", jobStr, sizeof(jobStr)) != ESP_OK) {
+    return send_json_error(req, "Missing job parameter");
+  }
+  return bulk_delete_send_status(req, strtoul(jobStr, NULL, 10));
+}
+
+// ==================================================================
+//  HANDLER: Burst capture (?count=N&interval=ms&framesize=F)
+// ==================================================================
+#define BURST_SYNC_MS 2000    // longer bursts run as a job that answers the request
+
+// Capture and write the reply; false (with an error reply) on failure
+static bool burst_capture(const burst_config_t *cfg, json_writer_t *w) {
+  // Result carries every file name; too big for a task stack
+  burst_result_t *result = (burst_result_t *)mem_alloc(MEM_BURST, sizeof(burst_result_t));
+  burst_err_t err = result ? burst_run(cfg, result) : BURST_ERR_NO_MEM;
+  if (err != BURST_OK) {
+    mem_free(MEM_BURST, result);
+    jw_obj_open(w);
+    jw_bool(w, "success", false);
+    jw_str(w, "error", burst_err_str(err));
+    jw_obj_close(w);
+    return false;
+  }
+
+  // Achieved timing comes from the driver's frame timestamps
+  float fps = result->avgIntervalUs ? 1000000.0f / result->avgIntervalUs : 0;
+  jw_obj_open(w);
+  jw_bool(w, "success", true);
+  jw_uint(w, "requested", cfg->count);
+  jw_uint(w, "captured", result->captured);
+  jw_uint(w, "dropped", result->dropped);
+  jw_bool(w, "arena_full", result->arenaFull);
+  jw_uint(w, "bytes", result->bytes);
+  jw_obj_open(w, "interval_ms");
+  jw_uint(w, "requested", cfg->intervalMs);
+  jw_float(w, "min", result->minIntervalUs / 1000.0f);
+  jw_float(w, "avg", result->avgIntervalUs / 1000.0f);
+  jw_float(w, "max", result->maxIntervalUs / 1000.0f);
+  jw_obj_close(w);
+  jw_float(w, "fps", fps);
+  jw_uint(w, "duration_ms", result->durationMs);
+  jw_arr_open(w, "files");
+  char path[SD_WRITER_NAME_LEN + 2];
+  for (uint16_t i = 0; i < result->captured; i++) {
+    snprintf(path, sizeof(path), "/%s", result->names[i]);
+    jw_str(w, NULL, path);
+  }
+  jw_arr_close(w);
+  jw_obj_close(w);
+  mem_free(MEM_BURST, result);
+  return true;
+}
+
+static void burst_release(void *arg) {
+  mem_free(MEM_BURST, arg);
+}
+
+static bool burst_job(job_t *job, void *arg, json_writer_t *out) {
+  return burst_capture((const burst_config_t *)arg, out);
+}
+
+static esp_err_t burst_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+
+  // Parsed wide, then range-checked: the config fields are 16-bit
+  int count = 5, intervalMs = 0, framesize = -1;
+  char query[96] = {0};
+  char value[12];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "count", value, sizeof(value)) == ESP_OK) count = atoi(value);
+    if (httpd_query_key_value(query, "interval", value, sizeof(value)) == ESP_OK) intervalMs = atoi(value);
+    if (httpd_query_key_value(query, "framesize", value, sizeof(value)) == ESP_OK) framesize = atoi(value);
+  }
+  if (count < 1 || count > BURST_MAX_FRAMES || intervalMs < 0 || intervalMs > BURST_MAX_INTERVAL_MS) {
+    char error[48];
+    snprintf(error, sizeof(error), "count must be 1-%d, interval 0-%d ms", BURST_MAX_FRAMES,
+             BURST_MAX_INTERVAL_MS);
+    return send_json_error(req, error);
+  }
+  burst_config_t cfg = { (uint16_t)count, (uint16_t)intervalMs, framesize };
+
+  if (count * intervalMs <= BURST_SYNC_MS) {
+    char buf[512];
+    json_writer_t w;
+    jw_init(&w, buf, sizeof(buf), req);
+    burst_capture(&cfg, &w);
+    return jw_finish(&w);
+  }
+
+  // Up to a minute at the longest interval: the control server stays free
+  burst_config_t *args = (burst_config_t *)mem_alloc(MEM_BURST, sizeof(burst_config_t));
+  if (!args) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+  *args = cfg;
+  uint32_t jobId = 0;
+  job_spec_t spec = { "burst", "burst", burst_job, args, burst_release, 0, req, true };
+  jobs_err_t err = jobs_start(&spec, &jobId);
+  if (err == JOBS_OK) return ESP_OK;  // the job sends the burst report
+  return send_json_error(req, jobs_err_str(err));
+}
+
+// ==================================================================
+//  HANDLER: Write-behind queue status
+// ==================================================================
+static esp_err_t save_status_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return sd_writer_send_status(req);
+}
+
+// ==================================================================
+//  HANDLER: Export media as one TAR (GET query or POST form)
+// ==================================================================
+typedef struct {
+  char *names;
+  char from[EXPORT_NAME_LEN];
+  char to[EXPORT_NAME_LEN];
+  char skip[EXPORT_NAME_LEN];
+  char jobHeader[12];       // X-Job-Id value, must outlive the response headers
+} export_args_t;
+
+static void export_release(void *arg) {
+  export_args_t *a = (export_args_t *)arg;
+  mem_free(MEM_EXPORT, a->names);
+  mem_free(MEM_EXPORT, a);
+}
+
+static void export_progress(void *arg, uint32_t done, uint32_t total) {
+  job_progress((job_t *)arg, done, total);
+}
+
+// Runs on the job's task with the detached request
+static bool export_job(job_t *job, void *arg, json_writer_t *out) {
+  export_args_t *a = (export_args_t *)arg;
+  httpd_req_t *req = job_request(job);
+
+  httpd_resp_set_type(req, "application/x-tar");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache, no-store");
+  httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=\"trinetra_export.tar\"");
+  snprintf(a->jobHeader, sizeof(a->jobHeader), "%u", job_id(job));
+  httpd_resp_set_hdr(req, "X-Job-Id", a->jobHeader);
+
+  // Exports can run for minutes (lwIP takes a timeval, not seconds)
+  struct timeval sendTimeout = { 120, 0 };
+  setsockopt(httpd_req_to_sockfd(req), SOL_SOCKET, SO_SNDTIMEO, &sendTimeout, sizeof(sendTimeout));
+
+  export_request_t sel = { a->names, a->from, a->to, a->skip[0] ? a->skip : NULL,
+                           export_progress, job };
+  export_result_t result;
+  esp_err_t res = media_export_send(req, &sel, &result);
+  if (res == ESP_ERR_NO_MEM && result.bytes == 0) httpd_resp_send_500(req);
+
+  jw_obj_open(out);
+  jw_uint(out, "files", result.files);
+  jw_uint(out, "skipped", result.skipped);
+  jw_uint(out, "bytes", result.bytes);
+  jw_obj_close(out);
+  return res == ESP_OK;
+}
+
+static esp_err_t export_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+
+  export_args_t *args = (export_args_t *)mem_calloc(MEM_EXPORT, 1, sizeof(export_args_t));
+  if (!args) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+
+  // names=a.jpg,b.mjpeg or from=/to= (inclusive name range; none = everything)
+  char *form = read_form(req);
+  if (form) {
+    size_t formLen = strlen(form);
+    args->names = (char *)mem_alloc(MEM_EXPORT, formLen + 1);
+    if (args->names && !form_value(form, "names", args->names, formLen + 1)) {
+      mem_free(MEM_EXPORT, args->names);
+      args->names = NULL;
+    }
+    form_value(form, "from", args->from, sizeof(args->from));
+    form_value(form, "to", args->to, sizeof(args->to));
+    pool_free(MEM_HTTP, form);
+  }
+  if (isRecording) strlcpy(args->skip, currentRecordingFilename + 1, sizeof(args->skip));
+
+  // The archive is sent from the job's task; this worker is free again
+  uint32_t jobId;
+  job_spec_t spec = { "export", NULL, export_job, args, export_release, 0, req, false };
+  jobs_err_t err = jobs_start(&spec, &jobId);
+  if (err != JOBS_OK) {
+    return send_json_error(req, jobs_err_str(err));
+  }
+  return ESP_OK;
+}
+
+// ==================================================================
+//  HANDLER: MJPEG Live Stream
+// ==================================================================
+static esp_err_t stream_handler(httpd_req_t *req) {
+  camera_fb_t *fb = NULL;
+  struct timeval _timestamp;
+  esp_err_t res = ESP_OK;
+  size_t _jpg_buf_len = 0;
+  uint8_t *_jpg_buf = NULL;
+  char *part_buf[128];
+
+  int64_t last_frame = esp_timer_get_time();  // per viewer
+
+  res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
+  if (res != ESP_OK) return res;
+
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "X-Framerate", "60");
+
+#if defined(LED_GPIO_NUM)
+  isStreaming = true;
+#endif
+  streamViewers++;
+  device_state_invalidate(STATE_SYSTEM);
+
+  while (true) {
+    int64_t grabUs = esp_timer_get_time();
+    fb = esp_camera_fb_get();
+    uint32_t captureUs = metrics_us_since(grabUs, esp_timer_get_time());
+    metrics_observe(&metrics_capture_us, captureUs);
+    // Frames from before an ROI change settles are neither sent nor recorded
+    if (fb && fb->format == PIXFORMAT_JPEG && !roi_frame_ready(fb->buf, fb->len)) {
+      esp_camera_fb_return(fb);
+      fb = NULL;
+      continue;
+    }
+    if (!fb) {
+      log_e("Camera capture failed");
+      metrics_capture_failures.fetch_add(1, std::memory_order_relaxed);
+      res = ESP_FAIL;
+    } else {
+      _timestamp.tv_sec = fb->timestamp.tv_sec;
+      _timestamp.tv_usec = fb->timestamp.tv_usec;
+
+      if (fb->format != PIXFORMAT_JPEG) {
+        bool jpeg_converted = frame_to_jpeg(fb, &_jpg_buf, &_jpg_buf_len);
+        esp_camera_fb_return(fb);
         fb = NULL;
         if (!jpeg_converted) {
           log_e("JPEG compression failed");
@@ -729,6 +1668,8 @@ static esp_err_t stream_handler(httpd_req_t *req) {
       }
     }
 
+    int64_t sendUs = esp_timer_get_time();
+    uint32_t sendTime = 0;
     if (res == ESP_OK) {
       res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
     }
@@ -740,25 +1681,29 @@ static esp_err_t stream_handler(httpd_req_t *req) {
     if (res == ESP_OK) {
       res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
     }
+    if (res == ESP_OK) {
+      sendTime = metrics_us_since(sendUs, esp_timer_get_time());
+      metrics_observe(&metrics_stream_send_us, sendTime);
+      metrics_observe(&metrics_frame_bytes, _jpg_buf_len);
+      metrics_add64(&metrics_stream_frames, 1);
+      metrics_add64(&metrics_stream_bytes, _jpg_buf_len);
+      roi_observe(_jpg_buf_len, captureUs);
+    }
 
     // If recording, save frame to SD card
-    if (isRecording && _jpg_buf && _jpg_buf_len > 0) {
-      recordingFile.println("Content-Type: image/jpeg");
-      recordingFile.print("Content-Length: ");
-      recordingFile.println(_jpg_buf_len);
-      recordingFile.println();
-      recordingFile.write(_jpg_buf, _jpg_buf_len);
-      recordingFile.println();
-      recordingFile.println("--" PART_BOUNDARY);
-      recordingFrameCount++;
-    }
+    if (isRecording && _jpg_buf && _jpg_buf_len > 0) record_frame(_jpg_buf, _jpg_buf_len);
+
+    // Luma statistics from the DC terms (/status "scene")
+    if (res == ESP_OK && _jpg_buf) scene_observe(_jpg_buf, _jpg_buf_len);
+    // The motion detector's frames, when one is due (no frame of its own)
+    if (res == ESP_OK && fb) motion_offer(fb);
 
     if (fb) {
       esp_camera_fb_return(fb);
       fb = NULL;
       _jpg_buf = NULL;
     } else if (_jpg_buf) {
-      free(_jpg_buf);
+      pool_free(MEM_STREAM, _jpg_buf);
       _jpg_buf = NULL;
     }
 
@@ -770,6 +1715,7 @@ static esp_err_t stream_handler(httpd_req_t *req) {
     int64_t fr_end = esp_timer_get_time();
     int64_t frame_time = fr_end - last_frame;
     last_frame = fr_end;
+    if (!rec_rate_active()) abr_observe((uint32_t)frame_time, sendTime, _jpg_buf_len);
     frame_time /= 1000;
 
     // Update global FPS stats
@@ -791,6 +1737,8 @@ static esp_err_t stream_handler(httpd_req_t *req) {
 #if defined(LED_GPIO_NUM)
   isStreaming = false;
 #endif
+  streamViewers--;
+  device_state_invalidate(STATE_SYSTEM);
 
   return res;
 }
@@ -802,7 +1750,7 @@ static esp_err_t parse_get(httpd_req_t *req, char **obuf) {
   char *buf = NULL;
   size_t buf_len = httpd_req_get_url_query_len(req) + 1;
   if (buf_len > 1) {
-    buf = (char *)malloc(buf_len);
+    buf = (char *)pool_alloc(MEM_HTTP, buf_len);
     if (!buf) {
       httpd_resp_send_500(req);
       return ESP_FAIL;
@@ -811,150 +1759,272 @@ static esp_err_t parse_get(httpd_req_t *req, char **obuf) {
       *obuf = buf;
       return ESP_OK;
     }
-    free(buf);
+    pool_free(MEM_HTTP, buf);
   }
   httpd_resp_send_404(req);
   return ESP_FAIL;
 }
 
-static esp_err_t cmd_handler(httpd_req_t *req) {
-  char *buf = NULL;
-  char variable[32];
-  char value[32];
+// One response for a whole batch: {"success":..,"applied":N,...}
+static esp_err_t send_control_result(httpd_req_t *req, const control_batch_t *batch, control_err_t err) {
+  char buf[160];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", err == CONTROL_OK);
+  jw_uint(&w, "applied", batch->applied);
+  if (err == CONTROL_OK) {
+    jw_uint(&w, "unchanged", batch->unchanged);
+  } else {
+    httpd_resp_set_status(req, err == CONTROL_ERR_SENSOR ? "500 Internal Server Error" : "400 Bad Request");
+    jw_str(&w, "error", control_err_str(err));
+    jw_str(&w, "param", batch->bad);
+  }
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
 
-  if (parse_get(req, &buf) != ESP_OK) return ESP_FAIL;
+#if defined(LED_GPIO_NUM)
+// led_intensity from /control and presets
+static void set_led_intensity(int duty) {
+  led_duty = duty;
+  if (isStreaming) enable_led(true);
+}
+#endif
 
-  if (httpd_query_key_value(buf, "var", variable, sizeof(variable)) != ESP_OK ||
-      httpd_query_key_value(buf, "val", value, sizeof(value)) != ESP_OK) {
-    free(buf);
-    httpd_resp_send_404(req);
-    return ESP_FAIL;
+// Validate a batch, apply it, and publish the new camera state
+static control_err_t run_control(control_batch_t *batch, const char *form, const char *const *ignore) {
+  control_err_t err = control_parse(form, batch, ignore);
+  if (err != CONTROL_OK) return err;
+  err = control_apply(batch);
+  if (batch->applied) {
+    device_state_invalidate(STATE_CAMERA);
+    roi_sync();  // a new framesize reprograms the sensor window
   }
-  free(buf);
+  return err;
+}
+
+// /control?framesize=8&quality=10&... (or a POST body); var=&val= still works
+static esp_err_t cmd_handler(httpd_req_t *req) {
+  char *form = read_form(req);
+  control_batch_t batch;
+  control_err_t err = run_control(&batch, form, NULL);
+  pool_free(MEM_HTTP, form);
+
+  // Single-setting callers expect the original empty 200 / 500 replies
+  if (batch.legacy || (err == CONTROL_ERR_EMPTY && req->method == HTTP_GET)) {
+    if (err == CONTROL_ERR_EMPTY) return httpd_resp_send_404(req);
+    if (err != CONTROL_OK) return httpd_resp_send_500(req);
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, NULL, 0);
+  }
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return send_control_result(req, &batch, err);
+}
 
-  int val = atoi(value);
-  log_i("%s = %d", variable, val);
-  sensor_t *s = esp_camera_sensor_get();
-  int res = 0;
+// ==================================================================
+//  HANDLER: Named presets in NVS
+//    /preset                 -> list
+//    /preset?apply=name      -> apply in one batch
+//    /preset?save=name[&k=v] -> store k=v pairs, or the current settings
+//    /preset?delete=name
+// ==================================================================
+static esp_err_t preset_handler(httpd_req_t *req) {
+  char name[CONTROL_PRESET_NAME + 1] = {0};
+  char *form = read_form(req);
 
-  // Handle all supported camera parameters
-  if (!strcmp(variable, "framesize")) {
-    if (s->pixformat == PIXFORMAT_JPEG) {
-      res = s->set_framesize(s, (framesize_t)val);
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  if (form && form_value(form, "apply", name, sizeof(name))) {
+    pool_free(MEM_HTTP, form);
+    char preset[CONTROL_PRESET_LEN];
+    if (!control_preset_load(name, preset, sizeof(preset))) {
+      httpd_resp_set_status(req, "404 Not Found");
+      return send_json_error(req, "No such preset");
     }
-  } else if (!strcmp(variable, "quality")) {
-    res = s->set_quality(s, val);
-  } else if (!strcmp(variable, "contrast")) {
-    res = s->set_contrast(s, val);
-  } else if (!strcmp(variable, "brightness")) {
-    res = s->set_brightness(s, val);
-  } else if (!strcmp(variable, "saturation")) {
-    res = s->set_saturation(s, val);
-  } else if (!strcmp(variable, "gainceiling")) {
-    res = s->set_gainceiling(s, (gainceiling_t)val);
-  } else if (!strcmp(variable, "colorbar")) {
-    res = s->set_colorbar(s, val);
-  } else if (!strcmp(variable, "awb")) {
-    res = s->set_whitebal(s, val);
-  } else if (!strcmp(variable, "agc")) {
-    res = s->set_gain_ctrl(s, val);
-  } else if (!strcmp(variable, "aec")) {
-    res = s->set_exposure_ctrl(s, val);
-  } else if (!strcmp(variable, "hmirror")) {
-    res = s->set_hmirror(s, val);
-  } else if (!strcmp(variable, "vflip")) {
-    res = s->set_vflip(s, val);
-  } else if (!strcmp(variable, "awb_gain")) {
-    res = s->set_awb_gain(s, val);
-  } else if (!strcmp(variable, "agc_gain")) {
-    res = s->set_agc_gain(s, val);
-  } else if (!strcmp(variable, "aec_value")) {
-    res = s->set_aec_value(s, val);
-  } else if (!strcmp(variable, "aec2")) {
-    res = s->set_aec2(s, val);
-  } else if (!strcmp(variable, "dcw")) {
-    res = s->set_dcw(s, val);
-  } else if (!strcmp(variable, "bpc")) {
-    res = s->set_bpc(s, val);
-  } else if (!strcmp(variable, "wpc")) {
-    res = s->set_wpc(s, val);
-  } else if (!strcmp(variable, "raw_gma")) {
-    res = s->set_raw_gma(s, val);
-  } else if (!strcmp(variable, "lenc")) {
-    res = s->set_lenc(s, val);
-  } else if (!strcmp(variable, "special_effect")) {
-    res = s->set_special_effect(s, val);
-  } else if (!strcmp(variable, "wb_mode")) {
-    res = s->set_wb_mode(s, val);
-  } else if (!strcmp(variable, "ae_level")) {
-    res = s->set_ae_level(s, val);
+    control_batch_t batch;
+    control_err_t err = run_control(&batch, preset, NULL);
+    return send_control_result(req, &batch, err);
   }
-#if defined(LED_GPIO_NUM)
-  else if (!strcmp(variable, "led_intensity")) {
-    led_duty = val;
-    if (isStreaming) enable_led(true);
+
+  if (form && form_value(form, "save", name, sizeof(name))) {
+    static const char *const ignore[] = { "save", NULL };
+    control_batch_t batch;
+    char preset[CONTROL_PRESET_LEN];
+    control_err_t err = control_parse(form, &batch, ignore);
+    if (err == CONTROL_ERR_EMPTY) {
+      control_capture(preset, sizeof(preset));   // no pairs given: snapshot the sensor
+    } else if (err == CONTROL_OK) {
+      control_format(&batch, preset, sizeof(preset));
+    } else {
+      pool_free(MEM_HTTP, form);
+      return send_control_result(req, &batch, err);
+    }
+    pool_free(MEM_HTTP, form);
+    if (!control_preset_save(name, preset)) return send_json_error(req, "Invalid name or preset limit reached");
+    char buf[64];
+    json_writer_t w;
+    jw_init(&w, buf, sizeof(buf), req);
+    jw_obj_open(&w);
+    jw_bool(&w, "success", true);
+    jw_str(&w, "name", name);
+    jw_obj_close(&w);
+    return jw_finish(&w);
   }
-#endif
-  else {
-    log_i("Unknown command: %s", variable);
-    res = -1;
+
+  if (form && form_value(form, "delete", name, sizeof(name))) {
+    pool_free(MEM_HTTP, form);
+    if (!control_preset_delete(name)) return send_json_error(req, "No such preset");
+    char buf[24];
+    json_writer_t w;
+    jw_init(&w, buf, sizeof(buf), req);
+    jw_obj_open(&w);
+    jw_bool(&w, "success", true);
+    jw_obj_close(&w);
+    return jw_finish(&w);
   }
 
-  if (res < 0) return httpd_resp_send_500(req);
+  pool_free(MEM_HTTP, form);
+  char buf[CONTROL_PRESET_MAX * (CONTROL_PRESET_NAME + 3) + 32];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_key(&w, "presets");
+  control_preset_list(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
 
+// ==================================================================
+//  HANDLER: Adaptive bitrate
+//    /abr                       -> config, last window, recent steps
+//    /abr?enabled=1&fps=12&...  -> change (kept in NVS)
+// ==================================================================
+static esp_err_t abr_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, NULL, 0);
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+  abr_config_t cfg;
+  abr_get_config(&cfg);
+  bool changed = false;
+  char query[128] = {0};
+  char value[12];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "enabled", value, sizeof(value)) == ESP_OK) {
+      cfg.enabled = atoi(value) != 0;
+      changed = true;
+    }
+    // Range checks happen in abr_set_config()
+    static const struct {
+      const char *key;
+      int abr_config_t::*field;
+    } fields[] = {
+      { "fps", &abr_config_t::targetFps }, { "send_ms", &abr_config_t::maxSendMs },
+      { "q_best", &abr_config_t::qualityBest }, { "q_worst", &abr_config_t::qualityWorst },
+      { "fs_min", &abr_config_t::framesizeMin }, { "fs_max", &abr_config_t::framesizeMax },
+    };
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+      if (httpd_query_key_value(query, fields[i].key, value, sizeof(value)) != ESP_OK) continue;
+      cfg.*fields[i].field = atoi(value);
+      changed = true;
+    }
+    if (changed && !abr_set_config(&cfg)) {
+      httpd_resp_set_status(req, "400 Bad Request");
+      return send_json_error(req, "fps 1-30, send_ms 20-2000, q_best<=q_worst in 4-63, fs_min<=fs_max");
+    }
+  }
+
+  char buf[1536];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  abr_report(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
 }
 
 // ==================================================================
-//  HANDLER: Camera status JSON
+//  HANDLER: Region of interest (sensor window)
+//    /roi                                  -> window, output, bytes/capture time with and without
+//    /roi?x=600&y=300&w=400&h=300          -> window in full-resolution sensor pixels
+//    /roi?x=..&out_w=320&out_h=240         -> explicit output size (default: fit the framesize)
+//    /roi?x=700                            -> move the current window
+//    /roi?reset=1                          -> full frame
 // ==================================================================
-static esp_err_t status_handler(httpd_req_t *req) {
-  static char json_response[1024];
-
-  sensor_t *s = esp_camera_sensor_get();
-  char *p = json_response;
-  *p++ = '{';
-
-  p += sprintf(p, "\"framesize\":%u,", s->status.framesize);
-  p += sprintf(p, "\"quality\":%u,", s->status.quality);
-  p += sprintf(p, "\"brightness\":%d,", s->status.brightness);
-  p += sprintf(p, "\"contrast\":%d,", s->status.contrast);
-  p += sprintf(p, "\"saturation\":%d,", s->status.saturation);
-  p += sprintf(p, "\"sharpness\":%d,", s->status.sharpness);
-  p += sprintf(p, "\"special_effect\":%u,", s->status.special_effect);
-  p += sprintf(p, "\"wb_mode\":%u,", s->status.wb_mode);
-  p += sprintf(p, "\"awb\":%u,", s->status.awb);
-  p += sprintf(p, "\"awb_gain\":%u,", s->status.awb_gain);
-  p += sprintf(p, "\"aec\":%u,", s->status.aec);
-  p += sprintf(p, "\"aec2\":%u,", s->status.aec2);
-  p += sprintf(p, "\"ae_level\":%d,", s->status.ae_level);
-  p += sprintf(p, "\"aec_value\":%u,", s->status.aec_value);
-  p += sprintf(p, "\"agc\":%u,", s->status.agc);
-  p += sprintf(p, "\"agc_gain\":%u,", s->status.agc_gain);
-  p += sprintf(p, "\"gainceiling\":%u,", s->status.gainceiling);
-  p += sprintf(p, "\"bpc\":%u,", s->status.bpc);
-  p += sprintf(p, "\"wpc\":%u,", s->status.wpc);
-  p += sprintf(p, "\"raw_gma\":%u,", s->status.raw_gma);
-  p += sprintf(p, "\"lenc\":%u,", s->status.lenc);
-  p += sprintf(p, "\"hmirror\":%u,", s->status.hmirror);
-  p += sprintf(p, "\"vflip\":%u,", s->status.vflip);
-  p += sprintf(p, "\"dcw\":%u,", s->status.dcw);
-  p += sprintf(p, "\"colorbar\":%u,", s->status.colorbar);
-  p += sprintf(p, "\"sd_card\":%s", sdCardAvailable ? "true" : "false");
+static esp_err_t roi_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+  roi_err_t err = ROI_OK;
+  char query[128] = {0};
+  char value[12];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "reset", value, sizeof(value)) == ESP_OK && atoi(value)) {
+      err = roi_reset();
+    } else {
+      // Unset window fields keep the current window; the output is re-derived unless given
+      roi_config_t cfg;
+      roi_get(&cfg);
+      if (!cfg.active) cfg.x = cfg.y = cfg.w = cfg.h = 0;
+      cfg.outW = cfg.outH = 0;
+      bool changed = false;
+      static const struct {
+        const char *key;
+        int roi_config_t::*field;
+      } fields[] = {
+        { "x", &roi_config_t::x }, { "y", &roi_config_t::y }, { "w", &roi_config_t::w },
+        { "h", &roi_config_t::h }, { "out_w", &roi_config_t::outW }, { "out_h", &roi_config_t::outH },
+      };
+      for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        if (httpd_query_key_value(query, fields[i].key, value, sizeof(value)) != ESP_OK) continue;
+        cfg.*fields[i].field = atoi(value);
+        changed = true;
+      }
+      if (changed) err = roi_set(&cfg);
+    }
+  }
+  if (err != ROI_OK) {
+    httpd_resp_set_status(req, err == ROI_ERR_APPLY ? "500 Internal Server Error" : "400 Bad Request");
+    return send_json_error(req, roi_err_str(err));
+  }
+
+  char buf[640];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  roi_report(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
 
+// ==================================================================
+//  HANDLER: Camera status JSON
+// ==================================================================
+static int render_camera_state(char *buf, size_t len) {
+  json_writer_t w;
+  jw_init(&w, buf, len, NULL);
+  jw_obj_open(&w);
+  sensor_params_write(esp_camera_sensor_get(), &w);
+  jw_bool(&w, "sd_card", sdCardAvailable);
 #if defined(LED_GPIO_NUM)
-  p += sprintf(p, ",\"led_intensity\":%u", led_duty);
+  jw_int(&w, "led_intensity", led_duty);
 #else
-  p += sprintf(p, ",\"led_intensity\":%d", -1);
+  jw_int(&w, "led_intensity", -1);
 #endif
+  jw_obj_close(&w);
+  return jw_result(&w);
+}
 
-  *p++ = '}';
-  *p++ = 0;
-
+static esp_err_t status_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  return device_state_send_section(req, STATE_CAMERA, STATE_SCENE);
 }
 
 // ==================================================================
@@ -967,11 +2037,11 @@ static esp_err_t led_handler(httpd_req_t *req) {
   if (parse_get(req, &buf) != ESP_OK) return ESP_FAIL;
 
   if (httpd_query_key_value(buf, "state", state_str, sizeof(state_str)) != ESP_OK) {
-    free(buf);
+    pool_free(MEM_HTTP, buf);
     httpd_resp_send_404(req);
     return ESP_FAIL;
   }
-  free(buf);
+  pool_free(MEM_HTTP, buf);
 
   int state = atoi(state_str);
 
@@ -979,6 +2049,7 @@ static esp_err_t led_handler(httpd_req_t *req) {
   led_duty = state ? CONFIG_LED_MAX_INTENSITY : 0;
   enable_led(state ? true : false);
   log_i("LED set to %s", state ? "ON" : "OFF");
+  device_state_invalidate(STATE_CAMERA);  // led_intensity is part of /status
 #endif
 
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
@@ -996,9 +2067,7 @@ uint8_t temprature_sens_read();
 }
 #endif
 
-static esp_err_t system_stats_handler(httpd_req_t *req) {
-  static char json_response[512];
-  
+static int render_system_state(char *buf, size_t len) {  
   // Calculate uptime
   unsigned long uptime_ms = millis() - systemStartTime;
   unsigned long uptime_sec = uptime_ms / 1000;
@@ -1020,165 +2089,516 @@ static esp_err_t system_stats_handler(httpd_req_t *req) {
   uint32_t free_psram = ESP.getFreePsram();
   uint32_t total_psram = ESP.getPsramSize();
   
-  char *p = json_response;
-  *p++ = '{';
-  
+  json_writer_t w;
+  jw_init(&w, buf, len, NULL);
+  jw_obj_open(&w);
+
   // Uptime
-  p += sprintf(p, "\"uptime_days\":%lu,", uptime_days);
-  p += sprintf(p, "\"uptime_hours\":%lu,", uptime_hrs % 24);
-  p += sprintf(p, "\"uptime_minutes\":%lu,", uptime_min % 60);
-  p += sprintf(p, "\"uptime_seconds\":%lu,", uptime_sec % 60);
-  p += sprintf(p, "\"uptime_total_sec\":%lu,", uptime_sec);
-  
+  jw_uint(&w, "uptime_days", uptime_days);
+  jw_uint(&w, "uptime_hours", uptime_hrs % 24);
+  jw_uint(&w, "uptime_minutes", uptime_min % 60);
+  jw_uint(&w, "uptime_seconds", uptime_sec % 60);
+  jw_uint(&w, "uptime_total_sec", uptime_sec);
+
   // Temperature
-  p += sprintf(p, "\"temp_celsius\":%.1f,", temp_c);
-  p += sprintf(p, "\"temp_fahrenheit\":%.1f,", (temp_c * 1.8) + 32);
-  
+  jw_float(&w, "temp_celsius", temp_c);
+  jw_float(&w, "temp_fahrenheit", (temp_c * 1.8) + 32);
+
   // Video stats
-  p += sprintf(p, "\"fps\":%u,", currentFPS);
-  p += sprintf(p, "\"total_frames\":%lu,", totalFrames);
-  p += sprintf(p, "\"streaming\":%s,", isStreaming ? "true" : "false");
-  
+  jw_uint(&w, "fps", currentFPS);
+  jw_uint(&w, "total_frames", totalFrames);
+  jw_bool(&w, "streaming", isStreaming);
+  jw_uint(&w, "stream_viewers", streamViewers);
+  jw_uint(&w, "event_clients", events_clients());
+
   // WiFi stats
-  p += sprintf(p, "\"wifi_rssi\":%d,", rssi);
-  p += sprintf(p, "\"wifi_clients\":%d,", clients);
-  
+  jw_int(&w, "wifi_rssi", rssi);
+  jw_int(&w, "wifi_clients", clients);
+
   // Memory stats
-  p += sprintf(p, "\"free_heap\":%u,", free_heap);
-  p += sprintf(p, "\"total_heap\":%u,", total_heap);
-  p += sprintf(p, "\"heap_usage\":%.1f,", 100.0 * (total_heap - free_heap) / total_heap);
-  p += sprintf(p, "\"free_psram\":%u,", free_psram);
-  p += sprintf(p, "\"total_psram\":%u,", total_psram);
-  
-  if (total_psram > 0) {
-    p += sprintf(p, "\"psram_usage\":%.1f,", 100.0 * (total_psram - free_psram) / total_psram);
-  } else {
-    p += sprintf(p, "\"psram_usage\":0.0,");
-  }
-  
+  jw_uint(&w, "free_heap", free_heap);
+  jw_uint(&w, "total_heap", total_heap);
+  jw_float(&w, "heap_usage", 100.0 * (total_heap - free_heap) / total_heap);
+  jw_uint(&w, "free_psram", free_psram);
+  jw_uint(&w, "total_psram", total_psram);
+  jw_float(&w, "psram_usage", total_psram > 0 ? 100.0 * (total_psram - free_psram) / total_psram : 0);
+
   // SD Card stats
-  p += sprintf(p, "\"sd_available\":%s,", sdCardAvailable ? "true" : "false");
-  if (sdCardAvailable) {
-    uint64_t sd_total = SD_MMC.totalBytes();
-    uint64_t sd_used = SD_MMC.usedBytes();
-    uint64_t sd_free = sd_total - sd_used;
-    float sd_percent = sd_total > 0 ? (sd_used * 100.0 / sd_total) : 0;
-    p += sprintf(p, "\"sd_total\":%llu,", sd_total);
-    p += sprintf(p, "\"sd_used\":%llu,", sd_used);
-    p += sprintf(p, "\"sd_free\":%llu,", sd_free);
-    p += sprintf(p, "\"sd_percent\":%.1f,", sd_percent);
-  } else {
-    p += sprintf(p, "\"sd_total\":0,");
-    p += sprintf(p, "\"sd_used\":0,");
-    p += sprintf(p, "\"sd_free\":0,");
-    p += sprintf(p, "\"sd_percent\":0,");
-  }
-  
+  uint64_t sd_total = 0, sd_used = 0;
+  if (sdCardAvailable) sd_usage(&sd_total, &sd_used);
+  jw_bool(&w, "sd_available", sdCardAvailable);
+  jw_uint(&w, "sd_total", sd_total);
+  jw_uint(&w, "sd_used", sd_used);
+  jw_uint(&w, "sd_free", sd_total - sd_used);
+  jw_float(&w, "sd_percent", sd_total > 0 ? (sd_used * 100.0 / sd_total) : 0);
+
   // Recording status
-  p += sprintf(p, "\"recording\":%s", isRecording ? "true" : "false");
+  jw_bool(&w, "recording", isRecording);
   if (isRecording) {
-    unsigned long rec_duration = (millis() - recordingStartTime) / 1000;
-    p += sprintf(p, ",\"recording_duration\":%lu", rec_duration);
-    p += sprintf(p, ",\"recording_frames\":%lu", recordingFrameCount);
+    jw_uint(&w, "recording_duration", (millis() - recordingStartTime) / 1000);
+    jw_uint(&w, "recording_frames", recordingFrameCount);
   }
+
+  jw_obj_close(&w);
+  return jw_result(&w);
+}
+
+static esp_err_t system_stats_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return device_state_send_section(req, STATE_SYSTEM);
+}
+
+// ==================================================================
+//  HANDLER: Task report (?ms=N sampling window, default 1000)
+// ==================================================================
+static esp_err_t tasks_handler(httpd_req_t *req) {
+  char query[32] = {0};
+  char value[12] = {0};
+  uint32_t windowMs = 1000;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+      httpd_query_key_value(query, "ms", value, sizeof(value)) == ESP_OK) {
+    windowMs = strtoul(value, NULL, 10);
+  }
+  if (windowMs < 100) windowMs = 100;
+
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return task_report_send(req, windowMs);
+}
+
+// ==================================================================
+//  HANDLER: Heap report (per-capability blocks, per-subsystem bytes)
+// ==================================================================
+static esp_err_t mem_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return mem_send(req, mem_pool_report);
+}
+
+// ==================================================================
+//  HANDLER: Prometheus metrics
+// ==================================================================
+static void metrics_gauges(json_writer_t *w) {
+  metrics_gauge(w, "trinetra_uptime_seconds", "Time since boot", (millis() - systemStartTime) / 1000.0);
+  metrics_gauge(w, "trinetra_heap_free_bytes", "Free internal heap", ESP.getFreeHeap());
+  metrics_gauge(w, "trinetra_heap_min_free_bytes", "Lowest free internal heap since boot",
+                heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+  metrics_gauge(w, "trinetra_psram_free_bytes", "Free PSRAM", ESP.getFreePsram());
+  metrics_gauge(w, "trinetra_psram_min_free_bytes", "Lowest free PSRAM since boot",
+                heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM));
+  if (WiFi.status() == WL_CONNECTED) {
+    metrics_gauge(w, "trinetra_wifi_rssi_dbm", "Station signal strength", WiFi.RSSI());
+  }
+  metrics_gauge(w, "trinetra_wifi_ap_clients", "Stations on the access point", WiFi.softAPgetStationNum());
+  metrics_gauge(w, "trinetra_stream_viewers", "Open /stream connections", streamViewers);
+  metrics_gauge(w, "trinetra_event_clients", "Open /events subscribers", events_clients());
+  metrics_gauge(w, "trinetra_recording", "1 while recording to SD", isRecording ? 1 : 0);
+  abr_metrics(w);
+  roi_metrics(w);
+  rec_rate_metrics(w);
+  motion_metrics(w);
+  scene_metrics(w);
+  mem_track_metrics(w);
+  mem_pool_metrics(w);
+}
+
+static esp_err_t metrics_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "text/plain; version=0.0.4");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return metrics_send(req, metrics_gauges);
+}
+
+// Every URI is timed for /metrics and gets a request arena; parallel
+// ones run on an HTTP worker (timed there, excluding the hand-off)
+static void register_uri(httpd_handle_t server, httpd_uri_t *uri, bool parallel = false) {
+  metrics_wrap(uri);
+  http_workers_wrap(uri, parallel);
+  httpd_register_uri_handler(server, uri);
+}
+
+// ==================================================================
+//  WiFi Manager Handlers
+// ==================================================================
+
+// Connect and scan block for seconds, so both run as jobs; the legacy
+// endpoints hand their request to the job, which answers when done.
+typedef struct {
+  char ssid[64];
+  char password[64];
+} wifi_connect_args_t;
+
+static void wifi_connect_release(void *arg) {
+  memset(arg, 0, sizeof(wifi_connect_args_t));  // don't leave the password on the heap
+  mem_free(MEM_JOBS, arg);
+}
+
+static bool wifi_connect_job(job_t *job, void *arg, json_writer_t *out) {
+  wifi_connect_args_t *a = (wifi_connect_args_t *)arg;
+  bool success = connectToWiFi(a->ssid, a->password, 15);
+  // Save credentials if connection successful
+  if (success) saveWiFiCredentials(a->ssid, a->password);
+  device_state_invalidate(STATE_WIFI);
+
+  jw_obj_open(out);
+  jw_bool(out, "success", success);
+  jw_str(out, "ssid", a->ssid);
+  jw_str(out, "ip", success ? WiFi.localIP().toString().c_str() : "");
+  jw_str(out, "message", success ? "Connected and saved!" : "Connection failed");
+  jw_obj_close(out);
+  return success;
+}
+
+// /wifi-scan streams the bare array it always sent; a /jobs result
+// has a fixed buffer, so it says when the list was cut short
+static bool wifi_scan_job(job_t *job, void *arg, json_writer_t *out) {
+  if (out->req) {
+    scanNetworks(out);
+    return true;
+  }
+  jw_obj_open(out);
+  jw_key(out, "networks");
+  bool complete = scanNetworks(out);
+  jw_bool(out, "truncated", !complete);
+  jw_obj_close(out);
+  return true;
+}
+
+// ssid=&password= from the query or a form body; NULL without an SSID
+static wifi_connect_args_t *read_wifi_connect(httpd_req_t *req) {
+  char *form = read_form(req);
+  if (!form) return NULL;
+  wifi_connect_args_t *args = (wifi_connect_args_t *)mem_calloc(MEM_JOBS, 1, sizeof(wifi_connect_args_t));
+  if (args) {
+    form_value(form, "ssid", args->ssid, sizeof(args->ssid));
+    form_value(form, "password", args->password, sizeof(args->password));
+    if (!args->ssid[0]) {
+      wifi_connect_release(args);
+      args = NULL;
+    }
+  }
+  pool_free(MEM_HTTP, form);
+  return args;
+}
+
+// Scan available WiFi networks
+static esp_err_t wifi_scan_handler(httpd_req_t *req) {
+  uint32_t jobId;
+  job_spec_t spec = { "wifi-scan", "wifi", wifi_scan_job, NULL, NULL, 0, req, true };
+  jobs_err_t err = jobs_start(&spec, &jobId);
+  if (err == JOBS_OK) return ESP_OK;  // the job sends the network list
+
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return send_json_error(req, jobs_err_str(err));
+}
+
+// Get WiFi status
+static int render_wifi_state(char *buf, size_t len) {
+  json_writer_t w;
+  jw_init(&w, buf, len, NULL);
+  getWiFiStatus(&w);
+  return jw_result(&w);
+}
+
+static esp_err_t wifi_status_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return device_state_send_section(req, STATE_WIFI);
+}
+
+// Whole device state in one request; ?since=N leaves out unchanged sections
+static esp_err_t state_handler(httpd_req_t *req) {
+  char query[32] = {0};
+  char value[12] = {0};
+  uint32_t since = 0;
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK &&
+      httpd_query_key_value(query, "since", value, sizeof(value)) == ESP_OK) {
+    since = strtoul(value, NULL, 10);
+  }
+
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+  return device_state_send(req, since);
+}
+
+// Push channel: state deltas and alerts over one long-lived response
+static esp_err_t events_handler(httpd_req_t *req) {
+  return events_subscribe(req);
+}
+
+// Connect to WiFi network
+static esp_err_t wifi_connect_handler(httpd_req_t *req) {
+  const char *error = "Missing SSID parameter";
+  wifi_connect_args_t *args = read_wifi_connect(req);
+  if (args) {
+    uint32_t jobId;
+    job_spec_t spec = { "wifi-connect", "wifi", wifi_connect_job, args, wifi_connect_release, 0, req, true };
+    jobs_err_t err = jobs_start(&spec, &jobId);
+    if (err == JOBS_OK) return ESP_OK;  // the job answers once connected or timed out
+    error = jobs_err_str(err);
+  }
+
+  char buf[96];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", false);
+  jw_str(&w, "message", error);
+  jw_obj_close(&w);
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return jw_finish(&w);
+}
+
+// Reset/clear saved WiFi credentials
+static esp_err_t wifi_reset_handler(httpd_req_t *req) {
+  clearWiFiCredentials();
+  WiFi.disconnect();
+  wifiConnected = false;
+  device_state_invalidate(STATE_WIFI);
   
-  *p++ = '}';
-  *p++ = 0;
-  
+  const char* response = "{\"success\":true,\"message\":\"WiFi credentials cleared. Device will use AP mode only until reconfigured.\"}";
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, json_response, strlen(json_response));
+  return httpd_resp_send(req, response, strlen(response));
 }
 
 // ==================================================================
-//  WiFi Manager Handlers
+//  HANDLER: Background jobs
+//    GET  /jobs                  -> all jobs
+//    GET  /jobs/<id>             -> one job, with its result once finished
+//    POST /jobs/wifi-scan        -> {"success":true,"job":N}
+//    POST /jobs/wifi-connect     (ssid=&password=)
+//    POST /jobs/delete           (same form as /delete-files)
 // ==================================================================
+static esp_err_t send_job_started(httpd_req_t *req, jobs_err_t err, uint32_t jobId) {
+  if (err != JOBS_OK) return send_json_error(req, jobs_err_str(err));
+  char buf[48];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_uint(&w, "job", jobId);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
 
-// Scan available WiFi networks
-static esp_err_t wifi_scan_handler(httpd_req_t *req) {
-  String networks = scanNetworks();
+static esp_err_t jobs_get_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, networks.c_str(), networks.length());
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+  const char *rest = req->uri + strlen("/jobs");
+  if (*rest == '\0' || *rest == '?') return jobs_send(req, 0);
+  if (*rest == '/') {
+    char *end;
+    uint32_t id = strtoul(rest + 1, &end, 10);
+    if (id && (*end == '\0' || *end == '?')) return jobs_send(req, id);
+  }
+  return send_json_error(req, "Unknown job");
 }
 
-// Get WiFi status
-static esp_err_t wifi_status_handler(httpd_req_t *req) {
-  String status = getWiFiStatus();
+static esp_err_t jobs_post_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, status.c_str(), status.length());
+
+  const char *kind = req->uri + strlen("/jobs/");
+  size_t kindLen = strcspn(kind, "?");
+  uint32_t jobId = 0;
+
+  if (kindLen == 9 && !strncmp(kind, "wifi-scan", kindLen)) {
+    job_spec_t spec = { "wifi-scan", "wifi", wifi_scan_job, NULL, NULL, 0, NULL, false };
+    return send_job_started(req, jobs_start(&spec, &jobId), jobId);
+  }
+  if (kindLen == 12 && !strncmp(kind, "wifi-connect", kindLen)) {
+    wifi_connect_args_t *args = read_wifi_connect(req);
+    if (!args) return send_json_error(req, "Missing SSID parameter");
+    job_spec_t spec = { "wifi-connect", "wifi", wifi_connect_job, args, wifi_connect_release, 0, NULL, false };
+    return send_job_started(req, jobs_start(&spec, &jobId), jobId);
+  }
+  if (kindLen == 6 && !strncmp(kind, "delete", kindLen)) {
+    return delete_files_handler(req);  // answers {"success":true,"job":N} as well
+  }
+  return send_json_error(req, "Unknown job type");
 }
 
-// Connect to WiFi network
-static esp_err_t wifi_connect_handler(httpd_req_t *req) {
-  char buf[256];
-  int ret, remaining = req->content_len;
-  
-  // Handle GET request with query params
-  if (req->method == HTTP_GET) {
-    size_t query_len = httpd_req_get_url_query_len(req) + 1;
-    if (query_len > 1) {
-      char query[256];
-      if (httpd_req_get_url_query_str(req, query, query_len) == ESP_OK) {
-        char ssid[64] = {0};
-        char password[64] = {0};
-        
-        httpd_query_key_value(query, "ssid", ssid, sizeof(ssid));
-        httpd_query_key_value(query, "password", password, sizeof(password));
-        
-        // URL decode the SSID and password
-        // (simple decode - handle %20 and + for space)
-        for (int i = 0; ssid[i]; i++) {
-          if (ssid[i] == '+') ssid[i] = ' ';
-        }
-        for (int i = 0; password[i]; i++) {
-          if (password[i] == '+') password[i] = ' ';
-        }
-        
-        if (strlen(ssid) > 0) {
-          // Try to connect
-          bool success = connectToWiFi(ssid, password, 15);
-          
-          String json = "{";
-          json += "\"success\":" + String(success ? "true" : "false") + ",";
-          json += "\"ssid\":\"" + String(ssid) + "\",";
-          if (success) {
-            // Save credentials if connection successful
-            saveWiFiCredentials(ssid, password);
-            json += "\"ip\":\"" + WiFi.localIP().toString() + "\",";
-            json += "\"message\":\"Connected and saved!\"";
-          } else {
-            json += "\"ip\":\"\",";
-            json += "\"message\":\"Connection failed\"";
-          }
-          json += "}";
-          
-          httpd_resp_set_type(req, "application/json");
-          httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-          return httpd_resp_send(req, json.c_str(), json.length());
-        }
-      }
+// ==================================================================
+//  Motion detection hooks (called on the motion task)
+// ==================================================================
+static void motion_snapshot(camera_fb_t *fb) {
+  if (!sdCardAvailable) return;
+  char filename[64];
+  filename[0] = '/';
+  if (!media_next_name("trinetra_", ".jpg", filename + 1, sizeof(filename) - 1)) return;
+  uint32_t seq = 0;
+  size_t len = 0;
+  if (sd_writer_submit_fb(fb, filename, &seq, &len)) log_i("Motion: photo queued %s", filename);
+  else log_w("Motion: save queue full, no photo");
+}
+
+// Start a recording on motion; on stop, end only a recording motion started
+static void motion_record(bool on) {
+  if (on) {
+    const char *error = recording_begin();
+    if (error) {
+      if (!isRecording) log_w("Motion: %s", error);
+      return;
     }
+    xSemaphoreTake(recLock, portMAX_DELAY);
+    motionRecording = true;
+    xSemaphoreGive(recLock);
+    return;
   }
-  
-  // Default error response
-  const char* error = "{\"success\":false,\"message\":\"Missing SSID parameter\"}";
+  xSemaphoreTake(recLock, portMAX_DELAY);
+  bool ours = isRecording && motionRecording;
+  xSemaphoreGive(recLock);
+  unsigned long fileSize, frames, duration;
+  if (ours) recording_end(&fileSize, &frames, &duration);
+}
+
+// Recordings are written by the stream loop; with nobody watching, the motion task feeds them
+static bool motion_wants_frames() {
+  return isRecording && streamViewers == 0;
+}
+
+static void motion_frame(camera_fb_t *fb) {
+  if (fb->format == PIXFORMAT_JPEG) record_frame(fb->buf, fb->len);
+}
+
+// With viewers, the stream loop offers its frames instead
+static bool motion_streaming() {
+  return streamViewers > 0;
+}
+
+// ==================================================================
+//  HANDLER: Motion detection
+//    /motion                                -> config, state, last cell scores
+//    /motion?enabled=1&threshold=20&...     -> change (kept in NVS)
+//    /motion?zones=0,0,8,12;8,6,8,6         -> zones in grid cells ("" = whole frame)
+//    /motion/replay?name=video_00001.mjpeg  -> job: run the detector over a clip
+// ==================================================================
+static esp_err_t motion_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, error, strlen(error));
+  httpd_resp_set_hdr(req, "Cache-Control", "no-store");
+
+  motion_config_t cfg;
+  motion_get_config(&cfg);
+  bool changed = false;
+  char query[192] = {0};
+  char value[80];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    static const struct {
+      const char *key;
+      bool motion_config_t::*field;
+    } flags[] = {
+      { "enabled", &motion_config_t::enabled }, { "snapshot", &motion_config_t::snapshot },
+      { "record", &motion_config_t::record },
+    };
+    for (size_t i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) {
+      if (httpd_query_key_value(query, flags[i].key, value, sizeof(value)) != ESP_OK) continue;
+      cfg.*flags[i].field = atoi(value) != 0;
+      changed = true;
+    }
+    // Range checks happen in motion_set_config()
+    static const struct {
+      const char *key;
+      int motion_config_t::*field;
+    } fields[] = {
+      { "threshold", &motion_config_t::threshold }, { "min_cells", &motion_config_t::minCells },
+      { "start_frames", &motion_config_t::startFrames }, { "hold_ms", &motion_config_t::holdMs },
+      { "learn", &motion_config_t::learn }, { "cpu_pct", &motion_config_t::cpuPct },
+      { "max_fps", &motion_config_t::maxFps },
+    };
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+      if (httpd_query_key_value(query, fields[i].key, value, sizeof(value)) != ESP_OK) continue;
+      cfg.*fields[i].field = atoi(value);
+      changed = true;
+    }
+    if (form_value(query, "zones", value, sizeof(value))) {
+      if (!motion_parse_zones(value, &cfg)) {
+        httpd_resp_set_status(req, "400 Bad Request");
+        return send_json_error(req, "zones: up to 4 x,y,w,h in the 16x12 grid, ';'-separated");
+      }
+      changed = true;
+    }
+    if (changed && !motion_set_config(&cfg)) {
+      httpd_resp_set_status(req, "400 Bad Request");
+      return send_json_error(req, "threshold 1-255, min_cells 1-192, start_frames 1-10, hold_ms 500-600000, "
+                                  "learn 1-8, cpu_pct 1-50, max_fps 1-15");
+    }
+  }
+
+  char buf[1536];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  motion_report(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
 }
 
-// Reset/clear saved WiFi credentials
-static esp_err_t wifi_reset_handler(httpd_req_t *req) {
-  clearWiFiCredentials();
-  WiFi.disconnect();
-  wifiConnected = false;
-  
-  const char* response = "{\"success\":true,\"message\":\"WiFi credentials cleared. Device will use AP mode only until reconfigured.\"}";
+typedef struct {
+  char path[MEDIA_PATH_MAX];
+  int fps;
+} motion_replay_args_t;
+
+static void motion_replay_release(void *arg) {
+  mem_free(MEM_MOTION, arg);
+}
+
+static void motion_replay_progress(void *arg, uint32_t done, uint32_t total) {
+  job_progress((job_t *)arg, done, total);
+}
+
+static bool motion_replay_job(job_t *job, void *arg, json_writer_t *out) {
+  motion_replay_args_t *a = (motion_replay_args_t *)arg;
+  return motion_replay(a->path, a->fps, out, motion_replay_progress, job);
+}
+
+static esp_err_t motion_replay_handler(httpd_req_t *req) {
   httpd_resp_set_type(req, "application/json");
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  return httpd_resp_send(req, response, strlen(response));
+
+  if (!sdCardAvailable) {
+    return send_json_error(req, "SD card not available");
+  }
+
+  char query[192] = {0};
+  char name[128];
+  char value[8];
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK ||
+      httpd_query_key_value(query, "name", name, sizeof(name)) != ESP_OK) {
+    return send_json_error(req, "Missing name parameter");
+  }
+  size_t nameLen = strlen(name);
+  if (nameLen < 6 || strcmp(name + nameLen - 6, ".mjpeg") != 0) {
+    return send_json_error(req, "Replay needs a .mjpeg recording");
+  }
+
+  motion_replay_args_t *args = (motion_replay_args_t *)mem_calloc(MEM_MOTION, 1, sizeof(motion_replay_args_t));
+  if (!args) {
+    httpd_resp_send_500(req);
+    return ESP_FAIL;
+  }
+  url_decode_path(name, args->path, sizeof(args->path));
+  // The file keeps no timing; the stream's frame rate is the best guess for its spacing
+  args->fps = 10;
+  if (httpd_query_key_value(query, "fps", value, sizeof(value)) == ESP_OK) args->fps = atoi(value);
+  if (args->fps < 1 || args->fps > 60) {
+    mem_free(MEM_MOTION, args);
+    return send_json_error(req, "fps 1-60");
+  }
+
+  uint32_t jobId = 0;
+  job_spec_t spec = { "motion-replay", "motion-replay", motion_replay_job, args, motion_replay_release,
+                      0, NULL, false };
+  return send_job_started(req, jobs_start(&spec, &jobId), jobId);
 }
 
 // ==================================================================
@@ -1186,7 +2606,11 @@ static esp_err_t wifi_reset_handler(httpd_req_t *req) {
 // ==================================================================
 void startCameraServer() {
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-  config.max_uri_handlers = 20;
+  config.max_uri_handlers = 48;
+  config.stack_size = TASK_CONTROL_STACK;
+  config.task_priority = TASK_CONTROL_PRIO;
+  config.core_id = TASK_CONTROL_CORE;
+  config.uri_match_fn = httpd_uri_match_wildcard;  // /jobs/<id>
 
   // ---- URI definitions for the main HTTP server (port 80) ----
   httpd_uri_t index_uri = {
@@ -1219,6 +2643,66 @@ void startCameraServer() {
 #endif
   };
 
+  httpd_uri_t cmd_post_uri = {
+    .uri = "/control",
+    .method = HTTP_POST,
+    .handler = cmd_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t preset_uri = {
+    .uri = "/preset",
+    .method = HTTP_GET,
+    .handler = preset_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t abr_uri = {
+    .uri = "/abr",
+    .method = HTTP_GET,
+    .handler = abr_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t roi_uri = {
+    .uri = "/roi",
+    .method = HTTP_GET,
+    .handler = roi_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t motion_uri = {
+    .uri = "/motion",
+    .method = HTTP_GET,
+    .handler = motion_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t motion_replay_uri = {
+    .uri = "/motion/replay",
+    .method = HTTP_GET,
+    .handler = motion_replay_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
   httpd_uri_t capture_uri = {
     .uri = "/capture",
     .method = HTTP_GET,
@@ -1280,6 +2764,26 @@ void startCameraServer() {
 #endif
   };
 
+  httpd_uri_t state_uri = {
+    .uri = "/state",
+    .method = HTTP_GET,
+    .handler = state_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t events_uri = {
+    .uri = "/events",
+    .method = HTTP_GET,
+    .handler = events_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
   httpd_uri_t wifi_status_uri = {
     .uri = "/wifi-status",
     .method = HTTP_GET,
@@ -1331,6 +2835,16 @@ void startCameraServer() {
 #endif
   };
 
+  httpd_uri_t recording_rate_uri = {
+    .uri = "/recording-rate",
+    .method = HTTP_GET,
+    .handler = recording_rate_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
   httpd_uri_t recording_status_uri = {
     .uri = "/recording-status",
     .method = HTTP_GET,
@@ -1371,6 +2885,167 @@ void startCameraServer() {
 #endif
   };
 
+  httpd_uri_t delete_files_uri = {
+    .uri = "/delete-files",
+    .method = HTTP_POST,
+    .handler = delete_files_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t delete_files_status_uri = {
+    .uri = "/delete-files",
+    .method = HTTP_GET,
+    .handler = delete_files_status_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t jobs_uri = {
+    .uri = "/jobs*",
+    .method = HTTP_GET,
+    .handler = jobs_get_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t jobs_post_uri = {
+    .uri = "/jobs/*",
+    .method = HTTP_POST,
+    .handler = jobs_post_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t thumb_uri = {
+    .uri = "/thumb",
+    .method = HTTP_GET,
+    .handler = thumb_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t burst_uri = {
+    .uri = "/burst",
+    .method = HTTP_GET,
+    .handler = burst_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t save_status_uri = {
+    .uri = "/save-status",
+    .method = HTTP_GET,
+    .handler = save_status_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t export_uri = {
+    .uri = "/export",
+    .method = HTTP_GET,
+    .handler = export_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t export_post_uri = {
+    .uri = "/export",
+    .method = HTTP_POST,
+    .handler = export_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  // ---- Benchmark URIs ----
+  httpd_uri_t bench_download_uri = {
+    .uri = "/bench/download",
+    .method = HTTP_GET,
+    .handler = bench_download_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t bench_fs_create_uri = {
+    .uri = "/bench/fs-create",
+    .method = HTTP_GET,
+    .handler = bench_fs_create_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t bench_sd_uri = {
+    .uri = "/bench/sd",
+    .method = HTTP_GET,
+    .handler = bench_sd_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t bench_alloc_uri = {
+    .uri = "/bench/alloc",
+    .method = HTTP_GET,
+    .handler = bench_alloc_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t tasks_uri = {
+    .uri = "/tasks",
+    .method = HTTP_GET,
+    .handler = tasks_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t mem_uri = {
+    .uri = "/mem",
+    .method = HTTP_GET,
+    .handler = mem_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t metrics_uri = {
+    .uri = "/metrics",
+    .method = HTTP_GET,
+    .handler = metrics_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    , .is_websocket = true, .handle_ws_control_frames = false, .supported_subprotocol = NULL
+#endif
+  };
+
   // ---- URI for the stream server (port 81) ----
   httpd_uri_t stream_uri = {
     .uri = "/stream",
@@ -1382,41 +3057,100 @@ void startCameraServer() {
 #endif
   };
 
+  // Snapshot sections behind /state and the legacy polling endpoints
+  device_state_register(STATE_CAMERA, "camera", 1024, 0, render_camera_state);
+  device_state_register(STATE_SYSTEM, "system", 896, 1000, render_system_state);
+  device_state_register(STATE_SD, "sd", 160, SD_USAGE_CACHE_MS, render_sd_state);
+  device_state_register(STATE_RECORDING, "recording", 192, 0, render_recording_state);
+  device_state_register(STATE_WIFI, "wifi", 256, 2000, render_wifi_state);
+  device_state_register(STATE_SCENE, "scene", SCENE_JSON_LEN, 1000, scene_render);
+  if (!events_init()) log_e("Events: push task failed to start");
+
+#if defined(LED_GPIO_NUM)
+  control_init(set_led_intensity);
+#else
+  control_init(NULL);
+#endif
+  abr_init();
+  roi_init();
+  rec_rate_init();
+  recLock = xSemaphoreCreateMutex();
+  sdUsageLock = xSemaphoreCreateMutex();
+  static const motion_hooks_t motionHooks = { motion_snapshot, motion_record, motion_wants_frames, motion_frame,
+                                                 motion_streaming };
+  if (!motion_init(&motionHooks)) log_e("Motion: detector task failed to start");
+
   // Initialize rolling-average filter for FPS logging
   ra_filter_init(&ra_filter, 20);
 
+  // Conversion buffers for non-JPEG sensor formats; PSRAM boards only
+  jpegPool = mem_pool_create("jpeg", JPEG_POOL_BLOCK, JPEG_POOL_BLOCKS, MEM_PSRAM, 0, false);
+
+  thumbs_init();
+  if (!scene_init()) log_e("Scene: no memory for frame statistics");
+  if (!http_workers_init()) log_e("HTTP workers failed to start; every handler runs inline");
+
   // Start main HTTP server on port 80
   log_i("Starting web server on port: '%d'", config.server_port);
   if (httpd_start(&camera_httpd, &config) == ESP_OK) {
-    httpd_register_uri_handler(camera_httpd, &index_uri);
-    httpd_register_uri_handler(camera_httpd, &cmd_uri);
-    httpd_register_uri_handler(camera_httpd, &status_uri);
-    httpd_register_uri_handler(camera_httpd, &capture_uri);
-    httpd_register_uri_handler(camera_httpd, &save_photo_uri);
-    httpd_register_uri_handler(camera_httpd, &led_uri);
-    httpd_register_uri_handler(camera_httpd, &system_stats_uri);
+    register_uri(camera_httpd, &index_uri);
+    register_uri(camera_httpd, &cmd_uri);
+    register_uri(camera_httpd, &cmd_post_uri);
+    register_uri(camera_httpd, &preset_uri);
+    register_uri(camera_httpd, &abr_uri);
+    register_uri(camera_httpd, &roi_uri);
+    register_uri(camera_httpd, &motion_uri);
+    register_uri(camera_httpd, &motion_replay_uri);
+    register_uri(camera_httpd, &status_uri);
+    register_uri(camera_httpd, &capture_uri, true);
+    register_uri(camera_httpd, &save_photo_uri);
+    register_uri(camera_httpd, &save_status_uri);
+    register_uri(camera_httpd, &burst_uri);
+    register_uri(camera_httpd, &led_uri);
+    register_uri(camera_httpd, &system_stats_uri);
+    register_uri(camera_httpd, &state_uri);
+    register_uri(camera_httpd, &events_uri);
     // WiFi Manager
-    httpd_register_uri_handler(camera_httpd, &wifi_scan_uri);
-    httpd_register_uri_handler(camera_httpd, &wifi_connect_uri);
-    httpd_register_uri_handler(camera_httpd, &wifi_status_uri);
-    httpd_register_uri_handler(camera_httpd, &wifi_reset_uri);
+    register_uri(camera_httpd, &wifi_scan_uri);
+    register_uri(camera_httpd, &wifi_connect_uri);
+    register_uri(camera_httpd, &wifi_status_uri);
+    register_uri(camera_httpd, &wifi_reset_uri);
     // Recording and SD Info
-    httpd_register_uri_handler(camera_httpd, &sd_info_uri);
-    httpd_register_uri_handler(camera_httpd, &start_recording_uri);
-    httpd_register_uri_handler(camera_httpd, &stop_recording_uri);
-    httpd_register_uri_handler(camera_httpd, &recording_status_uri);
+    register_uri(camera_httpd, &sd_info_uri);
+    register_uri(camera_httpd, &start_recording_uri);
+    register_uri(camera_httpd, &stop_recording_uri);
+    register_uri(camera_httpd, &recording_status_uri);
+    register_uri(camera_httpd, &recording_rate_uri);
     // File Browser (Gallery)
-    httpd_register_uri_handler(camera_httpd, &list_files_uri);
-    httpd_register_uri_handler(camera_httpd, &download_file_uri);
-    httpd_register_uri_handler(camera_httpd, &delete_file_uri);
+    register_uri(camera_httpd, &list_files_uri, true);
+    register_uri(camera_httpd, &download_file_uri, true);
+    register_uri(camera_httpd, &delete_file_uri);
+    register_uri(camera_httpd, &delete_files_uri);
+    register_uri(camera_httpd, &delete_files_status_uri);
+    register_uri(camera_httpd, &jobs_uri);
+    register_uri(camera_httpd, &jobs_post_uri);
+    register_uri(camera_httpd, &thumb_uri, true);
+    register_uri(camera_httpd, &export_uri);
+    register_uri(camera_httpd, &export_post_uri);
+    // Benchmarks
+    register_uri(camera_httpd, &bench_download_uri);
+    register_uri(camera_httpd, &bench_fs_create_uri);
+    register_uri(camera_httpd, &bench_sd_uri);
+    register_uri(camera_httpd, &bench_alloc_uri);
+    register_uri(camera_httpd, &tasks_uri, true);
+    register_uri(camera_httpd, &mem_uri);
+    register_uri(camera_httpd, &metrics_uri, true);
   }
 
   // Start stream HTTP server on port 81
   config.server_port += 1;
   config.ctrl_port += 1;
+  config.stack_size = TASK_STREAM_STACK;
+  config.task_priority = TASK_STREAM_PRIO;
+  config.core_id = TASK_STREAM_CORE;
   log_i("Starting stream server on port: '%d'", config.server_port);
   if (httpd_start(&stream_httpd, &config) == ESP_OK) {
-    httpd_register_uri_handler(stream_httpd, &stream_uri);
+    register_uri(stream_httpd, &stream_uri);
   }
 }
 
@@ -0,0 +1,323 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Bulk Delete Job (bulk_delete.cpp)
+ * =============================================================
+ *  One job runs at a time, on the jobs framework (its id is the
+ *  /jobs id too). The worker works in passes: resolve up to
+ *  BULK_DELETE_MAX_FILES of the selection into the result table
+ *  (one directory scan at most), remove those files and their
+ *  cached thumbnails, and go again while more matched. Failures
+ *  stay at the front of the table and are not retried; deleted
+ *  entries make room for the next pass. Entries below `shown`
+ *  only change between passes, under the job mutex; the status
+ *  handler copies them out a block at a time under it and sends
+ *  with it released.
+ * =============================================================
+ */
+
+#include "bulk_delete.h"
+#include "thumbs.h"
+#include "media_store.h"
+#include "json_writer.h"
+#include "jobs.h"
+#include "mem_track.h"
+#include "device_state.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "FS.h"
+#include "SD_MMC.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef enum {
+  BULK_IDLE = 0,
+  BULK_SCANNING,
+  BULK_DELETING,
+  BULK_DONE
+} bulk_state_t;
+
+static struct {
+  uint32_t id;
+  bulk_state_t state;
+  bulk_request_t req;
+  bulk_result_t *results;
+  size_t kept;            // failures from earlier passes, at the front of results
+  size_t used;            // table entries in use (kept + this pass)
+  size_t shown;           // entries with an outcome
+  bool more;              // the table filled before the selection ran out
+  bool truncated;         // stopped with files left: the table is all failures
+  char *namesCursor;      // next name in req.names
+  uint32_t passes;
+  size_t total;           // all passes
+  size_t done;
+  size_t failed;
+  uint32_t elapsedMs;
+} job;
+
+static SemaphoreHandle_t jobLock = NULL;
+
+#define BULK_STATUS_BLOCK 16    // results copied out per lock hold
+
+static const char *state_name(bulk_state_t st) {
+  switch (st) {
+    case BULK_SCANNING: return "scanning";
+    case BULK_DELETING: return "deleting";
+    case BULK_DONE:     return "done";
+    default:            return "idle";
+  }
+}
+
+// ==================================================================
+//  Selection
+// ==================================================================
+static bool ends_with_ci(const char *s, const char *suffix) {
+  size_t ls = strlen(s), lx = strlen(suffix);
+  return ls >= lx && strcasecmp(s + ls - lx, suffix) == 0;
+}
+
+static bool matches_filter(const bulk_request_t *r, const char *name, time_t mtime) {
+  bool photo = ends_with_ci(name, ".jpg");
+  bool video = ends_with_ci(name, ".mjpeg");
+  if (!photo && !video) return false;
+  if (r->type == BULK_TYPE_PHOTO && !photo) return false;
+  if (r->type == BULK_TYPE_VIDEO && !video) return false;
+  if (r->olderThan && mtime >= r->olderThan) return false;
+  if (r->from[0] && strcmp(name, r->from) < 0) return false;
+  if (r->to[0] && strcmp(name, r->to) > 0) return false;
+  return true;
+}
+
+// False when the table is full (the name is left for the next pass)
+static bool add_result(const char *name) {
+  if (name[0] == '/') name++;
+  if (job.req.skip[0] && strcmp(name, job.req.skip) == 0) return true;
+  for (size_t i = 0; i < job.kept; i++) {
+    if (strcmp(job.results[i].name, name) == 0) return true;   // failed in an earlier pass
+  }
+  if (job.used >= BULK_DELETE_MAX_FILES) {
+    job.more = true;
+    return false;
+  }
+  strlcpy(job.results[job.used].name, name, BULK_DELETE_NAME_LEN);
+  job.results[job.used].ok = false;
+  job.used++;
+  return true;
+}
+
+static void collect_from_names() {
+  char *p = job.namesCursor;
+  while (p && *p && job.used < BULK_DELETE_MAX_FILES) {
+    char *comma = strchr(p, ',');
+    if (comma) *comma = '\0';
+    while (*p == ' ') p++;
+    if (*p) add_result(p);
+    p = comma ? comma + 1 : NULL;
+  }
+  job.namesCursor = p;
+  job.more = p && *p;
+}
+
+static bool filter_visit(const char *name, const char *path, size_t size, time_t mtime, void *arg) {
+  return !matches_filter(&job.req, name, mtime) || add_result(name);
+}
+
+static void collect_from_filter() {
+  media_for_each(filter_visit, NULL);
+}
+
+// ==================================================================
+//  Worker (runs as a job)
+// ==================================================================
+static bool bulk_delete_run(job_t *runner, void *arg, json_writer_t *out) {
+  int64_t start = esp_timer_get_time();
+  job.namesCursor = job.req.names;
+
+  char path[MEDIA_PATH_MAX];
+  while (true) {
+    job.used = job.kept;
+    job.more = false;
+    if (job.req.names) collect_from_names();
+    else collect_from_filter();
+    if (job.used == job.kept) break;   // nothing (new) matched
+
+    xSemaphoreTake(jobLock, portMAX_DELAY);
+    job.state = BULK_DELETING;
+    job.passes++;
+    job.total += job.used - job.kept;
+    xSemaphoreGive(jobLock);
+    job_progress(runner, job.done, job.total);
+
+    for (size_t i = job.kept; i < job.used; i++) {
+      bool ok = media_resolve(job.results[i].name, path, sizeof(path)) && SD_MMC.remove(path);
+      if (ok) thumb_invalidate(path);
+
+      xSemaphoreTake(jobLock, portMAX_DELAY);
+      job.results[i].ok = ok;
+      job.shown = i + 1;
+      job.done++;
+      if (!ok) job.failed++;
+      xSemaphoreGive(jobLock);
+      job_progress(runner, job.done, job.total);
+    }
+    if (!job.more) break;
+
+    // Keep this pass's failures; deleted entries make room for the next
+    xSemaphoreTake(jobLock, portMAX_DELAY);
+    size_t n = job.kept;
+    for (size_t i = job.kept; i < job.used; i++) {
+      if (!job.results[i].ok) job.results[n++] = job.results[i];
+    }
+    job.kept = job.shown = n;
+    job.state = BULK_SCANNING;
+    xSemaphoreGive(jobLock);
+    if (job.kept >= BULK_DELETE_MAX_FILES) {
+      job.truncated = true;
+      break;
+    }
+  }
+
+  xSemaphoreTake(jobLock, portMAX_DELAY);
+  job.elapsedMs = (uint32_t)((esp_timer_get_time() - start) / 1000);
+  job.state = BULK_DONE;
+  mem_free(MEM_DELETE, job.req.names);
+  job.req.names = NULL;
+  job.namesCursor = NULL;
+  xSemaphoreGive(jobLock);
+  // Gallery counts and SD usage, once for the whole job
+  if (job.total > job.failed) device_state_invalidate(STATE_SD);
+
+  log_i("Bulk delete #%u: %u files in %u passes, %u failed, %ums%s",
+        job.id, job.total, job.passes, job.failed, job.elapsedMs, job.truncated ? " (truncated)" : "");
+
+  // Summary for /jobs; per-file results stay on /delete-files?job=N
+  jw_obj_open(out);
+  jw_uint(out, "total", job.total);
+  jw_uint(out, "deleted", job.total - job.failed);
+  jw_uint(out, "failed", job.failed);
+  jw_uint(out, "passes", job.passes);
+  jw_bool(out, "truncated", job.truncated);
+  jw_uint(out, "elapsed_ms", job.elapsedMs);
+  jw_obj_close(out);
+  return true;
+}
+
+bool bulk_delete_start(bulk_request_t *req, uint32_t *jobId) {
+  if (!jobLock) jobLock = xSemaphoreCreateMutex();
+
+  xSemaphoreTake(jobLock, portMAX_DELAY);
+  if (job.state == BULK_SCANNING || job.state == BULK_DELETING) {
+    xSemaphoreGive(jobLock);
+    return false;
+  }
+
+  if (!job.results) {
+    job.results = (bulk_result_t *)mem_alloc_caps(MEM_DELETE, BULK_DELETE_MAX_FILES * sizeof(bulk_result_t),
+                                                  MEM_PSRAM, MALLOC_CAP_DEFAULT);
+    if (!job.results) {
+      xSemaphoreGive(jobLock);
+      return false;
+    }
+  }
+
+  job.req = *req;
+  req->names = NULL;  // ownership moved to the job
+  job.kept = job.used = job.shown = 0;
+  job.more = job.truncated = false;
+  job.passes = 0;
+  job.total = job.done = job.failed = 0;
+  job.elapsedMs = 0;
+  job.state = BULK_SCANNING;
+
+  // The worker blocks on jobLock until the id is in place
+  job_spec_t spec = { "delete", "delete", bulk_delete_run, NULL, NULL, 0, NULL, false };
+  if (jobs_start(&spec, &job.id) != JOBS_OK) {
+    job.state = BULK_IDLE;
+    mem_free(MEM_DELETE, job.req.names);
+    job.req.names = NULL;
+    xSemaphoreGive(jobLock);
+    return false;
+  }
+  *jobId = job.id;
+  xSemaphoreGive(jobLock);
+  return true;
+}
+
+// ==================================================================
+//  Status (chunked JSON, one chunk per block of results)
+// ==================================================================
+esp_err_t bulk_delete_send_status(httpd_req_t *req, uint32_t jobId) {
+  char chunk[512];
+  json_writer_t w;
+  jw_init(&w, chunk, sizeof(chunk), req);
+  jw_obj_open(&w);
+
+  // Counters are copied under the lock and sent after it: a slow
+  // client must not hold up the worker, which takes it per file
+  bool known = false;
+  bulk_state_t state = BULK_IDLE;
+  size_t total = 0, done = 0, failed = 0, shown = 0;
+  uint32_t passes = 0, elapsedMs = 0;
+  bool truncated = false;
+  if (jobLock) {
+    xSemaphoreTake(jobLock, portMAX_DELAY);
+    known = job.id == jobId && job.state != BULK_IDLE;
+    state = job.state;
+    total = job.total;
+    done = job.done;
+    failed = job.failed;
+    shown = job.shown;
+    passes = job.passes;
+    truncated = job.truncated;
+    elapsedMs = job.elapsedMs;
+    xSemaphoreGive(jobLock);
+  }
+  if (!known) {
+    jw_bool(&w, "success", false);
+    jw_str(&w, "error", "Unknown job");
+    jw_obj_close(&w);
+    return jw_finish(&w);
+  }
+
+  jw_bool(&w, "success", true);
+  jw_uint(&w, "job", jobId);
+  jw_str(&w, "state", state_name(state));
+  jw_uint(&w, "total", total);
+  jw_uint(&w, "done", done);
+  jw_uint(&w, "failed", failed);
+  jw_uint(&w, "passes", passes);
+  jw_bool(&w, "truncated", truncated);
+  jw_uint(&w, "elapsed_ms", elapsedMs);
+
+  // This pass's files and every earlier failure, a block at a time.
+  // Compaction between passes moves entries, so the list ends early
+  // if the worker started another pass meanwhile.
+  bulk_result_t block[BULK_STATUS_BLOCK];
+  jw_arr_open(&w, "results");
+  for (size_t i = 0; i < shown && !w.error;) {
+    size_t n = 0;
+    xSemaphoreTake(jobLock, portMAX_DELAY);
+    if (job.id == jobId && job.passes == passes) {
+      if (shown > job.shown) shown = job.shown;
+      n = shown - i < BULK_STATUS_BLOCK ? shown - i : BULK_STATUS_BLOCK;
+      memcpy(block, job.results + i, n * sizeof(bulk_result_t));
+    }
+    xSemaphoreGive(jobLock);
+    if (n == 0) break;
+    for (size_t k = 0; k < n; k++) {
+      jw_obj_open(&w);
+      jw_str(&w, "name", block[k].name);
+      jw_bool(&w, "ok", block[k].ok);
+      jw_obj_close(&w);
+    }
+    i += n;
+  }
+  jw_arr_close(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
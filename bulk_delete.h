@@ -0,0 +1,52 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Bulk Delete Job (bulk_delete.h)
+ * =============================================================
+ *  Removes many media files in one background pass instead of
+ *  one HTTP request per file. Files are picked either from an
+ *  explicit name list or by a filter (type, age, name range).
+ *  Any number of files: the job repeats its pass until the
+ *  selection is used up.
+ * =============================================================
+ */
+#ifndef BULK_DELETE_H
+#define BULK_DELETE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "esp_http_server.h"
+
+#define BULK_DELETE_MAX_FILES   512     // result table: files per pass
+#define BULK_DELETE_NAME_LEN    48
+
+typedef enum {
+  BULK_TYPE_ALL = 0,
+  BULK_TYPE_PHOTO,
+  BULK_TYPE_VIDEO
+} bulk_type_t;
+
+// Selection for one job: either `names` (comma separated) or the filter
+typedef struct {
+  char *names;                          // mem_alloc(MEM_DELETE) copy, owned by the job
+  bulk_type_t type;
+  time_t olderThan;                     // 0 = no age limit
+  char from[BULK_DELETE_NAME_LEN];      // inclusive, "" = open
+  char to[BULK_DELETE_NAME_LEN];        // inclusive, "" = open
+  char skip[BULK_DELETE_NAME_LEN];      // never delete (active recording)
+} bulk_request_t;
+
+typedef struct {
+  char name[BULK_DELETE_NAME_LEN];
+  bool ok;
+} bulk_result_t;
+
+// Start a background job (see jobs.h); takes ownership of req->names.
+// Returns false if a delete is already running or memory is short.
+bool bulk_delete_start(bulk_request_t *req, uint32_t *jobId);
+
+// Stream the state of a job (per-file results) as JSON
+esp_err_t bulk_delete_send_status(httpd_req_t *req, uint32_t jobId);
+
+#endif  // BULK_DELETE_H
@@ -0,0 +1,238 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Burst Capture (burst.cpp)
+ * =============================================================
+ *  The arena is one PSRAM block, bump-allocated per frame. The
+ *  flush task queues every frame as a borrowed buffer on the SD
+ *  writer and frees the arena once the writer has finished the
+ *  last one (writer jobs complete in order).
+ * =============================================================
+ */
+
+#include "burst.h"
+#include "task_config.h"
+#include "mem_track.h"
+#include "media_store.h"
+#include "roi.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define BURST_MAX_DROPS  4   // frames skipped while the sensor settles
+
+typedef struct {
+  uint8_t *data;
+  size_t len;
+} burst_frame_t;
+
+static struct {
+  volatile bool busy;
+  uint8_t *arena;
+  size_t arenaSize;
+  size_t used;
+  uint16_t count;
+  burst_frame_t frames[BURST_MAX_FRAMES];
+  char names[BURST_MAX_FRAMES][SD_WRITER_NAME_LEN];
+} burst;
+
+const char *burst_err_str(burst_err_t err) {
+  switch (err) {
+    case BURST_OK:            return "OK";
+    case BURST_ERR_BUSY:      return "Burst already in progress";
+    case BURST_ERR_NO_MEM:    return "Not enough PSRAM for burst";
+    case BURST_ERR_FRAMESIZE: return "Unsupported framesize";
+    case BURST_ERR_FORMAT:    return "Burst needs JPEG pixel format";
+    default:                  return "Camera capture failed";
+  }
+}
+
+bool burst_busy() {
+  return burst.busy;
+}
+
+// ==================================================================
+//  Arena
+// ==================================================================
+static bool arena_alloc() {
+  // Take what PSRAM can spare, halving down to a useful minimum.
+  // Misses along the way are expected, so only the winner is counted.
+  for (size_t size = BURST_ARENA_BYTES; size >= 256 * 1024; size /= 2) {
+    burst.arena = (uint8_t *)heap_caps_malloc(size, MEM_PSRAM);
+    if (burst.arena) {
+      mem_adopt(MEM_BURST, burst.arena);
+      burst.arenaSize = size;
+      burst.used = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+static void arena_free() {
+  mem_free(MEM_BURST, burst.arena);
+  burst.arena = NULL;
+  burst.arenaSize = burst.used = 0;
+}
+
+static uint8_t *arena_take(size_t len) {
+  size_t aligned = (len + 3) & ~(size_t)3;
+  if (burst.used + aligned > burst.arenaSize) return NULL;
+  uint8_t *p = burst.arena + burst.used;
+  burst.used += aligned;
+  return p;
+}
+
+// ==================================================================
+//  Flush task
+// ==================================================================
+static void burst_flush_task(void *arg) {
+  uint32_t lastSeq = 0;
+  uint16_t queued = 0;
+  for (uint16_t i = 0; i < burst.count; i++) {
+    uint32_t seq;
+    if (!sd_writer_submit_borrowed(burst.names[i], burst.frames[i].data, burst.frames[i].len,
+                                   &seq, 10000)) {
+      break;
+    }
+    lastSeq = seq;
+    queued++;
+  }
+
+  // The arena must outlive every queued write
+  if (queued) sd_writer_wait_seq(lastSeq, portMAX_DELAY);
+  log_i("Burst: %u of %u frames flushed", queued, burst.count);
+
+  arena_free();
+  burst.busy = false;
+  vTaskDelete(NULL);
+}
+
+// ==================================================================
+//  Capture
+// ==================================================================
+static int64_t fb_time_us(const camera_fb_t *fb) {
+  return (int64_t)fb->timestamp.tv_sec * 1000000 + fb->timestamp.tv_usec;
+}
+
+burst_err_t burst_run(const burst_config_t *cfg, burst_result_t *result) {
+  memset(result, 0, sizeof(*result));
+  if (burst.busy) return BURST_ERR_BUSY;
+
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s) return BURST_ERR_CAPTURE;
+  if (s->pixformat != PIXFORMAT_JPEG) return BURST_ERR_FORMAT;
+  if (cfg->framesize >= (int)FRAMESIZE_INVALID) return BURST_ERR_FRAMESIZE;
+
+  burst.busy = true;
+  if (!arena_alloc()) {
+    burst.busy = false;
+    return BURST_ERR_NO_MEM;
+  }
+
+  framesize_t original = s->status.framesize;
+  bool resized = cfg->framesize >= 0 && (framesize_t)cfg->framesize != original;
+  if (resized && s->set_framesize(s, (framesize_t)cfg->framesize) != 0) {
+    arena_free();
+    burst.busy = false;
+    return BURST_ERR_FRAMESIZE;
+  }
+  framesize_t target = s->status.framesize;
+
+  uint16_t count = cfg->count > BURST_MAX_FRAMES ? BURST_MAX_FRAMES : cfg->count;
+  int64_t firstUs = 0, prevUs = 0, nextDue = 0;
+  uint64_t intervalSum = 0;
+  uint16_t drops = 0;
+  burst.count = 0;
+
+  while (burst.count < count) {
+    // Keep the requested cadence (measured from the start of the burst)
+    if (burst.count > 0 && cfg->intervalMs) {
+      int64_t wait = nextDue - esp_timer_get_time();
+      if (wait > 1000) vTaskDelay((wait / 1000) / portTICK_PERIOD_MS);
+    }
+
+    camera_fb_t *fb = esp_camera_fb_get();
+    if (!fb) break;
+
+    // Frames already queued in the driver may predate a framesize change
+    if (fb->width != resolution[target].width || fb->height != resolution[target].height) {
+      esp_camera_fb_return(fb);
+      if (++drops > BURST_MAX_DROPS) break;
+      continue;
+    }
+
+    uint8_t *dst = arena_take(fb->len);
+    if (!dst) {
+      esp_camera_fb_return(fb);
+      result->arenaFull = true;
+      break;
+    }
+    memcpy(dst, fb->buf, fb->len);
+    size_t len = fb->len;
+    int64_t t = fb_time_us(fb);
+    esp_camera_fb_return(fb);
+
+    burst.frames[burst.count].data = dst;
+    burst.frames[burst.count].len = len;
+    result->bytes += len;
+
+    if (burst.count == 0) {
+      firstUs = t;
+      nextDue = esp_timer_get_time() + (int64_t)cfg->intervalMs * 1000;
+    } else {
+      uint32_t dt = (uint32_t)(t - prevUs);
+      intervalSum += dt;
+      if (result->minIntervalUs == 0 || dt < result->minIntervalUs) result->minIntervalUs = dt;
+      if (dt > result->maxIntervalUs) result->maxIntervalUs = dt;
+      nextDue += (int64_t)cfg->intervalMs * 1000;
+    }
+    prevUs = t;
+    burst.count++;
+  }
+
+  if (resized) {
+    s->set_framesize(s, original);
+    roi_restore();   // set_framesize() reset the window
+  }
+
+  result->captured = burst.count;
+  result->dropped = drops;
+  if (burst.count > 1) {
+    result->durationMs = (uint32_t)((prevUs - firstUs) / 1000);
+    result->avgIntervalUs = (uint32_t)(intervalSum / (burst.count - 1));
+  }
+
+  if (burst.count == 0) {
+    arena_free();
+    burst.busy = false;
+    return BURST_ERR_CAPTURE;
+  }
+
+  // Names are reserved now so the client gets them in the response
+  for (uint16_t i = 0; i < burst.count; i++) {
+    if (!media_next_name("trinetra_", ".jpg", burst.names[i], SD_WRITER_NAME_LEN)) {
+      burst.count = i;
+      break;
+    }
+    strlcpy(result->names[i], burst.names[i], SD_WRITER_NAME_LEN);
+  }
+  result->captured = burst.count;
+
+  if (burst.count == 0 ||
+      xTaskCreatePinnedToCore(burst_flush_task, "burst_flush", TASK_BURST_FLUSH_STACK, NULL,
+                              TASK_BURST_FLUSH_PRIO, NULL, TASK_BURST_FLUSH_CORE) != pdPASS) {
+    arena_free();
+    burst.busy = false;
+    return BURST_ERR_NO_MEM;
+  }
+
+  log_i("Burst: %u frames, %u bytes, avg interval %uus", burst.count,
+        (unsigned)result->bytes, result->avgIntervalUs);
+  return BURST_OK;
+}
@@ -0,0 +1,59 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Burst Capture (burst.h)
+ * =============================================================
+ *  Grabs N frames back-to-back (or at a fixed interval) into a
+ *  PSRAM arena without touching the SD card, then hands the
+ *  frames to the SD writer as numbered photos. The capture loop
+ *  only copies JPEG data, so the frame rate is the sensor's.
+ * =============================================================
+ */
+#ifndef BURST_H
+#define BURST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+#include "sd_writer.h"
+
+#define BURST_MAX_FRAMES        30
+#define BURST_MAX_INTERVAL_MS   2000
+#define BURST_ARENA_BYTES       (2 * 1024 * 1024)
+
+typedef struct {
+  uint16_t count;
+  uint16_t intervalMs;          // 0 = back-to-back
+  int framesize;                // -1 = keep the current framesize
+} burst_config_t;
+
+typedef struct {
+  uint16_t captured;
+  uint16_t dropped;             // stale/wrong-size frames discarded
+  bool arenaFull;               // stopped early: out of arena space
+  uint32_t bytes;
+  uint32_t durationMs;          // first to last frame
+  uint32_t minIntervalUs;
+  uint32_t avgIntervalUs;
+  uint32_t maxIntervalUs;
+  char names[BURST_MAX_FRAMES][SD_WRITER_NAME_LEN];
+} burst_result_t;
+
+typedef enum {
+  BURST_OK = 0,
+  BURST_ERR_BUSY,               // previous burst still flushing
+  BURST_ERR_NO_MEM,
+  BURST_ERR_FRAMESIZE,
+  BURST_ERR_FORMAT,             // sensor not in JPEG mode
+  BURST_ERR_CAPTURE
+} burst_err_t;
+
+// Capture synchronously; flushing to SD continues in the background
+burst_err_t burst_run(const burst_config_t *cfg, burst_result_t *result);
+
+// True while a burst is capturing or flushing
+bool burst_busy();
+
+const char *burst_err_str(burst_err_t err);
+
+#endif  // BURST_H
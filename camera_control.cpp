@@ -0,0 +1,323 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Camera Control (camera_control.cpp)
+ * =============================================================
+ *  SCCB writes cannot be rolled back, so a batch is rejected as
+ *  a whole when any name or value is bad. If the sensor itself
+ *  fails part-way, `applied` tells the caller how far it got.
+ * =============================================================
+ */
+
+#include "camera_control.h"
+#include "esp_camera.h"
+#include "esp_http_server.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <Preferences.h>
+#include <ctype.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+static SemaphoreHandle_t sensorLock = NULL;
+static void (*ledHook)(int duty) = NULL;
+
+// ==================================================================
+//  Lookup
+// ==================================================================
+// The flash LED is a board feature, not a sensor register, so it sits
+// beside the registry; no getter, so it is always written.
+static const sensor_param_t ledParam = {
+  "led_intensity",
+  [](sensor_t *s, int v) {
+    if (!ledHook) return -1;
+    ledHook(v);
+    return 0;
+  },
+  NULL, 0, 255, SENSOR_PARAM_NO_PRESET
+};
+
+static const sensor_param_t *find_param(const char *name) {
+  const sensor_param_t *p = sensor_param_find(name);
+  if (!p && ledHook && !strcmp(name, ledParam.name)) p = &ledParam;
+  return p;
+}
+
+void control_init(void (*led_fn)(int duty)) {
+  if (!sensorLock) sensorLock = xSemaphoreCreateMutex();
+  ledHook = led_fn;
+}
+
+// ==================================================================
+//  Parse + validate
+// ==================================================================
+static bool parse_int(const char *text, int *out) {
+  char *end = NULL;
+  long v = strtol(text, &end, 10);
+  if (end == text || *end || v < INT16_MIN || v > INT16_MAX) return false;
+  *out = (int)v;
+  return true;
+}
+
+static bool ignored(const char *key, const char *const *ignore) {
+  for (; ignore && *ignore; ignore++) {
+    if (!strcmp(key, *ignore)) return true;
+  }
+  return false;
+}
+
+static control_err_t fail(control_batch_t *batch, control_err_t err, const char *name) {
+  batch->error = err;
+  strlcpy(batch->bad, name ? name : "", sizeof(batch->bad));
+  return err;
+}
+
+static control_err_t add_param(control_batch_t *batch, const char *name, const char *value) {
+  if (batch->count >= CONTROL_MAX_PARAMS) return fail(batch, CONTROL_ERR_TOO_MANY, name);
+  control_param_t *p = &batch->params[batch->count];
+  p->param = find_param(name);
+  if (!p->param) return fail(batch, CONTROL_ERR_UNKNOWN, name);
+  if (!parse_int(value, &p->value)) return fail(batch, CONTROL_ERR_VALUE, name);
+  if (p->value < p->param->min || p->value > p->param->max) return fail(batch, CONTROL_ERR_RANGE, name);
+  batch->count++;
+  return CONTROL_OK;
+}
+
+control_err_t control_parse(const char *form, control_batch_t *batch, const char *const *ignore) {
+  memset(batch, 0, sizeof(*batch));
+  if (!form) return fail(batch, CONTROL_ERR_EMPTY, NULL);
+
+  // Legacy single-setting form: /control?var=quality&val=10
+  char var[CONTROL_NAME_LEN], val[16];
+  if (httpd_query_key_value(form, "var", var, sizeof(var)) == ESP_OK &&
+      httpd_query_key_value(form, "val", val, sizeof(val)) == ESP_OK) {
+    batch->legacy = true;
+    return add_param(batch, var, val);
+  }
+
+  const char *p = form;
+  while (*p) {
+    const char *amp = strchr(p, '&');
+    size_t len = amp ? (size_t)(amp - p) : strlen(p);
+    const char *eq = (const char *)memchr(p, '=', len);
+    if (len > 0) {
+      char name[CONTROL_NAME_LEN];
+      char value[16];
+      size_t nameLen = eq ? (size_t)(eq - p) : len;
+      size_t valueLen = eq ? len - nameLen - 1 : 0;
+      if (nameLen >= sizeof(name) || valueLen >= sizeof(value)) {
+        char shown[CONTROL_NAME_LEN];
+        strlcpy(shown, p, nameLen < sizeof(shown) ? nameLen + 1 : sizeof(shown));
+        return fail(batch, nameLen >= sizeof(name) ? CONTROL_ERR_UNKNOWN : CONTROL_ERR_VALUE, shown);
+      }
+      memcpy(name, p, nameLen);
+      name[nameLen] = 0;
+      memcpy(value, eq ? eq + 1 : "", valueLen);
+      value[valueLen] = 0;
+      if (!ignored(name, ignore)) {
+        control_err_t err = add_param(batch, name, value);
+        if (err != CONTROL_OK) return err;
+      }
+    }
+    if (!amp) break;
+    p = amp + 1;
+  }
+  if (batch->count == 0) return fail(batch, CONTROL_ERR_EMPTY, NULL);
+  return CONTROL_OK;
+}
+
+// ==================================================================
+//  Apply
+// ==================================================================
+control_err_t control_apply(control_batch_t *batch) {
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s || !sensorLock) return fail(batch, CONTROL_ERR_SENSOR, NULL);
+
+  batch->applied = 0;
+  batch->unchanged = 0;
+  xSemaphoreTake(sensorLock, portMAX_DELAY);
+  for (uint8_t i = 0; i < batch->count; i++) {
+    const control_param_t *p = &batch->params[i];
+    if (p->param->get && p->param->get(s) == p->value) {
+      batch->unchanged++;  // each SCCB write costs; skip no-ops
+    } else if (p->param->set(s, p->value) < 0) {
+      fail(batch, CONTROL_ERR_SENSOR, p->param->name);
+      break;
+    }
+    batch->applied++;
+  }
+  xSemaphoreGive(sensorLock);
+
+  log_i("Control: applied %u/%u (%u unchanged)", batch->applied, batch->count, batch->unchanged);
+  return batch->error;
+}
+
+bool control_with_sensor(int (*fn)(sensor_t *s, void *arg), void *arg) {
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s || !sensorLock) return false;
+  xSemaphoreTake(sensorLock, portMAX_DELAY);
+  int ret = fn(s, arg);
+  xSemaphoreGive(sensorLock);
+  return ret == 0;
+}
+
+control_err_t control_set(const char *name, int value) {
+  char form[CONTROL_NAME_LEN + 8];
+  snprintf(form, sizeof(form), "%s=%d", name, value);
+  control_batch_t batch;
+  control_err_t err = control_parse(form, &batch, NULL);
+  return err == CONTROL_OK ? control_apply(&batch) : err;
+}
+
+const char *control_err_str(control_err_t err) {
+  switch (err) {
+    case CONTROL_OK: return "ok";
+    case CONTROL_ERR_EMPTY: return "no parameters";
+    case CONTROL_ERR_TOO_MANY: return "too many parameters";
+    case CONTROL_ERR_UNKNOWN: return "unknown parameter";
+    case CONTROL_ERR_VALUE: return "invalid value";
+    case CONTROL_ERR_RANGE: return "value out of range";
+    case CONTROL_ERR_SENSOR: return "sensor rejected setting";
+  }
+  return "error";
+}
+
+int control_format(const control_batch_t *batch, char *out, size_t len) {
+  int n = 0;
+  out[0] = 0;
+  for (uint8_t i = 0; i < batch->count && n < (int)len; i++) {
+    n += snprintf(out + n, len - n, "%s%s=%d", i ? "&" : "", batch->params[i].param->name,
+                  batch->params[i].value);
+  }
+  return n;
+}
+
+// Every presettable parameter, framesize last so a resize sees the rest
+int control_capture(char *out, size_t len) {
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s) return 0;
+  const sensor_param_t *framesize = sensor_param_find("framesize");
+  int n = 0;
+  for (size_t i = 0; i < SENSOR_PARAM_COUNT && n < (int)len; i++) {
+    const sensor_param_t *p = &SENSOR_PARAMS[i];
+    if ((p->flags & SENSOR_PARAM_NO_PRESET) || p == framesize) continue;
+    n += snprintf(out + n, len - n, "%s=%d&", p->name, p->get(s));
+  }
+  if (n < (int)len) n += snprintf(out + n, len - n, "%s=%d", framesize->name, framesize->get(s));
+  return n;
+}
+
+// ==================================================================
+//  Presets
+// ==================================================================
+// Names are NVS keys; the index lives under a key no preset can take
+#define PRESET_INDEX_KEY "_index"
+
+bool control_preset_valid_name(const char *name) {
+  size_t n = strlen(name);
+  if (n == 0 || n >= CONTROL_PRESET_NAME) return false;
+  for (size_t i = 0; i < n; i++) {
+    char c = name[i];
+    if (!isalnum((unsigned char)c) && c != '-' && (c != '_' || i == 0)) return false;
+  }
+  return true;
+}
+
+// Index is "name,name,..."; position of `name` or -1
+static int index_find(const char *index, const char *name) {
+  size_t n = strlen(name);
+  int pos = 0;
+  for (const char *p = index; *p; pos++) {
+    const char *comma = strchr(p, ',');
+    size_t len = comma ? (size_t)(comma - p) : strlen(p);
+    if (len == n && !strncmp(p, name, n)) return pos;
+    if (!comma) break;
+    p = comma + 1;
+  }
+  return -1;
+}
+
+static int index_count(const char *index) {
+  if (!*index) return 0;
+  int n = 1;
+  for (const char *p = index; *p; p++) n += *p == ',';
+  return n;
+}
+
+bool control_preset_save(const char *name, const char *form) {
+  if (!control_preset_valid_name(name) || strlen(form) >= CONTROL_PRESET_LEN) return false;
+
+  Preferences prefs;
+  if (!prefs.begin(CONTROL_PRESET_NS, false)) return false;
+  char index[CONTROL_PRESET_MAX * CONTROL_PRESET_NAME] = {0};
+  prefs.getString(PRESET_INDEX_KEY, index, sizeof(index));
+
+  bool ok = true;
+  if (index_find(index, name) < 0) {
+    if (index_count(index) >= CONTROL_PRESET_MAX) {
+      ok = false;
+    } else {
+      if (*index) strlcat(index, ",", sizeof(index));
+      strlcat(index, name, sizeof(index));
+      ok = prefs.putString(PRESET_INDEX_KEY, index) > 0;
+    }
+  }
+  if (ok) ok = prefs.putString(name, form) > 0;
+  prefs.end();
+  if (ok) log_i("Control: preset '%s' saved", name);
+  return ok;
+}
+
+bool control_preset_load(const char *name, char *form, size_t len) {
+  if (!control_preset_valid_name(name)) return false;
+  Preferences prefs;
+  if (!prefs.begin(CONTROL_PRESET_NS, true)) return false;
+  bool ok = prefs.isKey(name) && prefs.getString(name, form, len) > 0;
+  prefs.end();
+  return ok;
+}
+
+bool control_preset_delete(const char *name) {
+  if (!control_preset_valid_name(name)) return false;
+  Preferences prefs;
+  if (!prefs.begin(CONTROL_PRESET_NS, false)) return false;
+  char index[CONTROL_PRESET_MAX * CONTROL_PRESET_NAME] = {0};
+  prefs.getString(PRESET_INDEX_KEY, index, sizeof(index));
+
+  // Rebuild the index without `name`
+  char rebuilt[sizeof(index)] = {0};
+  bool found = false;
+  char *save = NULL;
+  for (char *tok = strtok_r(index, ",", &save); tok; tok = strtok_r(NULL, ",", &save)) {
+    if (!strcmp(tok, name)) {
+      found = true;
+      continue;
+    }
+    if (*rebuilt) strlcat(rebuilt, ",", sizeof(rebuilt));
+    strlcat(rebuilt, tok, sizeof(rebuilt));
+  }
+  if (found) {
+    prefs.putString(PRESET_INDEX_KEY, rebuilt);
+    prefs.remove(name);
+  }
+  prefs.end();
+  return found;
+}
+
+void control_preset_list(json_writer_t *w) {
+  char index[CONTROL_PRESET_MAX * CONTROL_PRESET_NAME] = {0};
+  Preferences prefs;
+  if (prefs.begin(CONTROL_PRESET_NS, true)) {
+    prefs.getString(PRESET_INDEX_KEY, index, sizeof(index));
+    prefs.end();
+  }
+
+  jw_arr_open(w);
+  char *save = NULL;
+  for (char *tok = strtok_r(index, ",", &save); tok; tok = strtok_r(NULL, ",", &save)) {
+    jw_str(w, NULL, tok);
+  }
+  jw_arr_close(w);
+}
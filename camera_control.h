@@ -0,0 +1,89 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Camera Control (camera_control.h)
+ * =============================================================
+ *  Batched sensor settings: a request carries any number of
+ *  name=value pairs, all of which are checked against the
+ *  sensor_params.h registry before the first register write,
+ *  then applied back to back under one sensor lock. Named
+ *  presets are stored in NVS as the same form string and go
+ *  through the same path.
+ * =============================================================
+ */
+#ifndef CAMERA_CONTROL_H
+#define CAMERA_CONTROL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sensor_params.h"
+#include "json_writer.h"
+
+#define CONTROL_MAX_PARAMS    32      // pairs per request
+#define CONTROL_NAME_LEN      20
+#define CONTROL_PRESET_NS     "presets"
+#define CONTROL_PRESET_MAX    8
+#define CONTROL_PRESET_NAME   16      // NVS key limit, including the terminator
+#define CONTROL_PRESET_LEN    512
+
+typedef enum {
+  CONTROL_OK = 0,
+  CONTROL_ERR_EMPTY,          // no parameters
+  CONTROL_ERR_TOO_MANY,
+  CONTROL_ERR_UNKNOWN,        // name not a control
+  CONTROL_ERR_VALUE,          // value not an integer
+  CONTROL_ERR_RANGE,          // outside the parameter's min..max
+  CONTROL_ERR_SENSOR          // sensor missing or a setter failed
+} control_err_t;
+
+typedef struct {
+  const sensor_param_t *param;
+  int value;
+} control_param_t;
+
+typedef struct {
+  control_param_t params[CONTROL_MAX_PARAMS];
+  uint8_t count;
+  uint8_t applied;                // includes unchanged ones
+  uint8_t unchanged;              // already at the requested value, not written
+  bool legacy;                    // single var=&val= request
+  control_err_t error;
+  char bad[CONTROL_NAME_LEN];     // offending name, if any
+} control_batch_t;
+
+// Create the sensor lock; led_fn handles led_intensity (NULL if no LED)
+void control_init(void (*led_fn)(int duty));
+
+// Parse "name=val&..." (or legacy var=&val=) and validate every pair.
+// Keys listed in `ignore` (NULL-terminated) are skipped.
+control_err_t control_parse(const char *form, control_batch_t *batch, const char *const *ignore);
+
+// Apply a parsed batch under the sensor lock, in request order,
+// skipping parameters whose getter already reports the value
+control_err_t control_apply(control_batch_t *batch);
+
+// One parameter, parsed and applied like a batch of one
+control_err_t control_set(const char *name, int value);
+
+// Run `fn` under the sensor lock, for register programming that is
+// not a registry parameter (e.g. the ROI window); false when there
+// is no sensor or `fn` returns nonzero
+bool control_with_sensor(int (*fn)(sensor_t *s, void *arg), void *arg);
+
+const char *control_err_str(control_err_t err);
+
+// Parsed batch back to "name=val&..." (canonical names, no ignored keys)
+int control_format(const control_batch_t *batch, char *out, size_t len);
+
+// Current settings as a form string suitable for a preset
+int control_capture(char *out, size_t len);
+
+// ---- Presets (NVS) ----
+bool control_preset_valid_name(const char *name);
+bool control_preset_save(const char *name, const char *form);
+bool control_preset_load(const char *name, char *form, size_t len);
+bool control_preset_delete(const char *name);
+// Preset names as a JSON array
+void control_preset_list(json_writer_t *w);
+
+#endif  // CAMERA_CONTROL_H
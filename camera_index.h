@@ -1,1087 +1,1193 @@
 /*
  * =============================================================
- *  TRINETRA — ESP32-CAM Surveillance System
- *  Web Interface v3.1 — Immersive Stream-First UI + Recording
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Web Interface (camera_index.h) - GENERATED, DO NOT EDIT
  * =============================================================
- *  Hero stream fills viewport, floating control bar,
- *  slide-in drawers, shutter flash, no toasts, all SVG.
+ *  Source: ui/index.html, rebuilt by tools/build_ui.py.
+ *  Stored gzip-compressed; served with Content-Encoding: gzip
+ *  and validated by ETag.
+ *
+ *  76085 bytes of HTML -> 18690 bytes gzip
  * =============================================================
  */
 #ifndef CAMERA_INDEX_H
 #define CAMERA_INDEX_H
+#include <stddef.h>
 #include <pgmspace.h>
 
-const char index_html[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="en">
-<head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width,initial-scale=1,maximum-scale=5">
-<meta name="theme-color" content="#060a11">
-<title>Trinetra</title>
-<style>
-*,*::before,*::after{margin:0;padding:0;box-sizing:border-box}
-:root{
---bg:#060a11;--sf:#0f1520;--sf2:#1a2233;--sf3:#2a3548;
---ac:#dc2626;--ac2:#f87171;--acg:rgba(220,38,38,.22);--acd:rgba(220,38,38,.08);
---ok:#10b981;--okd:rgba(16,185,129,.12);
---er:#ef4444;--erd:rgba(239,68,68,.12);
---wn:#f59e0b;--wnd:rgba(245,158,11,.12);
---tx:#f1f5f9;--tx2:#94a3b8;--tx3:#64748b;
---bd:#1a2233;--bd2:#2a3548;
---r:10px;--rs:6px;--rl:14px;
---font:system-ui,-apple-system,'Segoe UI',Roboto,sans-serif;
---safe-b:env(safe-area-inset-bottom,0px);
---bar:48px;--cbar:52px;--mnav:0px;
-}
-html{font-size:16px;scroll-behavior:smooth}
-body{font-family:var(--font);background:var(--bg);color:var(--tx);min-height:100vh;min-height:100dvh;overflow:hidden;-webkit-font-smoothing:antialiased;line-height:1.5}
-button{font-family:inherit;cursor:pointer;border:none;background:none;color:inherit}
-:focus-visible{outline:2px solid var(--ac);outline-offset:2px;border-radius:4px}
-::-webkit-scrollbar{width:5px}
-::-webkit-scrollbar-track{background:var(--sf)}
-::-webkit-scrollbar-thumb{background:var(--sf3);border-radius:3px}
-
-/* ===== APPBAR ===== */
-.bar{position:fixed;top:0;left:0;right:0;z-index:100;height:var(--bar);display:flex;align-items:center;justify-content:space-between;padding:0 12px;background:rgba(6,10,17,.88);backdrop-filter:blur(20px);-webkit-backdrop-filter:blur(20px);border-bottom:1px solid rgba(255,255,255,.04)}
-.bar-l{display:flex;align-items:center;gap:10px}
-.bar-r{display:flex;align-items:center;gap:2px}
-.lm{width:30px;height:30px;border-radius:8px;background:linear-gradient(135deg,var(--ac),#b91c1c);display:flex;align-items:center;justify-content:center;box-shadow:0 0 14px var(--acg);flex-shrink:0}
-.lm svg{width:16px;height:16px;fill:#fff}
-.lt{font-size:1rem;font-weight:700;letter-spacing:1.5px}.lt span{color:var(--ac)}
-.chip{display:flex;align-items:center;gap:5px;padding:3px 8px;border-radius:14px;background:var(--sf2);font-size:.6rem;font-weight:600;color:var(--tx3);border:1px solid var(--bd);margin-right:4px}
-.chip .d{width:6px;height:6px;border-radius:50%;background:var(--tx3);transition:.3s}
-.chip .d.on{background:var(--ok);box-shadow:0 0 8px rgba(16,185,129,.6);animation:pulse 2s infinite}
-@keyframes pulse{0%,100%{opacity:1}50%{opacity:.4}}
-.ib{width:34px;height:34px;border-radius:var(--rs);display:flex;align-items:center;justify-content:center;color:var(--tx3);transition:.2s}
-.ib:hover{background:var(--sf2);color:var(--tx)}
-.ib.active{color:var(--ac);background:var(--acd)}
-.ib svg{width:18px;height:18px;fill:currentColor}
-
-/* ===== HERO STREAM (FULL VIEWPORT WITH CURVED EDGES) ===== */
-.hero{position:fixed;top:calc(var(--bar) + 8px);left:8px;right:8px;bottom:calc(var(--mnav) + 8px);background:#000;display:flex;align-items:center;justify-content:center;overflow:hidden;border-radius:20px;box-shadow:0 4px 24px rgba(0,0,0,.3)}
-.hero img{width:100%;height:100%;object-fit:contain;display:block;transition:none;border-radius:20px}
-.hero img.hide{display:none}
-
-/* Placeholder */
-.ph{position:absolute;inset:0;display:flex;align-items:center;justify-content:center;cursor:pointer;z-index:3;transition:opacity .3s}
-.ph.hide{opacity:0;pointer-events:none}
-.ph-in{display:flex;flex-direction:column;align-items:center;gap:16px}
-.ph-btn{width:80px;height:80px;border-radius:50%;border:2px solid var(--ac);display:flex;align-items:center;justify-content:center;transition:.3s;background:rgba(6,182,212,.06)}
-.ph-btn svg{width:36px;height:36px;fill:var(--ac);margin-left:4px}
-.ph:hover .ph-btn{transform:scale(1.08);box-shadow:0 0 32px var(--acg);background:rgba(6,182,212,.12)}
-.ph-txt{font-size:.78rem;color:var(--tx3);font-weight:500}
-
-/* HUD top */
-.hud{position:absolute;top:0;left:0;right:0;padding:10px 14px;display:flex;justify-content:space-between;align-items:flex-start;background:linear-gradient(180deg,rgba(0,0,0,.65) 0%,transparent 100%);pointer-events:none;z-index:5;opacity:0;transition:opacity .3s}
-.hud.show{opacity:1}
-.bg{font-size:.58rem;font-weight:700;padding:3px 8px;border-radius:14px;letter-spacing:.8px;text-transform:uppercase;display:flex;align-items:center;gap:4px}
-.bg svg{width:8px;height:8px;fill:currentColor}
-.bg-live{background:var(--er);color:#fff}
-.bg-rec{background:var(--ac);color:#fff;animation:recPulse 1.5s ease-in-out infinite}
-@keyframes recPulse{0%,100%{opacity:1}50%{opacity:.7}}
-.bg-res{background:rgba(255,255,255,.1);color:#ccc;backdrop-filter:blur(4px)}
-.timer{font-variant-numeric:tabular-nums;margin-left:2px;font-weight:600}
-
-/* Shutter Flash */
-.shutter{position:absolute;inset:0;background:#fff;opacity:0;pointer-events:none;z-index:12}
-.shutter.flash{animation:shutterAnim .28s ease-out}
-@keyframes shutterAnim{0%{opacity:0}25%{opacity:.32}100%{opacity:0}}
-
-/* Loading spinner */
-.spinner{position:absolute;inset:0;display:flex;align-items:center;justify-content:center;z-index:4;opacity:0;pointer-events:none;transition:opacity .3s}
-.spinner.show{opacity:1}
-.spin-ring{width:40px;height:40px;border:3px solid var(--sf3);border-top-color:var(--ac);border-radius:50%;animation:spin .8s linear infinite}
-@keyframes spin{to{transform:rotate(360deg)}}
-
-/* Notify pill (minimal, replaces toasts) */
-.notify{position:absolute;bottom:100px;left:50%;transform:translateX(-50%);padding:8px 18px;border-radius:24px;background:rgba(10,14,23,.95);backdrop-filter:blur(16px);color:var(--tx);font-size:.75rem;font-weight:500;opacity:0;transition:opacity .3s;pointer-events:none;z-index:15;white-space:nowrap;border:1px solid rgba(255,255,255,.08);display:flex;align-items:center;gap:8px;max-width:90%;box-shadow:0 4px 20px rgba(0,0,0,.4)}
-.notify svg{width:14px;height:14px;flex-shrink:0}
-.notify.show{opacity:1}
-.notify.n-ok svg{fill:var(--ok)}
-.notify.n-er svg{fill:var(--er)}
-.notify.n-wn svg{fill:var(--wn)}
-
-/* ===== CONTROL BAR (PRO FLOATING DOCK) ===== */
-.cbar{position:absolute;bottom:16px;left:50%;transform:translateX(-50%);height:64px;display:flex;align-items:center;justify-content:center;gap:10px;padding:0 20px;background:rgba(10,14,23,.92);backdrop-filter:blur(24px);-webkit-backdrop-filter:blur(24px);border:1px solid rgba(255,255,255,.06);border-radius:32px;z-index:10;box-shadow:0 8px 32px rgba(0,0,0,.5)}
-.cb{width:48px;height:48px;border-radius:50%;display:flex;align-items:center;justify-content:center;transition:all .2s ease;position:relative;flex-shrink:0;box-shadow:0 2px 8px rgba(0,0,0,.3)}
-.cb svg{width:22px;height:22px;fill:currentColor}
-.cb:active{transform:scale(.92)}
-.cb:hover{transform:scale(1.08)}
-.cb-play{background:linear-gradient(135deg,var(--ac),#b91c1c);color:#fff}
-.cb-play:hover{box-shadow:0 0 24px var(--acg)}
-.cb-stop{background:linear-gradient(135deg,var(--er),#dc2626);color:#fff}
-.cb-stop:hover{box-shadow:0 0 24px var(--erd)}
-.cb-def{background:rgba(255,255,255,.08);color:var(--tx);border:1px solid rgba(255,255,255,.1)}
-.cb-def:hover{background:rgba(255,255,255,.15);color:#fff;box-shadow:0 0 16px rgba(255,255,255,.1)}
-.cb-led-on{background:linear-gradient(135deg,#fbbf24,#f59e0b);color:#000;border:none;box-shadow:0 0 20px rgba(251,191,36,.5);animation:ledGlow 1.5s ease infinite}
-@keyframes ledGlow{0%,100%{box-shadow:0 0 20px rgba(251,191,36,.5)}50%{box-shadow:0 0 30px rgba(251,191,36,.8)}}
-.cb.fb-ok{background:linear-gradient(135deg,var(--ok),#059669)!important;color:#fff!important;border-color:var(--ok)!important;box-shadow:0 0 20px rgba(16,185,129,.5)!important}
-.cb.fb-er{background:linear-gradient(135deg,var(--er),#dc2626)!important;color:#fff!important;border-color:var(--er)!important;box-shadow:0 0 20px rgba(239,68,68,.5)!important}
-.cb-sep{width:1px;height:32px;background:rgba(255,255,255,.1);margin:0 6px;flex-shrink:0}
-.cb-sel{appearance:none;background:rgba(255,255,255,.08);color:var(--tx);border:1px solid rgba(255,255,255,.1);border-radius:24px;padding:10px 32px 10px 14px;font-size:.75rem;font-weight:600;font-family:inherit;cursor:pointer;background-image:url("data:image/svg+xml,%3Csvg xmlns='http://www.w3.org/2000/svg' width='10' height='10' fill='%23f1f5f9'%3E%3Cpath d='M5 7L1 3h8z'/%3E%3C/svg%3E");background-repeat:no-repeat;background-position:right 12px center;transition:.2s;flex-shrink:0}
-.cb-sel:hover{background:rgba(255,255,255,.15);color:#fff}
-.cb-sel:focus{outline:none;border-color:var(--ac);box-shadow:0 0 0 3px var(--acg)}
-
-/* ===== DRAWERS ===== */
-.backdrop{position:fixed;inset:0;background:rgba(0,0,0,.5);z-index:150;opacity:0;pointer-events:none;transition:opacity .3s}
-.backdrop.show{opacity:1;pointer-events:auto}
-.drawer{position:fixed;top:var(--bar);right:0;bottom:var(--mnav);width:360px;max-width:100%;background:var(--sf);border-left:1px solid var(--bd);transform:translateX(100%);transition:transform .32s cubic-bezier(.4,0,.2,1);z-index:200;display:flex;flex-direction:column;overflow:hidden}
-.drawer.open{transform:translateX(0)}
-.dh{display:flex;align-items:center;justify-content:space-between;padding:14px 16px;border-bottom:1px solid var(--bd);flex-shrink:0}
-.dh h2{font-size:.85rem;font-weight:700;display:flex;align-items:center;gap:8px}
-.dh h2 svg{width:18px;height:18px;fill:var(--ac)}
-.db{flex:1;overflow-y:auto;padding:14px 16px}
-
-/* Form controls in drawers */
-.fg{margin-bottom:12px}
-.fg:last-child{margin-bottom:0}
-.fr{display:flex;align-items:center;gap:10px}
-.fl{font-size:.68rem;font-weight:600;color:var(--tx2);min-width:72px;flex-shrink:0;text-transform:uppercase;letter-spacing:.5px}
-.f-sel{flex:1;padding:9px 30px 9px 10px;border-radius:var(--rs);background:var(--sf2);color:var(--tx);border:1px solid var(--bd);font-size:.76rem;font-family:inherit;appearance:none;cursor:pointer;background-image:url("data:image/svg+xml,%3Csvg xmlns='http://www.w3.org/2000/svg' width='10' height='10' fill='%2394a3b8'%3E%3Cpath d='M5 7L1 3h8z'/%3E%3C/svg%3E");background-repeat:no-repeat;background-position:right 10px center;transition:.2s}
-.f-sel:focus{outline:none;border-color:var(--ac);box-shadow:0 0 0 3px var(--acg)}
-.f-in{flex:1;padding:9px 10px;border-radius:var(--rs);background:var(--sf2);color:var(--tx);border:1px solid var(--bd);font-size:.76rem;font-family:inherit;transition:.2s}
-.f-in:focus{outline:none;border-color:var(--ac);box-shadow:0 0 0 3px var(--acg)}
-.f-in::placeholder{color:var(--tx3)}
-.rw{flex:1;display:flex;align-items:center;gap:8px}
-input[type=range]{flex:1;-webkit-appearance:none;height:4px;border-radius:2px;background:var(--sf3);outline:none}
-input[type=range]::-webkit-slider-thumb{-webkit-appearance:none;width:16px;height:16px;border-radius:50%;background:var(--ac);cursor:pointer;box-shadow:0 0 6px var(--acg)}
-input[type=range]::-moz-range-thumb{width:16px;height:16px;border-radius:50%;border:none;background:var(--ac);cursor:pointer}
-.rv{min-width:24px;text-align:center;font-size:.7rem;color:var(--ac);font-weight:700;font-variant-numeric:tabular-nums}
-
-/* Section divider in drawer */
-.dsep{height:1px;background:var(--bd);margin:14px 0}
-.dsec{font-size:.62rem;font-weight:700;color:var(--tx3);text-transform:uppercase;letter-spacing:1px;margin-bottom:10px;display:flex;align-items:center;gap:6px}
-.dsec svg{width:14px;height:14px;fill:var(--tx3)}
-
-/* Toggle */
-.tg{display:flex;align-items:center;justify-content:space-between;padding:6px 0;cursor:pointer}
-.tg-label{font-size:.74rem;color:var(--tx2)}
-.tg input{display:none}
-.tg-track{width:36px;height:20px;border-radius:10px;background:var(--sf3);transition:.25s;position:relative;flex-shrink:0}
-.tg-track::after{content:'';position:absolute;top:2px;left:2px;width:16px;height:16px;border-radius:50%;background:#fff;transition:.25s;box-shadow:0 1px 3px rgba(0,0,0,.3)}
-.tg input:checked+.tg-track{background:var(--ac)}
-.tg input:checked+.tg-track::after{left:18px}
-
-/* ===== MONITOR STATS ===== */
-.sg{display:grid;grid-template-columns:1fr 1fr;gap:8px}
-.sc{padding:10px;background:var(--sf2);border-radius:var(--rs);border:1px solid var(--bd)}
-.sc-h{display:flex;align-items:center;gap:5px;margin-bottom:4px}
-.sc-h svg{width:12px;height:12px;fill:var(--tx3)}
-.sc-l{font-size:.58rem;color:var(--tx3);font-weight:600;text-transform:uppercase;letter-spacing:.5px}
-.sc-v{font-size:.88rem;font-weight:700;color:var(--ac);font-variant-numeric:tabular-nums}
-.sc-s{font-size:.56rem;color:var(--tx3);margin-top:1px}
-.prg{width:100%;height:3px;border-radius:2px;background:var(--sf3);margin-top:5px;overflow:hidden}
-.prg-b{height:100%;border-radius:2px;transition:width .6s;background:var(--ac)}
-.prg-b.wn{background:var(--wn)}
-.prg-b.cr{background:var(--er)}
-
-/* ===== WIFI ===== */
-.wsc{display:flex;align-items:center;gap:10px;padding:10px;background:var(--sf2);border-radius:var(--rs);border:1px solid var(--bd);margin-bottom:10px}
-.wsc-i{width:32px;height:32px;border-radius:var(--rs);display:flex;align-items:center;justify-content:center;flex-shrink:0}
-.wsc-i svg{width:18px;height:18px}
-.wsc-i.con{background:var(--okd)}.wsc-i.con svg{fill:var(--ok)}
-.wsc-i.dis{background:var(--sf3)}.wsc-i.dis svg{fill:var(--tx3)}
-.wsc-t{font-size:.78rem;font-weight:600}
-.wsc-d{font-size:.66rem;color:var(--tx3);margin-top:1px;overflow:hidden;text-overflow:ellipsis;white-space:nowrap}
-.ni{display:flex;align-items:center;justify-content:space-between;padding:9px 12px;background:var(--sf2);border-radius:var(--rs);margin-bottom:5px;cursor:pointer;transition:.2s;border:1px solid transparent}
-.ni:hover{border-color:var(--ac);background:#0c1d2e}
-.ni.sel{border-color:var(--ac);background:#0c2438}
-.ni-n{font-size:.78rem;font-weight:600}
-.ni-m{display:flex;align-items:center;gap:6px;font-size:.64rem;color:var(--tx3)}
-.ni-m svg{width:13px;height:13px;fill:currentColor}
-
-/* Info rows */
-.irow{display:flex;justify-content:space-between;padding:7px 10px;background:var(--sf2);border-radius:var(--rs);font-size:.72rem;margin-bottom:4px}
-.irow-l{color:var(--tx3)}
-.irow-v{font-weight:600}
-.irow-ac{color:var(--ac)}
-
-/* Buttons */
-.btn{padding:9px 14px;border-radius:var(--rs);font-size:.74rem;font-weight:600;display:inline-flex;align-items:center;justify-content:center;gap:6px;transition:.2s}
-.btn:active{transform:scale(.97)}
-.btn svg{width:14px;height:14px;fill:currentColor;flex-shrink:0}
-.btn-p{background:var(--ac);color:#fff}.btn-p:hover{background:var(--ac2);box-shadow:0 0 16px var(--acg)}
-.btn-s{background:var(--sf2);color:var(--tx);border:1px solid var(--bd)}.btn-s:hover{border-color:var(--ac);color:var(--ac)}
-.btn-d{background:var(--er);color:#fff}.btn-d:hover{background:#dc2626}
-.btn-g{background:transparent;color:var(--tx2);border:1px solid var(--bd2)}.btn-g:hover{background:var(--sf2);color:var(--tx)}
-.btn:disabled{opacity:.4;cursor:not-allowed;transform:none}
-.bg2{display:grid;gap:8px}.bg2.c2{grid-template-columns:1fr 1fr}
-
-/* Gallery Grid */
-.gal-grid{display:grid;grid-template-columns:repeat(auto-fill,minmax(120px,1fr));gap:10px;margin-bottom:12px}
-.gal-item{position:relative;aspect-ratio:1;border-radius:var(--r);overflow:hidden;background:var(--sf2);cursor:pointer;border:2px solid transparent;transition:.2s;box-shadow:0 2px 8px rgba(0,0,0,.2)}
-.gal-item:hover{border-color:var(--ac);transform:scale(1.02);box-shadow:0 4px 16px rgba(220,38,38,.3)}
-.gal-item:active{transform:scale(.98)}
-.gal-img{width:100%;height:100%;object-fit:cover;display:block;background:var(--sf3);position:absolute;top:0;left:0}
-.gal-placeholder{position:absolute;top:0;left:0;width:100%;height:100%;display:flex;align-items:center;justify-content:center;background:linear-gradient(135deg,var(--sf2),var(--sf3))}
-.gal-placeholder svg{width:40px;height:40px;fill:var(--tx2);opacity:.5}
-.gal-vid{width:100%;height:100%;display:flex;align-items:center;justify-content:center;background:linear-gradient(135deg,var(--ac),#b91c1c)}
-.gal-vid svg{width:36px;height:36px;fill:#fff;filter:drop-shadow(0 2px 4px rgba(0,0,0,.3))}
-.gal-type{position:absolute;top:6px;left:6px;background:rgba(0,0,0,.75);color:#fff;font-size:.58rem;padding:3px 8px;border-radius:12px;font-weight:700;text-transform:uppercase;letter-spacing:.5px;backdrop-filter:blur(4px)}
-.gal-type.vid{background:var(--ac)}
-.gal-sz{position:absolute;bottom:6px;right:6px;background:rgba(0,0,0,.75);color:#fff;font-size:.56rem;padding:3px 7px;border-radius:10px;backdrop-filter:blur(4px)}
-.gal-del{position:absolute;top:6px;right:6px;width:28px;height:28px;border-radius:50%;background:var(--er);display:flex;align-items:center;justify-content:center;opacity:0;transition:.2s;box-shadow:0 2px 8px rgba(239,68,68,.4)}
-.gal-item:hover .gal-del{opacity:1}
-.gal-del:hover{transform:scale(1.1);background:#dc2626}
-.gal-del svg{width:14px;height:14px;fill:#fff}
-.gal-empty{text-align:center;padding:60px 20px;color:var(--tx3);font-size:.8rem}
-.gal-empty svg{width:64px;height:64px;fill:var(--tx3);margin-bottom:14px;opacity:.4}
-.gal-count{font-size:.7rem;color:var(--tx3);margin-bottom:12px;padding:8px 12px;background:var(--sf2);border-radius:var(--rs);display:flex;align-items:center;justify-content:space-between}
-.gal-count strong{color:var(--ac)}
-
-/* Gallery Storage Card */
-.gal-storage{display:flex;align-items:center;gap:12px;padding:12px;background:var(--sf2);border-radius:var(--r);margin-bottom:14px;border:1px solid var(--bd)}
-.gal-storage-icon{width:36px;height:36px;border-radius:var(--rs);background:var(--acd);display:flex;align-items:center;justify-content:center;flex-shrink:0}
-.gal-storage-icon svg{width:20px;height:20px;fill:var(--ac)}
-.gal-storage-info{flex:1;min-width:0}
-.gal-storage-title{font-size:.72rem;font-weight:700;color:var(--tx)}
-.gal-storage-detail{font-size:.64rem;color:var(--tx3);margin-top:2px}
-.gal-storage-bar{width:80px;height:8px;background:var(--sf3);border-radius:4px;overflow:hidden;flex-shrink:0}
-.gal-storage-fill{height:100%;background:var(--ok);border-radius:4px;transition:width .3s,background .3s}
-.gal-storage-fill.warn{background:var(--wn)}
-.gal-storage-fill.crit{background:var(--er)}
-/* Mobile gallery - show delete always, smaller items */
-@media(max-width:640px){
-.gal-grid{grid-template-columns:repeat(auto-fill,minmax(100px,1fr));gap:8px}
-.gal-del{opacity:1;width:24px;height:24px;top:4px;right:4px}
-.gal-del svg{width:12px;height:12px}
-.gal-type{font-size:.52rem;padding:2px 6px;top:4px;left:4px}
-.gal-sz{font-size:.5rem;padding:2px 5px;bottom:4px;right:4px}
-}
-
-/* Gallery Preview Lightbox */
-.gal-preview{position:fixed;inset:0;z-index:600;display:flex;align-items:center;justify-content:center}
-.gal-preview-bg{position:absolute;inset:0;background:rgba(0,0,0,.9);backdrop-filter:blur(8px)}
-.gal-preview-wrap{position:relative;max-width:95%;max-height:90%;display:flex;flex-direction:column;align-items:center}
-.gal-preview-wrap img{max-width:100%;max-height:calc(90vh - 80px);object-fit:contain;border-radius:var(--r);box-shadow:0 8px 40px rgba(0,0,0,.5)}
-.gal-preview-info{margin-top:16px;text-align:center}
-.gal-preview-info span{display:block;font-size:.78rem;color:var(--tx2);margin-bottom:12px}
-.gal-preview-btns{display:flex;gap:10px;justify-content:center}
-.gal-preview-btns .btn{min-width:100px}
-.gal-preview-x{position:fixed;top:16px;right:16px;width:44px;height:44px;border-radius:50%;background:rgba(255,255,255,.1);backdrop-filter:blur(8px);display:flex;align-items:center;justify-content:center;cursor:pointer;transition:.2s}
-.gal-preview-x:hover{background:var(--er)}
-.gal-preview-x svg{width:24px;height:24px;fill:#fff}
-@media(max-width:640px){
-.gal-preview-wrap{max-width:100%;padding:10px}
-.gal-preview-btns{flex-direction:column;width:100%}
-.gal-preview-btns .btn{width:100%}
-.gal-preview-x{top:10px;right:10px;width:38px;height:38px}
-}
-.gal-preview-loading{position:absolute;top:50%;left:50%;transform:translate(-50%,-50%);display:flex;flex-direction:column;align-items:center;color:var(--tx3);font-size:.76rem;gap:12px}
-
-/* ===== MODAL ===== */
-.mov{position:fixed;inset:0;z-index:300;background:rgba(0,0,0,.7);backdrop-filter:blur(8px);display:none;align-items:center;justify-content:center;padding:16px}
-.mov.show{display:flex}
-.mo{background:var(--sf);border:1px solid var(--bd);border-radius:var(--rl);max-width:400px;width:100%;max-height:80vh;display:flex;flex-direction:column;box-shadow:0 8px 32px rgba(0,0,0,.5);animation:moIn .3s ease}
-@keyframes moIn{from{opacity:0;transform:scale(.95) translateY(8px)}to{opacity:1;transform:none}}
-.mo-h{padding:14px 16px;border-bottom:1px solid var(--bd);display:flex;align-items:center;justify-content:space-between}
-.mo-h h2{font-size:.9rem;font-weight:700;display:flex;align-items:center;gap:8px}
-.mo-h h2 svg{width:18px;height:18px;fill:var(--ac)}
-.mo-b{padding:16px;overflow-y:auto;flex:1}
-.mo-f{padding:12px 16px;border-top:1px solid var(--bd);display:flex;justify-content:flex-end}
-.about-icon{width:56px;height:56px;border-radius:14px;background:linear-gradient(135deg,var(--ac),#b91c1c);display:flex;align-items:center;justify-content:center;box-shadow:0 0 20px var(--acg)}
-.about-icon svg{width:28px;height:28px;fill:#fff}
-
-/* ===== FULLSCREEN ===== */
-.fso{display:none;position:fixed;inset:0;z-index:500;background:#000;align-items:center;justify-content:center}
-.fso.show{display:flex}
-.fso img{max-width:100%;max-height:100%;object-fit:contain}
-.fso-x{position:fixed;top:14px;right:14px;z-index:501;width:38px;height:38px;border-radius:50%;background:rgba(255,255,255,.08);backdrop-filter:blur(8px);display:flex;align-items:center;justify-content:center;cursor:pointer;transition:.2s}
-.fso-x:hover{background:var(--er)}
-.fso-x svg{width:20px;height:20px;fill:#fff}
-.fso-hud{position:fixed;top:14px;left:14px;z-index:501;display:flex;gap:8px}
-
-/* ===== MOBILE NAV ===== */
-.mnav{display:none;position:fixed;bottom:0;left:0;right:0;z-index:100;background:rgba(15,21,32,.96);backdrop-filter:blur(14px);border-top:1px solid rgba(255,255,255,.04);padding:4px 0 calc(4px + var(--safe-b))}
-.mnav-in{display:flex;justify-content:space-around;max-width:400px;margin:0 auto}
-.mn{display:flex;flex-direction:column;align-items:center;gap:2px;padding:4px 6px;border-radius:var(--rs);font-size:.52rem;font-weight:600;color:var(--tx3);transition:.2s;letter-spacing:.2px;min-width:0}
-.mn svg{width:18px;height:18px;fill:currentColor}
-.mn.active{color:var(--ac)}
-.mn:active{transform:scale(.92)}
-
-/* ===== RESPONSIVE ===== */
-@media(max-width:640px){
-:root{--bar:44px;--mnav:56px}
-.mnav{display:block}
-.bar{height:44px;padding:0 8px}
-.lt{font-size:.9rem}
-.bar-r .ib.desk{display:none}
-.drawer{top:44px;bottom:56px;width:100%}
-.cb{width:40px;height:40px}.cb svg{width:18px;height:18px}
-.cbar{height:52px;gap:6px;padding:0 12px;bottom:16px;border-radius:26px;max-width:calc(100% - 20px)}
-.cb-sel{padding:8px 26px 8px 10px;font-size:.65rem;min-width:70px}
-.cb-sep{height:24px;margin:0 4px}
-.sg{grid-template-columns:1fr 1fr}
-.hero{bottom:calc(var(--mnav) + 8px)}
-}
-@media(min-width:641px){.mnav{display:none}}
-</style>
-</head>
-<body>
-
-<!-- =============== APPBAR =============== -->
-<header class="bar">
-<div class="bar-l">
-<div class="lm"><svg viewBox="0 0 24 24"><path d="M12 4.5C7 4.5 2.73 7.61 1 12c1.73 4.39 6 7.5 11 7.5s9.27-3.11 11-7.5c-1.73-4.39-6-7.5-11-7.5zm0 12.5c-2.76 0-5-2.24-5-5s2.24-5 5-5 5 2.24 5 5-2.24 5-5 5zm0-8c-1.66 0-3 1.34-3 3s1.34 3 3 3 3-1.34 3-3-1.34-3-3-3z"/></svg></div>
-<span class="lt">TRINE<span>TRA</span></span>
-</div>
-<div class="bar-r">
-<div class="chip" id="chip"><div class="d" id="dot"></div><span id="chipTxt">Idle</span></div>
-<button class="ib desk" onclick="openDr('drSet')" title="Settings" aria-label="Settings" id="ibSet"><svg viewBox="0 0 24 24"><path d="M19.14 12.94c.04-.3.06-.61.06-.94 0-.32-.02-.64-.07-.94l2.03-1.58a.49.49 0 00.12-.61l-1.92-3.32a.49.49 0 00-.59-.22l-2.39.96c-.5-.38-1.03-.7-1.62-.94l-.36-2.54a.48.48 0 00-.48-.41h-3.84c-.24 0-.43.17-.47.41l-.36 2.54c-.59.24-1.13.56-1.62.94l-2.39-.96a.49.49 0 00-.59.22L2.74 8.87c-.12.21-.08.47.12.61l2.03 1.58c-.05.3-.07.62-.07.94s.02.64.07.94l-2.03 1.58a.49.49 0 00-.12.61l1.92 3.32c.12.22.37.29.59.22l2.39-.96c.5.38 1.03.7 1.62.94l.36 2.54c.05.24.24.41.48.41h3.84c.24 0 .44-.17.47-.41l.36-2.54c.59-.24 1.13-.57 1.62-.94l2.39.96c.22.08.47 0 .59-.22l1.92-3.32c.12-.22.07-.47-.12-.61l-2.01-1.58zM12 15.6A3.6 3.6 0 1112 8.4a3.6 3.6 0 010 7.2z"/></svg></button>
-<button class="ib desk" onclick="openDr('drMon')" title="Monitor" aria-label="Monitor" id="ibMon"><svg viewBox="0 0 24 24"><path d="M19 3H5a2 2 0 00-2 2v11a2 2 0 002 2h3l-1 1v2h10v-2l-1-1h3a2 2 0 002-2V5a2 2 0 00-2-2zm0 13H5V5h14v11z"/></svg></button>
-<button class="ib desk" onclick="openDr('drWifi')" title="WiFi" aria-label="WiFi" id="ibWifi"><svg viewBox="0 0 24 24"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg></button>
-<button class="ib desk" onclick="openDr('drGal')" title="Gallery" aria-label="Gallery" id="ibGal"><svg viewBox="0 0 24 24"><path d="M22 16V4a2 2 0 00-2-2H8a2 2 0 00-2 2v12a2 2 0 002 2h12a2 2 0 002-2zm-11-4l2.03 2.71L16 11l4 5H8l3-4zM2 6v14a2 2 0 002 2h14v-2H4V6H2z"/></svg></button>
-<button class="ib" onclick="openAbout()" title="About" aria-label="About"><svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm1 15h-2v-6h2v6zm0-8h-2V7h2v2z"/></svg></button>
-</div>
-</header>
-
-<!-- =============== HERO STREAM =============== -->
-<main class="hero" id="hero">
-<img id="stream" class="hide" alt="Live stream">
-<div class="ph" id="ph" onclick="toggleStream()">
-<div class="ph-in"><div class="ph-btn"><svg viewBox="0 0 24 24"><path d="M8 5v14l11-7z"/></svg></div><span class="ph-txt">Tap to start stream</span></div>
-</div>
-<div class="hud" id="hud">
-<div style="display:flex;gap:8px">
-<span class="bg bg-live"><svg viewBox="0 0 24 24"><circle cx="12" cy="12" r="6"/></svg>LIVE <span class="timer" id="timer">00:00</span></span>
-<span class="bg bg-rec" id="recBadge" style="display:none"><svg viewBox="0 0 24 24"><circle cx="12" cy="12" r="8"/></svg>REC <span class="timer" id="recTimer">00:00</span></span>
-</div>
-<span class="bg bg-res" id="resLbl">QVGA</span>
-</div>
-<div class="shutter" id="shutter"></div>
-<div class="spinner" id="spinner"><div class="spin-ring"></div></div>
-<div class="notify" id="notify"></div>
-
-<!-- Control bar -->
-<div class="cbar">
-<button class="cb cb-play" id="btnPS" onclick="toggleStream()" title="Start Stream"><svg viewBox="0 0 24 24" id="icoPS"><path d="M8 5v14l11-7z"/></svg></button>
-<button class="cb cb-def" id="btnRec" onclick="toggleRecording()" title="Start Recording" style="display:none"><svg viewBox="0 0 24 24" id="icoRec"><circle cx="12" cy="12" r="8"/></svg></button>
-<button class="cb cb-def" id="btnCap" onclick="capturePhoto()" title="Capture Photo"><svg viewBox="0 0 24 24"><circle cx="12" cy="12" r="3.2"/><path d="M9 2L7.17 4H4a2 2 0 00-2 2v12a2 2 0 002 2h16a2 2 0 002-2V6a2 2 0 00-2-2h-3.17L15 2H9zm3 15a5 5 0 110-10 5 5 0 010 10z"/></svg></button>
-<button class="cb cb-def" id="btnSave" onclick="saveToSD()" title="Save to SD Card"><svg viewBox="0 0 24 24"><path d="M17 3H5a2 2 0 00-2 2v14a2 2 0 002 2h14a2 2 0 002-2V7l-4-4zm-5 16a3 3 0 110-6 3 3 0 010 6zm3-10H5V5h10v4z"/></svg></button>
-<button class="cb cb-def" id="btnLED" onclick="toggleLED()" title="Flash LED"><svg viewBox="0 0 24 24"><path d="M12 2C8.13 2 5 5.13 5 9c0 2.38 1.19 4.47 3 5.74V17c0 .55.45 1 1 1h6c.55 0 1-.45 1-1v-2.26c1.81-1.27 3-3.36 3-5.74 0-3.87-3.13-7-7-7zm2 11h-1v2h-2v-2H9v-2h2V9h2v2h2v2zm-2 6h-2v1h2v-1zm0 2h-2c0 .55.45 1 1 1s1-.45 1-1z"/></svg></button>
-<div class="cb-sep"></div>
-<select class="cb-sel" id="resSel" onchange="changeRes()" title="Resolution">
-<option value="3">QQVGA</option>
-<option value="5" selected>QVGA</option>
-<option value="8">VGA</option>
-<option value="9">SVGA</option>
-<option value="10">XGA</option>
-<option value="12">SXGA</option>
-</select>
-<button class="cb cb-def" onclick="toggleFS()" title="Fullscreen"><svg viewBox="0 0 24 24"><path d="M7 14H5v5h5v-2H7v-3zm-2-4h2V7h3V5H5v5zm12 7h-3v2h5v-5h-2v3zM14 5v2h3v3h2V5h-5z"/></svg></button>
-</div>
-</main>
-
-<!-- =============== SETTINGS DRAWER =============== -->
-<div class="drawer" id="drSet">
-<div class="dh"><h2><svg viewBox="0 0 24 24"><path d="M19.14 12.94c.04-.3.06-.61.06-.94 0-.32-.02-.64-.07-.94l2.03-1.58a.49.49 0 00.12-.61l-1.92-3.32a.49.49 0 00-.59-.22l-2.39.96c-.5-.38-1.03-.7-1.62-.94l-.36-2.54a.48.48 0 00-.48-.41h-3.84c-.24 0-.43.17-.47.41l-.36 2.54c-.59.24-1.13.56-1.62.94l-2.39-.96a.49.49 0 00-.59.22L2.74 8.87c-.12.21-.08.47.12.61l2.03 1.58c-.05.3-.07.62-.07.94s.02.64.07.94l-2.03 1.58a.49.49 0 00-.12.61l1.92 3.32c.12.22.37.29.59.22l2.39-.96c.5.38 1.03.7 1.62.94l.36 2.54c.05.24.24.41.48.41h3.84c.24 0 .44-.17.47-.41l.36-2.54c.59-.24 1.13-.57 1.62-.94l2.39.96c.22.08.47 0 .59-.22l1.92-3.32c.12-.22.07-.47-.12-.61l-2.01-1.58zM12 15.6A3.6 3.6 0 1112 8.4a3.6 3.6 0 010 7.2z"/></svg>Camera Settings</h2><button class="ib" onclick="closeDr('drSet')"><svg viewBox="0 0 24 24" fill="currentColor"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button></div>
-<div class="db">
-<div class="dsec"><svg viewBox="0 0 24 24"><path d="M3 17v2h6v-2H3zM3 5v2h10V5H3zm10 16v-2h8v-2h-8v-2h-2v6h2zM7 9v2H3v2h4v2h2V9H7zm14 4v-2H11v2h10zm-6-4h2V7h4V5h-4V3h-2v6z"/></svg>Image Adjustments</div>
-<div class="fg"><div class="fr"><span class="fl">Quality</span><div class="rw"><input type="range" id="sQuality" min="4" max="63" value="12" oninput="rv('sQuality')"><span class="rv" id="vQuality">12</span></div></div></div>
-<div class="fg"><div class="fr"><span class="fl">Brightness</span><div class="rw"><input type="range" id="sBright" min="-2" max="2" value="0" oninput="rv('sBright')"><span class="rv" id="vBright">0</span></div></div></div>
-<div class="fg"><div class="fr"><span class="fl">Contrast</span><div class="rw"><input type="range" id="sContrast" min="-2" max="2" value="0" oninput="rv('sContrast')"><span class="rv" id="vContrast">0</span></div></div></div>
-<div class="fg"><div class="fr"><span class="fl">Saturation</span><div class="rw"><input type="range" id="sSat" min="-2" max="2" value="0" oninput="rv('sSat')"><span class="rv" id="vSat">0</span></div></div></div>
-<div class="dsep"></div>
-<div class="dsec"><svg viewBox="0 0 24 24"><path d="M7 14a3 3 0 100-6 3 3 0 000 6zm6 7a3 3 0 100-6 3 3 0 000 6zm4-14a3 3 0 100-6 3 3 0 000 6z"/></svg>Toggles</div>
-<label class="tg" onclick="tgSet('awb',this)"><span class="tg-label">Auto White Balance</span><input type="checkbox" checked><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('agc',this)"><span class="tg-label">Auto Gain Control</span><input type="checkbox" checked><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('aec',this)"><span class="tg-label">Auto Exposure</span><input type="checkbox" checked><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('hmirror',this)"><span class="tg-label">Horizontal Mirror</span><input type="checkbox"><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('vflip',this)"><span class="tg-label">Vertical Flip</span><input type="checkbox"><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('bpc',this)"><span class="tg-label">Black Pixel Correction</span><input type="checkbox"><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('wpc',this)"><span class="tg-label">White Pixel Correction</span><input type="checkbox" checked><span class="tg-track"></span></label>
-<label class="tg" onclick="tgSet('lenc',this)"><span class="tg-label">Lens Correction</span><input type="checkbox" checked><span class="tg-track"></span></label>
-<div class="dsep"></div>
-<div class="dsec"><svg viewBox="0 0 24 24"><path d="M2 6H0v5h.01L0 20a2 2 0 002 2h18v-2H2V6zm20-2h-8l-2-2H6a2 2 0 00-2 2v10a2 2 0 002 2h16a2 2 0 002-2V6a2 2 0 00-2-2zM7 15l4.5-6 3.5 4.51 2.5-3.01L21 15H7z"/></svg>Effects &amp; White Balance</div>
-<div class="fg"><div class="fr"><span class="fl">Effect</span><select class="f-sel" id="selFx" onchange="chgFx()"><option value="0" selected>None</option><option value="1">Negative</option><option value="2">Grayscale</option><option value="3">Red Tint</option><option value="4">Green Tint</option><option value="5">Blue Tint</option><option value="6">Sepia</option></select></div></div>
-<div class="fg"><div class="fr"><span class="fl">WB Mode</span><select class="f-sel" id="selWB" onchange="chgWB()"><option value="0" selected>Auto</option><option value="1">Sunny</option><option value="2">Cloudy</option><option value="3">Office</option><option value="4">Home</option></select></div></div>
-</div>
-</div>
-
-<!-- =============== MONITOR DRAWER =============== -->
-<div class="drawer" id="drMon">
-<div class="dh"><h2><svg viewBox="0 0 24 24"><path d="M19 3H5a2 2 0 00-2 2v11a2 2 0 002 2h3l-1 1v2h10v-2l-1-1h3a2 2 0 002-2V5a2 2 0 00-2-2zm0 13H5V5h14v11z"/></svg>System Monitor</h2><button class="ib" onclick="closeDr('drMon')"><svg viewBox="0 0 24 24" fill="currentColor"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button></div>
-<div class="db">
-<div class="sg">
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M11.99 2C6.47 2 2 6.48 2 12s4.47 10 9.99 10C17.52 22 22 17.52 22 12S17.52 2 11.99 2zM12 20a8 8 0 110-16 8 8 0 010 16zm.5-13H11v6l5.25 3.15.75-1.23-4.5-2.67z"/></svg><span class="sc-l">Uptime</span></div><div class="sc-v" id="mUp">--</div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M15 13V5a3 3 0 00-6 0v8a5 5 0 103.54 7.54A5 5 0 0015 13zM11 5a1 1 0 012 0h-1v1h1v2h-1v1h1v2h-2V5z"/></svg><span class="sc-l">Temp</span></div><div class="sc-v" id="mTemp">--</div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M17 10.5V7a1 1 0 00-1-1H4a1 1 0 00-1 1v10a1 1 0 001 1h12a1 1 0 001-1v-3.5l4 4v-11l-4 4z"/></svg><span class="sc-l">FPS</span></div><div class="sc-v" id="mFPS">--</div><div class="sc-s" id="mFrames">0 frames</div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg><span class="sc-l">Signal</span></div><div class="sc-v" id="mSig">--</div><div class="sc-s" id="mSigQ">--</div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M16 11a3 3 0 100-6 3 3 0 000 6zm-8 0a3 3 0 100-6 3 3 0 000 6zm0 2c-2.33 0-7 1.17-7 3.5V19h14v-2.5c0-2.33-4.67-3.5-7-3.5zm8 0l-.97.05A4.22 4.22 0 0117 16.5V19h6v-2.5c0-2.33-4.67-3.5-7-3.5z"/></svg><span class="sc-l">Clients</span></div><div class="sc-v" id="mCli">--</div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M2 20h20v-4H2v4zm2-3h2v2H4v-2zM2 4v4h20V4H2zm4 3H4V5h2v2zm-4 7h20v-4H2v4zm2-3h2v2H4v-2z"/></svg><span class="sc-l">Heap</span></div><div class="sc-v" id="mHeap">--</div><div class="prg"><div class="prg-b" id="pHeap" style="width:0"></div></div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M19 3H5a2 2 0 00-2 2v14a2 2 0 002 2h14a2 2 0 002-2V5a2 2 0 00-2-2zm-7 14a3 3 0 110-6 3 3 0 010 6zm3-10H5V5h10v2z"/></svg><span class="sc-l">PSRAM</span></div><div class="sc-v" id="mPSRAM">--</div><div class="prg"><div class="prg-b" id="pPSRAM" style="width:0"></div></div></div>
-<div class="sc"><div class="sc-h"><svg viewBox="0 0 24 24"><path d="M17 3H5a2 2 0 00-2 2v14a2 2 0 002 2h14a2 2 0 002-2V7l-4-4zm-5 16a3 3 0 110-6 3 3 0 010 6zm3-10H5V5h10v4z"/></svg><span class="sc-l">SD Card</span></div><div class="sc-v" id="mSD">--</div><div class="sc-s" id="mSDSize">--</div><div class="prg"><div class="prg-b" id="pSD" style="width:0"></div></div></div>
-</div>
-<div style="text-align:center;margin-top:12px"><button class="btn btn-s" onclick="getStats()"><svg viewBox="0 0 24 24"><path d="M17.65 6.35A7.96 7.96 0 0012 4a8 8 0 107.73 10h-2.08A6 6 0 1112 6c1.66 0 3.14.69 4.22 1.78L13 11h7V4l-2.35 2.35z"/></svg>Refresh</button></div>
-</div>
-</div>
-
-<!-- =============== WIFI DRAWER =============== -->
-<div class="drawer" id="drWifi">
-<div class="dh"><h2><svg viewBox="0 0 24 24"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg>WiFi</h2><button class="ib" onclick="closeDr('drWifi')"><svg viewBox="0 0 24 24" fill="currentColor"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button></div>
-<div class="db">
-<div class="wsc" id="wifiCard">
-<div class="wsc-i dis" id="wIcon"><svg viewBox="0 0 24 24"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg></div>
-<div style="flex:1;min-width:0"><div class="wsc-t" id="wTitle">Checking...</div><div class="wsc-d" id="wDetail">Getting status</div></div>
-</div>
-<div class="bg2 c2" style="margin-bottom:14px">
-<button class="btn btn-p" id="btnScan" onclick="scanNets()"><svg viewBox="0 0 24 24"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg>Scan &amp; Connect</button>
-<button class="btn btn-d" onclick="resetWifi()"><svg viewBox="0 0 24 24"><path d="M6 19a2 2 0 002 2h8a2 2 0 002-2V7H6v12zM19 4h-3.5l-1-1h-5l-1 1H5v2h14V4z"/></svg>Reset WiFi</button>
-</div>
-<div id="netArea"></div>
-<div id="connForm" style="display:none;margin-top:12px;padding-top:12px;border-top:1px solid var(--bd)">
-<div style="font-size:.78rem;margin-bottom:8px"><strong>Network:</strong> <span id="selSSID" style="color:var(--ac)"></span></div>
-<input type="password" class="f-in" id="wPwd" placeholder="Enter password" style="width:100%;margin-bottom:8px">
-<div class="bg2 c2">
-<button class="btn btn-p" onclick="doConnect()"><svg viewBox="0 0 24 24"><path d="M3.9 12A3.1 3.1 0 017 8.9h4V7H7a5 5 0 000 10h4v-1.9H7A3.1 3.1 0 013.9 12zM8 13h8v-2H8v2zm9-6h-4v1.9h4a3.1 3.1 0 010 6.2h-4V17h4a5 5 0 000-10z"/></svg>Connect</button>
-<button class="btn btn-g" onclick="cancelConn()">Cancel</button>
-</div>
-</div>
-<div class="dsep"></div>
-<div class="dsec"><svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm1 15h-2v-2h2v2zm0-4h-2V7h2v6z"/></svg>Access Point Info</div>
-<div class="irow"><span class="irow-l">AP Network</span><span class="irow-v">Trinetra</span></div>
-<div class="irow"><span class="irow-l">AP Password</span><span class="irow-v">88888888</span></div>
-<div class="irow"><span class="irow-l">AP Address</span><span class="irow-v irow-ac">1.2.3.4</span></div>
-<div class="irow"><span class="irow-l">mDNS</span><span class="irow-v irow-ac">trinetra.local</span></div>
-<div class="irow"><span class="irow-l">Stream Port</span><span class="irow-v">81</span></div>
-</div>
-</div>
-
-<!-- =============== GALLERY DRAWER =============== -->
-<div class="drawer" id="drGal">
-<div class="dh"><h2><svg viewBox="0 0 24 24"><path d="M22 16V4a2 2 0 00-2-2H8a2 2 0 00-2 2v12a2 2 0 002 2h12a2 2 0 002-2zm-11-4l2.03 2.71L16 11l4 5H8l3-4zM2 6v14a2 2 0 002 2h14v-2H4V6H2z"/></svg>Gallery</h2><button class="ib" onclick="closeDr('drGal')"><svg viewBox="0 0 24 24" fill="currentColor"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button></div>
-<div class="db">
-<!-- SD Card Storage Info -->
-<div class="gal-storage" id="galStorage">
-<div class="gal-storage-icon"><svg viewBox="0 0 24 24"><path d="M18 2h-8L4.02 8 4 20a2 2 0 002 2h12a2 2 0 002-2V4a2 2 0 00-2-2zm-6 6H8V4h4v4z"/></svg></div>
-<div class="gal-storage-info">
-<div class="gal-storage-title">SD Card</div>
-<div class="gal-storage-detail" id="galStorageDetail">Loading...</div>
-</div>
-<div class="gal-storage-bar"><div class="gal-storage-fill" id="galStorageFill"></div></div>
-</div>
-<div class="bg2 c2" style="margin-bottom:14px">
-<button class="btn btn-p" onclick="loadGallery()"><svg viewBox="0 0 24 24"><path d="M17.65 6.35A7.958 7.958 0 0012 4c-4.42 0-7.99 3.58-7.99 8s3.57 8 7.99 8c3.73 0 6.84-2.55 7.73-6h-2.08A5.99 5.99 0 0112 18c-3.31 0-6-2.69-6-6s2.69-6 6-6c1.66 0 3.14.69 4.22 1.78L13 11h7V4l-2.35 2.35z"/></svg>Refresh</button>
-<button class="btn btn-d" onclick="deleteAllFiles()"><svg viewBox="0 0 24 24"><path d="M6 19a2 2 0 002 2h8a2 2 0 002-2V7H6v12zM19 4h-3.5l-1-1h-5l-1 1H5v2h14V4z"/></svg>Delete All</button>
-</div>
-<div id="galArea" style="min-height:200px">
-<div class="gal-empty">
-<svg viewBox="0 0 24 24"><path d="M22 16V4a2 2 0 00-2-2H8a2 2 0 00-2 2v12a2 2 0 002 2h12a2 2 0 002-2zm-11-4l2.03 2.71L16 11l4 5H8l3-4zM2 6v14a2 2 0 002 2h14v-2H4V6H2z"/></svg>
-<div>Loading gallery...</div>
-</div>
-</div>
-</div>
-</div>
-
-<!-- =============== DRAWER BACKDROP =============== -->
-<div class="backdrop" id="bk" onclick="closeAll()"></div>
-
-<!-- =============== FULLSCREEN =============== -->
-<div class="fso" id="fso">
-<div class="fso-hud"><span class="bg bg-live"><svg viewBox="0 0 24 24"><circle cx="12" cy="12" r="6"/></svg>LIVE</span><span class="bg bg-res" id="fsRes">QVGA</span></div>
-<img id="fsImg" alt="Fullscreen">
-<button class="fso-x" onclick="exitFS()"><svg viewBox="0 0 24 24"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button>
-</div>
-
-<!-- =============== ABOUT MODAL =============== -->
-<div class="mov" id="aboutOv" onclick="if(event.target===this)closeAbout()">
-<div class="mo">
-<div class="mo-h"><h2><svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm1 15h-2v-6h2v6zm0-8h-2V7h2v2z"/></svg>About</h2><button class="ib" onclick="closeAbout()"><svg viewBox="0 0 24 24" fill="currentColor"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button></div>
-<div class="mo-b" style="text-align:center">
-<div style="display:flex;flex-direction:column;align-items:center;gap:10px;padding:10px 0">
-<div class="about-icon"><svg viewBox="0 0 24 24"><path d="M12 4.5C7 4.5 2.73 7.61 1 12c1.73 4.39 6 7.5 11 7.5s9.27-3.11 11-7.5c-1.73-4.39-6-7.5-11-7.5zm0 12.5c-2.76 0-5-2.24-5-5s2.24-5 5-5 5 2.24 5 5-2.24 5-5 5zm0-8c-1.66 0-3 1.34-3 3s1.34 3 3 3 3-1.34 3-3-1.34-3-3-3z"/></svg></div>
-<div style="font-size:1.1rem;font-weight:700">TRINETRA</div>
-<span style="font-size:.65rem;color:var(--tx3);background:var(--sf2);padding:2px 10px;border-radius:10px">v3.1</span>
-</div>
-<p style="font-size:.76rem;color:var(--tx2);margin:12px 0;line-height:1.6">Professional ESP32-CAM surveillance with real-time MJPEG streaming, video recording to SD card, web-based WiFi management, and comprehensive storage monitoring. "Trinetra" means three eyes in Sanskrit.</p>
-<div style="text-align:left">
-<div class="irow"><span class="irow-l">Platform</span><span class="irow-v">ESP32-CAM AI-Thinker</span></div>
-<div class="irow"><span class="irow-l">Camera</span><span class="irow-v">OV2640</span></div>
-<div class="irow"><span class="irow-l">WiFi</span><span class="irow-v">STA + AP</span></div>
-</div>
-<div style="margin-top:16px;padding-top:14px;border-top:1px solid var(--bd);text-align:center">
-<div style="font-size:.64rem;color:var(--tx3);text-transform:uppercase;letter-spacing:.8px;margin-bottom:5px">Developed by</div>
-<div style="font-size:.82rem;font-weight:700;color:var(--ac)">Sakshyam Bastakoti</div>
-<div style="font-size:.62rem;color:var(--tx3);margin-top:3px">Embedded Systems Engineer</div>
-</div>
-</div>
-<div class="mo-f"><button class="btn btn-s" onclick="closeAbout()">Close</button></div>
-</div>
-</div>
-
-<!-- =============== MOBILE NAV =============== -->
-<nav class="mnav">
-<div class="mnav-in">
-<button class="mn active" onclick="goStream()" id="mn0"><svg viewBox="0 0 24 24"><path d="M17 10.5V7a1 1 0 00-1-1H4a1 1 0 00-1 1v10a1 1 0 001 1h12a1 1 0 001-1v-3.5l4 4v-11l-4 4z"/></svg>Stream</button>
-<button class="mn" onclick="openDr('drSet')" id="mn1"><svg viewBox="0 0 24 24"><path d="M19.14 12.94c.04-.3.06-.61.06-.94 0-.32-.02-.64-.07-.94l2.03-1.58a.49.49 0 00.12-.61l-1.92-3.32a.49.49 0 00-.59-.22l-2.39.96c-.5-.38-1.03-.7-1.62-.94l-.36-2.54a.48.48 0 00-.48-.41h-3.84c-.24 0-.43.17-.47.41l-.36 2.54c-.59.24-1.13.56-1.62.94l-2.39-.96a.49.49 0 00-.59.22L2.74 8.87c-.12.21-.08.47.12.61l2.03 1.58c-.05.3-.07.62-.07.94s.02.64.07.94l-2.03 1.58a.49.49 0 00-.12.61l1.92 3.32c.12.22.37.29.59.22l2.39-.96c.5.38 1.03.7 1.62.94l.36 2.54c.05.24.24.41.48.41h3.84c.24 0 .44-.17.47-.41l.36-2.54c.59-.24 1.13-.57 1.62-.94l2.39.96c.22.08.47 0 .59-.22l1.92-3.32c.12-.22.07-.47-.12-.61l-2.01-1.58zM12 15.6A3.6 3.6 0 1112 8.4a3.6 3.6 0 010 7.2z"/></svg>Settings</button>
-<button class="mn" onclick="openDr('drMon')" id="mn2"><svg viewBox="0 0 24 24"><path d="M19 3H5a2 2 0 00-2 2v11a2 2 0 002 2h3l-1 1v2h10v-2l-1-1h3a2 2 0 002-2V5a2 2 0 00-2-2zm0 13H5V5h14v11z"/></svg>Monitor</button>
-<button class="mn" onclick="openDr('drWifi')" id="mn3"><svg viewBox="0 0 24 24"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg>WiFi</button>
-<button class="mn" onclick="openDr('drGal')" id="mn4"><svg viewBox="0 0 24 24"><path d="M22 16V4a2 2 0 00-2-2H8a2 2 0 00-2 2v12a2 2 0 002 2h12a2 2 0 002-2zm-11-4l2.03 2.71L16 11l4 5H8l3-4zM2 6v14a2 2 0 002 2h14v-2H4V6H2z"/></svg>Gallery</button>
-</div>
-</nav>
-
-<script>
-/* ===== State ===== */
-var G={
-streaming:false,ledOn:false,recording:false,
-base:location.origin,
-sUrl:location.protocol+'//'+location.hostname+':81/stream',
-resN:{'3':'QQVGA','5':'QVGA','8':'VGA','9':'SVGA','10':'XGA','12':'SXGA'},
-tStart:0,tInt:null,sInt:null,selNet:null,openDrId:null,
-recStart:0,recInt:null
+#define INDEX_HTML_ETAG "\"8dc4ffbc331a9b7d\""
+
+const size_t index_html_gz_len = 18690;
+const unsigned char index_html_gz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xe9, 0x76, 0xdb, 0x46,
+  0xd2, 0xe8, 0x7f, 0x3d, 0x05, 0xa2, 0x7c, 0x31, 0xc4, 0x11, 0x01, 0x13, 0xe0, 0x22, 0x2e, 0xa1,
+  0x7c, 0x65, 0x59, 0x5e, 0x66, 0x64, 0x5b, 0x63, 0x29, 0xce, 0xf7, 0x1d, 0x8f, 0x4f, 0x0e, 0x48,
+  0x80, 0x24, 0x22, 0x10, 0x60, 0x00, 0x90, 0xb2, 0x4c, 0xeb, 0x9c, 0xfb, 0x2c, 0xf7, 0xd1, 0xee,
+  0x93, 0xdc, 0xaa, 0xea, 0x6e, 0xa0, 0xb1, 0x91, 0x94, 0x62, 0x67, 0x26, 0x73, 0x27, 0x8b, 0x88,
+  0xa5, 0x97, 0xea, 0xea, 0xea, 0xda, 0xba, 0xba, 0xf0, 0xe3, 0x77, 0xcf, 0xde, 0x9e, 0x5e, 0xfd,
+  0xcf, 0xc5, 0x99, 0x32, 0x8b, 0xe7, 0xde, 0xf1, 0xde, 0x8f, 0xf8, 0xa3, 0x78, 0x96, 0x3f, 0x1d,
+  0xee, 0x3b, 0xfe, 0x3e, 0x3e, 0x70, 0x2c, 0x1b, 0x7e, 0xe6, 0x4e, 0x6c, 0x29, 0xe3, 0x99, 0x15,
+  0x46, 0x4e, 0x3c, 0xdc, 0xff, 0xe9, 0xea, 0xb9, 0xd6, 0xdd, 0x17, 0x8f, 0x7d, 0x6b, 0xee, 0x0c,
+  0xf7, 0x57, 0xae, 0x73, 0xb3, 0x08, 0xc2, 0x78, 0x5f, 0x19, 0x07, 0x7e, 0xec, 0xf8, 0x50, 0xec,
+  0xc6, 0xb5, 0xe3, 0xd9, 0xd0, 0x76, 0x56, 0xee, 0xd8, 0xd1, 0xe8, 0xa6, 0xee, 0xfa, 0x6e, 0xec,
+  0x5a, 0x9e, 0x16, 0x8d, 0x2d, 0xcf, 0x19, 0x1a, 0xf5, 0xb9, 0xf5, 0xc9, 0x9d, 0x2f, 0xe7, 0xfc,
+  0xbe, 0x9d, 0x6b, 0x33, 0x9e, 0x39, 0x73, 0x47, 0x1b, 0x07, 0x5e, 0x10, 0x4a, 0xcd, 0x7e, 0xdf,
+  0xe8, 0x34, 0x2c, 0xc3, 0xc0, 0xb2, 0xb1, 0x1b, 0x7b, 0xce, 0xf1, 0x55, 0xe8, 0xfa, 0x4e, 0x1c,
+  0x5a, 0x3f, 0x3e, 0x66, 0xf7, 0x7b, 0x3f, 0x46, 0xf1, 0x2d, 0xfe, 0xfe, 0xa5, 0xfe, 0x97, 0x7e,
+  0x7f, 0xe4, 0x4c, 0x82, 0xd0, 0xc1, 0x2b, 0x6b, 0x12, 0x3b, 0xe1, 0x7a, 0x6e, 0x85, 0x53, 0xd7,
+  0xef, 0x37, 0x06, 0x0b, 0xcb, 0xb6, 0x5d, 0x7f, 0x0a, 0x57, 0xa3, 0xe0, 0x93, 0x16, 0xb9, 0x9f,
+  0xf1, 0x66, 0x14, 0x84, 0xb6, 0x13, 0x6a, 0xf0, 0xe4, 0x6e, 0xaf, 0x1f, 0x06, 0x41, 0xbc, 0xde,
+  0xd3, 0xb4, 0xd1, 0xb4, 0xcf, 0x3b, 0x1d, 0x68, 0x5a, 0x34, 0x81, 0x9b, 0x89, 0xd1, 0x36, 0x1b,
+  0x74, 0x63, 0xf6, 0xbf, 0x37, 0x2c, 0xd3, 0x6c, 0x36, 0xe9, 0xae, 0xd9, 0xff, 0xde, 0xb4, 0x9a,
+  0xed, 0x56, 0x77, 0x00, 0xd5, 0xac, 0x71, 0xff, 0x7b, 0x7b, 0x6c, 0x76, 0xcc, 0xce, 0x00, 0x6f,
+  0xa0, 0xe4, 0xa4, 0x7b, 0x64, 0x1c, 0x19, 0x74, 0x37, 0xed, 0x87, 0xd3, 0x91, 0x75, 0x60, 0x9a,
+  0x8d, 0x7a, 0xb3, 0x8b, 0xff, 0xe9, 0xa6, 0x59, 0xa3, 0x37, 0x76, 0xe1, 0x4d, 0xa3, 0x5b, 0xc3,
+  0xf6, 0x82, 0x6b, 0xe8, 0xab, 0x31, 0xea, 0x75, 0xb1, 0x85, 0xe0, 0x9a, 0x97, 0x33, 0x3a, 0x75,
+  0xa3, 0xdb, 0xae, 0x1b, 0x66, 0xaf, 0xae, 0x1b, 0x26, 0x15, 0x74, 0xc2, 0xfe, 0xf7, 0xce, 0xa4,
+  0x05, 0xff, 0x0c, 0xf0, 0x46, 0x34, 0xd8, 0xec, 0xd5, 0x3b, 0x5d, 0xfc, 0x4f, 0x94, 0xbb, 0xf1,
+  0x01, 0xa4, 0x76, 0xcf, 0x69, 0x8c, 0x06, 0x78, 0x23, 0xca, 0xb5, 0xa0, 0xb5, 0x76, 0xb7, 0x6e,
+  0x18, 0x49, 0xc1, 0xf8, 0x13, 0x14, 0x34, 0x26, 0xed, 0x49, 0x6f, 0x80, 0x37, 0x30, 0x92, 0x5e,
+  0xcb, 0x6a, 0x8e, 0xba, 0x74, 0x07, 0x63, 0xee, 0xb4, 0x8e, 0x5a, 0xdd, 0x11, 0x96, 0x1c, 0xd9,
+  0x12, 0x3e, 0x46, 0xb6, 0x29, 0xe3, 0x23, 0xec, 0x1b, 0x8d, 0xc5, 0x27, 0x78, 0x1e, 0x46, 0xfd,
+  0x0e, 0xbb, 0xf0, 0xfa, 0x46, 0x0b, 0xae, 0xe0, 0xe5, 0x04, 0xa6, 0xb7, 0x1f, 0xdd, 0x46, 0xb1,
+  0x33, 0xd7, 0x96, 0x6e, 0x5d, 0xb3, 0x16, 0x0b, 0xcf, 0xd1, 0xd8, 0x83, 0xba, 0x7a, 0xe9, 0x4c,
+  0x03, 0x47, 0xf9, 0xe9, 0x95, 0x5a, 0x7f, 0x17, 0x8c, 0x82, 0x38, 0xa8, 0x47, 0x96, 0x1f, 0x69,
+  0x91, 0x13, 0xba, 0x13, 0xac, 0x1c, 0x59, 0x13, 0x47, 0x1b, 0xf5, 0x1d, 0x7f, 0x75, 0x40, 0x97,
+  0x56, 0xe8, 0x58, 0x9a, 0xeb, 0x03, 0xb1, 0xc2, 0x4c, 0xc6, 0x71, 0x30, 0xaf, 0x43, 0xc7, 0x34,
+  0x92, 0x91, 0x15, 0xf6, 0x5b, 0x5d, 0xea, 0x7c, 0x8c, 0xd7, 0x6d, 0x93, 0xae, 0xe7, 0xbe, 0xb5,
+  0xea, 0x23, 0x70, 0x7b, 0x77, 0x7b, 0xb8, 0x06, 0xd6, 0x08, 0x0e, 0xd2, 0x84, 0xd3, 0x37, 0x10,
+  0xd4, 0x68, 0x1c, 0x06, 0x9e, 0xa7, 0x8d, 0x9c, 0x99, 0xb5, 0x72, 0x83, 0xb0, 0x1f, 0xcd, 0x81,
+  0x34, 0x66, 0x77, 0x7b, 0xa3, 0xc0, 0xbe, 0x65, 0x65, 0x27, 0xd6, 0xdc, 0xf5, 0x6e, 0xfb, 0x2b,
+  0x2b, 0x3c, 0x60, 0x83, 0xa9, 0x0d, 0x46, 0xd6, 0xf8, 0x7a, 0x1a, 0x06, 0x4b, 0x40, 0x2c, 0x7b,
+  0x3c, 0x9a, 0xd6, 0x06, 0x44, 0xcd, 0xfc, 0x3e, 0x06, 0x98, 0xe6, 0xae, 0xaf, 0xcd, 0x1c, 0x77,
+  0x3a, 0x8b, 0x01, 0x3b, 0x8d, 0xd5, 0x2c, 0xf7, 0xc0, 0x86, 0x27, 0xc1, 0xca, 0x09, 0x27, 0x5e,
+  0x70, 0xd3, 0x9f, 0xb9, 0xb6, 0xed, 0xf8, 0x03, 0xed, 0xc6, 0x19, 0x5d, 0xbb, 0xb1, 0xc6, 0x60,
+  0x24, 0x48, 0x90, 0x74, 0x2d, 0x1f, 0x97, 0x96, 0x6b, 0x45, 0x8e, 0x3d, 0xf0, 0x60, 0x45, 0x24,
+  0xad, 0xe8, 0x6d, 0x00, 0x74, 0x09, 0x68, 0xf0, 0x33, 0xa0, 0xba, 0xfe, 0x0c, 0xf0, 0x17, 0x0f,
+  0xc6, 0xcb, 0x30, 0x02, 0x90, 0x16, 0x81, 0x0b, 0x0b, 0x2c, 0x1c, 0xb0, 0x15, 0xd0, 0xf7, 0x03,
+  0xdf, 0x91, 0x47, 0x40, 0xf7, 0x0c, 0x78, 0x5e, 0x11, 0x16, 0xc8, 0x24, 0x18, 0x2f, 0x23, 0x6d,
+  0xe5, 0x46, 0xee, 0xc8, 0x73, 0xd6, 0xc1, 0x32, 0xc6, 0x7e, 0xfb, 0x80, 0x52, 0x25, 0x0a, 0x3c,
+  0xd7, 0x56, 0xd8, 0x30, 0xad, 0x71, 0x6d, 0xc0, 0xdf, 0x69, 0xc1, 0x64, 0x02, 0xb3, 0x82, 0x45,
+  0x78, 0x47, 0x5a, 0x68, 0xd9, 0xee, 0x32, 0xea, 0x03, 0x19, 0x40, 0x83, 0x7d, 0x31, 0x36, 0x86,
+  0x70, 0x98, 0xa1, 0x35, 0x31, 0x8e, 0x7e, 0xbb, 0xe2, 0xb5, 0x06, 0xeb, 0x7e, 0x7c, 0xbd, 0x2e,
+  0xa0, 0x3a, 0x9a, 0xd4, 0x2a, 0xca, 0xcf, 0x96, 0xf3, 0x51, 0x59, 0xf9, 0x66, 0x2d, 0x07, 0x51,
+  0x13, 0xbb, 0xdc, 0x7b, 0xfc, 0x17, 0x65, 0x88, 0xff, 0x28, 0x27, 0x17, 0x17, 0x4f, 0x4f, 0xde,
+  0xf1, 0x9b, 0xbf, 0x3c, 0xde, 0xd3, 0x11, 0xb8, 0x45, 0x10, 0x01, 0x43, 0x0b, 0xfc, 0xfe, 0xc4,
+  0xfd, 0x04, 0x68, 0x8f, 0x83, 0x05, 0xb0, 0x13, 0xcf, 0x99, 0xc4, 0xf0, 0x13, 0x12, 0xf6, 0x1b,
+  0x83, 0xcf, 0x40, 0x89, 0xb6, 0xf3, 0x09, 0x67, 0x73, 0xc0, 0xa7, 0x84, 0x93, 0x83, 0x15, 0xd6,
+  0x06, 0xb6, 0x1b, 0x2d, 0x3c, 0xeb, 0xb6, 0x3f, 0xf1, 0x9c, 0x4f, 0x03, 0x98, 0xbe, 0xa9, 0xaf,
+  0xb9, 0x40, 0xf2, 0x51, 0x7f, 0xec, 0xd0, 0x74, 0xfc, 0xba, 0x8c, 0x62, 0x77, 0x72, 0xab, 0x71,
+  0xf6, 0xd7, 0x8f, 0x16, 0x16, 0x70, 0xd3, 0x91, 0x13, 0xdf, 0x38, 0x40, 0x0a, 0x09, 0x0f, 0x53,
+  0x0c, 0x42, 0x69, 0x3a, 0x2c, 0x5a, 0xca, 0xc0, 0x1a, 0x1a, 0x75, 0xe3, 0xa8, 0xae, 0x77, 0xbb,
+  0x8c, 0x1c, 0xed, 0x30, 0x58, 0x68, 0x13, 0xd7, 0x83, 0x96, 0xfb, 0x23, 0x6f, 0x19, 0x1e, 0x98,
+  0xb4, 0x30, 0x04, 0x9a, 0x36, 0x14, 0x49, 0x18, 0x23, 0x2e, 0xa7, 0xbe, 0x91, 0x4c, 0x31, 0x63,
+  0x19, 0xed, 0x76, 0x5d, 0xfc, 0xaf, 0x37, 0x5a, 0x80, 0x7a, 0xc4, 0x8e, 0xe6, 0xad, 0xb7, 0x8d,
+  0x6e, 0x6a, 0x2d, 0x88, 0x29, 0xf0, 0x0a, 0xe1, 0x4e, 0x15, 0x4c, 0x2a, 0xef, 0xcd, 0x39, 0x69,
+  0x34, 0x71, 0xdd, 0x72, 0xc4, 0xd2, 0x75, 0x76, 0x1a, 0xbb, 0x59, 0xbc, 0x20, 0x15, 0x42, 0x4f,
+  0x53, 0x7c, 0x0b, 0x4d, 0x1e, 0x18, 0xcd, 0xb6, 0xed, 0x4c, 0xeb, 0x09, 0xa5, 0xd6, 0xbf, 0x1f,
+  0xf5, 0x8c, 0xb1, 0x31, 0xbe, 0xff, 0xcc, 0xf0, 0xc7, 0x24, 0x4c, 0x66, 0x96, 0x0d, 0xeb, 0xb5,
+  0xa1, 0xc0, 0xbc, 0x00, 0x61, 0x27, 0xeb, 0x00, 0xd6, 0x3f, 0xb6, 0x06, 0xef, 0x41, 0x64, 0x5d,
+  0xf7, 0x1b, 0x34, 0x0c, 0x25, 0x5a, 0x4d, 0xf9, 0x50, 0x88, 0xd7, 0x88, 0x65, 0x8b, 0xd7, 0x30,
+  0x0f, 0x1e, 0xb0, 0xde, 0xc9, 0x04, 0x4b, 0xc6, 0x32, 0x57, 0x0a, 0x9d, 0xf9, 0x80, 0x6e, 0x6f,
+  0x58, 0xf1, 0xa3, 0x06, 0x12, 0x5e, 0x0c, 0x10, 0x68, 0x48, 0x22, 0x48, 0x14, 0xb0, 0xf0, 0x01,
+  0x53, 0x50, 0x4f, 0x81, 0x27, 0xfe, 0x5a, 0xe6, 0x3c, 0x30, 0x50, 0x68, 0x71, 0x3c, 0x73, 0x17,
+  0x3b, 0x61, 0x1c, 0xda, 0x49, 0x48, 0x0d, 0x96, 0x85, 0xd2, 0x2d, 0x60, 0x99, 0xd8, 0x78, 0xc9,
+  0xaa, 0x02, 0xf9, 0x91, 0x02, 0xad, 0x77, 0xf2, 0x50, 0x77, 0x00, 0xea, 0x2c, 0x47, 0x4c, 0x96,
+  0xa1, 0x44, 0x63, 0x7c, 0xb9, 0xd8, 0xc0, 0x2d, 0x49, 0x78, 0x6b, 0x6c, 0x69, 0x11, 0xcb, 0xa0,
+  0x41, 0x28, 0xba, 0xcd, 0x31, 0x28, 0x21, 0xb0, 0x53, 0x00, 0xb2, 0xdd, 0xf8, 0xa1, 0x08, 0x23,
+  0x75, 0x09, 0x5c, 0xc4, 0xe7, 0x2b, 0x59, 0x6f, 0x46, 0x69, 0xab, 0x3a, 0xf0, 0xcc, 0x42, 0x8d,
+  0xe0, 0xba, 0x96, 0x9f, 0x65, 0x40, 0x88, 0x52, 0x90, 0xc6, 0x9d, 0xda, 0xc0, 0xf2, 0xdd, 0xb9,
+  0x45, 0xcd, 0x2e, 0x96, 0x5e, 0xe4, 0x28, 0x66, 0xa4, 0xb8, 0xfe, 0x04, 0xb5, 0x20, 0xe7, 0x6e,
+  0xef, 0x7f, 0x5d, 0x3b, 0xb7, 0x93, 0x10, 0x34, 0x9d, 0x48, 0xa1, 0xb7, 0xeb, 0xc6, 0x0f, 0xb0,
+  0x5e, 0x1b, 0x3f, 0xac, 0x03, 0x9c, 0xc0, 0xf8, 0xb6, 0x6f, 0xdc, 0xb5, 0xa5, 0x3b, 0xbd, 0x75,
+  0x07, 0x80, 0xb9, 0x23, 0x41, 0xf6, 0x2d, 0x89, 0xec, 0x5b, 0x85, 0xb1, 0x32, 0x50, 0xc3, 0xe8,
+  0xc1, 0x74, 0x5c, 0x98, 0x16, 0x19, 0x47, 0x66, 0x44, 0xa0, 0xf4, 0x67, 0x28, 0x9b, 0xd6, 0xe5,
+  0xf3, 0x9e, 0x93, 0x74, 0x54, 0x41, 0xb7, 0xc6, 0xb1, 0xbb, 0x72, 0xf2, 0xb4, 0x58, 0x9c, 0x15,
+  0x50, 0x83, 0x58, 0x0d, 0x79, 0x75, 0x74, 0xa5, 0xd5, 0xd1, 0x15, 0xab, 0x03, 0xc4, 0x57, 0x08,
+  0x10, 0x9f, 0x62, 0x8b, 0x32, 0xbf, 0x7e, 0x79, 0xf6, 0xee, 0xad, 0x72, 0x79, 0xf5, 0xee, 0xec,
+  0xe4, 0xb5, 0x72, 0xf0, 0xfc, 0xa7, 0xf3, 0x73, 0xe5, 0xfd, 0xab, 0xb3, 0x9f, 0x2f, 0xde, 0xbe,
+  0xbb, 0x52, 0x7e, 0x7e, 0x75, 0xf5, 0x52, 0x39, 0xfd, 0xe9, 0xdd, 0xfb, 0xb3, 0x67, 0xca, 0xd9,
+  0xb3, 0x17, 0x67, 0x97, 0x35, 0x89, 0xad, 0x83, 0x6c, 0x0b, 0xca, 0xf8, 0x3a, 0x68, 0xa8, 0xe3,
+  0x83, 0x94, 0x71, 0x2b, 0x87, 0x38, 0xe9, 0x35, 0xc6, 0xec, 0x11, 0x18, 0x46, 0x93, 0x6c, 0x65,
+  0x10, 0x8f, 0x94, 0x2a, 0xa0, 0x7a, 0x91, 0xd4, 0x90, 0xc6, 0xfa, 0x7d, 0x03, 0xe8, 0xff, 0x81,
+  0xf3, 0x93, 0xd7, 0x0a, 0xb2, 0xd3, 0x6f, 0x32, 0x46, 0x28, 0x11, 0x29, 0xf2, 0x21, 0xb3, 0x25,
+  0xe8, 0xb4, 0x51, 0xc7, 0x7f, 0xf5, 0x26, 0x22, 0x19, 0x47, 0xac, 0xb8, 0xf3, 0x04, 0xcd, 0x40,
+  0x82, 0x83, 0x54, 0x03, 0xf9, 0x61, 0x10, 0x8c, 0x7e, 0x75, 0xc6, 0xa0, 0x36, 0xb8, 0xd0, 0x37,
+  0xc0, 0x60, 0xb9, 0x7e, 0x02, 0xf3, 0xc8, 0x0b, 0xc6, 0xd7, 0x32, 0x65, 0x30, 0xb5, 0xa1, 0x00,
+  0x8a, 0xd4, 0x8b, 0x0e, 0xf0, 0x3a, 0x09, 0xd7, 0xc1, 0xf2, 0x6c, 0xd6, 0x2e, 0x3c, 0x10, 0x6c,
+  0xb3, 0xc0, 0x83, 0x9a, 0x34, 0x0f, 0x8b, 0x59, 0x3a, 0x0b, 0xd6, 0x08, 0x18, 0xc1, 0x32, 0x76,
+  0x06, 0xa4, 0xd3, 0xf5, 0x1f, 0x8c, 0xb3, 0x9c, 0xaa, 0x23, 0x24, 0x73, 0x53, 0x1e, 0x01, 0x5f,
+  0x6e, 0x0a, 0xe3, 0x03, 0x8b, 0x19, 0x83, 0x57, 0x2c, 0x42, 0x30, 0x1b, 0x58, 0x65, 0xcd, 0x59,
+  0x41, 0x9b, 0x11, 0x1f, 0x00, 0x94, 0x83, 0xb6, 0xb2, 0xbc, 0x94, 0x38, 0xbd, 0xed, 0x86, 0x80,
+  0x3b, 0x6c, 0x17, 0x48, 0x7e, 0x39, 0xf7, 0x2b, 0x85, 0x60, 0x87, 0x90, 0x04, 0xcd, 0x8c, 0x62,
+  0x9f, 0x4f, 0x44, 0x57, 0x12, 0x6c, 0xdd, 0x46, 0x39, 0x37, 0x63, 0xac, 0xb2, 0x4c, 0xe3, 0x7a,
+  0x20, 0x8a, 0xb2, 0x9c, 0xb0, 0x4c, 0xa3, 0xe8, 0x9a, 0x75, 0xd3, 0x30, 0x41, 0xce, 0x77, 0x6a,
+  0x09, 0xc4, 0xd2, 0x2a, 0x6d, 0x4a, 0x2c, 0xb8, 0x99, 0xc8, 0xb0, 0x14, 0x2e, 0xce, 0xc2, 0x69,
+  0xdd, 0xb4, 0xf8, 0xa0, 0x19, 0x1f, 0x51, 0xc4, 0xf0, 0x09, 0x06, 0xb0, 0xda, 0xe6, 0x7d, 0xb2,
+  0x0b, 0x0f, 0x0c, 0xb2, 0x80, 0x72, 0x2c, 0xb7, 0x69, 0x66, 0x05, 0xeb, 0x06, 0x48, 0xc1, 0x8a,
+  0x61, 0x90, 0xc6, 0x9f, 0x64, 0x19, 0xaa, 0x1f, 0x75, 0x51, 0x1e, 0x15, 0x18, 0x9d, 0x2c, 0xa0,
+  0xda, 0x8d, 0x06, 0x23, 0xcf, 0x97, 0x3f, 0x3d, 0x53, 0x80, 0x0d, 0x30, 0x16, 0xb1, 0xb4, 0x4b,
+  0x68, 0xb3, 0x54, 0xf9, 0x13, 0x52, 0x13, 0x95, 0x1c, 0xd2, 0x05, 0xb2, 0xf3, 0xb2, 0x59, 0xbb,
+  0x93, 0x67, 0x8d, 0xe9, 0x0d, 0xb1, 0x15, 0xc6, 0x1b, 0xb5, 0x99, 0x6e, 0x03, 0xb5, 0x19, 0x79,
+  0x89, 0x77, 0xda, 0x35, 0x05, 0x04, 0x0b, 0xe1, 0x74, 0x61, 0x21, 0xab, 0x54, 0x70, 0x55, 0xd7,
+  0xca, 0x08, 0x39, 0x59, 0x11, 0xed, 0x41, 0x4a, 0xf0, 0x95, 0x6b, 0x03, 0xd0, 0xa0, 0x47, 0xb3,
+  0xe0, 0x46, 0x92, 0x57, 0xa0, 0xc6, 0x4d, 0x65, 0x0c, 0xb7, 0xbb, 0x65, 0x7a, 0xca, 0x0e, 0xaa,
+  0x44, 0x4e, 0x95, 0xd1, 0xb1, 0x58, 0xec, 0x7c, 0x8a, 0xb5, 0x94, 0x36, 0x96, 0x8b, 0x85, 0x13,
+  0x8e, 0xc1, 0xdc, 0x19, 0xec, 0xa2, 0xc2, 0x30, 0x52, 0x1b, 0x4d, 0x25, 0x4a, 0x95, 0xc4, 0x49,
+  0x85, 0x34, 0x81, 0xf2, 0x9a, 0x87, 0xf2, 0xaa, 0x20, 0x9f, 0x9c, 0x50, 0x08, 0x38, 0xae, 0x9d,
+  0x41, 0x49, 0x58, 0xe9, 0xeb, 0x12, 0x41, 0x26, 0x17, 0x94, 0x14, 0x02, 0x28, 0x7d, 0x41, 0x3a,
+  0x01, 0xa8, 0x69, 0x91, 0xe2, 0xc0, 0x38, 0x00, 0xf7, 0x1a, 0xd8, 0x49, 0xe5, 0x1a, 0x82, 0x28,
+  0xbe, 0x4d, 0x49, 0x38, 0xba, 0x13, 0xc0, 0x44, 0xeb, 0xfc, 0x92, 0xc8, 0xa8, 0xe9, 0x46, 0x02,
+  0xd7, 0x78, 0x3c, 0x2e, 0x37, 0x0e, 0x00, 0x67, 0xb8, 0x70, 0x62, 0x77, 0x0e, 0x42, 0x9e, 0x26,
+  0x11, 0xc6, 0xe4, 0x82, 0x9d, 0xa9, 0xf9, 0x4b, 0x78, 0xe4, 0x8e, 0xfb, 0xb1, 0x35, 0x5a, 0x7a,
+  0x40, 0x80, 0x70, 0x1f, 0x65, 0x56, 0x36, 0x5a, 0x23, 0x39, 0x45, 0x8f, 0xad, 0xa3, 0xcb, 0xd9,
+  0x12, 0x67, 0x56, 0x79, 0xee, 0x59, 0xd1, 0x8c, 0x56, 0x53, 0xc4, 0x9e, 0x6c, 0xe0, 0xf6, 0xb2,
+  0xc4, 0x44, 0x24, 0x6e, 0x64, 0xc6, 0xa9, 0xbd, 0x65, 0xde, 0x25, 0x8d, 0xeb, 0x13, 0xec, 0x6e,
+  0x9d, 0x62, 0x9f, 0x3f, 0x3f, 0x81, 0x07, 0x8a, 0x6e, 0x76, 0xf9, 0x04, 0x00, 0xf6, 0x33, 0x48,
+  0x97, 0x4a, 0xad, 0x25, 0x24, 0x37, 0xee, 0xcc, 0xb6, 0x84, 0xf2, 0xa6, 0x79, 0x97, 0x99, 0x91,
+  0xc6, 0x1d, 0x1b, 0xea, 0x79, 0x60, 0x21, 0x99, 0x83, 0xf6, 0xed, 0xfa, 0x3e, 0x97, 0x6a, 0xfc,
+  0xfa, 0xeb, 0x8b, 0x36, 0x31, 0xea, 0xd6, 0x16, 0xec, 0x54, 0xae, 0x66, 0x0e, 0x59, 0x71, 0x45,
+  0xe3, 0x0b, 0xd0, 0xb8, 0x7d, 0xb1, 0x6c, 0x5a, 0x92, 0x58, 0x6a, 0xa5, 0x62, 0x89, 0x56, 0xb3,
+  0x2c, 0x84, 0x64, 0x93, 0x1a, 0x78, 0xa3, 0x56, 0xd0, 0xf9, 0x0a, 0xd2, 0x4c, 0x9a, 0x1e, 0xe8,
+  0x53, 0xd1, 0x61, 0x5a, 0x18, 0x83, 0x2b, 0x5f, 0x12, 0x58, 0x68, 0x1d, 0x07, 0x92, 0xb8, 0x08,
+  0x83, 0xd8, 0x8a, 0x9d, 0x83, 0x66, 0x07, 0xb9, 0x60, 0x8d, 0x4f, 0xc3, 0x9b, 0x00, 0xf1, 0xa5,
+  0x2c, 0x60, 0x79, 0x2b, 0x07, 0x73, 0x17, 0xfb, 0xf0, 0xea, 0xb0, 0x9e, 0x16, 0xa8, 0x70, 0x44,
+  0xc0, 0xd4, 0xad, 0x28, 0x8e, 0x6a, 0x34, 0x3b, 0x3e, 0x15, 0x2d, 0x99, 0x1c, 0x61, 0xf6, 0x36,
+  0x1a, 0xc4, 0x9b, 0x26, 0x31, 0xc1, 0x9b, 0x76, 0x4c, 0x57, 0x1e, 0xf4, 0xfd, 0xdf, 0x07, 0x5a,
+  0x9b, 0x98, 0x2b, 0x67, 0x71, 0x68, 0x18, 0x18, 0x45, 0x1e, 0x67, 0xb6, 0x4a, 0xac, 0x75, 0xb4,
+  0xd5, 0x5b, 0x75, 0xb3, 0x59, 0xd7, 0x7b, 0xed, 0x0a, 0x73, 0x1d, 0xd5, 0x84, 0xa2, 0x0f, 0x49,
+  0x16, 0x69, 0xed, 0x3c, 0xc3, 0x05, 0x09, 0xb6, 0x95, 0x99, 0x6f, 0x5e, 0x47, 0xed, 0xc1, 0xcd,
+  0x0c, 0x70, 0x4f, 0xcc, 0xd8, 0x81, 0x77, 0x37, 0xa1, 0xb5, 0x28, 0x1a, 0x69, 0x25, 0x8e, 0x80,
+  0x6e, 0x6d, 0x27, 0xd6, 0x8c, 0xe8, 0x99, 0x5b, 0x9f, 0x98, 0x8b, 0xb8, 0xdf, 0x23, 0xb5, 0x26,
+  0xaf, 0xb8, 0x36, 0x72, 0x8a, 0x2b, 0xf9, 0x18, 0xd8, 0x74, 0xc9, 0x16, 0x82, 0x64, 0x13, 0xd1,
+  0x75, 0xde, 0xda, 0x66, 0x35, 0x8a, 0x34, 0xce, 0x9f, 0x03, 0xff, 0xbd, 0xa6, 0xe6, 0x24, 0x9d,
+  0x05, 0xac, 0x3d, 0xb9, 0x00, 0xac, 0xe3, 0x5c, 0x01, 0x10, 0x05, 0x72, 0x81, 0x1b, 0x3f, 0x5f,
+  0xe0, 0xc6, 0xaf, 0xc9, 0x86, 0xc9, 0xe9, 0xdb, 0x37, 0x57, 0xef, 0xde, 0x9e, 0x2b, 0xe8, 0x4d,
+  0x3a, 0xb8, 0x00, 0x23, 0xe5, 0xf9, 0xf9, 0xdb, 0x93, 0xab, 0x57, 0x6f, 0x5e, 0x28, 0xcf, 0xde,
+  0x9e, 0xfe, 0x4d, 0x36, 0x45, 0xc6, 0x19, 0x17, 0x53, 0x81, 0x18, 0x3b, 0x3b, 0xd2, 0xa2, 0xb0,
+  0x87, 0x0b, 0xda, 0xc7, 0xee, 0xdc, 0x45, 0xf8, 0x69, 0x24, 0x87, 0x13, 0xb3, 0x30, 0xaa, 0x49,
+  0xd8, 0xac, 0xf2, 0x38, 0xb5, 0xb6, 0x7b, 0x9c, 0x5a, 0xa9, 0xc7, 0x69, 0x33, 0x85, 0x75, 0x0a,
+  0x4e, 0x3b, 0x14, 0x3c, 0xa9, 0xc7, 0x2d, 0x4b, 0x49, 0xb8, 0x18, 0x49, 0x6d, 0x94, 0x29, 0xa9,
+  0x4d, 0x9e, 0x10, 0x61, 0x55, 0xb7, 0x24, 0xa5, 0xa0, 0xd5, 0x2d, 0xd5, 0xb9, 0x7f, 0xbf, 0x62,
+  0x6d, 0x01, 0x27, 0x02, 0x13, 0x9a, 0x64, 0xce, 0x20, 0x99, 0xdf, 0xd0, 0x81, 0x49, 0x03, 0x65,
+  0x23, 0x4b, 0xb4, 0xd9, 0x11, 0x98, 0x4c, 0x63, 0x2a, 0xda, 0x70, 0x63, 0xd9, 0x50, 0x36, 0xcd,
+  0x74, 0x10, 0x74, 0x5d, 0xa6, 0xda, 0x8c, 0x47, 0x7d, 0x6e, 0x8c, 0xe7, 0xd5, 0x6d, 0x9c, 0x3b,
+  0x56, 0x80, 0x99, 0xf7, 0xa5, 0xea, 0x38, 0x15, 0xd0, 0x10, 0x11, 0xeb, 0x07, 0x79, 0xd7, 0x32,
+  0xca, 0x13, 0x6f, 0x49, 0xb8, 0x13, 0xb2, 0x8a, 0xbe, 0x99, 0xf5, 0xa0, 0xb1, 0xe2, 0x11, 0x48,
+  0x94, 0x9d, 0x3b, 0x86, 0x15, 0x5a, 0xe7, 0x3b, 0x31, 0xc5, 0x8e, 0xb1, 0xa5, 0xad, 0x1d, 0x3b,
+  0xa1, 0xcd, 0x3b, 0xb6, 0x9d, 0xc9, 0x66, 0xbd, 0x0a, 0xb9, 0x5e, 0x9e, 0x41, 0xef, 0x40, 0xca,
+  0x46, 0xda, 0x7e, 0xd1, 0xab, 0x52, 0x52, 0xbc, 0x9d, 0x51, 0x2b, 0xf3, 0x4e, 0xc7, 0x8e, 0xa0,
+  0x91, 0xd2, 0x3e, 0x3c, 0xc7, 0xd6, 0xb2, 0x8e, 0xad, 0x0a, 0xf4, 0x7d, 0x3f, 0x19, 0x8d, 0x26,
+  0x66, 0xab, 0xce, 0x77, 0x89, 0x92, 0x2e, 0xd1, 0x6d, 0x91, 0xd9, 0x27, 0xc8, 0x21, 0xae, 0x91,
+  0x76, 0x6f, 0xd4, 0x8d, 0x9e, 0x51, 0x6f, 0x76, 0x70, 0xa1, 0x49, 0x02, 0x1e, 0x40, 0x78, 0xe1,
+  0x05, 0x37, 0xa9, 0xf2, 0x5b, 0x2e, 0xe2, 0x79, 0xb1, 0x44, 0xe9, 0xdd, 0xb1, 0x23, 0x52, 0x89,
+  0xf3, 0xf6, 0x62, 0x69, 0xd9, 0x2e, 0x6a, 0x09, 0x80, 0x13, 0x7d, 0x32, 0x02, 0x4e, 0xbf, 0x33,
+  0x45, 0x81, 0x50, 0xa8, 0x7f, 0xdf, 0x68, 0xf7, 0x3a, 0x9d, 0x5e, 0xed, 0x3b, 0x77, 0x8e, 0x1b,
+  0x9f, 0xa0, 0x16, 0x4b, 0x33, 0x22, 0x3d, 0xe4, 0x1c, 0x44, 0xa6, 0x09, 0xa8, 0x9e, 0x29, 0x50,
+  0x31, 0x28, 0xd9, 0x99, 0xd8, 0x96, 0x6a, 0x24, 0x10, 0x67, 0xa9, 0x64, 0xe7, 0x35, 0xf0, 0x00,
+  0x88, 0xa1, 0xfa, 0x2e, 0x10, 0x4b, 0x7b, 0x8c, 0x05, 0x80, 0xb5, 0xc8, 0x59, 0x08, 0x39, 0x2d,
+  0xb9, 0x08, 0xca, 0xf6, 0x2d, 0xf2, 0x86, 0x8a, 0xd8, 0xb3, 0x55, 0x3a, 0x25, 0x32, 0x9d, 0x5a,
+  0xf6, 0xd6, 0x16, 0x98, 0x83, 0x16, 0x70, 0x2a, 0x52, 0x51, 0xb2, 0x7b, 0x57, 0x5f, 0x71, 0x91,
+  0x96, 0xe9, 0x71, 0x19, 0x1b, 0x9f, 0xe4, 0x4b, 0x6a, 0xed, 0x6f, 0x54, 0xcd, 0xd0, 0xfb, 0xbd,
+  0xcb, 0x8e, 0x5c, 0x32, 0x12, 0x0d, 0x96, 0xcf, 0xd4, 0xe9, 0x2f, 0x43, 0xef, 0x60, 0xdf, 0xb6,
+  0x62, 0xab, 0x4f, 0xf7, 0x8f, 0x81, 0xf3, 0x1f, 0x7e, 0x9a, 0x7b, 0xf5, 0x1f, 0x9a, 0xa7, 0x70,
+  0xa9, 0xc0, 0xa5, 0x1f, 0x0d, 0xd5, 0x59, 0x1c, 0x2f, 0xfa, 0x8f, 0x1f, 0xdf, 0xdc, 0xdc, 0xe8,
+  0x37, 0x4d, 0x3d, 0x08, 0xa7, 0x8f, 0x4d, 0x58, 0xb7, 0x58, 0x58, 0x55, 0xd8, 0xd6, 0xbc, 0x6a,
+  0x34, 0x54, 0x85, 0xcd, 0x03, 0xbb, 0x46, 0x39, 0x31, 0x54, 0x7f, 0x30, 0x9b, 0x6c, 0xb3, 0x57,
+  0xfd, 0xa1, 0x79, 0x06, 0x6d, 0x2e, 0xac, 0x78, 0xa6, 0xd8, 0x43, 0xf5, 0x75, 0x5b, 0x39, 0x3a,
+  0x37, 0x94, 0xe6, 0xac, 0xfb, 0x59, 0x7d, 0xcc, 0x5e, 0x61, 0x6b, 0x70, 0xb5, 0x2f, 0xbb, 0x5f,
+  0xc0, 0xf4, 0x84, 0x99, 0x88, 0x61, 0x16, 0xf8, 0x95, 0xfc, 0x2e, 0x95, 0x76, 0xd8, 0x2b, 0xed,
+  0x5a, 0x29, 0x25, 0x9e, 0x27, 0x33, 0xaa, 0x98, 0xe6, 0xfb, 0xf3, 0xc6, 0xb4, 0x2a, 0xed, 0x56,
+  0x26, 0xbb, 0x94, 0xb2, 0xa7, 0xb2, 0x68, 0x9a, 0x64, 0xe8, 0x1b, 0x98, 0x47, 0x4e, 0x04, 0xa5,
+  0xda, 0xdc, 0xb3, 0x77, 0x27, 0x3f, 0x9f, 0xbd, 0xbb, 0xcc, 0xec, 0x0b, 0x32, 0x95, 0x26, 0xef,
+  0x44, 0x2e, 0xb1, 0x66, 0xb3, 0x7a, 0x88, 0xa4, 0x71, 0x37, 0x1e, 0x6a, 0xc5, 0x89, 0xce, 0x73,
+  0x2a, 0x6e, 0xbe, 0x11, 0x6b, 0x19, 0x07, 0x50, 0xda, 0x0e, 0xad, 0x1b, 0xa7, 0x74, 0x17, 0x53,
+  0xda, 0xa1, 0x14, 0xae, 0x2c, 0xae, 0x76, 0x4a, 0x1e, 0xed, 0x81, 0xf0, 0xf8, 0x35, 0x32, 0x1a,
+  0x3c, 0x39, 0x8d, 0xcb, 0x76, 0x64, 0x05, 0xba, 0x49, 0x69, 0x2d, 0xdb, 0xde, 0x29, 0x55, 0x62,
+  0x99, 0xb7, 0x4a, 0x1a, 0x71, 0x52, 0x0a, 0xc6, 0x0c, 0x5a, 0xd4, 0x78, 0x39, 0x72, 0xc7, 0xda,
+  0xc8, 0xf9, 0xec, 0x3a, 0xe1, 0x81, 0xde, 0x42, 0x5c, 0x9a, 0x75, 0x23, 0xc5, 0xa6, 0x99, 0xf7,
+  0xb1, 0x97, 0x3b, 0x66, 0x73, 0xfe, 0xf4, 0x04, 0x3b, 0x7a, 0xb0, 0x70, 0x64, 0x97, 0xa4, 0x04,
+  0x59, 0x03, 0xe5, 0xa9, 0x3d, 0x5b, 0x7f, 0x9d, 0x3d, 0x5c, 0xda, 0x29, 0x34, 0xa4, 0x5d, 0xab,
+  0xc2, 0x5e, 0x6b, 0x8a, 0xa8, 0xfc, 0xe2, 0xb0, 0x67, 0xca, 0xcc, 0x94, 0x1d, 0x6f, 0xdd, 0x76,
+  0x99, 0xe3, 0x6d, 0x47, 0x6b, 0x4c, 0x34, 0xb8, 0x75, 0xef, 0x45, 0xde, 0x4c, 0xb4, 0x47, 0x6b,
+  0x6c, 0x16, 0x68, 0x4d, 0x60, 0x52, 0xbb, 0x25, 0x3a, 0x2b, 0x0e, 0x90, 0xad, 0x9f, 0xe7, 0x38,
+  0x83, 0x88, 0x92, 0x30, 0xf0, 0x70, 0x5b, 0x4c, 0x61, 0xf8, 0x8e, 0x68, 0x11, 0x4d, 0xa6, 0x3c,
+  0x50, 0x27, 0xc1, 0x02, 0xdb, 0xf5, 0x9d, 0x4c, 0xfb, 0x1e, 0xd8, 0xeb, 0xda, 0x78, 0xe6, 0x7a,
+  0x76, 0xae, 0x08, 0x22, 0x62, 0x12, 0xde, 0x67, 0xcf, 0x79, 0x22, 0x07, 0x7a, 0xe8, 0x9d, 0xee,
+  0xf6, 0xed, 0x49, 0x93, 0x45, 0x6c, 0x30, 0xa4, 0x1c, 0x99, 0x79, 0x71, 0x54, 0xed, 0xa3, 0xcc,
+  0x3b, 0x34, 0xdb, 0x0c, 0x00, 0x12, 0x5d, 0x1c, 0x6f, 0x02, 0x4f, 0x3d, 0x14, 0x23, 0x28, 0x41,
+  0x7a, 0x5c, 0x94, 0x54, 0x6e, 0xed, 0xed, 0xb4, 0xf1, 0xb6, 0x69, 0x3f, 0x55, 0x16, 0x4f, 0xe9,
+  0xe6, 0x6c, 0x4e, 0x1c, 0xe5, 0x25, 0xeb, 0x3f, 0x5f, 0x3c, 0xb1, 0xe8, 0xa3, 0x3f, 0x40, 0x3c,
+  0x35, 0xaa, 0xc4, 0x93, 0x98, 0xbb, 0xaf, 0x29, 0x54, 0xa0, 0x45, 0xd7, 0x2f, 0x23, 0x86, 0x7f,
+  0x01, 0x1a, 0x28, 0x19, 0x3d, 0x28, 0x64, 0x5f, 0x7b, 0xf0, 0xfd, 0xfe, 0x22, 0xdd, 0x05, 0x5c,
+  0xe7, 0x37, 0x66, 0xa0, 0x50, 0x78, 0x23, 0xf0, 0xb3, 0x33, 0x2b, 0x73, 0xfd, 0xc5, 0x32, 0xfe,
+  0x10, 0xdf, 0x2e, 0x9c, 0x21, 0x8c, 0x61, 0xea, 0x7c, 0x14, 0x2d, 0x08, 0x17, 0x44, 0x9e, 0xbc,
+  0x85, 0xf5, 0x5f, 0x74, 0xda, 0x95, 0x87, 0x38, 0x34, 0x93, 0xe8, 0x26, 0xbe, 0x19, 0x58, 0xe8,
+  0x51, 0x8a, 0x43, 0x02, 0xd4, 0x3b, 0x22, 0x08, 0xa9, 0x0a, 0x80, 0x8a, 0x58, 0x90, 0x1d, 0x62,
+  0x19, 0x68, 0xb3, 0x21, 0x1f, 0xce, 0x95, 0x41, 0x7c, 0x27, 0x87, 0xf6, 0x32, 0x58, 0xe7, 0xc1,
+  0x67, 0x8d, 0x6e, 0x38, 0x9c, 0xbb, 0xc3, 0x53, 0x1e, 0x3a, 0x56, 0x05, 0x1b, 0xce, 0xe7, 0x6a,
+  0x9d, 0xb2, 0x53, 0x52, 0xa6, 0x89, 0x81, 0xd2, 0x7c, 0x8a, 0x99, 0x94, 0xe9, 0x33, 0xbf, 0x5f,
+  0x87, 0x8d, 0xe6, 0x85, 0xdc, 0xd6, 0x8d, 0x0a, 0xbe, 0x11, 0xc1, 0xc4, 0xbf, 0x62, 0xbb, 0x2b,
+  0x9c, 0x93, 0x54, 0x00, 0x91, 0xfc, 0xb1, 0xd1, 0x58, 0x11, 0xa3, 0x2d, 0x9b, 0xf7, 0x34, 0x1a,
+  0x85, 0xc9, 0x35, 0x92, 0xc2, 0x91, 0x33, 0xce, 0x08, 0x14, 0xb3, 0x4c, 0x08, 0x17, 0x03, 0x2b,
+  0x76, 0x94, 0x19, 0x06, 0x69, 0x59, 0x19, 0xa1, 0xd8, 0xd8, 0xc1, 0xa5, 0x87, 0x2b, 0x81, 0xed,
+  0x2e, 0x23, 0x7c, 0x1b, 0xbd, 0xa5, 0xa9, 0x4c, 0x67, 0xeb, 0x0d, 0xf1, 0x74, 0x15, 0x4c, 0xa7,
+  0x9e, 0x43, 0x48, 0x89, 0xa7, 0x5f, 0x49, 0xd5, 0x41, 0x2a, 0x6c, 0x14, 0xa9, 0x21, 0x9e, 0x6a,
+  0x9e, 0x35, 0x72, 0x32, 0x42, 0xf9, 0xa8, 0x55, 0xdc, 0xa3, 0x25, 0xf7, 0x54, 0x3c, 0x55, 0x88,
+  0x78, 0x73, 0xa1, 0x04, 0xd8, 0x08, 0x8b, 0x09, 0x2c, 0x6e, 0x47, 0x9b, 0x45, 0x3e, 0x6a, 0x34,
+  0x2a, 0x17, 0x75, 0x86, 0xe5, 0xb5, 0xa3, 0x6d, 0x8e, 0x3a, 0xa9, 0x6b, 0x11, 0x6a, 0x2c, 0x90,
+  0xa0, 0xaa, 0x83, 0xf2, 0xed, 0x62, 0x53, 0x78, 0x70, 0xf1, 0xe2, 0x21, 0xcb, 0x9e, 0x9c, 0x3f,
+  0x79, 0x40, 0x33, 0x4b, 0x1e, 0x39, 0x7e, 0xb3, 0xcc, 0x63, 0x28, 0xf0, 0xd7, 0x1f, 0xcf, 0x9c,
+  0xf1, 0xb5, 0x63, 0x1f, 0xa6, 0x98, 0x2b, 0x5b, 0xbb, 0x1b, 0x6b, 0x88, 0x01, 0x33, 0xc5, 0xbe,
+  0x9b, 0x0d, 0x9c, 0x7c, 0xfd, 0xf6, 0xcd, 0xab, 0xab, 0xb7, 0xef, 0x94, 0xcb, 0xab, 0x93, 0x2b,
+  0xd9, 0x4e, 0x8a, 0x52, 0x6a, 0x9a, 0x86, 0xae, 0x3d, 0xc0, 0x3f, 0x1a, 0xd0, 0xd2, 0x02, 0x95,
+  0x6b, 0x8d, 0x69, 0xe5, 0x30, 0x41, 0x93, 0x50, 0x81, 0xff, 0x25, 0xd5, 0x34, 0x1a, 0xaf, 0x65,
+  0x8b, 0xbb, 0x42, 0x00, 0x56, 0x8a, 0xcb, 0x4a, 0x41, 0x48, 0x4d, 0x6b, 0xb3, 0x9d, 0x03, 0xe2,
+  0xb2, 0x4b, 0xb1, 0xc5, 0x61, 0xd3, 0x66, 0xf2, 0x0a, 0x93, 0x1c, 0xb1, 0x86, 0x59, 0xb6, 0xc2,
+  0xb0, 0x86, 0x57, 0xdc, 0x31, 0xdf, 0x18, 0x93, 0x80, 0x5a, 0xe9, 0x3d, 0xf5, 0x4c, 0xe8, 0x65,
+  0x95, 0x31, 0x0f, 0xba, 0xdb, 0x38, 0x53, 0xc2, 0x59, 0x37, 0x73, 0x52, 0x6c, 0x39, 0xca, 0xc0,
+  0xdf, 0x29, 0x85, 0x9f, 0x23, 0x0b, 0x89, 0xde, 0x60, 0x41, 0x1f, 0x61, 0x59, 0xbc, 0x51, 0xf3,
+  0x1e, 0x42, 0x57, 0x6a, 0x12, 0xa7, 0xa3, 0x68, 0xbf, 0x41, 0x17, 0xda, 0x68, 0x2d, 0x47, 0x32,
+  0x15, 0x9b, 0x96, 0xd6, 0x0e, 0x41, 0xa3, 0xe8, 0x9d, 0x68, 0x50, 0x41, 0xff, 0xd4, 0x9e, 0x7e,
+  0x53, 0x12, 0x11, 0x48, 0x3b, 0x3c, 0xfc, 0xfd, 0x38, 0x2c, 0x8d, 0x16, 0x90, 0x57, 0xc4, 0xcf,
+  0xaf, 0x9e, 0xbf, 0x92, 0x16, 0xc2, 0x0d, 0x50, 0xf4, 0xae, 0x46, 0xcb, 0xe0, 0x9b, 0x90, 0x7e,
+  0x89, 0x58, 0xb9, 0x23, 0xb8, 0x34, 0x57, 0xb0, 0x51, 0x33, 0xef, 0xb2, 0xfb, 0xba, 0xd1, 0x86,
+  0x79, 0x56, 0x4a, 0x7d, 0x6f, 0xb0, 0x3f, 0x45, 0x11, 0x7d, 0x5c, 0x1e, 0xa1, 0x09, 0xcb, 0x39,
+  0x2d, 0x50, 0xbe, 0xa5, 0xc7, 0x5e, 0x03, 0xbc, 0xe5, 0xd1, 0xe0, 0x77, 0x69, 0x81, 0x7c, 0x7d,
+  0xbe, 0x74, 0xf1, 0x7d, 0x49, 0x3c, 0x51, 0x21, 0xec, 0x81, 0x0a, 0xda, 0x19, 0xc5, 0x60, 0x97,
+  0x45, 0x52, 0x88, 0xf0, 0xa3, 0x35, 0x9f, 0x3c, 0x74, 0x3c, 0xcf, 0x5d, 0x44, 0x6e, 0x54, 0xb2,
+  0x39, 0x8b, 0xdb, 0x91, 0xee, 0x57, 0x12, 0xd5, 0x64, 0x7f, 0x98, 0xf7, 0xa6, 0xb5, 0x2c, 0x41,
+  0xe1, 0xfa, 0xcc, 0xe9, 0xa5, 0x39, 0x6f, 0x5f, 0x81, 0x36, 0xa5, 0x78, 0x25, 0x1a, 0x4e, 0xb2,
+  0x45, 0x53, 0x6e, 0x5e, 0xc8, 0x31, 0x95, 0x63, 0xc3, 0x36, 0x1d, 0xaa, 0xa4, 0xa3, 0x75, 0xbd,
+  0x53, 0x15, 0xb3, 0xd5, 0xec, 0x52, 0x15, 0xcd, 0xdf, 0x65, 0x46, 0xa1, 0xdc, 0x7c, 0xbd, 0xa3,
+  0xe2, 0x95, 0x09, 0x80, 0x6e, 0x95, 0x4d, 0x3c, 0x6f, 0x50, 0x26, 0xf7, 0xa6, 0x44, 0xee, 0xcd,
+  0xea, 0x50, 0xd7, 0x57, 0xfe, 0x24, 0x50, 0xc2, 0xe0, 0x86, 0x39, 0x4d, 0x5c, 0xb8, 0x5a, 0xdf,
+  0x23, 0xbe, 0x4c, 0xcc, 0xf1, 0x51, 0x62, 0x63, 0xde, 0x6b, 0x8e, 0x65, 0x3c, 0x91, 0xa6, 0x5b,
+  0x26, 0x11, 0x11, 0x26, 0x90, 0x70, 0x25, 0x43, 0xa6, 0x37, 0x5c, 0x2a, 0x65, 0x90, 0x4b, 0x2f,
+  0xac, 0x71, 0x31, 0x60, 0x1d, 0x47, 0xfc, 0x94, 0x0e, 0xb2, 0xb0, 0xf1, 0x62, 0xac, 0x60, 0x86,
+  0x4e, 0x37, 0x85, 0x41, 0x17, 0x74, 0xca, 0xbc, 0x48, 0x15, 0x88, 0x73, 0x7d, 0x3a, 0xa9, 0xf2,
+  0x80, 0x1d, 0xf2, 0x4e, 0x56, 0xa0, 0x30, 0x43, 0x19, 0x80, 0xac, 0xde, 0x68, 0x3d, 0xaa, 0xb1,
+  0x12, 0x5b, 0xb5, 0x72, 0x79, 0xea, 0x0b, 0xcc, 0x12, 0x1a, 0xd0, 0x16, 0xdb, 0x42, 0xcf, 0xee,
+  0x58, 0xb1, 0xaa, 0x90, 0x6d, 0x6b, 0x6c, 0xd6, 0x4a, 0xb7, 0x11, 0x33, 0x46, 0x3a, 0x36, 0x11,
+  0xad, 0x7f, 0xaf, 0xcb, 0x81, 0x81, 0x12, 0x6d, 0x5e, 0xd2, 0xc5, 0xe3, 0x0a, 0x58, 0xc9, 0xde,
+  0x1a, 0x8a, 0xc7, 0x8a, 0x15, 0x87, 0xc9, 0x37, 0xbf, 0x78, 0x3b, 0x53, 0xf9, 0x95, 0xc4, 0x6b,
+  0x8a, 0xee, 0xbe, 0xca, 0x61, 0x98, 0x7c, 0x1c, 0xd3, 0x7b, 0x46, 0xc1, 0x23, 0x41, 0x00, 0xad,
+  0x59, 0x23, 0xcf, 0xb1, 0xa5, 0xe0, 0x7e, 0xc1, 0x20, 0xfd, 0x00, 0xed, 0x5f, 0xe0, 0xf0, 0xe8,
+  0x89, 0x4f, 0x08, 0x86, 0x1b, 0x37, 0xa3, 0xa9, 0x99, 0x53, 0x9a, 0xb9, 0x5a, 0x8c, 0x6f, 0xf4,
+  0xb1, 0xb9, 0xde, 0xa8, 0x44, 0xf3, 0x52, 0xcd, 0xcd, 0xa5, 0xa8, 0x24, 0xad, 0xb5, 0x17, 0x00,
+  0x87, 0x13, 0xde, 0x2a, 0x2f, 0xa0, 0x38, 0x2d, 0xb8, 0xa9, 0xe5, 0x69, 0x58, 0x77, 0x17, 0xc5,
+  0x9d, 0x39, 0xd7, 0x0e, 0xd0, 0x03, 0x8c, 0xc1, 0x1d, 0x5e, 0x1d, 0x0c, 0xfd, 0xb9, 0xf5, 0xe9,
+  0xc0, 0x40, 0x2b, 0xac, 0x0e, 0x7d, 0xd4, 0x6a, 0xa9, 0x56, 0x53, 0xea, 0xeb, 0xc5, 0xde, 0x70,
+  0xe9, 0xad, 0x8b, 0x96, 0x97, 0x15, 0x2d, 0x30, 0x24, 0x3d, 0xc4, 0xcd, 0xe4, 0xbe, 0x51, 0xbe,
+  0xe6, 0x6b, 0xc5, 0x10, 0xf9, 0xf2, 0x19, 0x2a, 0x3d, 0xff, 0x66, 0x96, 0x49, 0xa2, 0xa2, 0xd4,
+  0xda, 0x12, 0x9b, 0x41, 0x96, 0xaa, 0x18, 0xc7, 0x66, 0x7a, 0x2f, 0x89, 0xb2, 0xc8, 0xaf, 0x48,
+  0xe1, 0x3f, 0x57, 0xf2, 0x07, 0x44, 0x9b, 0x99, 0x6e, 0x2a, 0xb9, 0x4d, 0x37, 0x29, 0xb6, 0x63,
+  0xb0, 0x3f, 0x80, 0x9b, 0x0b, 0xf5, 0x2f, 0x57, 0xc5, 0x37, 0x07, 0x43, 0xf3, 0x4e, 0x65, 0xd7,
+  0xde, 0x96, 0xe8, 0xe9, 0x0a, 0xd8, 0x1e, 0x7a, 0x22, 0x6b, 0xc7, 0x2d, 0x72, 0xa4, 0x86, 0x7a,
+  0x3a, 0xaa, 0x5a, 0x11, 0x6e, 0x89, 0x4d, 0x17, 0xa2, 0x20, 0x33, 0xfa, 0x21, 0xcc, 0x5c, 0xb2,
+  0xb2, 0xdb, 0xbc, 0x9d, 0x95, 0x6b, 0xaf, 0xff, 0x39, 0x03, 0x93, 0x03, 0x6f, 0x52, 0x60, 0xb6,
+  0xc6, 0xec, 0x93, 0x73, 0x81, 0xc7, 0x65, 0x51, 0x8c, 0x16, 0x23, 0xc4, 0x03, 0x46, 0xea, 0xc5,
+  0xa3, 0x24, 0x12, 0xc2, 0x6e, 0x7f, 0xe7, 0x0c, 0x93, 0x0b, 0x71, 0x77, 0x44, 0x94, 0x9f, 0xc9,
+  0x10, 0xb0, 0xfc, 0xce, 0x81, 0x76, 0x72, 0x03, 0xed, 0x24, 0x03, 0x45, 0xb7, 0x69, 0xc5, 0x40,
+  0x93, 0xd8, 0xbc, 0x4e, 0x49, 0x78, 0x03, 0x6f, 0xe8, 0x28, 0x1b, 0xc3, 0x53, 0x70, 0x02, 0x6c,
+  0x09, 0x93, 0xcf, 0x87, 0x58, 0x1f, 0xdd, 0xd3, 0x2d, 0xb0, 0x31, 0xe6, 0x5b, 0x0c, 0x4f, 0x47,
+  0xaa, 0xad, 0xb0, 0x87, 0xb1, 0x4c, 0xf4, 0xb9, 0x3a, 0x40, 0xb1, 0x93, 0x9c, 0x8a, 0x7a, 0x18,
+  0x12, 0x3a, 0x79, 0x24, 0x1c, 0x55, 0xbb, 0xef, 0x36, 0x8d, 0xc3, 0x06, 0x23, 0xa0, 0x7a, 0x96,
+  0x52, 0x08, 0xb9, 0x17, 0x5a, 0xb2, 0x34, 0xcd, 0xee, 0x6e, 0x7e, 0x77, 0x27, 0x7c, 0xb0, 0xe1,
+  0x5b, 0x1a, 0x9a, 0xbb, 0x59, 0xb6, 0x48, 0x41, 0x36, 0xad, 0xa2, 0x7c, 0x51, 0x92, 0x31, 0xcb,
+  0x01, 0xae, 0xfc, 0x59, 0x65, 0x44, 0x9f, 0x91, 0x35, 0x88, 0x12, 0x5d, 0x89, 0xd7, 0xdb, 0xaa,
+  0x9f, 0xf2, 0x48, 0x0b, 0x2c, 0x0e, 0x8a, 0x40, 0x7c, 0xbb, 0x2e, 0xfa, 0xf1, 0x13, 0xe7, 0x6f,
+  0x83, 0x07, 0xf4, 0x56, 0x78, 0xb9, 0xb8, 0x87, 0x0a, 0x26, 0x5f, 0x6e, 0x50, 0x82, 0xa0, 0x23,
+  0x41, 0xd0, 0x29, 0xf1, 0x5b, 0xe7, 0xb5, 0x09, 0x2c, 0x22, 0x1d, 0xa2, 0x64, 0x8d, 0x8e, 0x61,
+  0xa0, 0x59, 0xe3, 0x7d, 0x93, 0x49, 0x2e, 0x29, 0x26, 0xd9, 0xd0, 0xee, 0xfb, 0x5b, 0xc6, 0xbf,
+  0xcb, 0x2c, 0x97, 0x81, 0x57, 0xa2, 0x38, 0x0c, 0xfc, 0x69, 0xb9, 0x99, 0x24, 0x54, 0xb7, 0xcb,
+  0x38, 0x08, 0xad, 0xa9, 0xa3, 0x9c, 0x5a, 0x61, 0xaa, 0xc2, 0x45, 0xec, 0xe1, 0x6e, 0x4e, 0x27,
+  0x79, 0xc8, 0xf7, 0x1d, 0x6e, 0xe9, 0x54, 0x6c, 0xf4, 0xc0, 0x4a, 0xe0, 0x69, 0x2e, 0xfa, 0x76,
+  0x2a, 0xf8, 0xf6, 0xce, 0xbb, 0xa1, 0x78, 0x90, 0xf4, 0x6b, 0x39, 0xa5, 0xf2, 0xc0, 0xc9, 0x21,
+  0xb7, 0x8d, 0xdc, 0x36, 0x43, 0x21, 0x3e, 0x22, 0x53, 0x19, 0xcc, 0x76, 0xb1, 0x0d, 0x99, 0xee,
+  0x7f, 0xe5, 0xbb, 0xa0, 0x6c, 0x26, 0xeb, 0x82, 0x95, 0xbd, 0x79, 0x3f, 0x29, 0xdf, 0x95, 0xed,
+  0xc4, 0x96, 0x9b, 0x0d, 0x73, 0x68, 0x6d, 0x73, 0x3e, 0xa5, 0xea, 0xb7, 0x68, 0x25, 0x4d, 0xc4,
+  0x90, 0x39, 0x94, 0x58, 0xe9, 0x9b, 0x2d, 0xe4, 0x76, 0x28, 0xe8, 0xe2, 0x9b, 0x70, 0x8b, 0xb8,
+  0xcb, 0xfa, 0x6d, 0xcb, 0x8f, 0x60, 0xe7, 0xfb, 0x28, 0x3a, 0x73, 0x9b, 0x51, 0x3d, 0xad, 0xcb,
+  0x43, 0xa4, 0xf2, 0x3d, 0xe9, 0x37, 0x56, 0x58, 0xe9, 0xd3, 0x2d, 0x14, 0x1e, 0x87, 0x6e, 0x5c,
+  0xe1, 0xe0, 0x85, 0x65, 0xf7, 0x3a, 0x18, 0xb9, 0x9e, 0xa3, 0x4c, 0xf9, 0xea, 0xd3, 0x14, 0x0c,
+  0xc3, 0x52, 0x80, 0x81, 0x3a, 0xb1, 0xa3, 0x58, 0xde, 0x8d, 0x75, 0x1b, 0xd5, 0x95, 0x68, 0x4e,
+  0xaf, 0x15, 0x22, 0x41, 0x5c, 0x94, 0xff, 0x6b, 0xee, 0xd8, 0xae, 0x75, 0x90, 0x46, 0x50, 0x75,
+  0x50, 0xa3, 0xac, 0xad, 0x25, 0x83, 0xeb, 0x9e, 0x36, 0x56, 0x23, 0x6b, 0x63, 0x75, 0x93, 0x09,
+  0xcd, 0xc8, 0x85, 0x81, 0xb4, 0xef, 0x2a, 0x68, 0x97, 0xf0, 0x18, 0xd0, 0x79, 0xb9, 0x81, 0x7c,
+  0xcc, 0xbe, 0x44, 0x10, 0xe4, 0x36, 0x37, 0x64, 0xa5, 0x48, 0x16, 0xe3, 0xa6, 0x2c, 0xc6, 0xb9,
+  0x42, 0x95, 0x74, 0x21, 0x1d, 0x03, 0xe5, 0xea, 0x84, 0x5c, 0x35, 0x5f, 0xb3, 0x9d, 0x9e, 0xae,
+  0xce, 0xc1, 0x97, 0xe5, 0x7a, 0x17, 0xa1, 0x83, 0xf9, 0x88, 0x94, 0x73, 0x2c, 0x00, 0x82, 0x34,
+  0xe1, 0x7c, 0x0b, 0xf6, 0xa2, 0x2a, 0x34, 0x4f, 0x84, 0x8c, 0x75, 0x1e, 0x7c, 0x2c, 0xfb, 0x2e,
+  0xd3, 0x8f, 0x36, 0x9a, 0xee, 0x76, 0xac, 0x4d, 0xd6, 0x88, 0x7a, 0x15, 0x07, 0x27, 0xba, 0xa9,
+  0x46, 0x23, 0x9a, 0x47, 0x67, 0x6f, 0x89, 0x75, 0x2c, 0x1d, 0xa6, 0x69, 0xff, 0x40, 0x77, 0x7c,
+  0x9a, 0x7a, 0x79, 0x5b, 0x63, 0xd7, 0x33, 0xca, 0x25, 0xfd, 0xd2, 0x89, 0xf1, 0x5c, 0xd0, 0x9f,
+  0xd4, 0x15, 0x9d, 0x7e, 0xef, 0x35, 0x56, 0x33, 0x58, 0x04, 0x5d, 0xca, 0x20, 0x52, 0x72, 0x8c,
+  0xbc, 0x42, 0x68, 0x14, 0x0e, 0x6d, 0xb4, 0x1a, 0x65, 0x87, 0x36, 0x64, 0x88, 0x88, 0xa3, 0xca,
+  0xfe, 0xf3, 0x4e, 0x59, 0x2c, 0x41, 0x49, 0x25, 0x96, 0x1b, 0x23, 0x6b, 0xe4, 0x6e, 0x39, 0x22,
+  0x6c, 0xd6, 0xaa, 0xfd, 0x15, 0xc9, 0xc4, 0xc7, 0x7e, 0x94, 0x95, 0xaf, 0x89, 0xaf, 0x63, 0x37,
+  0xc2, 0x81, 0xfa, 0x0a, 0x39, 0x38, 0x53, 0xf9, 0x40, 0xab, 0x3a, 0x57, 0xee, 0x53, 0x59, 0xf0,
+  0xa6, 0x91, 0xea, 0xb5, 0x46, 0xaa, 0xd8, 0xb6, 0xa4, 0x65, 0xde, 0x6a, 0x6d, 0x53, 0x6c, 0xcb,
+  0x83, 0x9f, 0xab, 0xe8, 0xf2, 0x2b, 0x1d, 0xc8, 0x2f, 0x38, 0x4f, 0x33, 0x43, 0xad, 0xf2, 0xb3,
+  0xb1, 0x03, 0x58, 0x99, 0xa2, 0xb2, 0x64, 0xce, 0x73, 0x37, 0x49, 0x5f, 0xdd, 0xcc, 0x78, 0x33,
+  0xab, 0x2c, 0x47, 0xe9, 0xf2, 0x36, 0x5c, 0xd9, 0xd4, 0x97, 0x2f, 0xac, 0xb4, 0x81, 0xca, 0xe9,
+  0xae, 0x2c, 0xf2, 0x69, 0x4d, 0x53, 0xdb, 0x48, 0xa7, 0xb6, 0x91, 0x4c, 0x6d, 0x53, 0xb2, 0x59,
+  0x9a, 0x5d, 0xc6, 0x0f, 0x33, 0x95, 0x3d, 0x76, 0x14, 0xb5, 0xc2, 0x0c, 0xc2, 0xa9, 0xdf, 0x74,
+  0x90, 0x8c, 0xce, 0x91, 0xd5, 0xd9, 0x61, 0xb2, 0x87, 0xa5, 0x38, 0xd8, 0xa4, 0xe9, 0xb3, 0xa0,
+  0x33, 0xa1, 0x6b, 0x66, 0x23, 0x07, 0x9e, 0x9d, 0x9c, 0x4b, 0x1b, 0xa5, 0xf3, 0x60, 0xb5, 0x8d,
+  0x73, 0x37, 0x1b, 0x95, 0x7c, 0xf5, 0x68, 0x17, 0xfa, 0xbd, 0xaf, 0xe3, 0x41, 0x90, 0x01, 0x0b,
+  0xb0, 0x01, 0x00, 0x59, 0xe0, 0xb5, 0x8c, 0x25, 0x7a, 0xbe, 0xde, 0x10, 0x0f, 0x5d, 0xba, 0x23,
+  0x5b, 0xca, 0x1a, 0xbd, 0x9a, 0xc4, 0xdb, 0x5b, 0x8d, 0x94, 0x00, 0xf2, 0xdc, 0xb7, 0x8b, 0x99,
+  0xc4, 0x76, 0x98, 0xaa, 0x5d, 0x8e, 0xc7, 0x49, 0xa7, 0x76, 0xe6, 0xc1, 0x2b, 0x1f, 0xb5, 0x28,
+  0x3a, 0xb1, 0x93, 0x39, 0xa8, 0x83, 0x6f, 0xd6, 0x93, 0x30, 0x98, 0xaf, 0x73, 0x06, 0x6d, 0xc6,
+  0x01, 0xd9, 0xae, 0x29, 0x09, 0x51, 0xfd, 0x0f, 0x13, 0x68, 0x71, 0x20, 0xe9, 0x23, 0x39, 0x7f,
+  0x37, 0x61, 0x4e, 0x9b, 0xad, 0x1f, 0x12, 0x21, 0xfd, 0x7b, 0xcd, 0x2c, 0xec, 0x38, 0x17, 0x53,
+  0xdd, 0xfb, 0x7d, 0x21, 0xd5, 0xbc, 0xc5, 0x7b, 0x05, 0x55, 0x43, 0x9d, 0xd1, 0x5a, 0x26, 0xb2,
+  0x42, 0x70, 0x35, 0xb3, 0x22, 0x58, 0xd1, 0xc9, 0x5a, 0x36, 0xd4, 0x32, 0x98, 0xe2, 0x7b, 0xca,
+  0x9b, 0xd1, 0x94, 0xc7, 0x09, 0xd1, 0x8c, 0xe3, 0xdb, 0xd0, 0xba, 0x35, 0x0a, 0x96, 0xb1, 0x6c,
+  0x91, 0xb5, 0x25, 0x8b, 0xac, 0xdd, 0xd9, 0x9a, 0x0f, 0xea, 0x8f, 0x4e, 0xbb, 0x45, 0x47, 0x92,
+  0x32, 0x5b, 0x57, 0xe9, 0x08, 0x64, 0xe1, 0x90, 0x77, 0xf6, 0x48, 0xc2, 0x21, 0xe5, 0x43, 0x98,
+  0x3d, 0xe8, 0xf2, 0xf4, 0xdd, 0xd9, 0xd9, 0x1b, 0x89, 0x19, 0x4d, 0xa2, 0x20, 0x13, 0x7a, 0x36,
+  0xd8, 0xc2, 0x99, 0xda, 0x59, 0xce, 0x44, 0x67, 0xe8, 0xee, 0xa3, 0x56, 0x42, 0x7f, 0xa5, 0xbc,
+  0x05, 0x9e, 0x6f, 0x51, 0xc5, 0x2a, 0x92, 0xf8, 0xb0, 0xba, 0x15, 0x1a, 0x44, 0xaa, 0x5e, 0xd3,
+  0x65, 0x3a, 0x08, 0xa3, 0x42, 0xe4, 0xdc, 0x57, 0x9b, 0x68, 0x74, 0xff, 0x09, 0xea, 0x04, 0x8d,
+  0x77, 0xb3, 0x1a, 0x41, 0x45, 0xb6, 0x1a, 0xf6, 0xdc, 0xdd, 0x85, 0x85, 0x33, 0xc9, 0x60, 0x72,
+  0x18, 0x64, 0xf1, 0x70, 0x79, 0x04, 0x16, 0xd4, 0xc2, 0x42, 0xc0, 0xdc, 0xd3, 0x57, 0xe7, 0x67,
+  0xca, 0x9b, 0x93, 0xf7, 0xb2, 0xec, 0xf3, 0xad, 0xd5, 0x46, 0x7a, 0x13, 0x87, 0x20, 0x36, 0xa5,
+  0x1f, 0x2c, 0x1c, 0xd7, 0x86, 0xc9, 0x30, 0xea, 0x4d, 0x13, 0x8c, 0x8e, 0x4e, 0x55, 0xc6, 0x01,
+  0xe9, 0x2c, 0x76, 0x8e, 0x8b, 0x94, 0xa6, 0xfe, 0x4b, 0x44, 0x22, 0x05, 0xc5, 0x2a, 0x64, 0x06,
+  0xe0, 0xe5, 0xa1, 0xc8, 0x0a, 0x41, 0xa9, 0x3a, 0xc9, 0x85, 0x8e, 0x43, 0x2a, 0x64, 0x4d, 0x2a,
+  0xe7, 0xcb, 0x16, 0x01, 0x5d, 0x10, 0x7e, 0xc9, 0xb9, 0x40, 0x7e, 0x9e, 0x69, 0xfe, 0x7b, 0x52,
+  0x30, 0xc9, 0x8e, 0xae, 0x16, 0x37, 0x53, 0x77, 0x08, 0x26, 0x68, 0x9b, 0x3b, 0x25, 0xb5, 0xcb,
+  0x79, 0x77, 0xf3, 0xfe, 0x78, 0xec, 0x3c, 0xeb, 0x09, 0x9a, 0xfb, 0xf7, 0x4c, 0x7d, 0x06, 0x35,
+  0x2a, 0xd2, 0xab, 0xd1, 0xbb, 0xcd, 0xa7, 0xbd, 0x53, 0xea, 0x7b, 0x77, 0x76, 0x79, 0xf1, 0xf6,
+  0xcd, 0xe5, 0xab, 0xf7, 0x67, 0x29, 0xf5, 0x55, 0xea, 0xc9, 0x2c, 0x45, 0x2e, 0x4f, 0xab, 0xda,
+  0x4a, 0x53, 0xa9, 0xb6, 0xb9, 0x3e, 0x24, 0x13, 0x2d, 0xd9, 0x56, 0x2c, 0xd1, 0xe3, 0x5a, 0x36,
+  0x43, 0xd2, 0x94, 0x02, 0x4c, 0x4e, 0x66, 0xf2, 0x1c, 0x92, 0xd0, 0x15, 0xd9, 0x21, 0x15, 0xcc,
+  0x20, 0x67, 0x3b, 0xd1, 0x75, 0x3e, 0xe6, 0x97, 0x9f, 0x63, 0x23, 0xa7, 0x42, 0x2b, 0xf5, 0x11,
+  0xb4, 0x3b, 0x19, 0x05, 0x29, 0x73, 0xce, 0x3f, 0xb7, 0x7d, 0x77, 0x97, 0x3d, 0x41, 0x5f, 0x12,
+  0x6e, 0x36, 0x96, 0xe0, 0xa6, 0xac, 0xb1, 0x22, 0xe2, 0x23, 0x9f, 0x83, 0x53, 0xca, 0xce, 0x90,
+  0x8b, 0x37, 0xec, 0x64, 0x8e, 0xc9, 0xd1, 0xd2, 0x40, 0xb8, 0xc0, 0x42, 0xa6, 0x1c, 0x9b, 0xe9,
+  0x59, 0x56, 0xd9, 0xc5, 0x8c, 0xb5, 0x48, 0x35, 0x23, 0x7d, 0x5f, 0xf6, 0xe3, 0x91, 0x7b, 0x44,
+  0x3a, 0x8d, 0xd4, 0xe0, 0x70, 0x6a, 0x52, 0xec, 0x3a, 0x59, 0x3c, 0xc9, 0x32, 0xe1, 0x41, 0xaa,
+  0xd3, 0x2d, 0x61, 0x02, 0x3c, 0x09, 0xde, 0xe6, 0x3c, 0x76, 0x68, 0x63, 0x08, 0xba, 0x48, 0x60,
+  0xe8, 0xb4, 0x0c, 0xa4, 0x8b, 0x22, 0xb7, 0x02, 0x5d, 0xee, 0xc7, 0xc7, 0x3c, 0x2d, 0xf3, 0x8f,
+  0x8f, 0x79, 0x56, 0x69, 0xcc, 0x9e, 0x7b, 0xbc, 0xb7, 0xf7, 0xe3, 0x77, 0x9a, 0xc6, 0x68, 0x2d,
+  0xfd, 0x27, 0x93, 0x6e, 0x55, 0x7a, 0xac, 0x69, 0x3c, 0x29, 0xb5, 0x13, 0x2a, 0x63, 0xcf, 0x8a,
+  0xa2, 0xe1, 0x3e, 0xcc, 0x0b, 0xe6, 0x82, 0xb6, 0xdd, 0x95, 0xf4, 0x44, 0xf3, 0x72, 0xcf, 0xbc,
+  0xf9, 0xfe, 0xf1, 0x8f, 0x78, 0xfc, 0x08, 0xed, 0xa1, 0xa7, 0xc1, 0xa7, 0xe1, 0x3e, 0x3b, 0xe2,
+  0x0f, 0xff, 0xc1, 0x0b, 0x7e, 0x86, 0x68, 0xff, 0xb5, 0x61, 0x2a, 0x2d, 0xbd, 0x7d, 0x7a, 0x84,
+  0x7f, 0x15, 0x53, 0x3f, 0x6a, 0x2a, 0x47, 0x7a, 0xc7, 0x50, 0xe0, 0x5f, 0x73, 0x6c, 0xe0, 0x6d,
+  0x4b, 0x6f, 0xf6, 0x94, 0x0e, 0x3c, 0x6d, 0x2b, 0x86, 0x81, 0x3f, 0x51, 0x4f, 0x37, 0x8f, 0xb4,
+  0xa6, 0x0e, 0x77, 0x86, 0xa1, 0xc1, 0x83, 0xb1, 0x86, 0x05, 0x35, 0x2c, 0xa8, 0x75, 0xf0, 0x81,
+  0xc6, 0x9e, 0x7f, 0x9e, 0x23, 0x85, 0xe0, 0x7b, 0x68, 0xb7, 0xa3, 0x34, 0xb4, 0x36, 0x5c, 0x98,
+  0x2d, 0xf8, 0x69, 0x47, 0xec, 0x42, 0x69, 0xe3, 0xff, 0x0a, 0xde, 0x28, 0x78, 0xc3, 0x2e, 0xf0,
+  0x19, 0xd4, 0xd5, 0xba, 0xd8, 0x70, 0x07, 0x2b, 0x36, 0x15, 0x43, 0x6f, 0xb6, 0xe0, 0xa7, 0x19,
+  0xe1, 0x85, 0xd2, 0x64, 0xff, 0x6a, 0xec, 0x46, 0x63, 0x17, 0x1a, 0x5e, 0x34, 0x3f, 0xef, 0x3f,
+  0x3e, 0xfe, 0x11, 0x8f, 0x41, 0xc1, 0x5f, 0xc0, 0x06, 0xe6, 0xc6, 0x5e, 0x58, 0x7e, 0x82, 0x94,
+  0x78, 0xff, 0xf8, 0xea, 0xdd, 0xab, 0x37, 0x67, 0xf4, 0x14, 0x2e, 0x4f, 0xa0, 0x2c, 0x5e, 0xf1,
+  0x9f, 0x3d, 0x51, 0x29, 0x87, 0xdc, 0x3c, 0xc2, 0x31, 0x5b, 0xe6, 0xbe, 0xe2, 0xda, 0xfc, 0xea,
+  0x58, 0x7e, 0x67, 0xb3, 0x17, 0x76, 0x00, 0x7d, 0xb1, 0xe6, 0x18, 0x08, 0xa2, 0xf4, 0xd5, 0x27,
+  0x78, 0xf1, 0xca, 0xf6, 0x9c, 0xa4, 0x6b, 0xd6, 0x25, 0xcb, 0x58, 0x2c, 0x5a, 0x71, 0x47, 0x0a,
+  0x2e, 0xfc, 0x7d, 0x25, 0xf0, 0xc7, 0x9e, 0x3b, 0xbe, 0x1e, 0xee, 0xe3, 0xb1, 0xcc, 0x67, 0xe1,
+  0x81, 0x6a, 0x87, 0x97, 0x4e, 0xac, 0xd6, 0xf6, 0x15, 0x72, 0x97, 0x0f, 0xf7, 0xe1, 0x2e, 0x86,
+  0xb5, 0x13, 0xed, 0x2b, 0x18, 0xb8, 0xcc, 0x0e, 0x14, 0xc8, 0x4f, 0xb1, 0x5f, 0x77, 0x04, 0xf7,
+  0xbb, 0xd1, 0x43, 0x4f, 0x37, 0x5a, 0x38, 0x6d, 0xbd, 0xd6, 0x18, 0xc4, 0x9b, 0xa6, 0x37, 0xf5,
+  0x46, 0x47, 0x03, 0x92, 0xa0, 0x9f, 0x5e, 0x0b, 0x66, 0x43, 0x6f, 0x9a, 0x9a, 0xde, 0x80, 0xff,
+  0x3b, 0xf0, 0xba, 0x71, 0x84, 0x4f, 0x3d, 0x53, 0x6f, 0xe0, 0x2c, 0xb4, 0xbb, 0x96, 0xde, 0xea,
+  0xc1, 0x7f, 0x78, 0xe4, 0xa9, 0xa1, 0x1b, 0x58, 0xc8, 0xf0, 0xe0, 0x45, 0xcf, 0x04, 0x8a, 0x69,
+  0x9a, 0xf2, 0x5b, 0x4d, 0x6f, 0xf7, 0x34, 0xdd, 0x34, 0x3d, 0x98, 0xf6, 0x66, 0x0f, 0x04, 0xf2,
+  0x18, 0x9e, 0x40, 0xe3, 0x5d, 0x28, 0x0e, 0x8d, 0xe9, 0x47, 0x38, 0xfb, 0x26, 0xb5, 0x0e, 0x4f,
+  0x3b, 0x50, 0xaa, 0xdd, 0x82, 0xfa, 0x5d, 0xf8, 0x8f, 0xd7, 0x6f, 0x75, 0xe1, 0x7f, 0x63, 0x06,
+  0x2d, 0x77, 0x5b, 0x50, 0xd9, 0x24, 0xe0, 0x5a, 0x40, 0x99, 0x00, 0x53, 0xeb, 0x08, 0x5e, 0x51,
+  0x45, 0x05, 0x2b, 0x62, 0xdb, 0x3d, 0xa4, 0x39, 0x43, 0x37, 0x9a, 0x7a, 0xbb, 0x43, 0x6d, 0x53,
+  0xd3, 0xd8, 0x39, 0x74, 0xd2, 0xc9, 0x83, 0x06, 0x90, 0x9d, 0x03, 0xdd, 0xb6, 0x94, 0xae, 0xde,
+  0x3d, 0x82, 0xea, 0x80, 0x12, 0xd3, 0x80, 0xf1, 0x76, 0xb1, 0x69, 0xb8, 0x81, 0x71, 0xe1, 0xa0,
+  0x31, 0xa1, 0x03, 0x10, 0xaa, 0xde, 0x68, 0xeb, 0x4d, 0xc4, 0x06, 0x81, 0x0c, 0x3f, 0xbd, 0x56,
+  0x04, 0x38, 0x02, 0x14, 0xb1, 0x1b, 0xec, 0x87, 0x17, 0xce, 0x76, 0xc4, 0x5a, 0x42, 0x04, 0x29,
+  0x88, 0xa0, 0x31, 0xf5, 0x03, 0x30, 0x1d, 0xe9, 0x66, 0x8f, 0x41, 0xe1, 0x09, 0x08, 0xc7, 0x3a,
+  0xf4, 0xd1, 0x55, 0x10, 0x3b, 0xfa, 0x91, 0x22, 0x06, 0x90, 0x8c, 0x10, 0x41, 0x30, 0x5b, 0xf8,
+  0x5f, 0xcb, 0x20, 0x34, 0x19, 0x33, 0x42, 0x0c, 0xe1, 0x45, 0xd1, 0x5b, 0x30, 0x59, 0x06, 0x20,
+  0x05, 0x71, 0x63, 0x78, 0x02, 0xa1, 0x63, 0x36, 0x09, 0x30, 0xe3, 0x80, 0x17, 0x18, 0x36, 0x6b,
+  0x97, 0x4f, 0x29, 0x9b, 0x15, 0x04, 0x87, 0x46, 0x8d, 0xad, 0xf0, 0x29, 0x4b, 0x26, 0x74, 0x4c,
+  0x73, 0x8c, 0x25, 0x08, 0xe7, 0x5a, 0x32, 0xe5, 0xf0, 0xc4, 0x20, 0x82, 0xf8, 0x8c, 0x2c, 0xc6,
+  0x68, 0xeb, 0x9d, 0x93, 0xa6, 0xde, 0x51, 0xf0, 0x7f, 0xe0, 0x0a, 0x06, 0x3c, 0x83, 0x26, 0xad,
+  0xf4, 0x51, 0xc3, 0x68, 0x00, 0x73, 0x31, 0xe5, 0xe5, 0xcb, 0x16, 0xc4, 0xbd, 0x56, 0xc6, 0xeb,
+  0xc0, 0x97, 0x56, 0x06, 0xdc, 0xb9, 0x31, 0xa6, 0xd2, 0x97, 0x17, 0x46, 0xf2, 0x90, 0xad, 0x0b,
+  0xb8, 0xdd, 0x71, 0x5d, 0x28, 0xcd, 0x97, 0x6d, 0xcb, 0x54, 0x4c, 0x36, 0x71, 0x70, 0xb1, 0x32,
+  0x8c, 0xe4, 0x1e, 0x7e, 0x67, 0x4d, 0x20, 0x74, 0xc5, 0x58, 0x99, 0x33, 0xa3, 0xb1, 0xd2, 0x80,
+  0xac, 0x61, 0xfc, 0xb3, 0x66, 0x5a, 0x42, 0x33, 0xdf, 0xcb, 0xf5, 0x35, 0x93, 0xf8, 0x23, 0x34,
+  0xfa, 0xbe, 0x3d, 0x33, 0x5a, 0xd0, 0xd8, 0xef, 0x1c, 0xfb, 0xcf, 0xee, 0xc4, 0x95, 0x06, 0xff,
+  0xb3, 0xfb, 0xdc, 0xcd, 0x8e, 0x9c, 0x3d, 0x61, 0xc3, 0xc6, 0xc2, 0xbb, 0x8d, 0x5b, 0xe9, 0x79,
+  0x00, 0xf4, 0xb8, 0xa5, 0xf7, 0x8e, 0x34, 0xfc, 0x03, 0x20, 0xe3, 0xf2, 0x64, 0x97, 0xb0, 0x12,
+  0x3d, 0x18, 0xc9, 0xa9, 0xd1, 0xd1, 0x7b, 0x4d, 0x20, 0xc3, 0x1e, 0x8a, 0x8f, 0x46, 0x97, 0x5d,
+  0x41, 0xd5, 0xcf, 0xf3, 0xae, 0xd2, 0xf5, 0x18, 0xb3, 0x6e, 0x5a, 0x40, 0x9c, 0x4d, 0x14, 0x34,
+  0xf8, 0x97, 0x90, 0x00, 0x13, 0xff, 0x79, 0xae, 0xb5, 0xb4, 0x16, 0x75, 0x81, 0x52, 0x82, 0x89,
+  0x8a, 0x23, 0x5c, 0xa9, 0x74, 0x05, 0x54, 0xc1, 0x7b, 0x68, 0x23, 0x5f, 0x22, 0xe6, 0x84, 0x0b,
+  0x92, 0x5d, 0x81, 0x48, 0x6a, 0xfe, 0x4e, 0xac, 0xbd, 0xb0, 0x3c, 0x09, 0x69, 0x7c, 0x3f, 0x25,
+  0x8b, 0xb7, 0xe4, 0x21, 0x43, 0x1d, 0xdc, 0xee, 0x84, 0x39, 0x13, 0xc8, 0xbe, 0xf3, 0xbe, 0x95,
+  0x99, 0xf2, 0x97, 0xdd, 0x1c, 0x05, 0x99, 0x19, 0x0a, 0x92, 0x6f, 0x91, 0x3e, 0x50, 0x90, 0x32,
+  0xde, 0x8a, 0xa2, 0xd9, 0x38, 0x37, 0x00, 0x21, 0x86, 0x07, 0xe3, 0x7e, 0x09, 0x48, 0xd5, 0x5a,
+  0x9f, 0x5f, 0x9b, 0x4a, 0x67, 0x65, 0xb4, 0xb2, 0x6d, 0xb4, 0x80, 0xf8, 0x5e, 0xb6, 0xde, 0x77,
+  0x5e, 0xee, 0xb6, 0x98, 0x72, 0x58, 0x39, 0x41, 0xaf, 0xc1, 0x41, 0x8a, 0x11, 0xba, 0xcf, 0xe2,
+  0x83, 0x3d, 0xda, 0x51, 0xb9, 0x30, 0x2d, 0x98, 0x42, 0x83, 0x82, 0x6b, 0x1b, 0xe8, 0xa5, 0x50,
+  0xc4, 0x6d, 0x03, 0x51, 0x00, 0xd3, 0x0f, 0x4b, 0xa6, 0x3d, 0xd3, 0xcc, 0x95, 0xd6, 0x99, 0x99,
+  0xab, 0x0e, 0xc9, 0x7d, 0xb8, 0x7d, 0x7f, 0x04, 0x77, 0xe5, 0x03, 0xe0, 0xe2, 0xf2, 0x31, 0x53,
+  0x8a, 0xaa, 0xd4, 0x29, 0x39, 0x1b, 0x72, 0xa9, 0x4e, 0x35, 0xb7, 0xdc, 0x04, 0x0b, 0xa8, 0xfd,
+  0xb1, 0xe9, 0xa5, 0x2b, 0x78, 0xeb, 0xce, 0xa7, 0x74, 0x1f, 0xc5, 0xa1, 0x63, 0xcd, 0xf7, 0x93,
+  0x82, 0xae, 0xed, 0x00, 0x32, 0xbc, 0x78, 0xb8, 0x7f, 0x0e, 0xb6, 0x85, 0xc2, 0x5f, 0x67, 0x95,
+  0x83, 0xc5, 0x8c, 0xb5, 0x85, 0xbf, 0x09, 0x6e, 0x63, 0x3a, 0x55, 0x78, 0x49, 0xe5, 0x01, 0xbd,
+  0xf9, 0x1a, 0x60, 0x16, 0x66, 0xb5, 0x08, 0x96, 0x19, 0x76, 0x27, 0x2c, 0x77, 0x95, 0x36, 0x10,
+  0x81, 0x87, 0x4a, 0x57, 0x5e, 0xfb, 0xc9, 0x28, 0x3f, 0x2c, 0x1f, 0x2c, 0x28, 0x40, 0xd6, 0x42,
+  0x89, 0x03, 0x85, 0x72, 0xab, 0xf2, 0x11, 0xe4, 0x54, 0x91, 0xa2, 0x12, 0x04, 0x46, 0x3f, 0x47,
+  0x10, 0x5c, 0xf0, 0x57, 0xa4, 0xdd, 0x82, 0xa2, 0x53, 0x62, 0xdd, 0xef, 0xe7, 0xf4, 0xae, 0xd1,
+  0x54, 0xe1, 0x99, 0x45, 0x37, 0x8d, 0x68, 0xec, 0x86, 0x63, 0xcf, 0x51, 0xc6, 0xf0, 0xd8, 0x30,
+  0x01, 0xe7, 0xb7, 0xec, 0x37, 0x1c, 0xee, 0x77, 0x92, 0x71, 0x9d, 0xa3, 0x9d, 0x96, 0x69, 0x9b,
+  0xb2, 0x75, 0x32, 0xe0, 0xd8, 0xe5, 0x71, 0xa3, 0xd1, 0x6f, 0x34, 0xf2, 0x8a, 0x5d, 0x11, 0x1c,
+  0xb0, 0x92, 0x59, 0x35, 0xb8, 0x78, 0x6a, 0xd9, 0x53, 0x98, 0xd9, 0xdc, 0x90, 0x50, 0x91, 0x7f,
+  0x18, 0xc0, 0xdd, 0x04, 0xe0, 0x77, 0x67, 0xa7, 0x95, 0xf0, 0x42, 0xc7, 0x57, 0x1b, 0x40, 0x2e,
+  0x51, 0x60, 0x05, 0xe4, 0x91, 0x68, 0x20, 0x3a, 0x1f, 0x01, 0x3b, 0xfa, 0xfb, 0xfb, 0x17, 0x27,
+  0x1b, 0x54, 0x58, 0x9e, 0xd6, 0x93, 0xd5, 0x11, 0x37, 0xc7, 0x65, 0x05, 0x59, 0x4e, 0x4c, 0x5e,
+  0x90, 0xdf, 0x1c, 0xe7, 0x4b, 0x50, 0x72, 0xcc, 0x44, 0xb9, 0x2d, 0xb6, 0xc2, 0x52, 0x03, 0xb2,
+  0x46, 0xf8, 0xb5, 0x28, 0xc6, 0x16, 0xeb, 0x29, 0x4b, 0x82, 0xa1, 0x80, 0x6a, 0xcd, 0x16, 0xa3,
+  0xac, 0x5a, 0x73, 0xf3, 0x26, 0xcb, 0xa7, 0xc0, 0x58, 0xe5, 0x39, 0xd3, 0x58, 0xb3, 0xb0, 0x36,
+  0x2e, 0x2e, 0xab, 0x97, 0x57, 0xa2, 0x1b, 0x13, 0x8d, 0x5f, 0xf2, 0x55, 0x5a, 0x35, 0x91, 0x8c,
+  0xb1, 0x8f, 0x03, 0x68, 0x71, 0xfb, 0xb2, 0xaa, 0x60, 0xa4, 0x0c, 0x40, 0xdb, 0x99, 0x24, 0xf0,
+  0xbd, 0x43, 0xf2, 0xca, 0x01, 0x08, 0xcf, 0xc0, 0x42, 0x06, 0xec, 0x15, 0x60, 0x4c, 0xde, 0xdc,
+  0x93, 0x08, 0x05, 0xec, 0xd8, 0xdb, 0x6e, 0x04, 0x79, 0x8f, 0x21, 0x9c, 0x5a, 0x0b, 0x69, 0x08,
+  0x63, 0x6b, 0x11, 0x2f, 0x43, 0xe7, 0x62, 0x16, 0xc4, 0x81, 0x04, 0xff, 0x29, 0x7b, 0xac, 0xd0,
+  0xf3, 0x87, 0xad, 0x96, 0xa6, 0x6e, 0x22, 0x78, 0x09, 0xea, 0x7b, 0x8a, 0x79, 0x0e, 0x4a, 0x36,
+  0xe8, 0x0a, 0x2f, 0x5b, 0x9b, 0x05, 0x66, 0x27, 0xa3, 0x5f, 0x75, 0x32, 0xc2, 0x16, 0x0d, 0x03,
+  0xe3, 0xe8, 0xdc, 0x00, 0x03, 0xf3, 0x25, 0x68, 0x22, 0xa0, 0x90, 0xb4, 0x2d, 0x34, 0x37, 0x51,
+  0xff, 0x6c, 0x68, 0x20, 0x84, 0xd8, 0x4d, 0x83, 0x24, 0xd2, 0x83, 0xa6, 0xf8, 0xd2, 0x02, 0x86,
+  0x96, 0x22, 0x28, 0x82, 0xdb, 0xab, 0xe0, 0xf2, 0x99, 0x3c, 0xb9, 0xf0, 0x08, 0x99, 0xed, 0xe5,
+  0x33, 0x8a, 0x48, 0xdb, 0x4d, 0x6a, 0x1e, 0x95, 0xa8, 0x9a, 0x79, 0x21, 0x9f, 0x19, 0xf7, 0x91,
+  0x87, 0x4a, 0x14, 0xe8, 0x0b, 0xa0, 0x10, 0x75, 0x2c, 0x54, 0xb7, 0xd8, 0x18, 0x3b, 0x0a, 0xbb,
+  0xc6, 0x21, 0x82, 0x68, 0x05, 0x0b, 0xad, 0xc1, 0xd4, 0xcd, 0xc6, 0xaa, 0xf5, 0xa0, 0x01, 0x9f,
+  0x9f, 0x3d, 0x2b, 0xd0, 0x34, 0x3c, 0x93, 0x06, 0xcc, 0xd2, 0x1c, 0x63, 0xb9, 0x5d, 0x15, 0x84,
+  0xd3, 0x2e, 0x98, 0x1e, 0x30, 0x18, 0x98, 0x0d, 0xbc, 0x68, 0x2b, 0xbd, 0x31, 0x94, 0x64, 0x96,
+  0x0e, 0x68, 0xdd, 0x2d, 0xb4, 0x3c, 0xe0, 0x31, 0x98, 0x62, 0xef, 0x8d, 0xa3, 0x31, 0xda, 0x20,
+  0x6d, 0xbd, 0xd5, 0x56, 0xc8, 0x47, 0x31, 0x43, 0xa3, 0x88, 0x66, 0x54, 0xa3, 0x67, 0x9a, 0xb1,
+  0x42, 0x27, 0x42, 0x67, 0x6c, 0xe8, 0x5d, 0x34, 0x3f, 0xcc, 0x23, 0x54, 0x3c, 0xd1, 0x44, 0x6a,
+  0x6a, 0xd8, 0x02, 0xfa, 0x12, 0x40, 0x7b, 0x44, 0xc2, 0x68, 0x6a, 0x47, 0xf8, 0xef, 0xe7, 0x39,
+  0xa8, 0x69, 0x60, 0x43, 0xa2, 0xde, 0x8e, 0x5a, 0x08, 0x90, 0x0a, 0xfc, 0x99, 0x99, 0xef, 0x7b,
+  0xa8, 0x80, 0x90, 0x12, 0x32, 0x87, 0x19, 0xe8, 0xe0, 0x4b, 0x03, 0x6e, 0x35, 0x03, 0xd5, 0x76,
+  0x2c, 0x9b, 0x03, 0x25, 0x4a, 0x40, 0x28, 0xc5, 0x6c, 0x86, 0xc3, 0xa1, 0xc3, 0x2a, 0xe5, 0xbf,
+  0x91, 0xe3, 0x39, 0xe3, 0x38, 0xf3, 0xd6, 0x4b, 0xd8, 0xfb, 0x25, 0x5e, 0x03, 0xc6, 0x67, 0x98,
+  0x9f, 0x02, 0x1d, 0x08, 0xf8, 0xfb, 0xce, 0x89, 0x24, 0x94, 0xc3, 0x1d, 0x6e, 0x6d, 0xbb, 0x01,
+  0x7d, 0xc0, 0x2c, 0x58, 0x50, 0x96, 0x87, 0x95, 0xe5, 0x2d, 0xe1, 0x5d, 0x13, 0x64, 0x03, 0x13,
+  0x0e, 0xec, 0x79, 0xa1, 0x40, 0x1b, 0xf8, 0x0d, 0xf5, 0xef, 0xd8, 0xc7, 0x1b, 0x0b, 0x76, 0xf7,
+  0x8f, 0x37, 0xbd, 0xee, 0xed, 0x1f, 0x5f, 0x6e, 0x7a, 0x6f, 0x34, 0xf6, 0x8f, 0xff, 0x7b, 0xd3,
+  0x7b, 0x13, 0x1a, 0xc8, 0x16, 0x78, 0xcc, 0x00, 0xdb, 0x44, 0x96, 0x39, 0x52, 0x7c, 0x7e, 0x29,
+  0x53, 0xe2, 0xd2, 0xf3, 0xa2, 0x71, 0xe8, 0x38, 0xbb, 0x69, 0x51, 0x60, 0xcd, 0xb4, 0x5e, 0xb6,
+  0x57, 0xed, 0x59, 0x1b, 0x89, 0xe0, 0x68, 0xa5, 0x35, 0x71, 0xe2, 0xb5, 0xd6, 0x0c, 0x75, 0xd1,
+  0xe6, 0xfb, 0x36, 0xbe, 0x03, 0x6d, 0xd5, 0x54, 0x8e, 0x80, 0xaf, 0x00, 0x65, 0x40, 0x31, 0xd2,
+  0x5b, 0x9b, 0x60, 0xe0, 0x82, 0x46, 0x0e, 0x4f, 0x9a, 0xab, 0x26, 0x14, 0x86, 0x87, 0xed, 0x8d,
+  0x7a, 0x2b, 0x2a, 0x9e, 0x55, 0x5a, 0xeb, 0xe5, 0xd9, 0x15, 0x26, 0xc6, 0xbd, 0xe4, 0x59, 0xd6,
+  0xca, 0x35, 0x57, 0xd9, 0xd7, 0x44, 0x7e, 0x60, 0xee, 0x70, 0x0a, 0xc9, 0xc7, 0x93, 0x7d, 0x3f,
+  0x83, 0x21, 0xce, 0xcc, 0xff, 0x38, 0x7e, 0xfe, 0xe3, 0xf8, 0xf9, 0xd3, 0x38, 0x7e, 0x4e, 0x2d,
+  0xd0, 0x88, 0x2d, 0x45, 0x38, 0x30, 0xc1, 0xd0, 0x03, 0xfa, 0xdd, 0x60, 0xb5, 0x8e, 0xbd, 0x20,
+  0x72, 0x64, 0xc7, 0x68, 0xb5, 0xae, 0x44, 0xf9, 0xb4, 0xf6, 0xe5, 0x5d, 0xa4, 0x9c, 0x8b, 0xa7,
+  0x03, 0x28, 0x3a, 0x07, 0x64, 0xb5, 0x7b, 0xe8, 0x5b, 0x00, 0xf0, 0x1b, 0x78, 0x89, 0x4f, 0x49,
+  0x59, 0xa0, 0x0b, 0xf6, 0xcc, 0x40, 0x81, 0xc5, 0x4a, 0xb2, 0xa7, 0xf4, 0x08, 0x48, 0x0c, 0xaf,
+  0xe9, 0xb1, 0xc1, 0xfe, 0x63, 0xd7, 0xec, 0x79, 0x99, 0x41, 0x5b, 0xa2, 0x3f, 0xdb, 0xa3, 0xfc,
+  0x32, 0x8e, 0x48, 0xbb, 0xdb, 0xbe, 0x88, 0x81, 0xd0, 0x8e, 0x80, 0x13, 0x75, 0x90, 0x85, 0x01,
+  0x63, 0x6a, 0x12, 0x5f, 0x32, 0x1a, 0xc0, 0xbd, 0x80, 0x9b, 0xa1, 0x9e, 0x83, 0x6f, 0x66, 0x5d,
+  0xfc, 0xa3, 0xb1, 0xbf, 0x60, 0x73, 0xcf, 0xcc, 0xcf, 0xc0, 0xfd, 0x7a, 0x2b, 0xa8, 0x02, 0xa5,
+  0x5b, 0x2b, 0x92, 0x7e, 0x2f, 0x41, 0x32, 0x02, 0x3f, 0x20, 0x67, 0x82, 0xc1, 0x9c, 0x5a, 0xc0,
+  0x0f, 0x3b, 0x9c, 0x1f, 0xb6, 0x90, 0xcd, 0xb5, 0xde, 0x37, 0xa9, 0x7e, 0x3a, 0xa8, 0x57, 0x98,
+  0xfe, 0x4c, 0x39, 0xb1, 0x71, 0x4f, 0x73, 0x8e, 0x27, 0x93, 0x4a, 0x06, 0x37, 0x99, 0x66, 0x0d,
+  0x8a, 0x09, 0xce, 0x81, 0x6c, 0xe2, 0x4c, 0xd0, 0x9e, 0x59, 0x5a, 0x9e, 0x1b, 0xdf, 0x0a, 0x83,
+  0x48, 0x2a, 0x1e, 0xde, 0x40, 0x71, 0xca, 0xca, 0xa2, 0x50, 0x12, 0xa7, 0x7d, 0x4a, 0xdc, 0xc4,
+  0x0d, 0x16, 0x5e, 0x6d, 0x5f, 0x99, 0xbb, 0xfe, 0x70, 0x1f, 0x26, 0x7c, 0x6e, 0x01, 0xa6, 0x3a,
+  0xcd, 0x7d, 0x49, 0xca, 0x00, 0xe1, 0x50, 0x75, 0xa8, 0xb9, 0x3a, 0x50, 0x45, 0x15, 0x46, 0x36,
+  0x12, 0x14, 0xe1, 0x8a, 0xb5, 0xb9, 0x12, 0x6d, 0x1e, 0x1b, 0x66, 0xc6, 0x4a, 0xae, 0xb4, 0x7e,
+  0x76, 0x1a, 0xe0, 0x53, 0xda, 0xad, 0xf6, 0x9d, 0x28, 0xba, 0xef, 0x18, 0x59, 0x4d, 0x3e, 0x44,
+  0xcd, 0xe4, 0x63, 0x34, 0x93, 0x21, 0x36, 0xf2, 0x23, 0x64, 0x15, 0xaa, 0x07, 0xc8, 0x1b, 0x3c,
+  0x6e, 0x7c, 0xc5, 0xe1, 0x91, 0x81, 0x67, 0x45, 0xf1, 0x7d, 0x07, 0x27, 0xea, 0xdd, 0x63, 0x78,
+  0xa2, 0x4a, 0xf5, 0x00, 0x93, 0x46, 0xbf, 0xea, 0x10, 0x2f, 0x2d, 0xb0, 0x7a, 0x28, 0x4a, 0xec,
+  0xbe, 0x83, 0x84, 0x9a, 0xf7, 0x18, 0x1f, 0x94, 0xae, 0x1e, 0x1a, 0x36, 0xb5, 0xeb, 0xa8, 0xec,
+  0x8c, 0xd2, 0xf9, 0x10, 0xee, 0x82, 0x2a, 0x92, 0xb0, 0x2e, 0x1a, 0x92, 0x75, 0xd1, 0x20, 0xeb,
+  0xa2, 0xa3, 0x1c, 0x55, 0xbf, 0x04, 0xf9, 0x5b, 0x5d, 0x35, 0xe1, 0x1f, 0x2c, 0xf5, 0x56, 0xc2,
+  0x35, 0xc8, 0xdf, 0x98, 0xb8, 0x4d, 0xa6, 0xb2, 0xba, 0x37, 0x05, 0x56, 0x7f, 0xa0, 0x5a, 0x37,
+  0x23, 0xb5, 0x1e, 0xcf, 0xdc, 0x28, 0x8f, 0x20, 0x91, 0x58, 0x6b, 0xff, 0xf8, 0x64, 0x09, 0xd6,
+  0xd7, 0xcf, 0x98, 0x31, 0x44, 0x79, 0x6a, 0x79, 0x98, 0x73, 0x4e, 0x60, 0x4b, 0x9e, 0x1e, 0x4a,
+  0xf0, 0x34, 0x0a, 0x3e, 0x81, 0x55, 0xca, 0x52, 0x3d, 0x15, 0x9a, 0xa3, 0xb4, 0x4f, 0xfb, 0xc7,
+  0x09, 0xaa, 0xa9, 0xf9, 0x9d, 0x60, 0x9c, 0x8e, 0x77, 0x82, 0xf1, 0x05, 0xfa, 0x23, 0xb9, 0x63,
+  0xe4, 0x8f, 0x06, 0xd1, 0xd9, 0x0d, 0xc4, 0xb3, 0x4f, 0x8b, 0x20, 0x02, 0x53, 0xff, 0x0f, 0x06,
+  0x6f, 0x36, 0x77, 0xc3, 0x30, 0x08, 0xb7, 0x81, 0xf8, 0x32, 0x08, 0xdd, 0xcf, 0x18, 0xe9, 0xe5,
+  0x29, 0xaf, 0xa9, 0xc2, 0x46, 0x30, 0xbf, 0x1e, 0x78, 0xab, 0x89, 0xe7, 0x2e, 0xb6, 0x01, 0xf7,
+  0xde, 0x09, 0x63, 0x77, 0x0c, 0xa0, 0x3d, 0x87, 0xc2, 0x7f, 0x10, 0x60, 0xa3, 0xc5, 0xd6, 0x69,
+  0x7d, 0xea, 0x41, 0xdb, 0xca, 0x85, 0xfb, 0x09, 0x5a, 0x3a, 0x0d, 0x42, 0x1e, 0x37, 0xf4, 0x07,
+  0xc1, 0x77, 0xb3, 0x1d, 0x3e, 0xb6, 0x70, 0xef, 0x05, 0xdf, 0xd7, 0xa7, 0x3f, 0xcf, 0xf1, 0xb7,
+  0x02, 0x7a, 0xee, 0xf8, 0xd1, 0x3f, 0x01, 0x42, 0x6b, 0x84, 0x3a, 0xef, 0x01, 0x83, 0x4d, 0x18,
+  0xbe, 0xe7, 0x01, 0x26, 0x75, 0xfc, 0x8d, 0xe9, 0x2d, 0x75, 0x25, 0x9e, 0x39, 0xbe, 0x12, 0x26,
+  0x3e, 0x82, 0xba, 0x72, 0x83, 0x0f, 0xe0, 0x29, 0x7e, 0x6b, 0xe8, 0x5a, 0x19, 0x5b, 0xbe, 0x1f,
+  0xc4, 0xca, 0xb5, 0xe3, 0x2c, 0x94, 0xe5, 0xa2, 0x9a, 0x01, 0xd8, 0xd6, 0x02, 0xc3, 0xa9, 0x94,
+  0xa7, 0x2e, 0x80, 0x19, 0x6f, 0xe1, 0x01, 0x14, 0xeb, 0x30, 0x3a, 0x19, 0x85, 0x5f, 0x83, 0x5c,
+  0xe6, 0x01, 0xc2, 0x5d, 0x1c, 0xe7, 0xcf, 0x56, 0x3c, 0x9e, 0x29, 0x93, 0x20, 0x54, 0x58, 0x89,
+  0x81, 0x12, 0x2f, 0x7d, 0x07, 0x46, 0x06, 0x83, 0xc5, 0xf4, 0x05, 0x91, 0x62, 0xf9, 0xb6, 0x02,
+  0x2c, 0xc1, 0x81, 0xab, 0x58, 0x79, 0xcc, 0x4a, 0x55, 0x8e, 0xf0, 0x35, 0xbd, 0x56, 0x9e, 0x39,
+  0xf1, 0x2e, 0x73, 0xc8, 0x46, 0xf8, 0xba, 0xa2, 0xc9, 0xaa, 0x41, 0x7e, 0x55, 0x71, 0x6c, 0x2a,
+  0x9d, 0x97, 0x8d, 0x55, 0x7b, 0x06, 0x06, 0xd7, 0x39, 0x6e, 0xad, 0x65, 0x3d, 0x84, 0xa8, 0xde,
+  0xbf, 0x34, 0xdf, 0x83, 0xec, 0x35, 0x1b, 0xa4, 0xee, 0x7b, 0xb4, 0x01, 0xd9, 0xc9, 0xf9, 0x15,
+  0x1b, 0xbb, 0xfb, 0x53, 0xd1, 0x4a, 0x30, 0xda, 0x5e, 0x0b, 0x8c, 0x75, 0x34, 0xde, 0xda, 0x18,
+  0x32, 0x64, 0xa0, 0x09, 0x0a, 0x06, 0x21, 0x80, 0x60, 0xe2, 0x4e, 0xde, 0x4b, 0xc9, 0x57, 0x7e,
+  0x36, 0x99, 0x00, 0x26, 0x23, 0xe5, 0x91, 0x35, 0x5f, 0x0c, 0xf2, 0x32, 0xf8, 0x61, 0x4a, 0x17,
+  0x6b, 0x52, 0xa0, 0x35, 0xeb, 0x38, 0x9b, 0xa4, 0x7e, 0x33, 0xb8, 0x78, 0xfe, 0x29, 0xeb, 0x36,
+  0x9b, 0x3e, 0xff, 0x84, 0xdb, 0x6e, 0x39, 0xaf, 0x53, 0x43, 0xf2, 0x7e, 0xbd, 0x01, 0x42, 0x49,
+  0xbc, 0x4f, 0x79, 0xef, 0xd4, 0xfe, 0xf1, 0x1b, 0x67, 0x4a, 0x87, 0xcd, 0xaa, 0x8a, 0x98, 0xfb,
+  0xc7, 0x2f, 0x42, 0xeb, 0x96, 0x62, 0x0c, 0xab, 0xca, 0x34, 0xf7, 0x8f, 0xdf, 0x39, 0xb6, 0x72,
+  0xe5, 0xfa, 0x71, 0x55, 0x91, 0x16, 0x36, 0xe3, 0xc0, 0x02, 0xdd, 0x54, 0xa8, 0x8d, 0x9c, 0x7b,
+  0xe9, 0x6c, 0x2c, 0xd3, 0x01, 0x15, 0xd5, 0x59, 0xb8, 0x56, 0xfa, 0x5e, 0xf8, 0xd3, 0x7e, 0x9f,
+  0xde, 0xfb, 0xf3, 0x53, 0xe5, 0x75, 0x60, 0x3b, 0xbb, 0xcc, 0xc1, 0xcf, 0x4f, 0x73, 0x73, 0xf0,
+  0xf3, 0xd3, 0x2d, 0x73, 0x80, 0x6a, 0xc6, 0x86, 0x39, 0xb8, 0x5c, 0xfa, 0xfe, 0xed, 0x86, 0x09,
+  0x38, 0xf5, 0x82, 0xa5, 0x7d, 0xbb, 0x01, 0xfb, 0x6f, 0x27, 0x13, 0x77, 0xec, 0x6c, 0xc0, 0xfd,
+  0xcb, 0x60, 0xee, 0xdc, 0x03, 0x63, 0xbf, 0x7f, 0x11, 0x93, 0xb3, 0xff, 0x28, 0xb7, 0x28, 0x3b,
+  0xde, 0x91, 0xd6, 0x54, 0xe0, 0x4d, 0x3e, 0x62, 0x24, 0x59, 0x5b, 0x17, 0xc0, 0xe3, 0x9c, 0x87,
+  0xdb, 0xd7, 0xac, 0xfa, 0x2e, 0x73, 0xc8, 0x4a, 0x16, 0x26, 0x0d, 0xd6, 0x43, 0xa0, 0x2c, 0x04,
+  0x10, 0x3b, 0xe3, 0x6b, 0x34, 0x35, 0x95, 0x31, 0xcc, 0x43, 0xce, 0x9f, 0x83, 0x09, 0xc1, 0x28,
+  0x43, 0x96, 0x2c, 0xda, 0x16, 0x0b, 0xef, 0x96, 0xf5, 0x8e, 0x44, 0x73, 0x82, 0xb7, 0xa9, 0xd3,
+  0x64, 0x7b, 0x7d, 0xdc, 0x8c, 0x49, 0xab, 0xd3, 0x3e, 0x0c, 0x77, 0xfc, 0xdc, 0xa7, 0x15, 0x76,
+  0x92, 0x39, 0x6d, 0xe7, 0x19, 0xdd, 0x17, 0x9c, 0x37, 0x99, 0x9f, 0x72, 0xd7, 0xae, 0xc8, 0x0a,
+  0xfb, 0x20, 0xcf, 0xee, 0x6b, 0xe6, 0xdb, 0x7f, 0xa8, 0x67, 0xf7, 0x0f, 0x0c, 0x5d, 0xba, 0xbc,
+  0x8d, 0x62, 0x67, 0xae, 0xf0, 0x28, 0xab, 0xfb, 0x38, 0xef, 0x58, 0xec, 0xd6, 0xbf, 0x9f, 0xf3,
+  0x2e, 0x9a, 0xe6, 0x1f, 0x8c, 0x73, 0x5b, 0xea, 0x63, 0x6d, 0xb6, 0x1b, 0xaf, 0x30, 0xf4, 0x5e,
+  0x4f, 0x31, 0x4f, 0x3b, 0xe8, 0x93, 0xc5, 0xe9, 0xe8, 0xa0, 0x4b, 0x1c, 0x00, 0x37, 0x23, 0xda,
+  0x25, 0x33, 0x1a, 0x4a, 0x0f, 0x4b, 0x18, 0x8d, 0x53, 0x84, 0x1c, 0x4a, 0xd0, 0x7f, 0xc9, 0xb5,
+  0x61, 0x5e, 0xf2, 0x6b, 0x85, 0x37, 0x45, 0x3e, 0x5a, 0xd0, 0x1c, 0xba, 0x4a, 0x57, 0x6c, 0x8b,
+  0x76, 0x14, 0x76, 0x43, 0xdb, 0xa2, 0xa0, 0x3d, 0x60, 0x38, 0x6f, 0x13, 0x5d, 0x80, 0x1d, 0xaf,
+  0xad, 0x9b, 0x6d, 0x10, 0xfc, 0x46, 0x5b, 0x3f, 0x6a, 0xe3, 0xe6, 0x1a, 0x46, 0x81, 0x61, 0xd0,
+  0x6e, 0x47, 0xde, 0x20, 0x97, 0x59, 0x0d, 0xe6, 0xfa, 0xdd, 0x3f, 0xfe, 0x69, 0x81, 0x21, 0x0f,
+  0x59, 0x27, 0x45, 0x76, 0xf8, 0xdc, 0x9d, 0x31, 0xff, 0x09, 0x98, 0xa9, 0xa6, 0x55, 0x72, 0x8f,
+  0x87, 0x23, 0x0e, 0x03, 0xc5, 0x80, 0x84, 0x85, 0xd3, 0x01, 0x03, 0xcf, 0x56, 0x5d, 0xb1, 0x19,
+  0xdc, 0x00, 0x5d, 0xa6, 0x85, 0x91, 0xcd, 0xad, 0x13, 0xbe, 0x23, 0xdc, 0xa0, 0x0a, 0x80, 0x1c,
+  0xa0, 0x1c, 0x0b, 0x77, 0xf7, 0x10, 0x1d, 0x40, 0xfd, 0xb8, 0x4d, 0x68, 0xcc, 0x68, 0xab, 0x30,
+  0xb9, 0x80, 0xa5, 0xb1, 0x71, 0xf4, 0x57, 0xce, 0x7c, 0xb1, 0xcb, 0xd8, 0xb1, 0xdc, 0x37, 0x1a,
+  0xfd, 0x11, 0x91, 0xfd, 0xfb, 0x23, 0x31, 0x94, 0x06, 0xae, 0xef, 0x97, 0x2d, 0xe9, 0x16, 0xd6,
+  0x3e, 0x68, 0x82, 0xe2, 0x1e, 0x37, 0x56, 0x0d, 0x33, 0xbd, 0xc5, 0x5d, 0x55, 0xc0, 0x91, 0x47,
+  0xee, 0x60, 0xc3, 0xf0, 0x34, 0xb8, 0xd8, 0x38, 0xe6, 0xe7, 0x17, 0x97, 0xbb, 0x0c, 0xf9, 0x39,
+  0x06, 0x5c, 0x24, 0x23, 0xce, 0x96, 0x89, 0x44, 0x19, 0x3a, 0x6e, 0xb9, 0x7f, 0xdc, 0x50, 0xd8,
+  0xc1, 0xcb, 0x6f, 0x80, 0x9e, 0x3f, 0x51, 0x84, 0x63, 0x11, 0xd5, 0x97, 0xee, 0xd4, 0xb7, 0xbc,
+  0x5d, 0xb0, 0x0d, 0x25, 0xb7, 0x62, 0x1b, 0xca, 0xfc, 0xfd, 0x1b, 0x11, 0x21, 0x86, 0x2e, 0x56,
+  0xfb, 0x07, 0x35, 0xc0, 0x73, 0xf5, 0x5b, 0x68, 0x0f, 0x0f, 0x11, 0x34, 0xe1, 0x91, 0x86, 0x1b,
+  0x55, 0xc6, 0x11, 0xfc, 0x00, 0x45, 0xbe, 0x37, 0x7a, 0x2c, 0xde, 0x51, 0x6f, 0x8f, 0x1b, 0x54,
+  0x00, 0x66, 0xad, 0x83, 0xdb, 0xfb, 0x6d, 0x8d, 0xfe, 0xe2, 0xec, 0x34, 0x3c, 0x0d, 0x66, 0x52,
+  0x6f, 0xb4, 0x4f, 0x60, 0x5e, 0xf0, 0xb4, 0x83, 0x49, 0x72, 0xcc, 0xc0, 0x65, 0xd1, 0x61, 0x6d,
+  0x74, 0x36, 0x35, 0xb1, 0x09, 0xfb, 0xa7, 0x9e, 0xcb, 0xb6, 0x39, 0xb6, 0xa3, 0x1f, 0x8a, 0x7e,
+  0x1b, 0xcc, 0x22, 0x03, 0x9f, 0x99, 0x20, 0xb7, 0x5b, 0x2f, 0xcd, 0x55, 0x0b, 0xcc, 0x3d, 0xad,
+  0x89, 0x61, 0x0b, 0x2f, 0x11, 0x2f, 0x18, 0x21, 0xda, 0x5a, 0xb5, 0xe0, 0xf5, 0x7b, 0x78, 0xfb,
+  0x79, 0xde, 0x02, 0x4d, 0x00, 0xf7, 0x6e, 0x58, 0x58, 0x03, 0x30, 0xbd, 0xca, 0x8a, 0x9b, 0x46,
+  0xfd, 0xd2, 0xb1, 0x76, 0x62, 0x69, 0x58, 0xae, 0x9c, 0xe4, 0x16, 0x61, 0x4e, 0x4b, 0xa5, 0x54,
+  0xe2, 0x3c, 0x6c, 0x92, 0xaa, 0x89, 0x28, 0x28, 0x7e, 0x3e, 0x6c, 0x7f, 0x9b, 0x77, 0xfb, 0xe1,
+  0x84, 0xd9, 0xbb, 0x6f, 0xb4, 0x4d, 0x5e, 0x15, 0xd2, 0x64, 0xbf, 0xf8, 0xe6, 0xa8, 0x9b, 0xcd,
+  0x78, 0xbd, 0xb8, 0x7c, 0x77, 0xf2, 0x7a, 0x17, 0xc4, 0x52, 0xc1, 0x07, 0x60, 0x96, 0xd5, 0xfb,
+  0xe3, 0x50, 0xfb, 0x47, 0x07, 0x32, 0x95, 0xb0, 0x47, 0x16, 0x77, 0xb5, 0x13, 0x7f, 0x7c, 0xb6,
+  0x9d, 0x3d, 0x3e, 0xbb, 0x74, 0x3f, 0x3b, 0x0f, 0x40, 0x3c, 0xb4, 0xbd, 0x13, 0xd6, 0x25, 0xe4,
+  0xf3, 0xe2, 0xc5, 0xb4, 0x72, 0x72, 0xd2, 0x17, 0x13, 0x43, 0x6d, 0x77, 0x30, 0x63, 0xa6, 0x4e,
+  0x7c, 0x19, 0x5b, 0x71, 0x74, 0x50, 0xdb, 0x71, 0xe2, 0xf4, 0x0e, 0x2a, 0xcc, 0xcd, 0xf6, 0xc9,
+  0x91, 0xde, 0x43, 0x69, 0xd5, 0xeb, 0x30, 0x55, 0x00, 0xd8, 0x89, 0x50, 0x16, 0x1b, 0x47, 0x78,
+  0x3c, 0xcc, 0x00, 0xa5, 0x08, 0xc3, 0x04, 0x4e, 0x3a, 0x4a, 0xb2, 0xc1, 0x8f, 0xe1, 0x57, 0x78,
+  0x6e, 0x0b, 0x75, 0x45, 0x60, 0xa6, 0x3d, 0xc6, 0x73, 0x0d, 0xfd, 0xa8, 0x7b, 0x6e, 0x34, 0x31,
+  0xda, 0xea, 0xe8, 0x3d, 0x8b, 0xbf, 0xc0, 0xa3, 0x5f, 0x4d, 0x89, 0xc3, 0xbe, 0x73, 0x26, 0xe8,
+  0xbb, 0x7b, 0x88, 0x79, 0x45, 0x9f, 0x18, 0x78, 0x90, 0x6d, 0xc5, 0x8e, 0x42, 0x3c, 0xd8, 0xb8,
+  0xfa, 0xf3, 0x68, 0x0f, 0x78, 0xfe, 0xe3, 0x3e, 0x06, 0x19, 0x3f, 0x50, 0xf2, 0xef, 0x67, 0x91,
+  0xdd, 0x44, 0x3c, 0xf0, 0xfb, 0x06, 0x46, 0xc8, 0xc2, 0x32, 0xf3, 0xef, 0x35, 0x57, 0xb1, 0x5d,
+  0xbe, 0xec, 0x6f, 0x5e, 0x8d, 0x77, 0x3d, 0x24, 0xf4, 0x67, 0x3a, 0x2c, 0x53, 0x60, 0x35, 0xc5,
+  0xfc, 0x7c, 0x59, 0x86, 0x46, 0x9f, 0x7f, 0xe0, 0x28, 0xb9, 0x42, 0x17, 0x3c, 0xe8, 0x3f, 0xe8,
+  0x0f, 0x77, 0xfd, 0xa9, 0xae, 0xeb, 0x45, 0x8e, 0x48, 0x5f, 0x81, 0xe0, 0xe5, 0x9f, 0x51, 0x56,
+  0xbe, 0xfd, 0xe3, 0x17, 0x2c, 0xaa, 0x07, 0x0f, 0x1f, 0xc4, 0xcb, 0xa8, 0x92, 0xf9, 0xc9, 0xee,
+  0x22, 0x33, 0x61, 0x9d, 0xc5, 0xdc, 0x8a, 0xc5, 0x40, 0x71, 0xc1, 0xfd, 0x16, 0x69, 0x90, 0xee,
+  0xd8, 0xf2, 0x65, 0xbf, 0x10, 0xdc, 0xbe, 0x71, 0x76, 0x67, 0x85, 0x7f, 0x9e, 0x29, 0xc5, 0x81,
+  0x72, 0x67, 0xfb, 0x69, 0xe0, 0xfb, 0xe4, 0x28, 0xaf, 0x88, 0xec, 0x15, 0x58, 0xb2, 0x25, 0xc4,
+  0x90, 0x8f, 0x0b, 0xd7, 0xfc, 0x8e, 0x98, 0x01, 0xe0, 0x7a, 0x19, 0x59, 0xde, 0xcd, 0x8a, 0xf2,
+  0x97, 0x9d, 0x95, 0x81, 0x0e, 0x06, 0x60, 0xff, 0x33, 0x32, 0x1f, 0xc9, 0xab, 0xa4, 0xb5, 0xc9,
+  0xd5, 0xf4, 0x92, 0x02, 0x93, 0x5a, 0xef, 0x5b, 0x32, 0xf3, 0x87, 0xfe, 0x15, 0xc6, 0xa4, 0xf2,
+  0x41, 0x93, 0x48, 0x13, 0x74, 0x9a, 0xc0, 0x89, 0x4f, 0x42, 0xc7, 0xca, 0xba, 0x5c, 0x69, 0x2b,
+  0x06, 0x06, 0x8c, 0xdf, 0xd7, 0x2c, 0x8d, 0x9e, 0xcf, 0x8b, 0x4c, 0x71, 0x82, 0x3d, 0x7d, 0xb0,
+  0x39, 0x69, 0x4c, 0xee, 0xc0, 0x4b, 0x21, 0x5b, 0x5a, 0x96, 0x2e, 0xe9, 0xf8, 0xcb, 0x8f, 0x2c,
+  0x57, 0xe9, 0x31, 0x50, 0xda, 0x4d, 0x10, 0x5e, 0xf7, 0xf1, 0x2c, 0x38, 0x3d, 0x50, 0xd2, 0xc3,
+  0xc0, 0x91, 0xe3, 0x5d, 0x5e, 0xbe, 0x4a, 0x35, 0x83, 0x5c, 0x12, 0x03, 0x69, 0xfb, 0x88, 0x8d,
+  0x55, 0xde, 0x88, 0x5a, 0xc0, 0x34, 0x42, 0xc3, 0xf6, 0x7e, 0xea, 0xb5, 0x75, 0x7d, 0xbe, 0xd6,
+  0x2e, 0x6e, 0xe0, 0xb1, 0x94, 0xc4, 0x7b, 0xb8, 0x7f, 0x86, 0x8a, 0x83, 0x92, 0xd6, 0xc9, 0xa8,
+  0x22, 0x3c, 0x7b, 0x4a, 0x61, 0x08, 0x65, 0x2b, 0x71, 0xd3, 0x72, 0x4b, 0x7d, 0xa6, 0x01, 0x27,
+  0xbf, 0x1d, 0x09, 0xa9, 0xa9, 0x23, 0xb3, 0x3f, 0x01, 0x65, 0x01, 0x15, 0x06, 0xd2, 0xf2, 0x8e,
+  0x80, 0xc8, 0x7b, 0xb3, 0x16, 0x10, 0xd1, 0x91, 0x25, 0x7c, 0x32, 0xa8, 0x72, 0xcc, 0xd0, 0x01,
+  0xa1, 0xf7, 0x5e, 0x1e, 0x65, 0x4a, 0xb3, 0x06, 0x3e, 0xbf, 0xee, 0xc2, 0x72, 0xa0, 0xe0, 0xb6,
+  0x97, 0x5d, 0xb4, 0x6f, 0x7a, 0x5a, 0x67, 0xa6, 0xb5, 0x56, 0x06, 0xb6, 0x64, 0xc9, 0xe5, 0x41,
+  0x87, 0xd4, 0x4d, 0x8c, 0x5f, 0x33, 0x8e, 0xe0, 0x4d, 0xd2, 0xbe, 0x26, 0x9f, 0x02, 0xd8, 0x75,
+  0x05, 0x4d, 0x33, 0x07, 0x24, 0xfc, 0xb1, 0xe3, 0x61, 0x4d, 0x1c, 0xf9, 0x29, 0xdd, 0x95, 0x04,
+  0x00, 0x7f, 0x8b, 0x5d, 0x84, 0xfb, 0x1c, 0xb4, 0xe3, 0x51, 0xed, 0x0d, 0xad, 0x25, 0x0e, 0xda,
+  0x49, 0x21, 0x38, 0x27, 0xe3, 0xb1, 0x13, 0x45, 0xca, 0x05, 0x66, 0x94, 0xa1, 0xaf, 0xad, 0x94,
+  0x80, 0x85, 0xdf, 0x2b, 0xc9, 0x6d, 0x2a, 0xb0, 0xaf, 0x9e, 0xec, 0x1f, 0x9f, 0x5c, 0x28, 0x9c,
+  0xe4, 0x93, 0xcd, 0x85, 0x7c, 0xa9, 0xd5, 0xfe, 0xf1, 0x55, 0xe8, 0xc2, 0x4a, 0x0e, 0xad, 0x1c,
+  0x81, 0xef, 0xdc, 0xc5, 0x05, 0xa7, 0xe4, 0x4d, 0x7d, 0x74, 0xf9, 0x3f, 0x0f, 0xed, 0xe3, 0xc4,
+  0xb6, 0x43, 0x29, 0x3c, 0xaf, 0xd8, 0x85, 0xc2, 0x3f, 0xdb, 0xb2, 0x7f, 0x6c, 0xe8, 0xa0, 0xc6,
+  0xea, 0xad, 0x07, 0xf5, 0x34, 0x7f, 0xf6, 0xe6, 0x72, 0x97, 0x3e, 0x62, 0x8e, 0x32, 0xdd, 0x0b,
+  0xc6, 0x39, 0x7f, 0xcf, 0xae, 0x5d, 0xb1, 0x63, 0x50, 0x30, 0xb5, 0x61, 0xbc, 0x11, 0x71, 0x46,
+  0xf9, 0x69, 0xc0, 0x4d, 0xda, 0xf7, 0x8b, 0x93, 0xf3, 0xf3, 0xb3, 0x77, 0xff, 0xf3, 0x30, 0x05,
+  0x9c, 0x0e, 0xd4, 0x3e, 0x54, 0xff, 0xfe, 0x57, 0x3a, 0x65, 0xcb, 0x0f, 0x0a, 0xdf, 0x47, 0xc7,
+  0x66, 0xc7, 0x8f, 0xff, 0x4d, 0x54, 0x6c, 0xa4, 0x0c, 0x6e, 0x70, 0x27, 0x79, 0xb8, 0xe9, 0x83,
+  0x4d, 0xf9, 0xf9, 0x97, 0x92, 0x0c, 0x33, 0x22, 0x80, 0x07, 0xbc, 0xc2, 0x7e, 0x65, 0x49, 0x4a,
+  0x65, 0xb6, 0x1b, 0x37, 0xec, 0xe2, 0x01, 0x9d, 0xee, 0x79, 0x4b, 0x87, 0xb9, 0xea, 0x2a, 0xad,
+  0x42, 0x6c, 0x44, 0x86, 0x00, 0x72, 0xc4, 0x83, 0x51, 0xce, 0x4a, 0xe7, 0x65, 0xf7, 0x7d, 0x0b,
+  0x84, 0x4d, 0xab, 0x5c, 0x61, 0x2e, 0x03, 0x0e, 0xc6, 0xb9, 0x01, 0xf6, 0x98, 0xe9, 0xcb, 0x89,
+  0x3b, 0x62, 0x63, 0x5b, 0x2c, 0x85, 0x75, 0x1e, 0x33, 0x42, 0x85, 0x3e, 0x67, 0xa9, 0x2d, 0x13,
+  0x95, 0x7b, 0x6f, 0x4b, 0x6b, 0x74, 0x9e, 0xb2, 0xea, 0x25, 0xd2, 0x57, 0xbe, 0xa3, 0xe7, 0xf8,
+  0xec, 0x78, 0x27, 0xdd, 0xbc, 0xf9, 0x50, 0xdd, 0x3c, 0x59, 0x0b, 0x98, 0xa8, 0x93, 0xaf, 0x9b,
+  0x07, 0x39, 0x27, 0xda, 0x5d, 0x85, 0xfd, 0x15, 0xee, 0x89, 0x31, 0xa8, 0xe6, 0x2d, 0x13, 0x1d,
+  0xc5, 0xb8, 0xc3, 0x05, 0x7a, 0x67, 0x97, 0x5d, 0x75, 0xa3, 0x26, 0x9e, 0x72, 0xa0, 0xe2, 0x70,
+  0x37, 0x6e, 0xa2, 0xf7, 0x02, 0x35, 0x81, 0x2e, 0xaa, 0xda, 0xed, 0xb6, 0x82, 0xee, 0x0c, 0xd4,
+  0x18, 0xc8, 0x9b, 0xd1, 0xc6, 0x42, 0xf4, 0x87, 0x5c, 0xc5, 0xb0, 0x4e, 0xba, 0x63, 0x3c, 0xf7,
+  0x00, 0x0a, 0x84, 0x86, 0x4a, 0x7a, 0x07, 0x53, 0xdd, 0x74, 0x22, 0x76, 0xa1, 0xc0, 0xe5, 0xd7,
+  0x72, 0x79, 0xec, 0xed, 0xe0, 0xcd, 0x71, 0x3e, 0x2d, 0x80, 0x87, 0x9f, 0x78, 0x1e, 0xcc, 0x94,
+  0xb3, 0xb3, 0x21, 0xd3, 0x53, 0x7a, 0x14, 0xb3, 0xff, 0xb2, 0xb7, 0xea, 0xbc, 0x6c, 0x7b, 0x47,
+  0x0a, 0xfc, 0xab, 0x1d, 0x7d, 0x7e, 0x0d, 0x4c, 0xa1, 0xbb, 0x12, 0x1c, 0x4d, 0x82, 0xec, 0x8c,
+  0x7a, 0xb9, 0x97, 0x09, 0xc1, 0x76, 0xcb, 0xef, 0x09, 0xd8, 0xd7, 0xb6, 0x23, 0xd8, 0x16, 0xbd,
+  0x02, 0x50, 0x54, 0xdb, 0x11, 0x40, 0xec, 0x64, 0x47, 0x24, 0xd4, 0x0b, 0xa4, 0x9b, 0xe4, 0xbc,
+  0x6b, 0x14, 0xb4, 0xdf, 0xe4, 0xa3, 0x0c, 0x74, 0xae, 0xfd, 0x4f, 0x25, 0x93, 0x68, 0x1c, 0x82,
+  0x67, 0x88, 0x3c, 0xed, 0x45, 0xde, 0xb1, 0xbb, 0xa8, 0xe7, 0x22, 0xfe, 0xe9, 0xc9, 0xe9, 0xdf,
+  0x9e, 0xbd, 0x7b, 0x7b, 0xb1, 0x55, 0xd6, 0x8b, 0x24, 0x7b, 0xdc, 0x1e, 0xbf, 0xce, 0xcb, 0x41,
+  0x98, 0x27, 0x22, 0x94, 0x4d, 0x7d, 0xe6, 0xf3, 0x51, 0x6e, 0xe8, 0x6e, 0x12, 0xf1, 0x4c, 0x0e,
+  0x78, 0x51, 0x78, 0xa5, 0x51, 0xfa, 0x82, 0x6f, 0x98, 0x9a, 0xa0, 0x4c, 0xb1, 0xca, 0x9d, 0xd9,
+  0x9f, 0x44, 0xef, 0x70, 0x43, 0x53, 0x3a, 0xb2, 0x9f, 0x18, 0x78, 0x3c, 0xe9, 0xc4, 0x24, 0x7a,
+  0x35, 0x9f, 0xf2, 0x34, 0x13, 0xf2, 0x29, 0xc6, 0xfc, 0x12, 0xa4, 0xd4, 0x8d, 0x19, 0xbe, 0xe0,
+  0xc6, 0x74, 0x04, 0x72, 0x47, 0x7e, 0xf0, 0x4f, 0xd0, 0x1d, 0x36, 0xd3, 0xd6, 0xc9, 0xd3, 0xb7,
+  0x3f, 0x5d, 0xc9, 0x59, 0x90, 0x37, 0x4c, 0xf4, 0x3c, 0xe0, 0x8e, 0x7b, 0xca, 0x73, 0xfa, 0x76,
+  0x25, 0xe1, 0xc1, 0x9d, 0x1c, 0xd0, 0x87, 0x91, 0xf4, 0x18, 0x84, 0x92, 0x13, 0x43, 0x6d, 0x0a,
+  0x1c, 0x65, 0xe4, 0xc6, 0xf3, 0x9b, 0xe4, 0x1b, 0x2b, 0x3c, 0xd0, 0xee, 0xe1, 0x03, 0xfe, 0x6a,
+  0x69, 0x4e, 0x08, 0xba, 0xdd, 0xf4, 0xc7, 0x64, 0x20, 0x7f, 0x76, 0xdd, 0x11, 0x53, 0xfe, 0xee,
+  0x57, 0x6e, 0x77, 0x6c, 0x4a, 0x36, 0x72, 0xaf, 0x6c, 0x97, 0x85, 0x8f, 0x09, 0x2b, 0x8d, 0xdc,
+  0x9c, 0xa7, 0x09, 0x73, 0xff, 0x93, 0x39, 0xaf, 0xe0, 0x1b, 0x4e, 0x7c, 0x5e, 0x86, 0x6e, 0x94,
+  0xa4, 0x85, 0xe6, 0x69, 0xf5, 0x28, 0xa1, 0x9e, 0x94, 0xb5, 0xa4, 0xe8, 0x31, 0x63, 0x49, 0x1c,
+  0x0b, 0xd9, 0x42, 0xcb, 0xbf, 0xb1, 0x23, 0x7f, 0x0a, 0xc3, 0x28, 0xff, 0x96, 0xfd, 0xfe, 0xf1,
+  0x0a, 0x10, 0x9a, 0xcf, 0x7d, 0xb2, 0x28, 0xf3, 0xd5, 0x75, 0x36, 0x7c, 0xd9, 0x80, 0x25, 0x90,
+  0x6e, 0x0c, 0xe8, 0x4b, 0xa8, 0x22, 0x0f, 0xa6, 0xde, 0xc1, 0x48, 0xc9, 0x60, 0xe2, 0x44, 0x11,
+  0xd0, 0x97, 0xe5, 0x29, 0x67, 0x97, 0x17, 0x4d, 0x53, 0x3b, 0x3d, 0x79, 0xad, 0x44, 0xcb, 0x70,
+  0xe5, 0xc0, 0xfa, 0x42, 0x1f, 0x8f, 0x72, 0xe3, 0x02, 0x49, 0x80, 0x3a, 0xe1, 0x69, 0x18, 0xe8,
+  0xa4, 0xbc, 0xfe, 0xeb, 0xc5, 0xd9, 0x0b, 0x9e, 0x58, 0x07, 0xa0, 0xaf, 0x03, 0x1d, 0xd9, 0x4e,
+  0x00, 0x05, 0x78, 0x86, 0x0f, 0x9e, 0x0f, 0x62, 0x0c, 0x86, 0x40, 0x5d, 0xb9, 0x71, 0x46, 0xa0,
+  0xa1, 0x47, 0x8e, 0x4d, 0x9e, 0x4f, 0x65, 0x6e, 0xf9, 0xa0, 0x81, 0xe3, 0xd9, 0xc9, 0x3a, 0x45,
+  0xaf, 0x8f, 0x83, 0xf9, 0x22, 0x74, 0x66, 0x8e, 0x1f, 0xb1, 0x74, 0x43, 0xcc, 0xa8, 0x9a, 0xb3,
+  0xe8, 0x3a, 0xb4, 0x02, 0x94, 0x7d, 0xe1, 0x4c, 0xd9, 0x57, 0xe6, 0x8e, 0xe5, 0x47, 0x14, 0xff,
+  0xee, 0x28, 0xce, 0xad, 0x13, 0x29, 0xae, 0xaf, 0x5c, 0xc2, 0xa3, 0xeb, 0xd0, 0x8d, 0x41, 0xe0,
+  0x2f, 0x2a, 0x77, 0x16, 0x31, 0x83, 0xee, 0xfe, 0xce, 0x7e, 0x84, 0x0b, 0xcf, 0x8a, 0x31, 0x9f,
+  0xea, 0x26, 0x27, 0x42, 0x8a, 0xa9, 0x93, 0x57, 0xda, 0xd5, 0xcc, 0xf5, 0xaf, 0x9d, 0xf0, 0x41,
+  0x4e, 0x0b, 0x76, 0x1a, 0x78, 0x53, 0x57, 0x6f, 0xdf, 0x9b, 0x9d, 0x56, 0xe3, 0x41, 0x8d, 0x33,
+  0x67, 0x73, 0x75, 0xd3, 0x97, 0x57, 0x27, 0xca, 0xa1, 0x72, 0x72, 0x51, 0x9d, 0x1e, 0x29, 0x6b,
+  0xfd, 0x24, 0xdf, 0xa2, 0xc8, 0x38, 0x98, 0x5b, 0xdb, 0xb3, 0x92, 0x6f, 0x63, 0x7b, 0xdb, 0xbf,
+  0x66, 0xb4, 0xf3, 0x87, 0xf0, 0xba, 0x85, 0xaf, 0x8f, 0xb6, 0x71, 0x15, 0x3d, 0x03, 0x89, 0xe9,
+  0x05, 0x0b, 0xa0, 0xc3, 0xd1, 0xed, 0xc6, 0xf5, 0xaf, 0x77, 0xb7, 0x7e, 0x94, 0x89, 0x9c, 0xd7,
+  0x97, 0xd6, 0x75, 0x34, 0xbb, 0xb5, 0xe6, 0xca, 0x53, 0x2b, 0x8a, 0xad, 0xeb, 0x20, 0x76, 0x37,
+  0x37, 0xdb, 0x31, 0xb7, 0x7d, 0xa5, 0xa9, 0x89, 0x70, 0x9e, 0xcd, 0x47, 0x8e, 0x6d, 0x03, 0x98,
+  0x2c, 0xd0, 0x34, 0x52, 0xce, 0x7c, 0x78, 0xef, 0x20, 0x75, 0x95, 0x69, 0xb2, 0x59, 0x39, 0x33,
+  0xd9, 0x69, 0xb3, 0x3c, 0x2b, 0x5e, 0x4f, 0xf1, 0xee, 0x61, 0x01, 0xbf, 0xd9, 0xac, 0xd6, 0x79,
+  0x5d, 0xc6, 0xb7, 0x52, 0xd0, 0xe0, 0x3a, 0xaf, 0x80, 0xb0, 0x5c, 0xd1, 0x45, 0xa5, 0x6f, 0xee,
+  0x2b, 0x2c, 0xb1, 0xb1, 0xbc, 0xbd, 0x1f, 0xa4, 0x99, 0x8f, 0x28, 0x50, 0xc1, 0x6f, 0xfc, 0x2b,
+  0x44, 0x06, 0x5e, 0xf2, 0xdc, 0x62, 0x15, 0x16, 0xe4, 0xdc, 0xdf, 0x94, 0xdd, 0x94, 0x8d, 0xc3,
+  0xf8, 0x4f, 0xd2, 0xd2, 0xff, 0xe4, 0xae, 0xf8, 0xf3, 0xe4, 0xae, 0x48, 0x93, 0x56, 0xdc, 0x8f,
+  0xe6, 0x79, 0xde, 0x52, 0x46, 0xf3, 0xe6, 0xbf, 0x5e, 0x42, 0xd2, 0x24, 0x9c, 0xff, 0x7e, 0xc3,
+  0x12, 0x29, 0x49, 0xd9, 0xb8, 0x9a, 0xfb, 0xff, 0x96, 0x01, 0x35, 0xf7, 0x43, 0x09, 0xcf, 0x37,
+  0xca, 0x30, 0xd2, 0xda, 0xff, 0xd3, 0x6e, 0x71, 0x14, 0x76, 0x35, 0x41, 0x5e, 0xa1, 0x24, 0x8c,
+  0xc6, 0xa1, 0xbb, 0x88, 0x8f, 0xd3, 0xf4, 0xfa, 0x18, 0x77, 0xe6, 0xa4, 0x99, 0xf5, 0x41, 0xb4,
+  0x2b, 0x2f, 0x86, 0xeb, 0xbd, 0x44, 0x3d, 0xee, 0x4f, 0x2c, 0x2f, 0x72, 0xea, 0x9e, 0x63, 0xbf,
+  0xf5, 0xf9, 0x75, 0xa2, 0x29, 0xf3, 0xfb, 0x3d, 0x54, 0x90, 0xfb, 0xb8, 0xf1, 0x85, 0x76, 0x9e,
+  0x0e, 0x8a, 0x2f, 0x88, 0xfc, 0xfa, 0x5e, 0xf4, 0x53, 0xe8, 0xa5, 0x4f, 0x17, 0x61, 0x10, 0x07,
+  0xa0, 0x3e, 0x1c, 0xaa, 0x8f, 0x1f, 0xab, 0x87, 0xc9, 0xe3, 0x59, 0x10, 0xc5, 0x3e, 0xe8, 0x90,
+  0x87, 0x6a, 0xbf, 0x6b, 0x3c, 0x66, 0xbd, 0xaa, 0xf5, 0xbd, 0xd0, 0x89, 0xde, 0xf4, 0xd7, 0x6a,
+  0x53, 0xed, 0xab, 0x94, 0x1f, 0x4b, 0xad, 0xab, 0x6d, 0xbc, 0x66, 0x97, 0x5d, 0xb8, 0x64, 0x57,
+  0x3d, 0xb8, 0xba, 0x64, 0x97, 0x46, 0x03, 0xae, 0xff, 0x9b, 0x5d, 0x9a, 0xf8, 0x18, 0xaf, 0xef,
+  0xea, 0x7b, 0x31, 0x25, 0xf0, 0xeb, 0x37, 0xea, 0xf1, 0x2b, 0x3f, 0xee, 0xfb, 0x4b, 0xcf, 0xab,
+  0x47, 0xe9, 0x95, 0xe3, 0xbd, 0x71, 0xf8, 0x35, 0x23, 0x82, 0x57, 0x36, 0xbb, 0x03, 0x10, 0xc6,
+  0xa2, 0x26, 0x5c, 0x26, 0x35, 0x7e, 0x0d, 0x46, 0x51, 0x7f, 0x7d, 0xb7, 0x77, 0x37, 0x20, 0x5c,
+  0xfd, 0xd7, 0x70, 0xb2, 0xf4, 0xc9, 0xbe, 0x3d, 0x70, 0xed, 0xda, 0x3a, 0x74, 0xe2, 0x65, 0xe8,
+  0x2b, 0x76, 0x30, 0x5e, 0xa2, 0x91, 0xa0, 0x4f, 0x9d, 0xf8, 0xcc, 0x23, 0x7b, 0xe1, 0xe9, 0xed,
+  0x2b, 0x1b, 0x8b, 0x40, 0xbd, 0x14, 0xf9, 0x6f, 0x28, 0xfb, 0xa2, 0x82, 0x09, 0xeb, 0xdd, 0x39,
+  0x18, 0x30, 0x0b, 0xfc, 0x66, 0x22, 0x7d, 0x3c, 0x42, 0xc3, 0x54, 0xa6, 0x51, 0x2d, 0x3b, 0x31,
+  0xfe, 0xd5, 0xdb, 0xc1, 0x9e, 0xe8, 0x4f, 0xf1, 0x27, 0xb7, 0x07, 0xf3, 0x68, 0x5a, 0xc7, 0x88,
+  0x83, 0xda, 0x9a, 0x0a, 0x38, 0xde, 0xf0, 0xbf, 0x0e, 0x54, 0x96, 0xd3, 0x51, 0xad, 0x31, 0x08,
+  0xdd, 0xf1, 0x70, 0x1d, 0x5c, 0xf7, 0xd5, 0xaf, 0xe4, 0x28, 0xd1, 0x90, 0xf1, 0x7a, 0x68, 0xea,
+  0x02, 0x57, 0x6f, 0x21, 0x3b, 0x46, 0x27, 0x05, 0x14, 0x6a, 0x81, 0x24, 0xf0, 0xd0, 0xbf, 0x80,
+  0x16, 0x72, 0xef, 0x1c, 0xf8, 0x5f, 0xd7, 0xd3, 0x7a, 0xb0, 0xe4, 0x13, 0xe2, 0x54, 0xeb, 0x4e,
+  0xf8, 0xd5, 0xe0, 0xd8, 0x6d, 0xbb, 0x5c, 0xad, 0xdf, 0xf8, 0xbb, 0x75, 0xa9, 0x98, 0xc6, 0x0c,
+  0xa4, 0xb3, 0x41, 0xa7, 0x6f, 0xe0, 0x06, 0x73, 0x89, 0x69, 0xcd, 0x62, 0x0f, 0x2b, 0x4c, 0xb1,
+  0x23, 0x6f, 0x3c, 0xa9, 0x30, 0xa3, 0x8e, 0xa7, 0x13, 0x5b, 0x79, 0x03, 0x94, 0x3c, 0xe4, 0xf8,
+  0x57, 0x7c, 0x4d, 0x3d, 0x3c, 0xc0, 0xc9, 0xf9, 0xf2, 0x45, 0x0d, 0xae, 0x71, 0x3a, 0xa0, 0x18,
+  0xa5, 0xec, 0x7c, 0x79, 0xf5, 0xfa, 0x7c, 0x78, 0xe0, 0x8e, 0x3f, 0xa4, 0x6f, 0x3f, 0x7e, 0xf9,
+  0xe2, 0x8e, 0xf5, 0xe0, 0xba, 0x76, 0xa8, 0xb2, 0xdc, 0xf7, 0xea, 0x21, 0xcc, 0x2d, 0xdc, 0x30,
+  0xd3, 0x46, 0x1d, 0xec, 0x8d, 0x3d, 0xc7, 0x0a, 0x31, 0x1d, 0x29, 0x2a, 0xbe, 0x40, 0x09, 0x38,
+  0xbd, 0x01, 0x58, 0x29, 0xd0, 0x68, 0x30, 0x99, 0x50, 0x6c, 0x90, 0x1d, 0xcf, 0x52, 0x58, 0xce,
+  0xdd, 0x28, 0xd6, 0xc1, 0xce, 0x39, 0x50, 0xf1, 0x2b, 0x3d, 0xd8, 0x3d, 0x54, 0x1a, 0x42, 0x39,
+  0xd1, 0x46, 0x42, 0xb8, 0xb5, 0x75, 0xa6, 0x0e, 0xe8, 0xf9, 0xc1, 0xca, 0x11, 0xd5, 0xee, 0xea,
+  0xa6, 0xd9, 0x68, 0x40, 0x6d, 0xf9, 0x9b, 0x1c, 0x4f, 0x19, 0x2b, 0x9d, 0x38, 0x8e, 0x8d, 0x9e,
+  0x01, 0x65, 0x42, 0x59, 0x05, 0x13, 0x5a, 0x4d, 0x48, 0x74, 0x02, 0xba, 0xfb, 0x81, 0x03, 0x4b,
+  0xeb, 0x1a, 0x08, 0xb4, 0x00, 0x58, 0x70, 0xfd, 0x44, 0x9d, 0x8c, 0x34, 0x18, 0x7d, 0x1f, 0x7f,
+  0x9d, 0x10, 0x81, 0xbc, 0x07, 0x80, 0xac, 0x6e, 0x5d, 0xd4, 0xbd, 0xab, 0xb7, 0x0b, 0x80, 0x5e,
+  0x52, 0x1c, 0x9b, 0x82, 0x79, 0xfd, 0x4b, 0xc0, 0x83, 0xbe, 0x4e, 0xe1, 0xcd, 0x01, 0x7a, 0x97,
+  0xeb, 0xf1, 0xa7, 0x18, 0x80, 0x84, 0xe5, 0x63, 0x07, 0xa0, 0xe0, 0xca, 0xf3, 0x69, 0xc3, 0x3c,
+  0x62, 0x91, 0x27, 0x2a, 0x48, 0x0c, 0x80, 0x15, 0xc1, 0x84, 0x72, 0xfc, 0x63, 0x01, 0x50, 0x16,
+  0x8d, 0xbb, 0x53, 0xf6, 0x7d, 0x98, 0x21, 0x34, 0x03, 0x33, 0x8a, 0xdf, 0x0f, 0x50, 0xf3, 0xa0,
+  0xd0, 0xf6, 0x3e, 0x25, 0x94, 0x2d, 0x83, 0x05, 0x79, 0x0d, 0xbd, 0x84, 0xe1, 0xbe, 0xd0, 0x19,
+  0xd7, 0x1a, 0x3e, 0x03, 0xe6, 0xac, 0xfb, 0xc1, 0xcd, 0x41, 0x6d, 0x00, 0xcf, 0x80, 0x09, 0xe1,
+  0x04, 0xbe, 0x42, 0x0b, 0x74, 0x65, 0x79, 0x07, 0xcb, 0x85, 0x4d, 0x35, 0xea, 0xb0, 0x46, 0x1a,
+  0xb5, 0x3b, 0xb9, 0xb1, 0x60, 0x21, 0xda, 0x22, 0xba, 0x49, 0xaa, 0xb0, 0x56, 0x6a, 0x03, 0x80,
+  0x9f, 0x12, 0xdd, 0xe6, 0xa0, 0x57, 0x29, 0xd1, 0xad, 0x2a, 0x35, 0x25, 0xfa, 0x38, 0x10, 0x2c,
+  0x66, 0xf8, 0x1a, 0xd6, 0x8c, 0x3e, 0xf1, 0x82, 0x20, 0x3c, 0x38, 0x48, 0xe1, 0xd3, 0x04, 0xcc,
+  0xb5, 0xc7, 0x04, 0x0d, 0xa1, 0xa8, 0xac, 0x8b, 0x4b, 0x0c, 0x95, 0x98, 0x1e, 0x48, 0xad, 0x38,
+  0x8f, 0x3b, 0x8d, 0x5a, 0x4d, 0x07, 0xa3, 0x9c, 0x1a, 0x38, 0x30, 0xeb, 0x6a, 0x43, 0x85, 0x85,
+  0xd0, 0x57, 0x0f, 0x79, 0x61, 0xe7, 0x07, 0x28, 0x91, 0x2f, 0x50, 0x8e, 0x5e, 0x4a, 0x51, 0x53,
+  0x82, 0xdf, 0x6c, 0x06, 0xda, 0xf5, 0x9e, 0x3b, 0x01, 0x5c, 0x24, 0x52, 0xae, 0x86, 0x18, 0x13,
+  0x2f, 0x07, 0x0e, 0x48, 0x35, 0x36, 0x21, 0xc9, 0xa3, 0xbd, 0xbb, 0xdc, 0x54, 0xa5, 0x2d, 0x11,
+  0x93, 0x9d, 0x4f, 0x91, 0xf3, 0x72, 0xf9, 0xc5, 0x06, 0xcf, 0xf3, 0xf3, 0x0a, 0x5a, 0x2a, 0xae,
+  0x47, 0xa8, 0xa4, 0x07, 0x3e, 0xee, 0xb0, 0x0e, 0x25, 0x52, 0xaf, 0xa8, 0x99, 0x5d, 0x95, 0x03,
+  0xa9, 0x2e, 0x8a, 0xa5, 0x3b, 0xd1, 0x9a, 0x83, 0x99, 0x55, 0xee, 0xdf, 0x1c, 0xca, 0x12, 0x95,
+  0xa3, 0x70, 0x62, 0xb9, 0x20, 0xed, 0x61, 0x5d, 0xd1, 0xa2, 0x62, 0x0d, 0x47, 0xe1, 0x78, 0x08,
+  0xe8, 0x02, 0x89, 0xce, 0xee, 0x8b, 0x0d, 0xa1, 0xbc, 0xe2, 0x03, 0x5f, 0xcc, 0x8a, 0x63, 0x96,
+  0x5e, 0xcf, 0x96, 0x76, 0x35, 0x4e, 0xe0, 0x3d, 0xe5, 0x0e, 0xce, 0xae, 0x40, 0x96, 0x52, 0x12,
+  0xe7, 0x48, 0xa5, 0x22, 0x94, 0x0c, 0x18, 0x8a, 0xa4, 0xdc, 0x54, 0x95, 0x37, 0x2c, 0x3b, 0xa0,
+  0x60, 0x81, 0xca, 0xf5, 0x92, 0x04, 0x81, 0x2a, 0x1a, 0x7d, 0xe7, 0x8c, 0xa1, 0x0a, 0x79, 0x36,
+  0x74, 0xee, 0xa7, 0x1e, 0xaa, 0xe8, 0xa3, 0x86, 0x12, 0x12, 0x29, 0x0c, 0xe3, 0x70, 0xe9, 0x10,
+  0x1f, 0x22, 0xde, 0x80, 0x77, 0x75, 0x15, 0xb3, 0x89, 0x13, 0x77, 0x92, 0x56, 0x69, 0x8e, 0x26,
+  0x52, 0xfa, 0xe1, 0xc4, 0x95, 0xa8, 0x49, 0xb5, 0x35, 0xbe, 0x95, 0x72, 0x0b, 0xdf, 0x95, 0xd3,
+  0x8c, 0x40, 0xb4, 0xaa, 0x0e, 0xb2, 0x38, 0xce, 0x63, 0x30, 0x87, 0xe0, 0x92, 0x29, 0xc8, 0xe3,
+  0x38, 0x37, 0xdd, 0x1b, 0xd1, 0x8c, 0x88, 0xd9, 0x01, 0xcd, 0xb9, 0xfc, 0xcb, 0x9b, 0xd1, 0x8c,
+  0x61, 0x9e, 0x6a, 0xe5, 0xaa, 0xc8, 0x43, 0x27, 0xcf, 0x06, 0xa9, 0x98, 0xe9, 0x74, 0x30, 0x8d,
+  0x93, 0xf1, 0x57, 0x9a, 0x8f, 0x84, 0xd1, 0x81, 0xe4, 0xe3, 0xfb, 0x6b, 0x59, 0xc6, 0x20, 0xf2,
+  0x1f, 0x17, 0x59, 0x42, 0x36, 0x61, 0xb2, 0xac, 0x41, 0xb1, 0xdc, 0xca, 0x42, 0x83, 0x8a, 0x66,
+  0x34, 0x4f, 0x2c, 0x2f, 0x37, 0xf5, 0x3a, 0x2b, 0x93, 0x46, 0x28, 0x03, 0xe1, 0x2d, 0x09, 0x65,
+  0x28, 0x21, 0x0b, 0xe5, 0x4c, 0x05, 0x9a, 0x4d, 0x51, 0x7a, 0x6f, 0xe2, 0xc4, 0xe3, 0x19, 0x50,
+  0x0b, 0xea, 0xd0, 0xa0, 0x1b, 0x73, 0x98, 0xd4, 0xda, 0x9e, 0x8e, 0x89, 0x61, 0x52, 0x19, 0x18,
+  0xd6, 0xd6, 0x40, 0x55, 0xdf, 0x85, 0xa8, 0x23, 0xc4, 0xb3, 0x30, 0xb8, 0x51, 0x7c, 0xe7, 0x46,
+  0x39, 0xc3, 0xe5, 0x0e, 0x23, 0xe6, 0x7a, 0x67, 0xa8, 0x8f, 0xbc, 0x60, 0x04, 0x04, 0x56, 0xa8,
+  0x3e, 0xe2, 0xe3, 0x5b, 0x0e, 0x7f, 0x7a, 0x77, 0xae, 0x8f, 0x01, 0xbb, 0xb1, 0xf3, 0x96, 0x3e,
+  0xc1, 0x07, 0xf7, 0xf0, 0x76, 0x80, 0x2f, 0xad, 0x61, 0xa2, 0xb8, 0xb2, 0x12, 0x5c, 0x77, 0x3d,
+  0x50, 0x2d, 0x04, 0xd5, 0xd2, 0x67, 0xa1, 0x33, 0x19, 0x2e, 0x07, 0x96, 0x6e, 0x07, 0x37, 0x8c,
+  0xf9, 0xa8, 0x22, 0xf0, 0xed, 0x17, 0xf5, 0x30, 0x15, 0x06, 0x87, 0xaa, 0xfe, 0xeb, 0x62, 0xaa,
+  0x42, 0x41, 0x32, 0xb0, 0x70, 0x4a, 0xb0, 0xdb, 0xd0, 0x59, 0x05, 0xd7, 0x52, 0xb7, 0xcb, 0xda,
+  0x40, 0x68, 0x08, 0xb8, 0xcc, 0x70, 0xe2, 0x00, 0xf0, 0x31, 0xe6, 0x8d, 0x91, 0x85, 0xbf, 0x28,
+  0x43, 0x73, 0xcf, 0x79, 0x95, 0x98, 0xd5, 0x2c, 0xb3, 0xca, 0xcb, 0x84, 0x34, 0xbb, 0x73, 0x89,
+  0xc0, 0x4d, 0xb2, 0x41, 0xe7, 0x66, 0x1e, 0x6b, 0x95, 0xcc, 0x0c, 0x96, 0xd7, 0x16, 0x48, 0x2b,
+  0xa5, 0x93, 0x93, 0xcc, 0xc0, 0xaf, 0x11, 0x02, 0x5d, 0x9c, 0x01, 0x9b, 0xf1, 0x05, 0x5b, 0x8f,
+  0x96, 0x14, 0xc3, 0x99, 0x8e, 0x8b, 0x8d, 0x1d, 0x87, 0x65, 0xeb, 0x13, 0x18, 0x0e, 0xda, 0x43,
+  0x75, 0x52, 0x19, 0xef, 0xf6, 0x50, 0x14, 0x95, 0x21, 0xc0, 0xd6, 0x89, 0xd3, 0x83, 0xaa, 0x01,
+  0x83, 0x73, 0x58, 0xfe, 0x2d, 0x86, 0x83, 0xdd, 0x71, 0x08, 0x35, 0x71, 0x50, 0x9b, 0x71, 0x78,
+  0x7e, 0xf6, 0xac, 0x52, 0x9a, 0x52, 0x6a, 0x69, 0x86, 0x3d, 0x1f, 0x24, 0x3c, 0x48, 0x08, 0x32,
+  0x13, 0x9f, 0x34, 0xfa, 0x46, 0x01, 0x7d, 0xf0, 0xe6, 0x09, 0x9e, 0x2a, 0x00, 0x36, 0x73, 0x88,
+  0x85, 0xcb, 0x70, 0x88, 0xf8, 0x21, 0x02, 0x5f, 0xef, 0xf1, 0xa6, 0x86, 0xdf, 0x7d, 0x87, 0x85,
+  0x05, 0x6f, 0x81, 0x0e, 0x0b, 0x1c, 0x0b, 0x94, 0x33, 0xd1, 0x2f, 0xdc, 0x6a, 0x70, 0xa5, 0x91,
+  0x96, 0xc6, 0x72, 0x10, 0x33, 0x35, 0xe1, 0xae, 0x56, 0xc4, 0x08, 0xa1, 0x00, 0x47, 0xb7, 0x71,
+  0xf8, 0x09, 0xd7, 0xae, 0x52, 0xd9, 0xde, 0xf1, 0x6f, 0x04, 0x90, 0xd6, 0x26, 0x6c, 0xc6, 0xac,
+  0xde, 0xc6, 0xcc, 0xc7, 0xbc, 0xe6, 0x26, 0x2a, 0x96, 0x2a, 0x6f, 0x52, 0xab, 0x79, 0xfd, 0x8d,
+  0xb5, 0x46, 0x1a, 0x9c, 0xf8, 0x3e, 0xc1, 0x2e, 0x4a, 0x9c, 0xd4, 0xe2, 0x36, 0x3d, 0x4e, 0x8c,
+  0x42, 0xd6, 0xe4, 0x2a, 0xba, 0xfa, 0xba, 0xca, 0x5c, 0x8e, 0xbc, 0x24, 0x89, 0x59, 0x10, 0xa9,
+  0x39, 0x89, 0x2a, 0xa9, 0x6c, 0xf2, 0xd3, 0x4c, 0xa3, 0xf9, 0xb7, 0xd4, 0xe6, 0x77, 0xb2, 0x12,
+  0xb8, 0xe6, 0x6a, 0x50, 0xfa, 0xe1, 0x0d, 0x65, 0xe2, 0x86, 0x51, 0x0c, 0xb4, 0x71, 0xe3, 0xab,
+  0x82, 0xcb, 0xde, 0x65, 0xd9, 0x05, 0xc9, 0xbb, 0x22, 0xb7, 0xc0, 0x46, 0xb4, 0x04, 0xde, 0xaf,
+  0xc5, 0x32, 0xf6, 0x24, 0x1c, 0x70, 0x45, 0x25, 0x6b, 0x7b, 0x96, 0x68, 0x4a, 0x4c, 0x20, 0xef,
+  0xa8, 0x2a, 0x41, 0x6b, 0x2c, 0x7d, 0x17, 0xa0, 0x21, 0x58, 0xa4, 0xe4, 0xaf, 0x0a, 0x2a, 0xa0,
+  0x2f, 0x71, 0x54, 0xea, 0x51, 0xb9, 0x25, 0x01, 0x68, 0xc9, 0xf2, 0x77, 0x42, 0x70, 0xba, 0xa6,
+  0xa8, 0x38, 0xad, 0x3d, 0x66, 0x20, 0xdf, 0x11, 0xbb, 0xdb, 0xcb, 0x31, 0xab, 0xbd, 0x2c, 0xc3,
+  0x4b, 0xab, 0x67, 0x56, 0x6e, 0xd5, 0x3a, 0x2f, 0xe3, 0x7c, 0x69, 0x13, 0x19, 0xd6, 0x59, 0x20,
+  0x98, 0x0c, 0x8d, 0xad, 0x77, 0x9b, 0xf7, 0x60, 0xf1, 0x8d, 0xa7, 0x9d, 0x6b, 0x44, 0x65, 0xf3,
+  0x8e, 0x0c, 0xaf, 0x7a, 0xda, 0x37, 0x7f, 0x7d, 0x22, 0x37, 0xf9, 0x99, 0x8f, 0x5e, 0x6c, 0x9b,
+  0x7d, 0xae, 0xde, 0x65, 0x39, 0x57, 0x61, 0xf2, 0x11, 0x7d, 0xf3, 0x68, 0x0a, 0xad, 0x83, 0xd4,
+  0xb1, 0xfb, 0xc0, 0xb9, 0x53, 0x79, 0x77, 0xa8, 0x2a, 0x07, 0xc0, 0xc9, 0x61, 0xcc, 0xee, 0x67,
+  0x07, 0xf8, 0x4e, 0xab, 0xdb, 0x3e, 0xea, 0x00, 0xaf, 0x09, 0x9e, 0xe3, 0xc7, 0x64, 0x0f, 0x0c,
+  0xe0, 0x20, 0xaf, 0x9f, 0xd6, 0x59, 0x15, 0x4a, 0x34, 0x01, 0x15, 0xd8, 0x05, 0x7b, 0x68, 0xf3,
+  0x64, 0xaf, 0x87, 0x6a, 0x54, 0x53, 0x19, 0xc5, 0xa0, 0x6f, 0xec, 0x3e, 0x74, 0x45, 0x04, 0xff,
+  0x60, 0x92, 0xa2, 0xda, 0x25, 0xd4, 0x24, 0x49, 0x12, 0x91, 0xe2, 0xaf, 0x4c, 0x15, 0x4d, 0xbf,
+  0x1b, 0xc0, 0xc8, 0x6c, 0x35, 0x24, 0x84, 0xe3, 0xf7, 0x05, 0x00, 0xdd, 0x94, 0xd5, 0xa9, 0xa8,
+  0x2b, 0xb2, 0x6c, 0xa4, 0x4f, 0xa0, 0xfc, 0x90, 0xe1, 0x02, 0x70, 0xf7, 0x08, 0xca, 0x82, 0x88,
+  0x5d, 0x6d, 0x91, 0xaf, 0x24, 0xb3, 0x87, 0x48, 0x56, 0xd1, 0x9b, 0x0f, 0xab, 0x8f, 0x5f, 0xbe,
+  0xac, 0xf8, 0x14, 0xe3, 0x07, 0x6b, 0x72, 0x4c, 0xde, 0xa7, 0x57, 0x14, 0x17, 0x57, 0x7c, 0x93,
+  0xb3, 0xa3, 0xd7, 0x38, 0xe0, 0xe7, 0x41, 0x38, 0x16, 0x1f, 0x5f, 0x52, 0x42, 0x07, 0x15, 0x45,
+  0xca, 0x03, 0x88, 0x1a, 0x6b, 0x9a, 0xe9, 0x50, 0x78, 0x35, 0x37, 0xd9, 0x41, 0x15, 0xee, 0xa0,
+  0xac, 0x49, 0x7a, 0x57, 0x17, 0x1e, 0x2a, 0x9a, 0x67, 0x72, 0x8c, 0xaa, 0xcf, 0x73, 0x13, 0x59,
+  0xa5, 0x01, 0x9c, 0x6d, 0x98, 0x32, 0xb1, 0x5d, 0xc4, 0xa7, 0x27, 0x52, 0x0e, 0x22, 0x0f, 0x6c,
+  0xac, 0x50, 0xf6, 0xcb, 0x26, 0x53, 0x18, 0xae, 0xc8, 0x03, 0x9c, 0x32, 0x09, 0xb8, 0x23, 0xad,
+  0x7a, 0x75, 0x46, 0x2c, 0x63, 0xa5, 0x1e, 0xba, 0xb8, 0xa4, 0x47, 0x11, 0x13, 0x83, 0x46, 0xad,
+  0x46, 0xd8, 0x83, 0xd7, 0x35, 0xf8, 0x3f, 0x83, 0x57, 0x58, 0x88, 0x7c, 0xca, 0xef, 0x10, 0x9a,
+  0x53, 0xde, 0xfd, 0xdc, 0xb2, 0x59, 0x34, 0x8b, 0xeb, 0x2b, 0xcd, 0x46, 0x63, 0x1e, 0x29, 0xd3,
+  0x40, 0x01, 0xd4, 0x28, 0x56, 0xa4, 0xc0, 0x0a, 0x54, 0x04, 0x45, 0x28, 0x23, 0x4a, 0xbd, 0xc8,
+  0xf1, 0x3b, 0x8e, 0xbd, 0xbf, 0x0f, 0xd7, 0x77, 0x75, 0xf8, 0xbd, 0x7a, 0x4b, 0xde, 0x02, 0xc9,
+  0x89, 0xfc, 0xdb, 0xd2, 0x59, 0x3a, 0xa7, 0xb1, 0x77, 0xb0, 0xb0, 0x80, 0x82, 0xea, 0xd0, 0x2b,
+  0x0c, 0x01, 0x6b, 0x7c, 0xa0, 0x07, 0x1f, 0x87, 0xf0, 0x24, 0xe7, 0x7b, 0xa4, 0x76, 0x00, 0x76,
+  0xd6, 0x9e, 0x3c, 0x41, 0xde, 0x32, 0x9a, 0x41, 0x5b, 0xf5, 0x26, 0x9f, 0x8e, 0xd4, 0x0f, 0xc8,
+  0xdf, 0x08, 0xea, 0xfe, 0x6d, 0xf8, 0xe1, 0xe3, 0x00, 0x28, 0x02, 0x3f, 0xe3, 0xaa, 0x5c, 0x63,
+  0x1c, 0x0c, 0x76, 0x59, 0xfb, 0x4d, 0x5f, 0x40, 0xb9, 0x83, 0xeb, 0x43, 0x15, 0x28, 0xd8, 0xf1,
+  0xc7, 0x81, 0xed, 0xfc, 0xf4, 0xee, 0xd5, 0x69, 0x30, 0x5f, 0xc0, 0xe8, 0x7c, 0xea, 0xf9, 0xef,
+  0x1f, 0xae, 0x3f, 0xd6, 0x58, 0xe7, 0x38, 0x28, 0xc2, 0xe0, 0x77, 0xbf, 0x81, 0xfe, 0xe7, 0x4f,
+  0xe3, 0x59, 0x8d, 0xb1, 0xd6, 0xca, 0x85, 0xa2, 0x1e, 0xfe, 0xa6, 0xff, 0x1a, 0xb8, 0xfe, 0x81,
+  0xfa, 0x48, 0x05, 0x1d, 0x65, 0x3b, 0x67, 0x2e, 0x67, 0xcc, 0xdf, 0xa5, 0x9c, 0x99, 0x2d, 0x7d,
+  0x7e, 0x68, 0x96, 0xf1, 0x0e, 0xe4, 0x6b, 0xc0, 0x55, 0x08, 0x7d, 0x5f, 0xbe, 0x70, 0xf6, 0x52,
+  0x7b, 0x00, 0x1d, 0x4a, 0xcc, 0x61, 0x7a, 0x49, 0x74, 0xc7, 0x27, 0x09, 0xc9, 0x2c, 0x37, 0x6f,
+  0x44, 0x6d, 0x8c, 0x66, 0x6a, 0x44, 0x32, 0x27, 0x71, 0x6c, 0x01, 0x09, 0x30, 0xc2, 0x55, 0x28,
+  0xdc, 0x32, 0xca, 0x90, 0xab, 0xeb, 0xbb, 0x31, 0x6b, 0x35, 0xe1, 0x39, 0xf3, 0xe1, 0x87, 0x0f,
+  0x2a, 0xcf, 0x4b, 0x0a, 0x90, 0x24, 0xb9, 0xd7, 0x3f, 0xd6, 0x3f, 0xa8, 0xa3, 0x24, 0x21, 0x3a,
+  0xbe, 0xe1, 0x39, 0xcb, 0xf1, 0xc5, 0x58, 0xe4, 0xf7, 0xae, 0x4b, 0xb9, 0xbe, 0xf1, 0x45, 0x94,
+  0x24, 0xe0, 0xc6, 0x57, 0x98, 0x26, 0xfb, 0xe3, 0x47, 0x98, 0x19, 0x3e, 0xe9, 0xee, 0xb0, 0x31,
+  0x70, 0x7f, 0x9c, 0xf3, 0x89, 0x1b, 0xb8, 0x87, 0x87, 0x00, 0x44, 0x8a, 0x94, 0x05, 0x0d, 0x72,
+  0x8f, 0x0d, 0x0b, 0x0c, 0xe6, 0x33, 0x1c, 0x00, 0x5a, 0xcf, 0x0e, 0x88, 0x33, 0x74, 0xbd, 0xe2,
+  0xb0, 0xd4, 0xba, 0x84, 0x44, 0x09, 0x49, 0x58, 0x97, 0x50, 0x58, 0x3b, 0x98, 0x7f, 0x70, 0x3f,
+  0x7e, 0x68, 0x7c, 0xac, 0xd3, 0xaf, 0xf1, 0x91, 0x31, 0x09, 0x69, 0x85, 0x73, 0x77, 0x61, 0x24,
+  0x16, 0x7a, 0x89, 0xa5, 0x43, 0x49, 0x66, 0xc9, 0x24, 0x73, 0x70, 0x6d, 0x94, 0x33, 0x24, 0xb6,
+  0xd0, 0x46, 0xb8, 0x70, 0x61, 0x66, 0xc2, 0xdb, 0x4b, 0x4a, 0xb4, 0x07, 0x63, 0x55, 0xe9, 0x54,
+  0x28, 0xce, 0x7c, 0x32, 0x63, 0xd4, 0xd6, 0x78, 0xa4, 0xf3, 0x34, 0xb3, 0x4f, 0x8c, 0x3e, 0xad,
+  0x96, 0x7a, 0x3b, 0xef, 0xbc, 0x4e, 0x12, 0x74, 0x2a, 0x3f, 0x3f, 0x2d, 0x95, 0x19, 0x94, 0x34,
+  0x33, 0x25, 0x05, 0x35, 0x5a, 0x38, 0x63, 0xd7, 0xf2, 0x7e, 0x71, 0xa8, 0xa2, 0x5a, 0x47, 0xae,
+  0x8a, 0xa9, 0x36, 0xd5, 0x94, 0x34, 0xe4, 0xda, 0x98, 0xee, 0x51, 0xaa, 0x7d, 0x33, 0xfa, 0x65,
+  0x0e, 0x2b, 0x4e, 0x54, 0xfb, 0xf9, 0xa9, 0x54, 0x2d, 0x05, 0x2a, 0x49, 0x34, 0x3b, 0x62, 0x89,
+  0x66, 0x81, 0x27, 0x32, 0x3e, 0xcf, 0x09, 0x07, 0x18, 0xbd, 0xe7, 0x05, 0x37, 0x51, 0x92, 0xc1,
+  0xb6, 0x8c, 0x57, 0xa2, 0x44, 0x38, 0x19, 0x91, 0x2d, 0x92, 0x5b, 0xaa, 0xd6, 0x88, 0x4c, 0x8c,
+  0x07, 0xac, 0x4c, 0xf4, 0xc8, 0x63, 0x4a, 0x5b, 0x34, 0x10, 0x19, 0x66, 0xc1, 0x78, 0x84, 0xe5,
+  0xe7, 0x5b, 0x23, 0x58, 0x95, 0x65, 0xeb, 0x2e, 0xb7, 0xcc, 0x78, 0xb2, 0xde, 0x6d, 0xb3, 0x1c,
+  0xf8, 0xd5, 0xb3, 0x2c, 0x7a, 0x1e, 0x94, 0x0c, 0xeb, 0x09, 0x87, 0x04, 0x58, 0xdb, 0x41, 0xe0,
+  0xd3, 0xac, 0x3f, 0x9c, 0x05, 0xe5, 0x38, 0x50, 0x61, 0x52, 0x58, 0x1f, 0x2a, 0x19, 0xc2, 0xc1,
+  0x04, 0xac, 0x60, 0xae, 0x09, 0x25, 0xf2, 0x31, 0x55, 0x7b, 0x1e, 0x2c, 0x28, 0x8b, 0x04, 0xcb,
+  0x53, 0xf4, 0xda, 0x22, 0x45, 0x6f, 0xc5, 0xcc, 0xb3, 0x62, 0x25, 0x93, 0xcf, 0x32, 0x00, 0xff,
+  0x9e, 0xf9, 0x7f, 0x2d, 0x5a, 0x78, 0x18, 0x09, 0xa4, 0xa9, 0x8c, 0xbf, 0x09, 0x15, 0xb0, 0xe6,
+  0xbf, 0x25, 0x21, 0x14, 0x66, 0xe0, 0x9f, 0x43, 0x08, 0x3c, 0xfd, 0x29, 0xf2, 0x86, 0x20, 0x74,
+  0x6c, 0x25, 0x60, 0x09, 0xad, 0xc7, 0x14, 0x2c, 0x5a, 0xc5, 0x10, 0x78, 0xa5, 0x12, 0xba, 0x60,
+  0x89, 0x4c, 0x1f, 0x48, 0x17, 0xcc, 0x85, 0xcb, 0xcc, 0xb6, 0x24, 0x61, 0x2a, 0x0c, 0x30, 0xca,
+  0xec, 0xc6, 0xa2, 0xae, 0xc9, 0x44, 0x3b, 0xcf, 0x9a, 0x2a, 0x54, 0x8a, 0x75, 0xae, 0xdc, 0x2e,
+  0x89, 0x56, 0xd5, 0xc4, 0x53, 0x90, 0x36, 0x07, 0x82, 0xef, 0xcc, 0x92, 0xb1, 0xe9, 0xd7, 0xd6,
+  0x44, 0x48, 0x95, 0x3e, 0x57, 0xd6, 0x18, 0x40, 0x1a, 0x30, 0x36, 0x3c, 0x0c, 0x72, 0xba, 0x37,
+  0x42, 0x66, 0x2d, 0x16, 0x8e, 0x6f, 0x9f, 0xce, 0x5c, 0xcf, 0x3e, 0x08, 0xb8, 0xd4, 0xdb, 0xce,
+  0xe9, 0xe4, 0xdc, 0xad, 0xc2, 0x16, 0xc8, 0xa2, 0x87, 0xeb, 0x9f, 0x88, 0x12, 0xbf, 0x4a, 0xad,
+  0x62, 0x43, 0x7b, 0x42, 0xad, 0x95, 0x2b, 0x6c, 0xfe, 0x57, 0xa1, 0x6c, 0x46, 0x76, 0x0c, 0x32,
+  0x82, 0xdd, 0x4d, 0x5d, 0x06, 0x0b, 0x90, 0x36, 0x14, 0xc2, 0x42, 0x1b, 0x35, 0xa5, 0x43, 0x67,
+  0x4e, 0xd4, 0x1c, 0xb1, 0xf3, 0xd6, 0x26, 0x0f, 0xb6, 0x12, 0x32, 0x7e, 0xe4, 0x3c, 0x2e, 0x17,
+  0x21, 0xa0, 0x20, 0x4e, 0x60, 0x46, 0x89, 0xaf, 0x1c, 0xb0, 0x48, 0x5f, 0xb0, 0x57, 0x6d, 0x77,
+  0xea, 0xc6, 0xf0, 0xab, 0x51, 0x08, 0xf9, 0x2f, 0x35, 0xdc, 0xce, 0xdb, 0x01, 0xcf, 0xd8, 0xd1,
+  0xb7, 0x47, 0x33, 0xd9, 0xe6, 0x64, 0x52, 0xa7, 0x6e, 0xe8, 0x41, 0x66, 0x79, 0x4a, 0x46, 0xd6,
+  0x65, 0xc1, 0x7d, 0xfc, 0x30, 0x1c, 0x66, 0xd3, 0xf8, 0xfe, 0x6e, 0x8a, 0x64, 0xcd, 0xed, 0x8a,
+  0xab, 0xda, 0x3a, 0x3b, 0xbc, 0xca, 0xf5, 0x93, 0xf2, 0xb7, 0xf4, 0xd4, 0x57, 0xa5, 0x6f, 0x1c,
+  0x37, 0xa2, 0x1e, 0xee, 0x61, 0x24, 0x7b, 0x3b, 0xd8, 0xb8, 0x4d, 0x4a, 0xa7, 0xd0, 0xd0, 0x15,
+  0x23, 0x6d, 0xcd, 0x56, 0x98, 0xe9, 0x15, 0x86, 0xfd, 0x60, 0x2f, 0x61, 0x3d, 0xa3, 0xc0, 0xbe,
+  0xe5, 0x4e, 0x9d, 0x60, 0xe5, 0x84, 0x13, 0xd0, 0xe0, 0x86, 0xb8, 0x9f, 0x68, 0x3b, 0xbe, 0x9a,
+  0x99, 0x29, 0xb1, 0xc7, 0xb6, 0x2e, 0x03, 0xb1, 0x64, 0x97, 0x51, 0x86, 0x12, 0x79, 0xec, 0xe6,
+  0x1e, 0x73, 0x21, 0x13, 0xcf, 0x28, 0x0f, 0x41, 0x99, 0x56, 0xce, 0x03, 0xf6, 0xc8, 0x48, 0x48,
+  0x8f, 0x29, 0x0e, 0xb8, 0xc1, 0x90, 0x43, 0x1a, 0x16, 0x16, 0x9b, 0x9e, 0xd7, 0xd5, 0x38, 0x7d,
+  0xa1, 0x8b, 0x08, 0xb0, 0xa1, 0x0b, 0xb2, 0x1b, 0xa0, 0x98, 0x81, 0x95, 0xe3, 0xa1, 0xa5, 0x83,
+  0x5c, 0x67, 0x44, 0xb1, 0x54, 0x81, 0x1f, 0x09, 0xbb, 0x7a, 0x6e, 0x2d, 0x86, 0x6b, 0x8a, 0x87,
+  0xee, 0xab, 0xee, 0x08, 0xc3, 0xa2, 0xeb, 0x14, 0x29, 0x8a, 0x77, 0x18, 0x30, 0x5a, 0x67, 0x01,
+  0x96, 0x78, 0x4b, 0x81, 0x96, 0x75, 0x8a, 0x2e, 0xc4, 0x5b, 0x0c, 0x32, 0x64, 0xa6, 0x2b, 0xb4,
+  0xf1, 0xc1, 0xb5, 0x3f, 0x3e, 0x7a, 0xf4, 0x5f, 0xe2, 0xb2, 0x56, 0x4b, 0x2f, 0xf3, 0x90, 0xb2,
+  0xc0, 0x72, 0x84, 0x15, 0x80, 0x9b, 0x07, 0x23, 0x58, 0x77, 0x0a, 0x86, 0xa9, 0xa7, 0x70, 0x0a,
+  0xd0, 0x5c, 0x01, 0x99, 0xc1, 0x61, 0x32, 0x05, 0x34, 0x4d, 0x0e, 0x46, 0xeb, 0x4e, 0x9a, 0x8c,
+  0x8c, 0x1e, 0x83, 0xa8, 0x54, 0xf5, 0x39, 0x6a, 0x51, 0x05, 0xa1, 0x35, 0xaa, 0xbb, 0xb5, 0xf5,
+  0x48, 0x82, 0x8b, 0x11, 0x7b, 0x02, 0x5a, 0xdd, 0x85, 0x99, 0x3a, 0x98, 0xbb, 0x08, 0xfe, 0x97,
+  0x2f, 0xa0, 0xd8, 0xdc, 0x31, 0x27, 0x87, 0x6b, 0xc3, 0x73, 0x11, 0x3c, 0x9e, 0x5d, 0x6f, 0x83,
+  0xc4, 0x18, 0x18, 0xc8, 0xca, 0xe1, 0x9d, 0x5c, 0x8d, 0xe2, 0x6f, 0xd3, 0x24, 0x79, 0x99, 0x26,
+  0x59, 0x10, 0xeb, 0x94, 0xe5, 0x46, 0xba, 0x8c, 0x73, 0x6f, 0x29, 0x9e, 0x73, 0x9d, 0x39, 0xc5,
+  0x3e, 0xe0, 0x77, 0xfc, 0x38, 0x3d, 0x3c, 0xb8, 0xcb, 0x58, 0xdb, 0x3c, 0xfb, 0x83, 0x64, 0x80,
+  0x16, 0x29, 0xbc, 0x9a, 0xa4, 0x8a, 0x7b, 0xd9, 0x09, 0x55, 0x31, 0xd7, 0xcb, 0x26, 0xa4, 0xbb,
+  0x23, 0x5d, 0xcc, 0x71, 0x09, 0xee, 0xb3, 0x98, 0x17, 0x1d, 0x89, 0x0a, 0x88, 0xe9, 0x6f, 0x34,
+  0xa1, 0x8d, 0x82, 0x47, 0x22, 0x59, 0x72, 0x7c, 0x63, 0x46, 0x8c, 0xb1, 0x26, 0xb0, 0x27, 0x3d,
+  0xca, 0xd4, 0x4c, 0x8f, 0x42, 0xac, 0xd3, 0x46, 0x32, 0x6b, 0xde, 0x59, 0xb9, 0x63, 0x87, 0x87,
+  0xa5, 0x1e, 0xa0, 0x3f, 0x08, 0xf5, 0x47, 0xe0, 0x10, 0xca, 0x63, 0xe6, 0xc5, 0xa8, 0x2b, 0x8f,
+  0x69, 0x1f, 0x51, 0x41, 0xd1, 0x8f, 0x6e, 0x17, 0x2b, 0x02, 0x11, 0xe4, 0x79, 0x18, 0x88, 0x26,
+  0xa9, 0x96, 0xc8, 0x75, 0xdf, 0x3b, 0xe1, 0xb0, 0x31, 0x78, 0xa1, 0x3b, 0x51, 0xde, 0xed, 0x45,
+  0x3a, 0x0b, 0xd3, 0x1b, 0xec, 0xfa, 0x04, 0xde, 0x71, 0xa1, 0x43, 0xcc, 0x78, 0x88, 0x0f, 0xbe,
+  0x7c, 0x11, 0x2d, 0xc0, 0xf8, 0x07, 0x49, 0x73, 0xb6, 0x0e, 0xa0, 0xe0, 0x71, 0xb3, 0x01, 0x13,
+  0x9e, 0x4c, 0xa5, 0x7d, 0xf4, 0x88, 0x2a, 0x82, 0x58, 0xf2, 0x6d, 0x27, 0x64, 0x67, 0xa2, 0x92,
+  0x97, 0x35, 0x5e, 0x34, 0xa2, 0x13, 0x31, 0xbc, 0x0c, 0xa3, 0xe4, 0xe4, 0xa1, 0x28, 0x62, 0x8b,
+  0xd7, 0x36, 0xbb, 0xe3, 0xcf, 0x31, 0x11, 0x1e, 0x7f, 0x43, 0x19, 0xc0, 0xf8, 0x93, 0xc1, 0x9e,
+  0x88, 0x37, 0xcd, 0xe0, 0x38, 0xd5, 0x89, 0xf8, 0xc8, 0xa0, 0x0d, 0xba, 0x4a, 0x71, 0x22, 0x2a,
+  0x16, 0x77, 0xad, 0x62, 0xe7, 0x49, 0xe4, 0xfa, 0x63, 0x94, 0x9e, 0xbc, 0xf8, 0x43, 0xf7, 0x30,
+  0x78, 0x99, 0x22, 0xaa, 0xef, 0x4a, 0xc2, 0xa9, 0xc8, 0xc1, 0x13, 0x09, 0x91, 0x79, 0xe3, 0xfa,
+  0x76, 0x70, 0xa3, 0xd3, 0xc3, 0xcb, 0x60, 0x19, 0x8e, 0x9d, 0x44, 0xe2, 0x93, 0x7b, 0x15, 0xe6,
+  0x13, 0x83, 0x1f, 0xd2, 0xd7, 0xe9, 0x10, 0x18, 0x91, 0x50, 0xb4, 0x65, 0x54, 0xe2, 0x39, 0xa2,
+  0x11, 0x4a, 0x8e, 0x23, 0x11, 0x39, 0x6b, 0x0f, 0xff, 0x7a, 0xf9, 0xf6, 0x0d, 0x7a, 0xed, 0x22,
+  0xe7, 0xc0, 0xd1, 0x6d, 0x2b, 0xc6, 0x79, 0xcb, 0xc0, 0xfe, 0x1d, 0x12, 0x12, 0xad, 0x68, 0xe8,
+  0xdf, 0x89, 0x50, 0xd3, 0xa9, 0xe8, 0xe4, 0xd7, 0x60, 0x54, 0xd2, 0xc5, 0xaf, 0xa5, 0x5d, 0xd0,
+  0xf2, 0xc1, 0xa0, 0xe2, 0x0f, 0xbf, 0xea, 0xc8, 0xf3, 0xe5, 0x1b, 0xda, 0xc1, 0xac, 0xea, 0xc4,
+  0x02, 0x6e, 0x16, 0x97, 0x74, 0x63, 0x55, 0x75, 0x63, 0xe9, 0x94, 0x9b, 0x0c, 0xd8, 0x62, 0x64,
+  0xff, 0xe2, 0x21, 0x77, 0x12, 0x51, 0x00, 0x78, 0xd4, 0x11, 0x54, 0x3e, 0x4b, 0xc7, 0x43, 0x69,
+  0xd0, 0xc9, 0xa1, 0xfa, 0x83, 0x82, 0x33, 0x25, 0xb4, 0x12, 0xa6, 0x40, 0x67, 0x9a, 0x98, 0x3b,
+  0x73, 0xa9, 0x8d, 0xf3, 0xe0, 0x46, 0x81, 0x27, 0x41, 0x78, 0xdb, 0x57, 0x3c, 0x3c, 0xd4, 0x1d,
+  0xc5, 0xca, 0xc8, 0x0b, 0xc6, 0xd7, 0xd0, 0x2a, 0xed, 0x0d, 0xd3, 0xd1, 0x51, 0xa8, 0xce, 0x5f,
+  0x3e, 0x36, 0x1a, 0x66, 0xab, 0x76, 0xa8, 0x2a, 0x7f, 0x7b, 0xba, 0xa1, 0x0f, 0xb6, 0x7c, 0x7e,
+  0xb1, 0xad, 0xf0, 0x9a, 0xf7, 0xc3, 0xbf, 0x3d, 0xea, 0xd2, 0x77, 0x2c, 0xdd, 0x48, 0xa1, 0x57,
+  0x5b, 0x1b, 0x18, 0x23, 0xfb, 0x00, 0x0d, 0x35, 0xd3, 0x86, 0x87, 0x5f, 0x84, 0xf2, 0x82, 0xe0,
+  0x3a, 0x52, 0xc4, 0x7b, 0xd1, 0x50, 0x25, 0xca, 0xb9, 0x7f, 0xa2, 0x88, 0xf3, 0x79, 0x15, 0xce,
+  0xe7, 0x3a, 0x8b, 0x79, 0x40, 0xa4, 0x23, 0x99, 0xab, 0x25, 0x66, 0x7a, 0xb1, 0xe7, 0x92, 0x30,
+  0x3e, 0xda, 0x06, 0x38, 0x7f, 0x7b, 0x79, 0xf6, 0x2c, 0x39, 0x46, 0x8a, 0x6e, 0xcb, 0x10, 0x19,
+  0x63, 0xe8, 0x4c, 0x96, 0x78, 0x42, 0xf5, 0x60, 0xb4, 0x8c, 0x6e, 0x6b, 0x60, 0x56, 0x40, 0x57,
+  0xb7, 0x0a, 0x67, 0x04, 0xc8, 0x21, 0x81, 0x1d, 0xe2, 0x99, 0xfb, 0x08, 0x64, 0x86, 0x65, 0x33,
+  0x7a, 0x06, 0x88, 0xcc, 0x9a, 0xc4, 0x19, 0xef, 0xb2, 0x5c, 0x3a, 0x11, 0xb5, 0xeb, 0x9d, 0x0c,
+  0x2c, 0x29, 0x32, 0x38, 0x39, 0x28, 0xac, 0x50, 0xa4, 0xbc, 0x72, 0xf1, 0xf6, 0xf2, 0x4a, 0x61,
+  0x8b, 0x17, 0x3f, 0xf8, 0xa4, 0xb8, 0x36, 0x7d, 0xf2, 0x0a, 0xf7, 0x81, 0x96, 0x5e, 0x8c, 0x07,
+  0x68, 0x1d, 0x98, 0x07, 0x2b, 0x2e, 0x0d, 0x8a, 0xbd, 0xb1, 0xdc, 0xf8, 0xaf, 0xc1, 0x88, 0xc9,
+  0x62, 0xce, 0x4f, 0x70, 0xe5, 0x5f, 0x80, 0x7d, 0xe5, 0x46, 0x8e, 0xc4, 0x92, 0x9c, 0xa8, 0x1e,
+  0x3a, 0xbf, 0xf2, 0xe9, 0x88, 0xf3, 0xec, 0x1e, 0x07, 0x71, 0x40, 0xaa, 0xa2, 0xb4, 0x8f, 0x11,
+  0x17, 0x77, 0x6f, 0x11, 0xe4, 0xc7, 0xb8, 0x4f, 0xf3, 0x55, 0x36, 0x07, 0xd6, 0xcc, 0x0e, 0x51,
+  0xf8, 0x92, 0x86, 0x05, 0x0d, 0xfa, 0xfd, 0xaf, 0xc2, 0x08, 0x4d, 0x95, 0x7d, 0x40, 0x1e, 0x62,
+  0x84, 0xd8, 0x06, 0x73, 0xd5, 0xc3, 0xc0, 0xaf, 0x01, 0x2d, 0xcb, 0x48, 0x01, 0x78, 0xbd, 0xdb,
+  0x01, 0xbd, 0xa7, 0x60, 0x5a, 0xa4, 0xfa, 0xc0, 0xf7, 0x6e, 0x15, 0x2b, 0x11, 0x7a, 0x7c, 0x7a,
+  0x6d, 0xec, 0x25, 0x25, 0xb7, 0x70, 0xe9, 0xfb, 0xb4, 0x03, 0xbd, 0x8e, 0xe5, 0x3d, 0x1a, 0xc4,
+  0x44, 0x1d, 0xe7, 0xfd, 0x49, 0xb3, 0xd1, 0x68, 0xe0, 0xd1, 0xd0, 0x14, 0x8e, 0x32, 0x70, 0x23,
+  0xd6, 0x6e, 0xa9, 0x5d, 0xe7, 0x54, 0x8d, 0xd0, 0xe1, 0x2c, 0x3e, 0x7d, 0x3c, 0xc4, 0x7e, 0x07,
+  0x7b, 0x6c, 0x1e, 0x18, 0x9d, 0xe7, 0x25, 0x00, 0xce, 0xf3, 0x35, 0xf0, 0xfd, 0x3a, 0x5a, 0x06,
+  0xe9, 0x74, 0x97, 0xcf, 0x10, 0x15, 0x5c, 0xcf, 0x9d, 0x78, 0x16, 0xd8, 0x7d, 0x15, 0x69, 0x4c,
+  0xad, 0xcf, 0x80, 0xb8, 0x41, 0x36, 0xf7, 0xd7, 0x2a, 0xb7, 0x6f, 0xb4, 0x2b, 0xe0, 0x03, 0x6a,
+  0x5f, 0x25, 0x97, 0x01, 0x3b, 0x6f, 0xf2, 0xf8, 0x93, 0x76, 0x73, 0x73, 0xa3, 0xe1, 0x19, 0x5c,
+  0x6d, 0x19, 0x7a, 0xcc, 0x3e, 0xb4, 0xd5, 0x3b, 0xea, 0xb4, 0x8f, 0x7f, 0xbe, 0x7c, 0x51, 0xd5,
+  0xbb, 0x87, 0x8a, 0xbc, 0xec, 0xfc, 0xb3, 0x30, 0x3d, 0x3e, 0xdd, 0x22, 0x44, 0x4f, 0x90, 0x34,
+  0x43, 0x6b, 0x61, 0xc7, 0x91, 0x7d, 0x9e, 0x85, 0x16, 0x5f, 0xd9, 0x1e, 0xa3, 0xac, 0x3b, 0x24,
+  0x11, 0x7d, 0x18, 0x2f, 0x8a, 0xf3, 0xbf, 0xa4, 0x0f, 0x79, 0x00, 0xbf, 0xbc, 0x8d, 0x8e, 0x1b,
+  0xb5, 0xe5, 0xe1, 0x30, 0xf3, 0xe8, 0x50, 0x05, 0x1e, 0x3f, 0xd8, 0x83, 0xc7, 0x69, 0xd1, 0x19,
+  0x08, 0xcf, 0xe8, 0x07, 0x62, 0xc5, 0x33, 0xb6, 0x6d, 0xc5, 0x5f, 0x80, 0xb1, 0xba, 0x8c, 0x9d,
+  0x08, 0x23, 0x75, 0x0e, 0xd5, 0x39, 0xdb, 0xfe, 0x9f, 0xff, 0xb4, 0xc8, 0xd9, 0x95, 0x4b, 0xf6,
+  0x1c, 0x3f, 0x8d, 0x91, 0x7b, 0x63, 0xc3, 0xdd, 0x7c, 0xf1, 0xcb, 0x18, 0x78, 0xb2, 0xbb, 0x8c,
+  0x32, 0xdb, 0xf8, 0xff, 0x58, 0x36, 0x1a, 0x4f, 0x1b, 0xa7, 0xbc, 0xcd, 0xe7, 0x14, 0x60, 0x9a,
+  0xad, 0x3a, 0x59, 0xd0, 0xee, 0xfe, 0x22, 0x12, 0x65, 0x68, 0x6f, 0xbb, 0xd8, 0x43, 0x10, 0x5b,
+  0xde, 0x2f, 0x6c, 0xe3, 0x1b, 0x6e, 0xce, 0x31, 0xf1, 0x9e, 0xc3, 0x63, 0x8c, 0x6a, 0x49, 0x78,
+  0x80, 0xca, 0x63, 0x38, 0x7f, 0x1b, 0x32, 0xa5, 0xe9, 0x97, 0x30, 0x8a, 0xdc, 0x63, 0xad, 0xd3,
+  0x78, 0xa2, 0x9e, 0x7d, 0x02, 0xf8, 0x80, 0x06, 0x62, 0xb5, 0x9f, 0x79, 0x77, 0x04, 0xef, 0x5e,
+  0x04, 0x81, 0x9d, 0x7b, 0xdc, 0x85, 0xc7, 0xcf, 0x2d, 0x37, 0x04, 0x8a, 0xba, 0x08, 0x82, 0x90,
+  0x03, 0x77, 0xe9, 0x4e, 0x0b, 0x90, 0x25, 0x95, 0x00, 0x0a, 0xfb, 0xe9, 0x3c, 0x2d, 0xf9, 0xf7,
+  0x5c, 0xd1, 0xe8, 0x37, 0xf6, 0xea, 0xd4, 0x73, 0xcb, 0x1b, 0x19, 0xb3, 0x0f, 0x18, 0xb0, 0x31,
+  0xcc, 0x16, 0xf0, 0x18, 0xa8, 0x7c, 0xf1, 0xcb, 0x32, 0x02, 0x01, 0x98, 0x60, 0x95, 0x87, 0x68,
+  0x51, 0x3e, 0xff, 0x5c, 0x33, 0x18, 0x51, 0x18, 0x3a, 0x30, 0xd1, 0xf0, 0xaa, 0x2a, 0xaa, 0x42,
+  0xc1, 0x12, 0x1c, 0x4d, 0xb3, 0x11, 0x3a, 0x0b, 0x16, 0xac, 0xa5, 0xc1, 0x6c, 0xc4, 0x2d, 0x74,
+  0xca, 0x44, 0x3a, 0x9c, 0x2d, 0x40, 0x31, 0x50, 0xf1, 0xa9, 0x14, 0x78, 0x42, 0x69, 0xd4, 0x81,
+  0x74, 0x66, 0x8b, 0xe3, 0x6e, 0xfb, 0x89, 0xaa, 0x8c, 0x01, 0x3f, 0x70, 0x8d, 0x38, 0x54, 0x6e,
+  0xc4, 0x69, 0x09, 0x6c, 0x7a, 0x81, 0xd0, 0x2f, 0x22, 0x98, 0x94, 0x0a, 0xf0, 0x29, 0xfb, 0x7d,
+  0x05, 0xfc, 0x54, 0x6f, 0x97, 0x01, 0x2c, 0xd8, 0x00, 0x78, 0x5b, 0x83, 0x45, 0x76, 0x04, 0x0b,
+  0x36, 0x82, 0x45, 0xe9, 0x08, 0x16, 0xd2, 0x08, 0x16, 0xf9, 0x11, 0xc0, 0x0a, 0x15, 0xa9, 0xf3,
+  0x04, 0xbb, 0x05, 0x2d, 0xca, 0x5a, 0x59, 0xae, 0x87, 0xce, 0x7c, 0xe1, 0x66, 0xb6, 0x71, 0x90,
+  0xf0, 0x82, 0x2b, 0x52, 0x99, 0x31, 0xb2, 0x02, 0x08, 0xeb, 0x90, 0xd5, 0xc6, 0x4b, 0x18, 0xd3,
+  0x51, 0xf3, 0xa8, 0x65, 0x74, 0x61, 0x11, 0x4a, 0xc3, 0x12, 0xa5, 0x89, 0xc6, 0x79, 0x71, 0xba,
+  0xae, 0x2c, 0x4f, 0x14, 0xf6, 0x2c, 0x4f, 0x5f, 0xd4, 0xdd, 0xa1, 0xfa, 0x22, 0xc1, 0x11, 0x2b,
+  0x86, 0x69, 0xf2, 0x0b, 0x45, 0xa9, 0x7d, 0x2a, 0x4b, 0x57, 0x62, 0xe1, 0xd8, 0x0c, 0xa3, 0xd8,
+  0xf6, 0x00, 0x6e, 0x32, 0xf8, 0x84, 0xf1, 0x12, 0x42, 0xf1, 0x79, 0x09, 0x46, 0xe1, 0xf5, 0x71,
+  0xaf, 0xc1, 0x51, 0x8a, 0x37, 0x47, 0x6d, 0x19, 0xa7, 0x3c, 0x2a, 0xa7, 0x14, 0x72, 0xf5, 0x4d,
+  0x10, 0x2b, 0x27, 0x02, 0xbd, 0x9b, 0x00, 0x57, 0x35, 0x8d, 0xbd, 0x26, 0x10, 0x33, 0xe0, 0xa9,
+  0x0d, 0x35, 0xbf, 0xe1, 0x4b, 0x59, 0x3c, 0x8a, 0x8c, 0x55, 0x72, 0x1f, 0x48, 0x1a, 0x4f, 0x85,
+  0xb6, 0x93, 0x63, 0xc7, 0xcc, 0x22, 0x13, 0xde, 0xd4, 0x31, 0x4b, 0x4c, 0xeb, 0x30, 0xef, 0x81,
+  0x4a, 0xc9, 0xc9, 0xb3, 0x31, 0xab, 0x2c, 0x7d, 0x39, 0x3e, 0x26, 0xb0, 0x59, 0xae, 0xee, 0x6c,
+  0xa8, 0xd6, 0xa9, 0x68, 0x04, 0xa3, 0x97, 0x7f, 0x1c, 0x1d, 0xa3, 0x3b, 0x16, 0xd8, 0x89, 0x8d,
+  0xe7, 0xc1, 0x46, 0xc7, 0xb9, 0x7a, 0x6c, 0xc4, 0x94, 0x99, 0x61, 0xa8, 0xb2, 0xd4, 0x0c, 0xc1,
+  0x75, 0x8d, 0x17, 0x62, 0x59, 0x09, 0xf3, 0x28, 0x7b, 0x75, 0xc1, 0xa2, 0xaf, 0xdc, 0x05, 0x9f,
+  0x05, 0x85, 0x51, 0x34, 0xfa, 0x7e, 0x31, 0xe7, 0xf1, 0x16, 0xd8, 0x6d, 0x37, 0xca, 0xc1, 0x90,
+  0x69, 0x5d, 0x0a, 0xef, 0x4a, 0x5a, 0xdc, 0x0a, 0x32, 0x26, 0x7b, 0xd9, 0x08, 0x33, 0x12, 0x44,
+  0x82, 0x5c, 0x55, 0xa6, 0x9e, 0x87, 0xc2, 0xf9, 0x26, 0x20, 0x72, 0x50, 0x77, 0x80, 0xad, 0xb9,
+  0x19, 0xb6, 0x93, 0x0b, 0x05, 0xb7, 0xce, 0x49, 0x33, 0xe3, 0x24, 0x97, 0x2a, 0x37, 0x49, 0x42,
+  0x73, 0xc6, 0x23, 0x46, 0xb1, 0x2f, 0x02, 0xcd, 0xe1, 0x0d, 0xac, 0x03, 0xb8, 0xc2, 0x48, 0x3a,
+  0xb6, 0x27, 0xc8, 0x62, 0x3a, 0xf1, 0x10, 0x27, 0x4b, 0xa5, 0x9d, 0x0b, 0xe1, 0xdb, 0xf8, 0xe5,
+  0x89, 0x24, 0x1d, 0x0f, 0xa6, 0xe2, 0x29, 0x64, 0xea, 0x90, 0x53, 0xed, 0x60, 0x92, 0x9f, 0xdc,
+  0x47, 0x43, 0x16, 0xae, 0xaf, 0xa1, 0xe8, 0xcc, 0x65, 0x9f, 0x36, 0x31, 0x3b, 0x8a, 0x48, 0xbd,
+  0x27, 0x65, 0x4a, 0xe1, 0x6f, 0x93, 0x64, 0x25, 0xfd, 0x06, 0x1d, 0x5b, 0x55, 0x58, 0x76, 0x6d,
+  0x3a, 0x74, 0x8c, 0xc3, 0xf3, 0xe5, 0x4c, 0x98, 0x0c, 0x85, 0x22, 0x15, 0x78, 0x55, 0x14, 0xe1,
+  0x0b, 0x9d, 0x1d, 0xca, 0xe5, 0x3a, 0x7c, 0xa2, 0x1b, 0xaa, 0x28, 0x10, 0xb5, 0x88, 0x70, 0x96,
+  0x57, 0xbd, 0x50, 0x95, 0x12, 0x71, 0xe8, 0x71, 0x34, 0xc4, 0x7b, 0x9d, 0x19, 0x18, 0x8f, 0x1e,
+  0xa5, 0xd7, 0xba, 0xcf, 0x52, 0x1f, 0x47, 0xb5, 0x2f, 0x5f, 0x3e, 0x7c, 0x1c, 0xec, 0x65, 0x10,
+  0xcf, 0xa3, 0x2a, 0x69, 0x7b, 0x41, 0xde, 0xfe, 0xfb, 0x63, 0xa6, 0x02, 0x48, 0x51, 0x00, 0xa7,
+  0x4c, 0xd0, 0x7a, 0x12, 0x18, 0x13, 0xba, 0x39, 0xc1, 0x14, 0x05, 0xa1, 0xb4, 0x13, 0x6d, 0xd5,
+  0x47, 0x89, 0x56, 0x0a, 0x43, 0x04, 0xfe, 0xa0, 0x59, 0xf4, 0x73, 0xc7, 0xc5, 0xc7, 0x8c, 0x1c,
+  0xea, 0xd9, 0x88, 0x1b, 0x69, 0x6c, 0x3c, 0xe8, 0x86, 0xed, 0xb5, 0xe0, 0xf3, 0x0f, 0xee, 0x47,
+  0xce, 0xf3, 0xdd, 0xe9, 0xd0, 0xd7, 0x53, 0x45, 0x29, 0x65, 0x2a, 0x7d, 0xf1, 0x18, 0x39, 0x39,
+  0x7b, 0x7c, 0xe3, 0xc3, 0x63, 0x7e, 0xed, 0x84, 0x35, 0x2e, 0x36, 0xd0, 0xf8, 0x87, 0x36, 0x22,
+  0x67, 0xbc, 0x0c, 0x9d, 0x27, 0x95, 0x27, 0x70, 0x93, 0x44, 0x33, 0xae, 0xe7, 0xf5, 0x93, 0xf6,
+  0x72, 0xc9, 0x62, 0xbb, 0x33, 0xcd, 0x78, 0xdf, 0x49, 0x12, 0x81, 0x6b, 0x78, 0x0e, 0x78, 0xb5,
+  0xf5, 0x53, 0xb9, 0xd9, 0x24, 0xb2, 0xd2, 0xdb, 0x24, 0x8b, 0xac, 0x48, 0x6b, 0x89, 0x5f, 0xb0,
+  0x69, 0x29, 0xfc, 0x35, 0x34, 0xde, 0xfa, 0x3c, 0x6f, 0xea, 0x86, 0xd6, 0x7b, 0xd9, 0xd5, 0x7b,
+  0xef, 0x3b, 0xe3, 0x06, 0x66, 0x01, 0x33, 0x30, 0x51, 0x57, 0x4f, 0xe3, 0x69, 0xca, 0xf1, 0x37,
+  0xc2, 0x6b, 0x7c, 0xa8, 0xf0, 0x87, 0x72, 0xa2, 0x38, 0x94, 0x70, 0x83, 0xbd, 0xd9, 0x21, 0xa7,
+  0x13, 0xbe, 0xc8, 0x7c, 0x57, 0xca, 0x39, 0xb0, 0x80, 0xbf, 0x40, 0xe6, 0x07, 0xff, 0x50, 0xd5,
+  0x43, 0x9f, 0xb8, 0x3b, 0x90, 0x29, 0xa5, 0x85, 0x3f, 0x78, 0xac, 0x3e, 0x9e, 0xd6, 0xf7, 0xff,
+  0xf1, 0x0f, 0x75, 0x1f, 0xf5, 0x65, 0xb5, 0x4e, 0x05, 0x08, 0x93, 0x87, 0xe5, 0x1f, 0xba, 0xf6,
+  0x5d, 0xcd, 0xdf, 0x3f, 0x16, 0xed, 0x24, 0xa7, 0x86, 0xf3, 0x65, 0xe6, 0x1b, 0xb2, 0xd1, 0xc9,
+  0x13, 0xa1, 0x1e, 0x02, 0x05, 0x1c, 0xaa, 0x7f, 0xd2, 0xb4, 0x0f, 0x88, 0x06, 0xa6, 0x7c, 0x83,
+  0xee, 0xad, 0x50, 0xae, 0x81, 0xeb, 0x14, 0x25, 0x82, 0x13, 0xdd, 0xed, 0xc4, 0x64, 0xe7, 0xd6,
+  0xa7, 0x24, 0xf1, 0x28, 0xad, 0x65, 0xb1, 0x57, 0xa5, 0xdd, 0xf6, 0x91, 0xdf, 0x21, 0xd2, 0x67,
+  0xd8, 0xb8, 0x68, 0xb5, 0x44, 0x65, 0x28, 0x61, 0x33, 0x5f, 0x99, 0xa9, 0xc0, 0xb2, 0x2b, 0xe1,
+  0x29, 0xf4, 0xbd, 0x09, 0xb6, 0x39, 0xcb, 0xe1, 0xcb, 0x99, 0xdd, 0x82, 0x02, 0x91, 0x66, 0xea,
+  0x40, 0x5f, 0x2c, 0xc0, 0x2d, 0xe1, 0xbf, 0x6b, 0x7c, 0xde, 0x17, 0x2f, 0x81, 0xf8, 0xfa, 0xf0,
+  0x73, 0xc7, 0x0e, 0xf1, 0xb1, 0x4f, 0x23, 0xe4, 0x55, 0xc8, 0x08, 0xf7, 0xcd, 0x50, 0x4a, 0x5e,
+  0xdc, 0xd8, 0x62, 0xc3, 0x16, 0x79, 0x50, 0xfa, 0x28, 0xcb, 0xf1, 0xa1, 0xbd, 0x27, 0x2a, 0xf9,
+  0x09, 0x61, 0xbd, 0xa4, 0x47, 0x04, 0xab, 0x25, 0x04, 0x2b, 0xbb, 0x79, 0x9f, 0xc3, 0x77, 0xcb,
+  0xf6, 0x39, 0xfc, 0xda, 0xda, 0x2f, 0xdb, 0xa5, 0xc1, 0xf0, 0xea, 0xbb, 0x5a, 0xe9, 0xa9, 0x79,
+  0x7c, 0x95, 0xdd, 0xf5, 0x90, 0xbe, 0x1f, 0xb0, 0xbe, 0xaf, 0x24, 0x93, 0x77, 0xbb, 0xd3, 0x0f,
+  0x30, 0x24, 0x3b, 0xc4, 0x54, 0x30, 0xe3, 0xe4, 0x8e, 0x86, 0xe2, 0x31, 0x2d, 0xea, 0xfa, 0x62,
+  0x98, 0xc3, 0x2c, 0x3f, 0x4d, 0xc1, 0xdb, 0xe2, 0x89, 0xeb, 0x60, 0xe9, 0x1e, 0xaa, 0x20, 0x71,
+  0x93, 0x23, 0x15, 0x39, 0xf9, 0xc9, 0x35, 0x28, 0x0c, 0xc9, 0x84, 0x46, 0xcb, 0xb7, 0xc8, 0x23,
+  0xe0, 0x3a, 0x8f, 0xc4, 0xd7, 0x28, 0xca, 0x8b, 0x2c, 0x6a, 0x1b, 0x64, 0xb0, 0x3d, 0x4c, 0x65,
+  0xee, 0x97, 0x2f, 0x3c, 0x48, 0x37, 0x1f, 0x67, 0x90, 0xa8, 0xb8, 0xdf, 0x29, 0xa9, 0x36, 0xca,
+  0x81, 0xde, 0x01, 0xb7, 0x92, 0xc2, 0x2e, 0xc5, 0x77, 0xf0, 0x18, 0x26, 0x44, 0x44, 0x3a, 0xd0,
+  0x2d, 0x61, 0x09, 0x02, 0x7f, 0xb8, 0xb9, 0x5d, 0x1d, 0xa1, 0x20, 0x7d, 0x7d, 0x85, 0xcd, 0x19,
+  0xb4, 0x3f, 0x71, 0xc3, 0x39, 0xd4, 0x47, 0x9f, 0x22, 0x45, 0x81, 0xb0, 0x1c, 0x81, 0x4f, 0xd4,
+  0x5a, 0x55, 0x78, 0x02, 0xcd, 0xc0, 0xef, 0x89, 0x65, 0x62, 0x31, 0x2c, 0x73, 0xc0, 0x22, 0x18,
+  0xd0, 0x1c, 0x59, 0x32, 0x26, 0xaa, 0xc6, 0xf8, 0xae, 0x18, 0xec, 0x92, 0xf7, 0x3c, 0xfd, 0xcd,
+  0xb9, 0x1d, 0x05, 0x68, 0xde, 0x46, 0x33, 0xd0, 0x32, 0xc6, 0x4b, 0xd9, 0xff, 0x94, 0x2c, 0xb7,
+  0xa2, 0x4b, 0xfc, 0xda, 0xb9, 0xc5, 0xb3, 0xa0, 0x39, 0x9f, 0x38, 0x7a, 0x9b, 0x75, 0x78, 0x85,
+  0x8e, 0xc8, 0x33, 0x50, 0xd9, 0x16, 0xa0, 0x58, 0xaf, 0x93, 0xe3, 0xb9, 0xd2, 0x86, 0xbd, 0x9c,
+  0xcb, 0xed, 0x2e, 0x53, 0x6d, 0xa2, 0x3e, 0x7a, 0xf4, 0x1d, 0xe8, 0xe1, 0x71, 0xe8, 0x01, 0x68,
+  0x74, 0x3d, 0x07, 0xdd, 0x9b, 0xae, 0x53, 0x78, 0x68, 0x93, 0x92, 0x47, 0x4c, 0xe9, 0xb1, 0x35,
+  0x45, 0xed, 0xff, 0x3b, 0xa8, 0xfd, 0xea, 0xcd, 0xc5, 0x4f, 0x57, 0xea, 0x2e, 0x25, 0x2f, 0xcf,
+  0xce, 0xcf, 0x4e, 0xaf, 0xd4, 0x5a, 0x1a, 0xb5, 0x31, 0xc8, 0xc0, 0xa1, 0xa8, 0xdf, 0xa6, 0xbf,
+  0xb5, 0x83, 0xa1, 0x61, 0x88, 0xcc, 0x67, 0xce, 0xc4, 0x82, 0x95, 0x02, 0x1d, 0x67, 0x73, 0x14,
+  0xdc, 0x91, 0x9b, 0x54, 0x8a, 0xbc, 0x45, 0x34, 0x55, 0xc4, 0x42, 0x70, 0x14, 0x22, 0x57, 0xe2,
+  0xf9, 0x76, 0xab, 0xe2, 0x1c, 0x0a, 0xbb, 0xb8, 0x9b, 0x6b, 0xe6, 0x92, 0x81, 0x48, 0xe0, 0xbc,
+  0xf2, 0x5d, 0x09, 0x1a, 0xbe, 0x63, 0x57, 0x24, 0x10, 0xdc, 0x6c, 0xcf, 0x04, 0x6a, 0x57, 0x1d,
+  0xe5, 0xce, 0x04, 0xa4, 0xc3, 0xb8, 0xb7, 0x6e, 0x3c, 0xe4, 0xda, 0x79, 0x3b, 0x99, 0x60, 0x76,
+  0x50, 0x46, 0xd9, 0x99, 0x3d, 0x45, 0x68, 0x0c, 0x58, 0x69, 0xfe, 0x08, 0xa6, 0x7c, 0x9c, 0x44,
+  0xde, 0xc2, 0x06, 0x52, 0x3b, 0x40, 0x07, 0xf9, 0xa3, 0x47, 0xf8, 0x37, 0xbb, 0x65, 0x62, 0xd4,
+  0x6a, 0xdb, 0xbc, 0x03, 0x78, 0xf8, 0xa1, 0xc1, 0x5d, 0xdc, 0xf2, 0x21, 0x74, 0xda, 0x74, 0x4a,
+  0xe2, 0xcc, 0x0f, 0x78, 0x18, 0x1b, 0xee, 0xd2, 0x58, 0xb4, 0xd7, 0xa6, 0xb0, 0x4d, 0x6d, 0x44,
+  0x57, 0xad, 0xd2, 0xf3, 0x2b, 0x76, 0x96, 0x85, 0xb3, 0x21, 0x39, 0xf5, 0x03, 0x94, 0x05, 0x46,
+  0x83, 0x33, 0x01, 0x04, 0xb0, 0x50, 0xd8, 0xec, 0xd1, 0xa1, 0xa1, 0x54, 0x74, 0x50, 0x75, 0xcc,
+  0x87, 0x1f, 0x06, 0xe2, 0x1e, 0x54, 0xa9, 0x46, 0xed, 0x23, 0x39, 0xc5, 0x59, 0x97, 0x3c, 0xcc,
+  0xbb, 0xd0, 0x61, 0x72, 0x5a, 0x20, 0xed, 0x92, 0x17, 0xc5, 0x0e, 0x57, 0xe9, 0xdb, 0xac, 0x97,
+  0x93, 0x97, 0xe1, 0x8d, 0xa7, 0xa7, 0x0c, 0x8a, 0xed, 0xf3, 0x33, 0x07, 0x69, 0xf3, 0x69, 0x61,
+  0xea, 0x21, 0x79, 0x9f, 0xed, 0x20, 0x2d, 0x75, 0x97, 0x38, 0x68, 0xe8, 0x90, 0x42, 0xb1, 0x87,
+  0xe4, 0xf8, 0x42, 0xda, 0x87, 0x28, 0x4c, 0x3d, 0x48, 0xef, 0xb3, 0x7d, 0x88, 0x52, 0xbc, 0x87,
+  0xf4, 0xe4, 0x43, 0xb1, 0x0f, 0x3c, 0x07, 0x91, 0x36, 0x9f, 0x96, 0xa4, 0x0e, 0xd8, 0xcb, 0x6c,
+  0xdb, 0x69, 0x11, 0xd1, 0x7a, 0x26, 0xc8, 0x3f, 0xd3, 0x43, 0x3e, 0xde, 0x7f, 0x98, 0x2f, 0x2d,
+  0xc2, 0x09, 0x58, 0xa4, 0x7f, 0x49, 0xdd, 0x34, 0xe8, 0x7f, 0x98, 0x14, 0x63, 0xea, 0x48, 0x3c,
+  0x8d, 0x86, 0x1b, 0xd4, 0xae, 0xef, 0x29, 0xb6, 0x47, 0xd1, 0xe3, 0xa9, 0x92, 0x9c, 0x78, 0xa0,
+  0x6a, 0xd7, 0xc3, 0x0f, 0xaa, 0x75, 0x33, 0x02, 0xa9, 0x63, 0x4d, 0xc7, 0xf8, 0xd7, 0xc1, 0xbf,
+  0xb3, 0xb9, 0xcb, 0x65, 0xed, 0x0a, 0x56, 0xed, 0x02, 0x7e, 0x47, 0x0b, 0x7c, 0x7e, 0x43, 0x7f,
+  0x71, 0x5f, 0x46, 0x2d, 0x1c, 0x16, 0x89, 0xaf, 0x33, 0x86, 0x2b, 0x8e, 0xe4, 0x43, 0x7c, 0x0d,
+  0x46, 0xeb, 0x47, 0x79, 0x20, 0x8f, 0x1e, 0x01, 0xa4, 0xf0, 0xb0, 0xc6, 0x7e, 0xe4, 0x40, 0x70,
+  0x5e, 0xfa, 0x2e, 0x71, 0xdf, 0xe2, 0xbe, 0x37, 0x4d, 0x4b, 0x89, 0xff, 0x51, 0xf2, 0x3d, 0x56,
+  0xbb, 0x1e, 0xe9, 0xfb, 0x7a, 0x22, 0xdd, 0xaf, 0x3a, 0x60, 0x2e, 0xa9, 0x0a, 0x7f, 0xe6, 0xe3,
+  0x93, 0x4d, 0x2d, 0xa1, 0x13, 0x33, 0xeb, 0xa9, 0xe4, 0xf1, 0x4a, 0xd9, 0x2f, 0xb5, 0x94, 0x47,
+  0x4e, 0xcb, 0xc1, 0x4c, 0xeb, 0xbd, 0x8d, 0x1c, 0x0a, 0x20, 0xc8, 0x7f, 0xb2, 0xa4, 0x30, 0xa8,
+  0x60, 0xe9, 0xd9, 0x8a, 0x1f, 0xc4, 0x98, 0x33, 0xd9, 0x16, 0xa9, 0x90, 0xd5, 0x82, 0x42, 0x24,
+  0xe2, 0x54, 0x84, 0xd6, 0x47, 0x8d, 0x0d, 0x4b, 0x3b, 0x18, 0xf0, 0xe0, 0x1a, 0x2f, 0xf7, 0x1e,
+  0x3f, 0x65, 0xa2, 0xd6, 0x44, 0xe4, 0xb5, 0xec, 0x4d, 0x67, 0xad, 0xe5, 0xfc, 0x8a, 0x3c, 0x52,
+  0x01, 0x41, 0xb3, 0x24, 0xd7, 0x30, 0xb6, 0x9b, 0xf3, 0xfb, 0xfe, 0xa0, 0x8a, 0x10, 0x17, 0x04,
+  0x9a, 0x08, 0x51, 0x78, 0xd2, 0x99, 0x1b, 0xfd, 0x00, 0x23, 0x10, 0xfe, 0x92, 0xfc, 0xa9, 0x15,
+  0x9d, 0xef, 0xc2, 0x51, 0x4f, 0x5e, 0xfa, 0xea, 0xe2, 0xa6, 0xd8, 0xde, 0x18, 0xe3, 0x6a, 0x2d,
+  0xf3, 0xfb, 0x97, 0x0c, 0x25, 0xe3, 0x95, 0x57, 0x82, 0x09, 0xa8, 0xbf, 0xa9, 0xf7, 0xfd, 0x40,
+  0x3d, 0x84, 0xc6, 0x30, 0x06, 0x03, 0x77, 0xf5, 0x6b, 0x65, 0x03, 0x64, 0xef, 0x59, 0xc8, 0x3a,
+  0x5c, 0x1f, 0xf7, 0x1a, 0x35, 0x2a, 0x23, 0x79, 0x40, 0xf3, 0x5f, 0x91, 0x51, 0xc6, 0xa1, 0x1b,
+  0xab, 0x69, 0x94, 0x04, 0x56, 0x3b, 0x6a, 0x6f, 0xaf, 0x76, 0x63, 0x85, 0xbe, 0xa8, 0xb6, 0xad,
+  0x70, 0x2e, 0x7c, 0x53, 0x50, 0xf0, 0x73, 0x4e, 0x33, 0x51, 0x35, 0xf9, 0xb2, 0xc8, 0x3c, 0x1e,
+  0xc0, 0x02, 0x64, 0xc7, 0xc9, 0x84, 0x59, 0xc8, 0x83, 0x3d, 0x7c, 0x54, 0xb0, 0x93, 0x8b, 0x1f,
+  0xff, 0x28, 0x77, 0x68, 0xca, 0x9f, 0x15, 0x2e, 0xcf, 0x07, 0x9d, 0x7c, 0xb4, 0x07, 0x47, 0x08,
+  0x32, 0x3f, 0xf9, 0x5a, 0xa6, 0x30, 0xeb, 0xf3, 0xb9, 0x2c, 0x40, 0xbb, 0xd1, 0xa8, 0xa8, 0xfa,
+  0x75, 0x02, 0x05, 0x76, 0x1e, 0xe0, 0x1f, 0x99, 0x3b, 0x8f, 0xbe, 0x4c, 0x82, 0x76, 0x19, 0x99,
+  0x45, 0xc2, 0xc9, 0x91, 0xe0, 0x24, 0x5d, 0x5e, 0x6c, 0x30, 0x84, 0x0f, 0xe5, 0xcb, 0x17, 0x85,
+  0x5f, 0x72, 0x66, 0x4d, 0xe1, 0x83, 0x5f, 0x73, 0x80, 0xff, 0x4a, 0xe9, 0x36, 0x09, 0x45, 0x78,
+  0x00, 0x04, 0xd3, 0xc2, 0x44, 0x4a, 0x10, 0xb2, 0x5c, 0xf2, 0x91, 0x72, 0xeb, 0xc4, 0x1b, 0xa9,
+  0x0e, 0xb3, 0x7c, 0xcb, 0xc9, 0xb5, 0xbb, 0x65, 0xc9, 0xb5, 0xf7, 0x8f, 0xaf, 0xac, 0x6b, 0x47,
+  0x89, 0x82, 0xb9, 0x23, 0xf5, 0xc0, 0x12, 0x01, 0x88, 0x8e, 0xc0, 0xd2, 0x8d, 0x80, 0x85, 0x00,
+  0x85, 0xcd, 0x95, 0x99, 0x13, 0x3a, 0x95, 0x93, 0x44, 0x3c, 0x8a, 0x1a, 0x19, 0x8a, 0x09, 0x82,
+  0xbf, 0xa0, 0x0b, 0xa7, 0x84, 0x39, 0x49, 0x68, 0x77, 0x92, 0x84, 0x50, 0xb1, 0x84, 0x37, 0x40,
+  0xc3, 0x5c, 0xf4, 0xb2, 0xc3, 0xe9, 0xd4, 0xf7, 0x30, 0x3b, 0xd1, 0x2c, 0x37, 0x8e, 0xd8, 0xaa,
+  0x8e, 0xe7, 0x5e, 0x71, 0x92, 0xc7, 0xc1, 0xd2, 0x8f, 0xb9, 0xeb, 0x32, 0xf9, 0x04, 0xa7, 0xc8,
+  0x02, 0x20, 0xda, 0x21, 0x57, 0x1d, 0xff, 0x18, 0x27, 0x3d, 0x97, 0x9d, 0x99, 0x50, 0x9a, 0x75,
+  0x73, 0xa8, 0x0a, 0x94, 0xfc, 0xdf, 0xff, 0xfd, 0x7f, 0x80, 0x7d, 0x32, 0x90, 0xe0, 0x29, 0xbb,
+  0xc8, 0x7b, 0xfb, 0x10, 0x9e, 0xc3, 0x22, 0x40, 0xd3, 0xd0, 0xb5, 0xf7, 0xf1, 0x7d, 0x82, 0x92,
+  0xbc, 0xdf, 0x68, 0x22, 0x76, 0x76, 0x3f, 0x0f, 0x0f, 0x26, 0x22, 0x39, 0x81, 0xbc, 0xf7, 0x8a,
+  0x01, 0x12, 0x7f, 0x7b, 0xca, 0x58, 0x31, 0x2b, 0x70, 0x9c, 0x8a, 0x09, 0xa9, 0xd6, 0x41, 0xb9,
+  0xac, 0xc1, 0xfd, 0x6b, 0xee, 0x32, 0x47, 0x94, 0x9f, 0x5b, 0x23, 0xc7, 0x1b, 0xe6, 0xd1, 0xff,
+  0x44, 0xfd, 0xeb, 0xc5, 0x0b, 0xcc, 0x79, 0xfa, 0xea, 0xd9, 0xd9, 0x5b, 0xa9, 0xf4, 0x29, 0x8d,
+  0x24, 0x2d, 0x4d, 0x63, 0x87, 0xd2, 0x88, 0x04, 0xe6, 0x81, 0x06, 0x5e, 0x7c, 0x35, 0x5b, 0xce,
+  0x47, 0x3e, 0x48, 0x20, 0xe5, 0xa7, 0x77, 0xe7, 0x18, 0x3e, 0xc4, 0x03, 0x58, 0x29, 0x95, 0xbc,
+  0x82, 0xb0, 0x01, 0x85, 0x29, 0x60, 0xcb, 0xa1, 0xbb, 0x70, 0x84, 0x87, 0xb4, 0xc6, 0x18, 0x72,
+  0xeb, 0x32, 0x85, 0xca, 0x8d, 0x1d, 0xef, 0x56, 0x84, 0x95, 0xc7, 0xd8, 0xd4, 0x4f, 0xa1, 0x37,
+  0x4c, 0x38, 0x21, 0x3d, 0x79, 0xe2, 0x93, 0x34, 0x28, 0xf3, 0x13, 0x4d, 0xe8, 0x14, 0x09, 0xfa,
+  0x93, 0x22, 0x28, 0xc0, 0x50, 0x51, 0x39, 0x1b, 0xf8, 0x4d, 0x10, 0xc9, 0x41, 0x8e, 0x6c, 0x00,
+  0x3f, 0x54, 0x45, 0x1e, 0x72, 0xd6, 0x50, 0xd6, 0x43, 0xae, 0x3e, 0xfa, 0xbe, 0xd9, 0x1b, 0xa8,
+  0xcc, 0x47, 0xce, 0x0a, 0x21, 0x26, 0xf0, 0xb6, 0x46, 0xb3, 0x4a, 0x53, 0x92, 0x45, 0x25, 0x4c,
+  0x67, 0x45, 0xef, 0xd2, 0x17, 0x59, 0x77, 0xe3, 0x43, 0xf8, 0x99, 0x95, 0x5c, 0x86, 0xe6, 0x42,
+  0xc2, 0xe7, 0x3c, 0x0f, 0xc9, 0xf0, 0xa1, 0xd7, 0x5d, 0xfc, 0xf4, 0x08, 0xe6, 0x67, 0x37, 0xe1,
+  0xa2, 0xa9, 0x37, 0x80, 0x13, 0xe1, 0xc7, 0x4a, 0x0c, 0xd3, 0xc3, 0x1f, 0xfc, 0x0a, 0x18, 0xbc,
+  0xd4, 0xe0, 0x3a, 0xff, 0xed, 0x0f, 0x89, 0xa2, 0xf1, 0xa3, 0x44, 0x32, 0x0e, 0xf1, 0xcb, 0x44,
+  0x78, 0xd8, 0x62, 0x1f, 0x54, 0x0a, 0x3e, 0x5d, 0x87, 0x2a, 0xff, 0x58, 0x91, 0x40, 0x23, 0x3e,
+  0xf0, 0x98, 0xc4, 0x1b, 0xee, 0x7b, 0xd6, 0xe7, 0x5b, 0xc4, 0x3a, 0xa5, 0xf3, 0xda, 0xc7, 0xdd,
+  0x05, 0x72, 0x4c, 0xb8, 0xc1, 0x32, 0xe2, 0xee, 0x8b, 0x4b, 0x77, 0x84, 0x61, 0x84, 0x39, 0x47,
+  0xdc, 0x3f, 0xc8, 0x13, 0xf7, 0x0f, 0x15, 0xeb, 0xb2, 0x70, 0x45, 0x56, 0xb9, 0xa2, 0xd4, 0x71,
+  0xba, 0x65, 0x5b, 0x31, 0x01, 0x2b, 0xd7, 0xde, 0x09, 0xf1, 0xb9, 0xc4, 0x73, 0x7f, 0x20, 0x5e,
+  0x30, 0x15, 0xd5, 0x16, 0x9c, 0x60, 0x1e, 0x9c, 0x7b, 0xe1, 0xa4, 0x9a, 0x1a, 0x6f, 0xbf, 0x02,
+  0x36, 0xee, 0xaa, 0xda, 0xc7, 0x55, 0x01, 0x98, 0x10, 0x4c, 0x04, 0x37, 0x7b, 0xd8, 0x2d, 0x71,
+  0x20, 0x69, 0x47, 0xa3, 0xa2, 0x7e, 0xf4, 0x19, 0x2b, 0x44, 0x9f, 0x4b, 0x4a, 0x66, 0xf3, 0x6c,
+  0x63, 0x61, 0xdb, 0xf1, 0xe4, 0xcf, 0x60, 0xd1, 0xb7, 0x9f, 0x30, 0x57, 0xcc, 0x45, 0x18, 0x2c,
+  0xac, 0xa9, 0xc5, 0x4c, 0x93, 0x01, 0x8b, 0x25, 0xdc, 0x79, 0xc5, 0xd7, 0xf6, 0x15, 0x96, 0xac,
+  0x66, 0x9f, 0x7d, 0x51, 0xee, 0x9f, 0xf2, 0x31, 0xbb, 0x24, 0xd1, 0xb6, 0x34, 0xfe, 0x74, 0x2f,
+  0xa8, 0xf8, 0x2c, 0xa7, 0x06, 0xe1, 0xeb, 0x8a, 0xc8, 0xca, 0x3d, 0x3c, 0x6a, 0x14, 0x00, 0xd5,
+  0x10, 0x1d, 0x1d, 0xa8, 0x42, 0x99, 0xa6, 0xdb, 0xbe, 0x5a, 0x77, 0xee, 0xa1, 0x16, 0xff, 0xe1,
+  0x5a, 0x63, 0xea, 0x86, 0xa7, 0xdc, 0x2f, 0x53, 0x91, 0x95, 0xfc, 0x9e, 0x1a, 0x11, 0xff, 0x80,
+  0xbd, 0x30, 0x41, 0x85, 0x4f, 0x1f, 0x30, 0x94, 0x53, 0x73, 0xf2, 0x99, 0x9b, 0x44, 0x7a, 0x42,
+  0x22, 0x26, 0x92, 0x40, 0xdc, 0x46, 0xf5, 0x32, 0xd2, 0x4b, 0x14, 0x23, 0x5d, 0x7e, 0x83, 0x14,
+  0x13, 0x32, 0xcc, 0xf6, 0x86, 0x06, 0x4f, 0x2e, 0xa4, 0x3e, 0xe3, 0x75, 0xd1, 0x6a, 0x50, 0x0f,
+  0x19, 0xf7, 0x60, 0xfb, 0x2e, 0x2c, 0x94, 0xfb, 0xf1, 0x63, 0xe5, 0x27, 0x30, 0x99, 0xd8, 0xe7,
+  0xaf, 0x28, 0x11, 0x02, 0x9e, 0x84, 0x08, 0x03, 0xcc, 0xca, 0xa1, 0x29, 0xf3, 0x20, 0xc4, 0x10,
+  0x68, 0xcf, 0x45, 0x13, 0x96, 0x72, 0xe3, 0x50, 0x64, 0x3c, 0xff, 0x14, 0x11, 0xe9, 0x22, 0x7b,
+  0xbb, 0x67, 0x64, 0xa4, 0x61, 0xe1, 0x5d, 0x92, 0x96, 0x11, 0xe1, 0xc1, 0x07, 0xe5, 0x79, 0x9a,
+  0xb2, 0x87, 0xf0, 0xe4, 0x23, 0xc4, 0x74, 0xe8, 0x21, 0x4d, 0xda, 0x58, 0x7e, 0x00, 0x3e, 0x5b,
+  0x9d, 0x79, 0x88, 0x93, 0xea, 0x19, 0xe4, 0x88, 0x04, 0x5f, 0x7d, 0x8e, 0x22, 0x9e, 0xd5, 0x30,
+  0x4d, 0xd4, 0x9c, 0xcc, 0x58, 0x22, 0xec, 0xa9, 0x98, 0x94, 0xd2, 0x7c, 0xf9, 0xe0, 0x09, 0x1b,
+  0x48, 0x53, 0xbe, 0x44, 0x6e, 0x2f, 0xe6, 0x4f, 0xac, 0x2c, 0x2f, 0x98, 0x1e, 0xa8, 0xef, 0xa1,
+  0x63, 0x61, 0xf9, 0xc1, 0xb2, 0x62, 0x50, 0x62, 0xff, 0x70, 0x83, 0x3f, 0x75, 0x15, 0xea, 0xc2,
+  0x35, 0xfc, 0xe5, 0x2d, 0x3a, 0x64, 0xfc, 0x56, 0x33, 0x27, 0xd2, 0x3b, 0x0a, 0x5a, 0x07, 0xd0,
+  0xc3, 0xe5, 0x2c, 0xb8, 0x61, 0x5a, 0x2b, 0x66, 0xbc, 0xa1, 0x03, 0x7b, 0xa3, 0xe0, 0x13, 0x46,
+  0x0e, 0x59, 0x1e, 0x3b, 0x46, 0x80, 0x57, 0x95, 0x33, 0x0e, 0xb4, 0x8e, 0x8d, 0x53, 0xa1, 0xbc,
+  0x15, 0x4e, 0x12, 0xdb, 0xb9, 0x51, 0xc5, 0xeb, 0x0d, 0x4c, 0x81, 0x17, 0xd5, 0x46, 0xf2, 0xa7,
+  0xd1, 0x99, 0xd8, 0xb7, 0xf0, 0x4b, 0x74, 0x62, 0xcf, 0x82, 0x7b, 0xfe, 0x6b, 0x19, 0xfb, 0xb9,
+  0xa4, 0x9d, 0x9b, 0xd0, 0x5a, 0xec, 0x57, 0xbe, 0xe5, 0x4b, 0x64, 0x9b, 0x6d, 0xce, 0xfe, 0xa2,
+  0xcc, 0xe6, 0x32, 0x7a, 0x99, 0x11, 0xcf, 0x42, 0x38, 0x7f, 0x3d, 0x2d, 0xa5, 0xa2, 0x72, 0x8a,
+  0xb7, 0x7f, 0xa8, 0x39, 0x26, 0x46, 0x87, 0x4e, 0xfe, 0xa1, 0x0e, 0x36, 0x0a, 0xf4, 0x2a, 0x34,
+  0xb0, 0xcf, 0x0f, 0x0b, 0x13, 0x86, 0x0d, 0x47, 0xd8, 0x28, 0x55, 0xf3, 0x13, 0xfb, 0x51, 0xe5,
+  0xf7, 0x90, 0xe4, 0x4f, 0xf4, 0x66, 0x98, 0x1d, 0x4a, 0x4e, 0x22, 0x50, 0xae, 0x05, 0x7f, 0x8b,
+  0x2f, 0xcf, 0x8a, 0xd5, 0x9d, 0x7e, 0x75, 0x69, 0xfb, 0x47, 0x9b, 0xf8, 0xfe, 0x10, 0x6e, 0xb2,
+  0x10, 0x8c, 0x34, 0xbf, 0xa4, 0xb6, 0xff, 0x32, 0xf2, 0x2c, 0xff, 0xfa, 0x1e, 0xc0, 0x1a, 0x3d,
+  0xfa, 0x04, 0xca, 0xd1, 0xfb, 0xe6, 0xbd, 0xd4, 0xed, 0x95, 0x76, 0x84, 0xd2, 0x0b, 0xc6, 0x65,
+  0xb4, 0x94, 0x26, 0x8c, 0x0b, 0xc4, 0x7b, 0xcf, 0xd3, 0x7a, 0x7a, 0xb7, 0xa9, 0xd0, 0x1f, 0x83,
+  0xbe, 0x8a, 0x48, 0x9f, 0x33, 0x60, 0x9f, 0x51, 0x7c, 0x6f, 0x34, 0x66, 0xe6, 0xfb, 0xe6, 0x4c,
+  0xd6, 0xac, 0xde, 0xc2, 0x00, 0x94, 0x2b, 0x6b, 0xb4, 0x6d, 0xec, 0x76, 0x7e, 0x71, 0xd1, 0x66,
+  0x5b, 0x84, 0xe1, 0x3e, 0xba, 0x34, 0xcb, 0x30, 0xec, 0x64, 0xa1, 0xe5, 0x15, 0xa0, 0x7b, 0x4e,
+  0xe3, 0xb7, 0xf9, 0x4e, 0x6f, 0xee, 0xcb, 0x5a, 0xfc, 0x6f, 0x51, 0xc5, 0x13, 0x54, 0xfb, 0x69,
+  0x33, 0x53, 0xa9, 0x64, 0x31, 0xff, 0xaa, 0x1f, 0x44, 0x4d, 0x54, 0x8c, 0x6a, 0x99, 0x49, 0x1c,
+  0x37, 0x0d, 0x67, 0x16, 0x8c, 0x9e, 0x89, 0x72, 0x8e, 0x17, 0xc6, 0xda, 0xd9, 0x97, 0x08, 0xc5,
+  0x7a, 0x55, 0x58, 0x82, 0x8f, 0x7f, 0x7d, 0xce, 0xaf, 0xee, 0x1d, 0xaa, 0x9b, 0xb9, 0x7f, 0x52,
+  0x22, 0x1b, 0x3b, 0xda, 0x6d, 0x50, 0x7c, 0xe8, 0x27, 0x1e, 0x2d, 0xda, 0x6b, 0xfc, 0x50, 0xf6,
+  0x21, 0xc9, 0x5a, 0xee, 0xb3, 0x91, 0xec, 0x39, 0x8a, 0x5b, 0x11, 0xf0, 0xd4, 0xc4, 0x8f, 0x3f,
+  0x52, 0xf4, 0x69, 0x31, 0x28, 0x0a, 0x24, 0xa8, 0x16, 0xcd, 0x2c, 0x40, 0x6a, 0xbf, 0x81, 0xd1,
+  0xa7, 0x4a, 0x0b, 0xbf, 0x1d, 0x1a, 0x4e, 0x47, 0xd6, 0x41, 0xa3, 0x8e, 0xff, 0xea, 0x6d, 0xd1,
+  0x41, 0xd9, 0xa7, 0xfd, 0xaa, 0x60, 0x27, 0xd0, 0x79, 0xe4, 0x57, 0xb7, 0xf8, 0x69, 0xcb, 0x76,
+  0x76, 0x28, 0xb8, 0xf1, 0x6c, 0x85, 0xda, 0x14, 0xdf, 0xe2, 0x8c, 0x19, 0xcd, 0xb6, 0xed, 0x4c,
+  0xeb, 0xc9, 0xe7, 0xf6, 0xea, 0xdf, 0x8f, 0x7a, 0xc6, 0xd8, 0x18, 0xc3, 0x1a, 0x97, 0x3f, 0x90,
+  0x5a, 0xf2, 0x29, 0xd4, 0x5f, 0x97, 0x11, 0x7e, 0x3c, 0x04, 0xe3, 0x74, 0x70, 0xa7, 0x40, 0x3c,
+  0xce, 0x06, 0xd9, 0x32, 0x9f, 0xf5, 0xb6, 0x50, 0x3e, 0x36, 0x90, 0x96, 0x34, 0x10, 0xba, 0xa6,
+  0x08, 0xbf, 0xef, 0x27, 0x93, 0x89, 0xf8, 0x76, 0x1f, 0x7e, 0x5d, 0xb2, 0x4f, 0x1f, 0x84, 0xdf,
+  0xcd, 0xaa, 0xcc, 0xe1, 0x4b, 0x52, 0xda, 0x7b, 0xf9, 0x2f, 0x0f, 0x76, 0x1a, 0x8d, 0xdc, 0xc7,
+  0x0c, 0x5b, 0x85, 0x78, 0xd8, 0xda, 0x00, 0xc3, 0x8c, 0xb4, 0x11, 0x90, 0xfc, 0x75, 0x9f, 0xfe,
+  0xc2, 0x04, 0x7b, 0xfb, 0x92, 0x98, 0xdc, 0xd2, 0xeb, 0xd1, 0xa6, 0x0f, 0x13, 0xf2, 0x6e, 0x4d,
+  0xfa, 0x14, 0x29, 0xfb, 0xf2, 0xe7, 0x7b, 0x5a, 0x98, 0xe8, 0x36, 0x24, 0x66, 0x4e, 0x6b, 0xf2,
+  0xfd, 0xf9, 0x29, 0xfa, 0x56, 0xe7, 0x8e, 0xed, 0x5a, 0x0a, 0x4e, 0x90, 0xf8, 0x60, 0x61, 0xbe,
+  0xdf, 0x1d, 0x3e, 0x70, 0x8b, 0x5f, 0xb3, 0xa5, 0x30, 0x68, 0xaa, 0xfb, 0xbb, 0xe4, 0xf7, 0x60,
+  0x47, 0xd1, 0x91, 0x9b, 0x73, 0x30, 0xe0, 0x7e, 0xa8, 0xa0, 0xa4, 0x6f, 0xab, 0x11, 0x30, 0xdc,
+  0xa6, 0x46, 0x71, 0x35, 0x02, 0xbe, 0xae, 0x7c, 0xfc, 0xba, 0xc3, 0xff, 0xc6, 0x92, 0x94, 0xb0,
+  0x92, 0x12, 0x57, 0x7a, 0xf5, 0xff, 0x8f, 0x54, 0x95, 0x06, 0xbe, 0x93, 0x64, 0xcd, 0x1a, 0xf7,
+  0x29, 0x19, 0x70, 0xd3, 0x3e, 0x13, 0x8f, 0xc7, 0xb0, 0x9d, 0xd8, 0xe4, 0x1b, 0xc2, 0xf1, 0x58,
+  0x43, 0x3b, 0xd9, 0x92, 0x5f, 0x25, 0xbf, 0x12, 0x73, 0x1c, 0x20, 0xe0, 0x7c, 0x0c, 0x69, 0xe2,
+  0xeb, 0x6c, 0x82, 0x12, 0xa1, 0x4a, 0x64, 0x53, 0x56, 0xf1, 0x81, 0xed, 0x94, 0xa1, 0x98, 0x59,
+  0xe1, 0x25, 0x15, 0xf2, 0x9e, 0x12, 0xe7, 0xd3, 0x22, 0x08, 0xe3, 0x13, 0xcf, 0x43, 0xb0, 0x22,
+  0x7e, 0xd0, 0xfc, 0xad, 0xef, 0x28, 0x57, 0x27, 0xef, 0x78, 0x86, 0x22, 0xb6, 0x51, 0x90, 0xe6,
+  0x6f, 0x03, 0xe3, 0x35, 0x8a, 0x31, 0x32, 0x20, 0x98, 0x28, 0x56, 0xaa, 0xcd, 0x2c, 0x1c, 0xda,
+  0xe1, 0x77, 0xc4, 0x66, 0xc1, 0x66, 0xd7, 0x05, 0xf7, 0x5c, 0xa4, 0x69, 0x1b, 0x08, 0x0e, 0xb5,
+  0xfc, 0xd3, 0x12, 0xec, 0x25, 0x7e, 0x2e, 0x7e, 0x9b, 0xf3, 0x22, 0xf5, 0x5d, 0x58, 0x29, 0xdf,
+  0x60, 0x78, 0x3f, 0xa3, 0x46, 0x8a, 0x29, 0xc7, 0x0b, 0x94, 0x25, 0x23, 0xa3, 0x8c, 0xb2, 0x4e,
+  0xce, 0xcf, 0xc5, 0xde, 0x13, 0xe6, 0xef, 0x62, 0x1b, 0x4e, 0x4f, 0x94, 0x2b, 0x58, 0x97, 0xb8,
+  0x87, 0x82, 0xd1, 0x09, 0x23, 0x47, 0x01, 0xb5, 0x00, 0xe8, 0xe7, 0x3b, 0x89, 0xfa, 0x38, 0x62,
+  0xd9, 0xa1, 0x7d, 0x90, 0x5d, 0xb6, 0x83, 0x47, 0xe4, 0x65, 0x6c, 0x62, 0x0e, 0xdf, 0xd0, 0xf9,
+  0x6d, 0x89, 0xe9, 0x13, 0x64, 0x74, 0xa6, 0xb3, 0x29, 0xef, 0x51, 0x27, 0xae, 0xa6, 0x34, 0xc4,
+  0x97, 0x0d, 0x40, 0x65, 0x0e, 0x8c, 0xa1, 0xe5, 0x79, 0x85, 0xfd, 0xe9, 0x2d, 0x51, 0xba, 0xdf,
+  0xf1, 0xf8, 0x08, 0x96, 0xa6, 0xe0, 0x0d, 0x77, 0x45, 0xa1, 0x0d, 0x9c, 0x34, 0x9d, 0x4d, 0xb6,
+  0x00, 0xe5, 0x43, 0x68, 0xdb, 0xc2, 0x03, 0x6f, 0x12, 0xd1, 0xb1, 0x0c, 0x62, 0x9c, 0xca, 0xf1,
+  0x2c, 0x2e, 0x36, 0x33, 0xa0, 0x8c, 0xea, 0xf8, 0x0d, 0x63, 0x6b, 0x82, 0xe7, 0xfd, 0x69, 0xe7,
+  0x8f, 0x88, 0x13, 0x4b, 0xc0, 0xc5, 0x12, 0x8f, 0xf1, 0xb3, 0xfd, 0x4e, 0x98, 0x3c, 0xcb, 0xf5,
+  0x4b, 0xba, 0x63, 0x15, 0x36, 0xf5, 0x45, 0xe1, 0x14, 0x7c, 0x1c, 0xa2, 0xeb, 0x6c, 0x43, 0x85,
+  0xca, 0xf9, 0xb2, 0xa5, 0x8b, 0x32, 0x13, 0x25, 0x28, 0x65, 0x17, 0x2a, 0xa4, 0x13, 0x2a, 0x77,
+  0xe8, 0x62, 0xa7, 0x38, 0x2d, 0x00, 0x1e, 0xcf, 0x07, 0x81, 0x1e, 0x10, 0xf5, 0x89, 0xd3, 0x97,
+  0x3c, 0x0d, 0xfc, 0x3c, 0xbd, 0x80, 0x43, 0x5a, 0xb1, 0xc0, 0x41, 0xf9, 0xa7, 0x1b, 0x81, 0x8b,
+  0x02, 0xe5, 0xe3, 0x2f, 0xba, 0x8f, 0x8f, 0xf7, 0xfe, 0x1f, 0xfb, 0xa0, 0x1a, 0x70, 0x35, 0x29,
+  0x01, 0x00,
 };
-var $=function(id){return document.getElementById(id)};
-
-/* ===== Notify (minimal pill, auto-hides) ===== */
-var nTO;
-function nfy(msg,type){
-var el=$('notify');
-var ic={ok:'<svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm-2 15l-5-5 1.41-1.41L10 14.17l7.59-7.59L19 8l-9 9z"/></svg>',er:'<svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm1 15h-2v-2h2v2zm0-4h-2V7h2v6z"/></svg>',wn:'<svg viewBox="0 0 24 24"><path d="M1 21h22L12 2 1 21zm12-3h-2v-2h2v2zm0-4h-2v-4h2v4z"/></svg>'};
-el.className='notify n-'+(type||'ok');
-el.innerHTML=(ic[type||'ok']||ic.ok)+'<span>'+msg+'</span>';
-clearTimeout(nTO);
-void el.offsetWidth;
-el.classList.add('show');
-nTO=setTimeout(function(){el.classList.remove('show')},2200);
-}
-
-/* ===== Button feedback flash ===== */
-function fbtn(el,ok){
-el.classList.add(ok?'fb-ok':'fb-er');
-setTimeout(function(){el.classList.remove('fb-ok','fb-er')},500);
-}
-
-/* ===== Status chip ===== */
-function setChip(live,txt){
-$('dot').className='d'+(live?' on':'');
-$('chipTxt').textContent=txt||'Idle';
-}
-
-/* ===== Stream Timer ===== */
-function startTimer(){G.tStart=Date.now();G.tInt=setInterval(updTimer,1000)}
-function stopTimer(){clearInterval(G.tInt);$('timer').textContent='00:00'}
-function updTimer(){
-var e=Math.floor((Date.now()-G.tStart)/1000);
-$('timer').textContent=String(Math.floor(e/60)).padStart(2,'0')+':'+String(e%60).padStart(2,'0');
-}
-
-/* ===== Stream Toggle ===== */
-function toggleStream(){
-if(G.streaming)stopStream();else startStream();
-}
-function startStream(){
-var img=$('stream');
-$('spinner').classList.add('show');
-img.onload=function(){$('spinner').classList.remove('show');img.onload=null};
-img.onerror=function(){$('spinner').classList.remove('show');nfy('Stream failed','er')};
-img.src=G.sUrl;
-img.classList.remove('hide');
-$('ph').classList.add('hide');
-$('hud').classList.add('show');
-$('btnPS').className='cb cb-stop';
-$('icoPS').innerHTML='<path d="M6 6h12v12H6z"/>';
-$('btnRec').style.display='flex';
-G.streaming=true;
-setChip(true,'Live');
-startTimer();
-}
-function stopStream(){
-if(G.recording){stopRecording()}
-var img=$('stream');
-img.src='';img.classList.add('hide');
-$('ph').classList.remove('hide');
-$('hud').classList.remove('show');
-$('btnPS').className='cb cb-play';
-$('icoPS').innerHTML='<path d="M8 5v14l11-7z"/>';
-$('btnRec').style.display='none';
-$('spinner').classList.remove('show');
-G.streaming=false;
-setChip(false,'Idle');
-stopTimer();
-exitFS();
-}
-
-/* ===== Capture ===== */
-function capturePhoto(){
-var el=$('btnCap');
-var sh=$('shutter');
-sh.classList.remove('flash');void sh.offsetWidth;sh.classList.add('flash');
-fetch(G.base+'/capture')
-.then(function(r){if(!r.ok)throw new Error();return r.blob()})
-.then(function(b){
-var u=URL.createObjectURL(b);var a=document.createElement('a');
-a.href=u;a.download='trinetra_'+Date.now()+'.jpg';a.click();
-URL.revokeObjectURL(u);fbtn(el,true);
-})
-.catch(function(){fbtn(el,false);nfy('Capture failed','er')});
-}
-
-/* ===== Save to SD ===== */
-function saveToSD(){
-var el=$('btnSave');
-fetch(G.base+'/save-photo')
-.then(function(r){return r.json()})
-.then(function(d){
-if(d.success){fbtn(el,true);nfy(d.filename,'ok')}
-else{fbtn(el,false);nfy(d.error||'SD error','er')}
-})
-.catch(function(){fbtn(el,false);nfy('SD save failed','er')});
-}
-
-/* ===== LED ===== */
-function toggleLED(){
-var next=G.ledOn?0:1;
-fetch(G.base+'/led?state='+next)
-.then(function(r){
-if(r.ok){
-G.ledOn=!!next;
-$('btnLED').className='cb '+(G.ledOn?'cb-led-on':'cb-def');
-}
-}).catch(function(){nfy('LED failed','er')});
-}
-
-/* ===== Recording ===== */
-function startRecTimer(){G.recStart=Date.now();G.recInt=setInterval(updRecTimer,1000)}
-function stopRecTimer(){clearInterval(G.recInt);$('recTimer').textContent='00:00'}
-function updRecTimer(){
-var e=Math.floor((Date.now()-G.recStart)/1000);
-$('recTimer').textContent=String(Math.floor(e/60)).padStart(2,'0')+':'+String(e%60).padStart(2,'0');
-}
-
-function toggleRecording(){
-if(G.recording)stopRecording();else startRecording();
-}
-
-function startRecording(){
-if(!G.streaming){nfy('Start stream first','wn');return}
-var el=$('btnRec');
-fetch(G.base+'/start-recording')
-.then(function(r){return r.json()})
-.then(function(d){
-if(d.success){
-G.recording=true;
-el.className='cb cb-stop';
-$('icoRec').innerHTML='<path d="M6 6h12v12H6z"/>';
-el.title='Stop Recording';
-$('recBadge').style.display='flex';
-startRecTimer();
-fbtn(el,true);
-nfy('Recording started','ok');
-}else{
-fbtn(el,false);
-nfy(d.error||'Recording failed','er');
-}
-}).catch(function(){fbtn(el,false);nfy('Recording error','er')});
-}
-
-function stopRecording(){
-var el=$('btnRec');
-fetch(G.base+'/stop-recording')
-.then(function(r){return r.json()})
-.then(function(d){
-if(d.success){
-G.recording=false;
-el.className='cb cb-def';
-$('icoRec').innerHTML='<circle cx="12" cy="12" r="8"/>';
-el.title='Start Recording';
-$('recBadge').style.display='none';
-stopRecTimer();
-fbtn(el,true);
-var msg='Saved: '+d.filename+' ('+(d.size/1048576).toFixed(1)+'MB, '+d.frames+' frames, '+d.duration+'s)';
-nfy(msg,'ok');
-}else{
-fbtn(el,false);
-nfy(d.error||'Stop failed','er');
-}
-}).catch(function(){fbtn(el,false);nfy('Stop error','er')});
-}
-
-/* ===== Resolution ===== */
-function changeRes(){
-var v=$('resSel').value;
-fetch(G.base+'/control?var=framesize&val='+v)
-.then(function(r){
-if(r.ok){
-var n=G.resN[v]||v;
-$('resLbl').textContent=n;
-$('fsRes').textContent=n;
-if(G.streaming){
-/* Force stream reload for new resolution */
-var img=$('stream');
-img.src='';
-setTimeout(function(){img.src=G.sUrl},200);
-}
-}else nfy('Failed','er');
-}).catch(function(){nfy('Error','er')});
-}
-
-/* ===== Settings changes (sliders) ===== */
-function rv(id){
-var el=$(id);var vEl=$('v'+id.substring(1));
-if(vEl)vEl.textContent=el.value;
-}
-var chgTO={};
-function chgSlider(param,id){
-clearTimeout(chgTO[param]);
-chgTO[param]=setTimeout(function(){
-fetch(G.base+'/control?var='+param+'&val='+$(id).value);
-},300);
-}
-/* Attach change events */
-function initSliders(){
-var m=[['quality','sQuality'],['brightness','sBright'],['contrast','sContrast'],['saturation','sSat']];
-for(var i=0;i<m.length;i++){
-(function(p,id){
-$(id).addEventListener('change',function(){chgSlider(p,id)});
-})(m[i][0],m[i][1]);
-}
-}
-
-/* ===== Toggle settings ===== */
-function tgSet(name,el){
-setTimeout(function(){
-var cb=el.querySelector('input');
-fetch(G.base+'/control?var='+name+'&val='+(cb.checked?1:0));
-},50);
-}
-
-/* ===== Effects & WB ===== */
-function chgFx(){fetch(G.base+'/control?var=special_effect&val='+$('selFx').value)}
-function chgWB(){fetch(G.base+'/control?var=wb_mode&val='+$('selWB').value)}
-
-/* ===== Fullscreen ===== */
-function toggleFS(){
-if(!G.streaming){nfy('Start stream first','wn');return}
-$('fso').classList.add('show');
-$('fsImg').src=G.sUrl;
-$('fsRes').textContent=$('resLbl').textContent;
-document.body.style.overflow='hidden';
-}
-function exitFS(){
-$('fso').classList.remove('show');
-$('fsImg').src='';
-document.body.style.overflow='';
-}
-
-/* ===== Drawers ===== */
-function openDr(id){
-closeAll();
-$(id).classList.add('open');
-$('bk').classList.add('show');
-G.openDrId=id;
-/* highlight appbar icons */
-var map={drSet:'ibSet',drMon:'ibMon',drWifi:'ibWifi',drGal:'ibGal'};
-if(map[id]&&$(map[id]))$(map[id]).classList.add('active');
-/* mobile nav highlight */
-var mi={drSet:1,drMon:2,drWifi:3,drGal:4};
-document.querySelectorAll('.mn').forEach(function(b,i){b.classList.toggle('active',i===(mi[id]||0))});
-if(id==='drMon')getStats();
-if(id==='drWifi')getWifiSt();
-if(id==='drGal'){loadGallery();loadGalStorage();}
-}
-function closeDr(id){
-$(id).classList.remove('open');
-$('bk').classList.remove('show');
-G.openDrId=null;
-document.querySelectorAll('.ib.active').forEach(function(b){b.classList.remove('active')});
-document.querySelectorAll('.mn').forEach(function(b,i){b.classList.toggle('active',i===0)});
-}
-function closeAll(){
-if(G.openDrId)closeDr(G.openDrId);
-}
-function goStream(){closeAll()}
-
-/* ===== System Stats ===== */
-function getStats(){
-fetch(G.base+'/system-stats')
-.then(function(r){return r.json()})
-.then(function(d){
-var u='';if(d.uptime_days>0)u+=d.uptime_days+'d ';
-u+=(d.uptime_hours%24)+'h '+(d.uptime_minutes%60)+'m';
-$('mUp').textContent=u;
-$('mTemp').textContent=d.temp_celsius.toFixed(1)+'\u00B0C';
-$('mFPS').textContent=d.fps+' fps';
-$('mFrames').textContent=d.total_frames.toLocaleString()+' frames';
-var sq=d.wifi_rssi>-60?'Excellent':d.wifi_rssi>-70?'Good':d.wifi_rssi>-80?'Fair':'Poor';
-$('mSig').textContent=d.wifi_rssi+' dBm';
-$('mSigQ').textContent=sq;
-$('mCli').textContent=d.wifi_clients;
-var hp=d.heap_usage.toFixed(0);
-$('mHeap').textContent=(d.free_heap/1048576).toFixed(1)+'MB free';
-var hb=$('pHeap');hb.style.width=hp+'%';hb.className='prg-b'+(hp>85?' cr':hp>70?' wn':'');
-var pp=d.psram_usage.toFixed(0);
-$('mPSRAM').textContent=(d.free_psram/1048576).toFixed(1)+'MB free';
-var pb=$('pPSRAM');pb.style.width=pp+'%';pb.className='prg-b'+(pp>85?' cr':pp>70?' wn':'');
-/* SD Card */
-if(d.sd_available){
-var sdp=d.sd_percent.toFixed(0);
-var sdfree=(d.sd_free/1073741824).toFixed(1);
-var sdtotal=(d.sd_total/1073741824).toFixed(1);
-$('mSD').textContent=sdfree+'GB free';
-$('mSDSize').textContent=sdtotal+'GB total';
-var sdb=$('pSD');sdb.style.width=sdp+'%';sdb.className='prg-b'+(sdp>90?' cr':sdp>75?' wn':'');
-}else{
-$('mSD').textContent='Not Available';
-$('mSDSize').textContent='--';
-$('pSD').style.width='0';
-}
-}).catch(function(){});
-}
-
-/* ===== WiFi ===== */
-function getWifiSt(){
-fetch(G.base+'/wifi-status')
-.then(function(r){return r.json()})
-.then(function(d){
-if(d.connected){
-$('wIcon').className='wsc-i con';
-$('wTitle').innerHTML='Connected to <b>'+d.ssid+'</b>';
-$('wTitle').style.color='var(--ok)';
-$('wDetail').textContent='IP: '+d.ip;
-}else if(d.savedSSID){
-$('wIcon').className='wsc-i dis';
-$('wTitle').textContent='Saved: '+d.savedSSID;
-$('wTitle').style.color='var(--tx2)';
-$('wDetail').textContent='Not connected';
-}else{
-$('wIcon').className='wsc-i dis';
-$('wTitle').textContent='No WiFi';
-$('wTitle').style.color='var(--tx3)';
-$('wDetail').textContent='AP mode only';
-}
-}).catch(function(){});
-}
-function scanNets(){
-var btn=$('btnScan');btn.disabled=true;
-$('netArea').innerHTML='<div style="text-align:center;padding:20px;color:var(--tx3);font-size:.75rem"><div class="spin-ring" style="width:24px;height:24px;border-width:2px;margin:0 auto 8px"></div>Scanning...</div>';
-$('connForm').style.display='none';G.selNet=null;
-fetch(G.base+'/wifi-scan')
-.then(function(r){return r.json()})
-.then(function(nets){
-btn.disabled=false;
-if(!nets.length){$('netArea').innerHTML='<div style="text-align:center;padding:20px;color:var(--tx3);font-size:.75rem">No networks found</div>';return}
-nets.sort(function(a,b){return b.rssi-a.rssi});
-var h='';
-for(var i=0;i<nets.length;i++){
-var n=nets[i];
-var sig=n.rssi>-60?'var(--ok)':n.rssi>-75?'var(--wn)':'var(--er)';
-var lock=n.secure?'<svg viewBox="0 0 24 24" style="fill:var(--wn)"><path d="M18 8h-1V6a5 5 0 00-10 0v2H6a2 2 0 00-2 2v10a2 2 0 002 2h12a2 2 0 002-2V10a2 2 0 00-2-2zm-6 9a2 2 0 110-4 2 2 0 010 4zm3.1-9H8.9V6c0-1.71 1.39-3.1 3.1-3.1s3.1 1.39 3.1 3.1v2z"/></svg>':'';
-h+='<div class="ni" onclick="pickNet(\''+n.ssid.replace(/'/g,"\\'")+'\','+n.secure+',this)"><span class="ni-n">'+n.ssid+'</span><span class="ni-m"><svg viewBox="0 0 24 24" style="fill:'+sig+'"><path d="M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3a4.237 4.237 0 00-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z"/></svg>'+n.rssi+'dBm '+lock+'</span></div>';
-}
-$('netArea').innerHTML='<div style="max-height:220px;overflow-y:auto">'+h+'</div>';
-}).catch(function(){btn.disabled=false;$('netArea').innerHTML='<div style="text-align:center;padding:20px;color:var(--er);font-size:.75rem">Scan failed</div>'});
-}
-function pickNet(ssid,sec,el){
-G.selNet={ssid:ssid,secure:sec};
-$('selSSID').textContent=ssid;
-$('wPwd').value='';$('wPwd').style.display=sec?'block':'none';
-$('connForm').style.display='block';
-document.querySelectorAll('.ni').forEach(function(n){n.classList.remove('sel')});
-el.classList.add('sel');
-}
-function cancelConn(){$('connForm').style.display='none';G.selNet=null}
-function doConnect(){
-if(!G.selNet)return;
-var s=G.selNet.ssid,p=$('wPwd').value;
-nfy('Connecting to '+s+'...','ok');
-fetch(G.base+'/wifi-connect?ssid='+encodeURIComponent(s)+'&password='+encodeURIComponent(p))
-.then(function(r){return r.json()})
-.then(function(d){
-if(d.success){nfy('Connected! IP: '+d.ip,'ok');$('connForm').style.display='none';getWifiSt()}
-else nfy('Failed to connect','er');
-}).catch(function(){nfy('Connection error','er')});
-}
-function resetWifi(){
-if(!confirm('Clear saved WiFi?'))return;
-fetch(G.base+'/wifi-reset').then(function(r){return r.json()}).then(function(d){nfy(d.message,'ok');getWifiSt()}).catch(function(){nfy('Reset failed','er')});
-}
-
-/* ===== Keyboard shortcuts ===== */
-document.addEventListener('keydown',function(e){
-if(e.key==='Escape'){exitFS();closeAll();closeAbout()}
-if(e.key==='f'&&!e.ctrlKey&&!e.metaKey&&document.activeElement.tagName!=='INPUT'&&document.activeElement.tagName!=='SELECT')toggleFS();
-if(e.key===' '&&document.activeElement.tagName!=='INPUT'&&document.activeElement.tagName!=='SELECT'){e.preventDefault();toggleStream()}
-});
-
-/* ===== About ===== */
-function openAbout(){$('aboutOv').classList.add('show')}
-function closeAbout(){$('aboutOv').classList.remove('show')}
-
-/* ===== Init ===== */
-window.addEventListener('load',function(){
-setChip(false,'Idle');
-initSliders();
-
-fetch(G.base+'/status')
-.then(function(r){return r.json()})
-.then(function(d){
-if(d.framesize!==undefined){$('resSel').value=d.framesize;$('resLbl').textContent=G.resN[String(d.framesize)]||''}
-if(d.quality!==undefined){$('sQuality').value=d.quality;$('vQuality').textContent=d.quality}
-if(d.brightness!==undefined){$('sBright').value=d.brightness;$('vBright').textContent=d.brightness}
-if(d.contrast!==undefined){$('sContrast').value=d.contrast;$('vContrast').textContent=d.contrast}
-if(d.saturation!==undefined){$('sSat').value=d.saturation;$('vSat').textContent=d.saturation}
-if(d.special_effect!==undefined)$('selFx').value=d.special_effect;
-if(d.wb_mode!==undefined)$('selWB').value=d.wb_mode;
-var tgs=document.querySelectorAll('#drSet .tg input');
-var tk=['awb','agc','aec','hmirror','vflip','bpc','wpc','lenc'];
-for(var i=0;i<tk.length;i++){if(d[tk[i]]!==undefined&&tgs[i])tgs[i].checked=!!d[tk[i]]}
-if(d.sd_card){$('mSD').textContent='Available';$('mSDSize').textContent='Check monitor';}else{$('mSD').textContent='N/A';$('mSDSize').textContent='--';}
-}).catch(function(){setChip(false,'Offline')});
-
-G.sInt=setInterval(function(){if(G.openDrId==='drMon')getStats()},3000);
-});
-
-/* ===== Gallery Storage Info ===== */
-function loadGalStorage(){
-var detail=$('galStorageDetail');
-var fill=$('galStorageFill');
-detail.textContent='Loading...';
-fill.style.width='0%';
-fill.className='gal-storage-fill';
-fetch(G.base+'/sd-info').then(function(r){return r.json()}).then(function(d){
-if(!d.available){
-detail.textContent='SD card not available';
-fill.style.width='0%';
-return;
-}
-var total=(d.total/(1024*1024*1024)).toFixed(1);
-var free=(d.free/(1024*1024*1024)).toFixed(2);
-var pct=d.percent.toFixed(0);
-detail.textContent=free+'GB free of '+total+'GB ('+pct+'% used)';
-fill.style.width=pct+'%';
-if(pct>90)fill.className='gal-storage-fill crit';
-else if(pct>75)fill.className='gal-storage-fill warn';
-else fill.className='gal-storage-fill';
-}).catch(function(){
-detail.textContent='Could not read SD card';
-fill.style.width='0%';
-});
-}
-
-/* ===== Gallery Functions ===== */
-function loadGallery(){
-var area=$('galArea');
-area.innerHTML='<div class="gal-empty"><div class="spin-ring"></div><div style="margin-top:16px">Loading files...</div></div>';
-fetch(G.base+'/list-files').then(function(r){return r.json()}).then(function(d){
-if(!d.success){
-area.innerHTML='<div class="gal-empty"><svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm1 15h-2v-2h2v2zm0-4h-2V7h2v6z"/></svg><div>'+d.error+'</div></div>';
-return;
-}
-if(!d.files || d.files.length===0){
-area.innerHTML='<div class="gal-empty"><svg viewBox="0 0 24 24"><path d="M22 16V4a2 2 0 00-2-2H8a2 2 0 00-2 2v12a2 2 0 002 2h12a2 2 0 002-2zm-11-4l2.03 2.71L16 11l4 5H8l3-4zM2 6v14a2 2 0 002 2h14v-2H4V6H2z"/></svg><div>No photos or videos yet</div><div style="margin-top:8px;font-size:.68rem;color:var(--tx3)">Take some photos or record videos to see them here</div></div>';
-return;
-}
-var photos=d.files.filter(function(f){return f.type==='photo'}).length;
-var videos=d.files.length-photos;
-var html='<div class="gal-count"><span><strong>'+d.files.length+'</strong> files</span><span>'+photos+' photos • '+videos+' videos</span></div>';
-html+='<div class="gal-grid">';
-d.files.forEach(function(f){
-var sz=(f.size/1024).toFixed(0)+'KB';
-if(f.size>1024*1024)sz=(f.size/(1024*1024)).toFixed(1)+'MB';
-var typeLabel=f.type==='photo'?'JPG':'VIDEO';
-var typeClass=f.type==='video'?' vid':'';
-var imgUrl=G.base+'/download-file?name='+encodeURIComponent(f.name);
-html+='<div class="gal-item" onclick="viewFile(\''+f.name.replace(/'/g,'&#39;')+'\',\''+f.type+'\')">';
-if(f.type==='photo'){
-html+='<div class="gal-placeholder"><svg viewBox="0 0 24 24"><path d="M21 19V5a2 2 0 00-2-2H5a2 2 0 00-2 2v14a2 2 0 002 2h14a2 2 0 002-2zM8.5 13.5l2.5 3.01L14.5 12l4.5 6H5l3.5-4.5z"/></svg></div>';
-html+='<img class="gal-img" src="'+imgUrl+'" alt="'+f.name+'" loading="lazy" onload="this.previousElementSibling.style.display=\'none\'" onerror="this.style.display=\'none\'">';
-}else{
-html+='<div class="gal-vid"><svg viewBox="0 0 24 24"><path d="M8 5v14l11-7z"/></svg></div>';
-}
-html+='<div class="gal-type'+typeClass+'">'+typeLabel+'</div>';
-html+='<div class="gal-sz">'+sz+'</div>';
-html+='<button class="gal-del" onclick="event.stopPropagation();deleteFile(\''+f.name.replace(/'/g,'&#39;')+'\')" title="Delete"><svg viewBox="0 0 24 24"><path d="M6 19a2 2 0 002 2h8a2 2 0 002-2V7H6v12zM19 4h-3.5l-1-1h-5l-1 1H5v2h14V4z"/></svg></button>';
-html+='</div>';
-});
-html+='</div>';
-area.innerHTML=html;
-}).catch(function(e){
-console.error('Gallery error:',e);
-area.innerHTML='<div class="gal-empty"><svg viewBox="0 0 24 24"><path d="M12 2a10 10 0 100 20 10 10 0 000-20zm1 15h-2v-2h2v2zm0-4h-2V7h2v6z"/></svg><div>Failed to load gallery</div><div style="margin-top:8px;font-size:.68rem">Check SD card connection</div></div>';
-});
-}
-
-function downloadFile(name){
-var dlUrl=G.base+'/download-file?name='+encodeURIComponent(name)+'&dl=1';
-nfy('Downloading '+name+'...','wn');
-// Use direct link approach - more reliable for large video files
-var a=document.createElement('a');
-a.href=dlUrl;
-a.download=name;
-a.style.display='none';
-document.body.appendChild(a);
-a.click();
-setTimeout(function(){document.body.removeChild(a);nfy('Download started: '+name,'ok')},500);
-}
-
-function viewFile(name,type){
-var url=G.base+'/download-file?name='+encodeURIComponent(name);
-var dlUrl=url+'&dl=1';
-console.log('Viewing file:',name,'type:',type,'url:',url);
-var eName=name.replace(/'/g,'&#39;');
-if(type==='photo'){
-// Show photo in lightbox modal
-var modal=document.createElement('div');
-modal.className='gal-preview';
-modal.innerHTML='<div class="gal-preview-bg" onclick="this.parentElement.remove()"></div><div class="gal-preview-wrap"><div class="gal-preview-loading"><div class="spin-ring"></div></div><img src="'+url+'" alt="'+name+'" onload="this.previousElementSibling.style.display=\'none\'" onerror="this.previousElementSibling.innerHTML=\'Failed to load image\';this.style.display=\'none\'"><div class="gal-preview-info"><span>'+name+'</span><div class="gal-preview-btns"><button class="btn btn-p" onclick="downloadFile(\''+eName+'\')"><svg viewBox="0 0 24 24"><path d="M19 9h-4V3H9v6H5l7 7 7-7zM5 18v2h14v-2H5z"/></svg>Download</button><button class="btn btn-s" onclick="window.open(\''+url+'\',\'_blank\')"><svg viewBox="0 0 24 24"><path d="M19 19H5V5h7V3H5a2 2 0 00-2 2v14a2 2 0 002 2h14a2 2 0 002-2v-7h-2v7zM14 3v2h3.59l-9.83 9.83 1.41 1.41L19 6.41V10h2V3h-7z"/></svg>Open Tab</button><button class="btn btn-d" onclick="this.closest(\'.gal-preview\').remove();deleteFile(\''+eName+'\')"><svg viewBox="0 0 24 24"><path d="M6 19a2 2 0 002 2h8a2 2 0 002-2V7H6v12zM19 4h-3.5l-1-1h-5l-1 1H5v2h14V4z"/></svg>Delete</button></div></div><button class="gal-preview-x" onclick="this.parentElement.parentElement.remove()"><svg viewBox="0 0 24 24"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button></div>';
-document.body.appendChild(modal);
-}else{
-// Show video preview modal with download option
-var modal=document.createElement('div');
-modal.className='gal-preview';
-modal.innerHTML='<div class="gal-preview-bg" onclick="this.parentElement.remove()"></div>'
-+'<div class="gal-preview-wrap">'
-+'<div style="width:280px;max-width:90%;background:var(--sf);border-radius:var(--rl);padding:32px 24px;text-align:center;box-shadow:0 8px 40px rgba(0,0,0,.5);border:1px solid var(--bd)">'
-+'<div style="width:80px;height:80px;border-radius:50%;background:linear-gradient(135deg,var(--ac),#b91c1c);display:flex;align-items:center;justify-content:center;margin:0 auto 16px"><svg viewBox="0 0 24 24" style="width:40px;height:40px;fill:#fff;margin-left:4px"><path d="M8 5v14l11-7z"/></svg></div>'
-+'<div style="font-size:.9rem;font-weight:600;margin-bottom:4px;color:var(--tx);word-break:break-all">'+name+'</div>'
-+'<div style="font-size:.7rem;color:var(--tx3);margin-bottom:20px">MJPEG Video • Open with VLC or media player</div>'
-+'<div style="display:flex;flex-direction:column;gap:8px">'
-+'<button class="btn btn-p" onclick="downloadFile(\''+eName+'\');this.closest(\'.gal-preview\').remove()" style="width:100%;justify-content:center"><svg viewBox="0 0 24 24"><path d="M19 9h-4V3H9v6H5l7 7 7-7zM5 18v2h14v-2H5z"/></svg>Download Video</button>'
-+'<button class="btn btn-d" onclick="this.closest(\'.gal-preview\').remove();deleteFile(\''+eName+'\')" style="width:100%;justify-content:center"><svg viewBox="0 0 24 24"><path d="M6 19a2 2 0 002 2h8a2 2 0 002-2V7H6v12zM19 4h-3.5l-1-1h-5l-1 1H5v2h14V4z"/></svg>Delete</button>'
-+'</div>'
-+'</div>'
-+'<button class="gal-preview-x" onclick="this.parentElement.parentElement.remove()"><svg viewBox="0 0 24 24"><path d="M19 6.41L17.59 5 12 10.59 6.41 5 5 6.41 10.59 12 5 17.59 6.41 19 12 13.41 17.59 19 19 17.59 13.41 12z"/></svg></button>'
-+'</div>';
-document.body.appendChild(modal);
-}
-}
-
-function deleteFile(name){
-if(!confirm('Delete '+name+'?'))return;
-fetch(G.base+'/delete-file?name='+encodeURIComponent(name)).then(function(r){return r.json()}).then(function(d){
-if(d.success){
-nfy('File deleted','ok');
-loadGallery();
-}else{
-nfy(d.error||'Delete failed','er');
-}
-}).catch(function(){nfy('Delete failed','er')});
-}
-
-function deleteAllFiles(){
-if(!confirm('Delete ALL photos and videos? This cannot be undone!'))return;
-fetch(G.base+'/list-files').then(function(r){return r.json()}).then(function(d){
-if(!d.success||d.files.length===0){
-nfy('No files to delete','wn');
-return;
-}
-var count=0;
-var total=d.files.length;
-d.files.forEach(function(f){
-fetch(G.base+'/delete-file?name='+encodeURIComponent(f.name)).then(function(){
-count++;
-if(count===total){
-nfy('Deleted '+total+' files','ok');
-loadGallery();
-}
-});
-});
-}).catch(function(){nfy('Failed to delete files','er')});
-}
 
-</script>
-</body>
-</html>
-)rawliteral";
 #endif
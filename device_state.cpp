@@ -0,0 +1,160 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Device State Snapshot (device_state.cpp)
+ * =============================================================
+ *  Sections are refreshed lazily by whichever request reads
+ *  them. The response is assembled under the lock into one heap
+ *  buffer and sent after the lock is released, so a slow client
+ *  never holds up other readers.
+ * =============================================================
+ */
+
+#include "device_state.h"
+#include "json_writer.h"
+#include "mem_track.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef struct {
+  const char *name;
+  state_render_fn render;
+  uint32_t ttlMs;
+  size_t maxLen;
+  char *json;           // last rendering
+  int len;
+  char *scratch;        // new rendering, compared against json
+  uint32_t version;
+  int64_t renderedUs;
+  bool stale;
+} state_entry_t;
+
+static state_entry_t sections[STATE_SECTION_COUNT];
+static SemaphoreHandle_t stateLock = NULL;
+static uint32_t stateVersion = 0;
+static void (*invalidateListener)(state_section_t) = NULL;
+
+void device_state_register(state_section_t section, const char *name, size_t maxLen,
+                           uint32_t ttlMs, state_render_fn render) {
+  if (!stateLock) stateLock = xSemaphoreCreateMutex();
+  state_entry_t *e = &sections[section];
+  e->name = name;
+  e->render = render;
+  e->ttlMs = ttlMs;
+  e->maxLen = maxLen;
+  e->json = (char *)mem_alloc(MEM_STATE, maxLen);
+  e->scratch = (char *)mem_alloc(MEM_STATE, maxLen);
+  e->len = 0;
+  e->version = 0;
+  e->stale = true;
+  if (!e->json || !e->scratch) log_e("State: no memory for section %s", name);
+}
+
+void device_state_invalidate(state_section_t section) {
+  sections[section].stale = true;  // single store, read under the lock later
+  if (invalidateListener) invalidateListener(section);
+}
+
+void device_state_on_invalidate(void (*listener)(state_section_t section)) {
+  invalidateListener = listener;
+}
+
+uint32_t device_state_version() {
+  return stateVersion;
+}
+
+// Re-render if due; bump the version only when the JSON changed. Lock held.
+static void refresh(state_entry_t *e) {
+  if (!e->render || !e->json || !e->scratch) return;
+  int64_t now = esp_timer_get_time();
+  if (!e->stale && e->version && now - e->renderedUs < (int64_t)e->ttlMs * 1000) return;
+
+  int len = e->render(e->scratch, e->maxLen);
+  if (len < 0 || len >= (int)e->maxLen) len = 0;
+  e->renderedUs = now;
+  e->stale = false;
+
+  if (len != e->len || memcmp(e->scratch, e->json, len) != 0) {
+    char *tmp = e->json;
+    e->json = e->scratch;
+    e->scratch = tmp;
+    e->len = len;
+    e->version = ++stateVersion;
+  }
+}
+
+size_t device_state_max_len() {
+  size_t cap = 32;
+  for (int i = 0; i < STATE_SECTION_COUNT; i++) {
+    if (sections[i].name) cap += strlen(sections[i].name) + sections[i].maxLen + 4;
+  }
+  return cap;
+}
+
+int device_state_render(char *out, size_t cap, uint32_t since, uint32_t *version) {
+  if (!stateLock || cap < device_state_max_len()) return 0;
+
+  xSemaphoreTake(stateLock, portMAX_DELAY);
+  for (int i = 0; i < STATE_SECTION_COUNT; i++) refresh(&sections[i]);
+
+  // Version first so clients can store it before applying the sections
+  json_writer_t w;
+  jw_init(&w, out, cap, NULL);
+  jw_obj_open(&w);
+  jw_uint(&w, "version", stateVersion);
+  for (int i = 0; i < STATE_SECTION_COUNT; i++) {
+    const state_entry_t *e = &sections[i];
+    if (!e->name || !e->len || e->version <= since) continue;
+    jw_raw(&w, e->name, e->json, e->len);
+  }
+  if (version) *version = stateVersion;
+  xSemaphoreGive(stateLock);
+  jw_obj_close(&w);
+  int n = jw_result(&w);
+  return n > 0 ? n : 0;
+}
+
+esp_err_t device_state_send(httpd_req_t *req, uint32_t since) {
+  size_t cap = device_state_max_len();
+  char *out = (char *)mem_alloc(MEM_STATE, cap);
+  if (!out) return httpd_resp_send_500(req);
+
+  int n = device_state_render(out, cap, since, NULL);
+  esp_err_t res = n > 0 ? httpd_resp_send(req, out, n) : httpd_resp_send_500(req);
+  mem_free(MEM_STATE, out);
+  return res;
+}
+
+esp_err_t device_state_send_section(httpd_req_t *req, state_section_t section, state_section_t nested) {
+  state_entry_t *e = &sections[section];
+  if (!stateLock || !e->json) return httpd_resp_send_500(req);
+  state_entry_t *inner = nested < STATE_SECTION_COUNT && sections[nested].json ? &sections[nested] : NULL;
+
+  size_t cap = e->maxLen + (inner ? strlen(inner->name) + inner->maxLen + 4 : 0);
+  char *out = (char *)mem_alloc(MEM_STATE, cap);
+  if (!out) return httpd_resp_send_500(req);
+
+  xSemaphoreTake(stateLock, portMAX_DELAY);
+  refresh(e);
+  int n = e->len;
+  memcpy(out, e->json, n);
+  if (inner) refresh(inner);
+  if (inner && inner->len > 0 && n > 2 && out[n - 1] == '}') {
+    // {...} -> {...,"name":{...}}
+    n += sprintf(out + n - 1, ",\"%s\":", inner->name) - 1;
+    memcpy(out + n, inner->json, inner->len);
+    n += inner->len;
+    out[n++] = '}';
+  }
+  xSemaphoreGive(stateLock);
+
+  esp_err_t res = httpd_resp_send(req, out, n);
+  mem_free(MEM_STATE, out);
+  return res;
+}
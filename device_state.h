@@ -0,0 +1,60 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Device State Snapshot (device_state.h)
+ * =============================================================
+ *  One cached, versioned snapshot of everything the UI polls.
+ *  Each section is rendered by a callback at most once per TTL
+ *  (or right after device_state_invalidate), and its version
+ *  only moves when the rendered JSON actually changed, so
+ *  /state?since=N can leave out everything the client has.
+ * =============================================================
+ */
+#ifndef DEVICE_STATE_H
+#define DEVICE_STATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_http_server.h"
+
+typedef enum {
+  STATE_CAMERA = 0,     // sensor settings (/status)
+  STATE_SYSTEM,         // uptime, temp, fps, heap (/system-stats)
+  STATE_SD,             // card usage (/sd-info)
+  STATE_RECORDING,      // (/recording-status)
+  STATE_WIFI,           // (/wifi-status)
+  STATE_SCENE,          // per-frame image statistics (in /status as "scene")
+  STATE_SECTION_COUNT
+} state_section_t;
+
+// Write the section's JSON object into buf; return its length
+typedef int (*state_render_fn)(char *buf, size_t len);
+
+void device_state_register(state_section_t section, const char *name, size_t maxLen,
+                           uint32_t ttlMs, state_render_fn render);
+
+// Force a re-render on the next read (call after changing the state)
+void device_state_invalidate(state_section_t section);
+
+// Highest section version handed out so far
+uint32_t device_state_version();
+
+// Called (outside any lock) whenever a section is invalidated
+void device_state_on_invalidate(void (*listener)(state_section_t section));
+
+// Worst-case size of a full device_state_render() output
+size_t device_state_max_len();
+
+// Render {"version":N,...} into out; returns its length, 0 on overflow.
+// *version receives the version the output corresponds to.
+int device_state_render(char *out, size_t cap, uint32_t since, uint32_t *version);
+
+// {"version":N,"<name>":{...},...} with only the sections newer than `since`
+esp_err_t device_state_send(httpd_req_t *req, uint32_t since);
+
+// One section's JSON object on its own (legacy endpoints), optionally
+// with a second section added to it under that section's name
+esp_err_t device_state_send_section(httpd_req_t *req, state_section_t section,
+                                    state_section_t nested = STATE_SECTION_COUNT);
+
+#endif  // DEVICE_STATE_H
@@ -0,0 +1,196 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Server-Sent Events (events.cpp)
+ * =============================================================
+ *  The handler answers with the stream headers, then hands the
+ *  request to the push task via the async handler API, which
+ *  frees the HTTP server task straight away. Only the push task
+ *  writes to subscribers and only it drops them, so sending
+ *  needs no lock; the lock guards joins and queued alerts.
+ * =============================================================
+ */
+
+#include "events.h"
+#include "task_config.h"
+#include "device_state.h"
+#include "mem_track.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef struct {
+  httpd_req_t *req;      // async copy, owned by the push task
+  bool needFull;         // joined since the last push
+} events_client_t;
+
+typedef struct {
+  char event[16];
+  char json[EVENTS_ALERT_LEN];
+} events_alert_t;
+
+static events_client_t clients[EVENTS_MAX_CLIENTS];
+static uint8_t clientCount = 0;
+static events_alert_t alerts[EVENTS_ALERTS];
+static uint8_t alertCount = 0;
+static SemaphoreHandle_t eventsLock = NULL;
+static TaskHandle_t eventsTask = NULL;
+
+// ==================================================================
+//  Sending
+// ==================================================================
+// "event: <name>\ndata: " + payload + "\n\n"; payload must be one line
+static int frame(char *out, size_t cap, const char *event, const char *data, int len) {
+  int n = snprintf(out, cap, "event: %s\ndata: ", event);
+  if (n < 0 || n + len + 3 > (int)cap) return 0;
+  memcpy(out + n, data, len);
+  n += len;
+  out[n++] = '\n';
+  out[n++] = '\n';
+  out[n] = 0;
+  return n;
+}
+
+static void drop(int i) {
+  httpd_req_async_handler_complete(clients[i].req);
+  xSemaphoreTake(eventsLock, portMAX_DELAY);
+  clients[i] = clients[--clientCount];
+  xSemaphoreGive(eventsLock);
+  log_i("Events: subscriber left (%u connected)", clientCount);
+}
+
+static bool send_to(int i, const char *buf, int len) {
+  if (httpd_resp_send_chunk(clients[i].req, buf, len) == ESP_OK) return true;
+  drop(i);
+  return false;
+}
+
+// ==================================================================
+//  Push task
+// ==================================================================
+static void on_invalidate(state_section_t section) {
+  if (eventsTask && clientCount) xTaskNotifyGive(eventsTask);
+}
+
+static void events_task(void *arg) {
+  size_t stateCap = device_state_max_len();
+  size_t cap = stateCap + 32;
+  char *state = (char *)mem_alloc(MEM_EVENTS, stateCap);
+  char *out = (char *)mem_alloc(MEM_EVENTS, cap);
+  if (!state || !out) {
+    log_e("Events: no memory for %u byte buffers", (unsigned)cap);
+    vTaskDelete(NULL);
+    return;
+  }
+
+  uint32_t lastVersion = 0;
+  int64_t lastPushUs = 0;
+  events_alert_t pending[EVENTS_ALERTS];
+
+  while (true) {
+    bool woken = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENTS_STATS_MS)) > 0;
+    if (!clientCount) continue;
+    if (woken) vTaskDelay(pdMS_TO_TICKS(EVENTS_DEBOUNCE_MS));  // let related changes land
+
+    xSemaphoreTake(eventsLock, portMAX_DELAY);
+    uint8_t nAlerts = alertCount;
+    memcpy(pending, alerts, nAlerts * sizeof(events_alert_t));
+    alertCount = 0;
+    xSemaphoreGive(eventsLock);
+
+    for (uint8_t a = 0; a < nAlerts; a++) {
+      int n = frame(out, cap, pending[a].event, pending[a].json, strlen(pending[a].json));
+      for (int i = clientCount - 1; i >= 0 && n; i--) send_to(i, out, n);
+    }
+
+    // New subscribers get everything; the rest share one delta
+    for (int i = clientCount - 1; i >= 0; i--) {
+      if (!clients[i].needFull) continue;
+      int len = device_state_render(state, stateCap, 0, NULL);
+      int n = frame(out, cap, "state", state, len);
+      if (n && send_to(i, out, n)) clients[i].needFull = false;
+    }
+
+    int64_t now = esp_timer_get_time();
+    bool periodic = now - lastPushUs >= (int64_t)EVENTS_STATS_MS * 1000;
+    if (!woken && !periodic) continue;
+
+    uint32_t version = 0;
+    int len = device_state_render(state, stateCap, lastVersion, &version);
+    int n = 0;
+    if (len && version != lastVersion) {
+      n = frame(out, cap, "state", state, len);
+    } else if (periodic) {
+      n = snprintf(out, cap, ": ping\n\n");  // keeps proxies and dead-peer detection honest
+    }
+    lastVersion = version;
+    if (periodic) lastPushUs = now;
+    for (int i = clientCount - 1; i >= 0 && n; i--) send_to(i, out, n);
+  }
+}
+
+bool events_init() {
+  if (eventsTask) return true;
+  eventsLock = xSemaphoreCreateMutex();
+  if (!eventsLock) return false;
+  device_state_on_invalidate(on_invalidate);
+  return xTaskCreatePinnedToCore(events_task, "events", TASK_EVENTS_STACK, NULL,
+                                 TASK_EVENTS_PRIO, &eventsTask, TASK_EVENTS_CORE) == pdPASS;
+}
+
+// ==================================================================
+//  Subscribers and alerts
+// ==================================================================
+esp_err_t events_subscribe(httpd_req_t *req) {
+  if (!eventsTask || clientCount >= EVENTS_MAX_CLIENTS) {
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_set_hdr(req, "Retry-After", "10");
+    return httpd_resp_send(req, "Too many event subscribers", HTTPD_RESP_USE_STRLEN);
+  }
+
+  httpd_resp_set_type(req, "text/event-stream");
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+
+  // Headers and the retry hint go out now, from the server task
+  char hello[24];
+  int n = snprintf(hello, sizeof(hello), "retry: %u\n\n", EVENTS_RETRY_MS);
+  if (httpd_resp_send_chunk(req, hello, n) != ESP_OK) return ESP_FAIL;
+
+  httpd_req_t *copy = NULL;
+  if (httpd_req_async_handler_begin(req, &copy) != ESP_OK) return ESP_FAIL;
+
+  xSemaphoreTake(eventsLock, portMAX_DELAY);
+  bool added = clientCount < EVENTS_MAX_CLIENTS;
+  if (added) clients[clientCount++] = (events_client_t){ copy, true };
+  xSemaphoreGive(eventsLock);
+
+  if (!added) {
+    httpd_req_async_handler_complete(copy);
+    return ESP_FAIL;
+  }
+  log_i("Events: subscriber joined (%u connected)", clientCount);
+  xTaskNotifyGive(eventsTask);
+  return ESP_OK;
+}
+
+void events_publish(const char *event, const char *json) {
+  if (!eventsLock) return;
+  xSemaphoreTake(eventsLock, portMAX_DELAY);
+  if (alertCount < EVENTS_ALERTS && clientCount) {
+    strlcpy(alerts[alertCount].event, event, sizeof(alerts[alertCount].event));
+    strlcpy(alerts[alertCount].json, json, sizeof(alerts[alertCount].json));
+    alertCount++;
+  }
+  xSemaphoreGive(eventsLock);
+  if (eventsTask) xTaskNotifyGive(eventsTask);
+}
+
+uint8_t events_clients() {
+  return clientCount;
+}
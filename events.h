@@ -0,0 +1,45 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Server-Sent Events (events.h)
+ * =============================================================
+ *  /events keeps one text/event-stream open per dashboard. A
+ *  single task renders each device_state delta once and writes
+ *  the same buffer to every subscriber, so the cost of live
+ *  stats no longer grows with the number of open browsers.
+ *
+ *    event: state   {"version":N,...} sections changed since the
+ *                   last push (full snapshot on connect)
+ *    event: alert   one-off notices, e.g. {"type":"sd_low",...} or
+ *                   {"type":"mem_low",...}
+ *    event: job     a background job finished {"id":N,...}
+ *    event: abr     adaptive bitrate step {"dir":"down",...}
+ *    event: motion  motion started/stopped {"state":"start",...}
+ * =============================================================
+ */
+#ifndef EVENTS_H
+#define EVENTS_H
+
+#include <stdint.h>
+#include "esp_http_server.h"
+
+#define EVENTS_MAX_CLIENTS   3        // each one holds a server socket
+#define EVENTS_STATS_MS      2000     // periodic push rate (server-chosen)
+#define EVENTS_DEBOUNCE_MS   100      // coalesce bursts of invalidations
+#define EVENTS_RETRY_MS      3000     // client reconnect delay
+#define EVENTS_ALERTS        4        // pending alerts between pushes
+#define EVENTS_ALERT_LEN     160
+
+// Start the push task and hook device_state invalidations
+bool events_init();
+
+// GET /events: take over the connection as an event stream
+esp_err_t events_subscribe(httpd_req_t *req);
+
+// Queue a named event with a JSON payload for all subscribers
+void events_publish(const char *event, const char *json);
+
+// Currently connected subscribers
+uint8_t events_clients();
+
+#endif  // EVENTS_H
@@ -0,0 +1,151 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  HTTP Workers + Request Arena (http_workers.cpp)
+ * =============================================================
+ *  Only the server task dispatches, so it is the one producer:
+ *  it claims an idle worker before detaching the request, and
+ *  the queue (one slot per worker) can never be full. Workers
+ *  hand their slot back once the async request is completed.
+ *
+ *  The arena pointer is task-local and set for the duration of
+ *  one handler call; the block comes from the pools on first
+ *  use, so handlers that never ask for scratch pay nothing.
+ * =============================================================
+ */
+
+#include "http_workers.h"
+#include "task_config.h"
+#include "mem_pool.h"
+#include <atomic>
+#include <stdarg.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef struct {
+  esp_err_t (*handler)(httpd_req_t *req);
+  void *userCtx;
+  bool parallel;
+} http_route_t;
+
+typedef struct {
+  httpd_req_t *req;          // async copy, owned by the worker
+  const http_route_t *route;
+} http_work_t;
+
+typedef struct {
+  uint8_t *buf;
+  size_t used;
+} req_arena_t;
+
+static http_route_t routes[HTTP_MAX_ROUTES];
+static uint8_t routeCount = 0;
+static QueueHandle_t workQueue = NULL;
+static std::atomic<uint8_t> idleWorkers(0);
+static __thread req_arena_t *currentArena = NULL;
+
+// ==================================================================
+//  Running a handler
+// ==================================================================
+static esp_err_t run_route(const http_route_t *route, httpd_req_t *req) {
+  req_arena_t arena = { NULL, 0 };
+  currentArena = &arena;
+  req->user_ctx = route->userCtx;  // the real handler sees its own context
+  esp_err_t res = route->handler(req);
+  currentArena = NULL;
+  pool_free(MEM_HTTP, arena.buf);
+  return res;
+}
+
+static void worker_task(void *arg) {
+  http_work_t work;
+  while (true) {
+    if (xQueueReceive(workQueue, &work, portMAX_DELAY) != pdTRUE) continue;
+    run_route(work.route, work.req);
+    httpd_req_async_handler_complete(work.req);
+    idleWorkers.fetch_add(1, std::memory_order_release);
+  }
+}
+
+static esp_err_t dispatch(httpd_req_t *req) {
+  const http_route_t *route = (const http_route_t *)req->user_ctx;
+  if (route->parallel && idleWorkers.load(std::memory_order_acquire) > 0) {
+    httpd_req_t *copy = NULL;
+    if (httpd_req_async_handler_begin(req, &copy) == ESP_OK) {
+      idleWorkers.fetch_sub(1, std::memory_order_relaxed);
+      http_work_t work = { copy, route };
+      xQueueSend(workQueue, &work, portMAX_DELAY);  // a slot per idle worker, never blocks
+      return ESP_OK;
+    }
+  }
+  return run_route(route, req);
+}
+
+// ==================================================================
+//  Setup
+// ==================================================================
+bool http_workers_init() {
+  if (workQueue) return true;
+  workQueue = xQueueCreate(HTTP_WORKERS, sizeof(http_work_t));
+  if (!workQueue) return false;
+
+  char name[12];
+  for (int i = 0; i < HTTP_WORKERS; i++) {
+    snprintf(name, sizeof(name), "http_w%d", i);
+    if (xTaskCreatePinnedToCore(worker_task, name, TASK_HTTP_WORKER_STACK, NULL,
+                                TASK_HTTP_WORKER_PRIO, NULL, TASK_HTTP_WORKER_CORE) != pdPASS) {
+      log_e("HTTP: could not start worker %d", i);
+      break;
+    }
+    idleWorkers.fetch_add(1, std::memory_order_release);
+  }
+  return idleWorkers.load() > 0;
+}
+
+void http_workers_wrap(httpd_uri_t *uri, bool parallel) {
+  if (routeCount >= HTTP_MAX_ROUTES) {
+    log_w("HTTP: no route slot for %s", uri->uri);
+    return;
+  }
+  http_route_t *route = &routes[routeCount++];
+  route->handler = uri->handler;
+  route->userCtx = uri->user_ctx;
+  route->parallel = parallel;
+  uri->handler = dispatch;
+  uri->user_ctx = route;
+}
+
+// ==================================================================
+//  Request arena
+// ==================================================================
+void *req_arena_alloc(size_t size) {
+  req_arena_t *a = currentArena;
+  if (!a) return NULL;
+  size = (size + 3) & ~(size_t)3;
+  if (a->used + size > REQ_ARENA_LEN) return NULL;
+  if (!a->buf && !(a->buf = (uint8_t *)pool_alloc(MEM_HTTP, REQ_ARENA_LEN))) return NULL;
+  void *ptr = a->buf + a->used;
+  a->used += size;
+  return ptr;
+}
+
+char *req_arena_printf(const char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(NULL, 0, fmt, ap);
+  va_end(ap);
+  if (n < 0) return NULL;
+
+  char *out = (char *)req_arena_alloc(n + 1);
+  if (!out) return NULL;
+  va_start(ap, fmt);
+  vsnprintf(out, n + 1, fmt, ap);
+  va_end(ap);
+  return out;
+}
@@ -0,0 +1,45 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  HTTP Workers + Request Arena (http_workers.h)
+ * =============================================================
+ *  esp_http_server runs every handler on its one task, so a
+ *  download or thumbnail held up all other requests. Routes
+ *  registered as parallel now hand their request to an idle
+ *  worker task (async request) and the server task returns to
+ *  its sockets at once. With every worker busy the handler runs
+ *  inline as before, so nothing waits in a queue behind a
+ *  long download.
+ *
+ *  Each handler also gets a request arena: scratch memory that
+ *  stays valid until the handler returns. That is the lifetime
+ *  httpd_resp_set_hdr() values need, and it is what replaces
+ *  the static header buffers that two workers would share.
+ * =============================================================
+ */
+#ifndef HTTP_WORKERS_H
+#define HTTP_WORKERS_H
+
+#include <stddef.h>
+#include "esp_http_server.h"
+
+#define HTTP_WORKERS       2        // parallel handler tasks for the control server
+#define HTTP_MAX_ROUTES    48
+#define REQ_ARENA_LEN      512      // per request, taken from the pools on first use
+
+// Start the worker tasks (before the servers start)
+bool http_workers_init();
+
+// Wrap a URI before registering it: its handler always runs inside a
+// request arena, and with `parallel` on a worker when one is idle.
+// Parallel handlers must be re-entrant (no shared static scratch).
+void http_workers_wrap(httpd_uri_t *uri, bool parallel);
+
+// Inside a handler: `size` bytes valid until it returns, or NULL
+// when the arena is full (or outside a handler)
+void *req_arena_alloc(size_t size);
+
+// Inside a handler: formatted string in the arena, or NULL
+char *req_arena_printf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+
+#endif  // HTTP_WORKERS_H
@@ -0,0 +1,303 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Background Jobs (jobs.cpp)
+ * =============================================================
+ *  Each job gets its own task, created on start and deleted when
+ *  run() returns, like the bulk delete worker it replaces. Slots
+ *  and their result buffers are reused; the oldest finished job
+ *  gives way first. The table mutex only guards the counters and
+ *  the slot choice - results are written once, by the job task,
+ *  and copied out under the lock before anything is sent.
+ * =============================================================
+ */
+
+#include "jobs.h"
+#include "events.h"
+#include "task_config.h"
+#include "mem_track.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+struct job {
+  uint32_t id;
+  job_state_t state;
+  job_spec_t spec;
+  httpd_req_t *req;        // async copy while the job runs
+  uint32_t done;
+  uint32_t total;
+  int64_t startUs;
+  uint32_t elapsedMs;
+  char *result;            // JOBS_RESULT_LEN, kept for the slot's lifetime
+  int resultLen;
+};
+
+// Metadata copied out under the lock
+typedef struct {
+  uint32_t id;
+  const char *kind;
+  job_state_t state;
+  uint32_t done;
+  uint32_t total;
+  uint32_t elapsedMs;
+} job_info_t;
+
+static job_t jobs[JOBS_MAX];
+static SemaphoreHandle_t jobsLock = NULL;
+static uint32_t nextJobId = 1;
+
+static const char *state_name(job_state_t st) {
+  switch (st) {
+    case JOB_RUNNING: return "running";
+    case JOB_DONE:    return "done";
+    case JOB_FAILED:  return "failed";
+    default:          return "idle";
+  }
+}
+
+const char *jobs_err_str(jobs_err_t err) {
+  switch (err) {
+    case JOBS_OK:       return "OK";
+    case JOBS_BUSY:     return "Same kind of job already running";
+    case JOBS_FULL:     return "Too many jobs running";
+    case JOBS_NO_MEM:   return "Out of memory";
+    case JOBS_NO_ASYNC: return "Could not detach request";
+  }
+  return "Unknown error";
+}
+
+// ==================================================================
+//  Job task
+// ==================================================================
+static void publish_finished(uint32_t id, const char *kind, job_state_t state) {
+  char buf[96];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf) - 1, NULL);
+  jw_obj_open(&w);
+  jw_uint(&w, "id", id);
+  jw_str(&w, "kind", kind);
+  jw_str(&w, "state", state_name(state));
+  jw_obj_close(&w);
+  int n = jw_result(&w);
+  if (n <= 0) return;
+  buf[n] = '\0';
+  events_publish("job", buf);
+}
+
+static void job_task(void *param) {
+  job_t *job = (job_t *)param;
+
+  // A reply is written straight to the request, chunked once it
+  // outgrows the result buffer; /jobs/<id> keeps it only if it fit
+  httpd_req_t *reply = job->req && job->spec.reply ? job->req : NULL;
+  if (reply) {
+    httpd_resp_set_type(reply, "application/json");
+    httpd_resp_set_hdr(reply, "Access-Control-Allow-Origin", "*");
+  }
+  json_writer_t out;
+  jw_init(&out, job->result, JOBS_RESULT_LEN, reply);
+  bool ok = job->spec.run(job, job->spec.arg, &out);
+  int len = jw_result(&out);
+  if (reply) {
+    if (out.sent == 0 && out.len == 0) httpd_resp_send_500(reply);  // run() wrote nothing
+    else jw_finish(&out);
+    if (out.sent) len = 0;
+  }
+  if (job->spec.release) job->spec.release(job->spec.arg);
+
+  if (job->req) httpd_req_async_handler_complete(job->req);
+
+  xSemaphoreTake(jobsLock, portMAX_DELAY);
+  job->req = NULL;
+  job->resultLen = len > 0 ? len : 0;
+  job->elapsedMs = (uint32_t)((esp_timer_get_time() - job->startUs) / 1000);
+  job->state = ok ? JOB_DONE : JOB_FAILED;
+  // The slot may be reused as soon as the lock is released
+  uint32_t id = job->id, elapsedMs = job->elapsedMs;
+  const char *kind = job->spec.kind;
+  xSemaphoreGive(jobsLock);
+
+  log_i("Job #%u %s: %s in %ums", id, kind, ok ? "done" : "failed", elapsedMs);
+  publish_finished(id, kind, ok ? JOB_DONE : JOB_FAILED);
+  vTaskDelete(NULL);
+}
+
+// ==================================================================
+//  Start
+// ==================================================================
+static bool lock_busy(const char *lock) {
+  for (int i = 0; i < JOBS_MAX; i++) {
+    const job_t *j = &jobs[i];
+    if (j->state == JOB_RUNNING && j->spec.lock && strcmp(j->spec.lock, lock) == 0) return true;
+  }
+  return false;
+}
+
+// Free slot, or the oldest finished one. Lock held.
+static job_t *pick_slot() {
+  job_t *oldest = NULL;
+  for (int i = 0; i < JOBS_MAX; i++) {
+    job_t *j = &jobs[i];
+    if (j->state == JOB_IDLE) return j;
+    if (j->state != JOB_RUNNING && (!oldest || j->id < oldest->id)) oldest = j;
+  }
+  return oldest;
+}
+
+jobs_err_t jobs_start(const job_spec_t *spec, uint32_t *id) {
+  if (!jobsLock) jobsLock = xSemaphoreCreateMutex();
+
+  xSemaphoreTake(jobsLock, portMAX_DELAY);
+  jobs_err_t err = JOBS_OK;
+  job_t *job = NULL;
+  if (spec->lock && lock_busy(spec->lock)) {
+    err = JOBS_BUSY;
+  } else if (!(job = pick_slot())) {
+    err = JOBS_FULL;
+  } else if (!job->result) {
+    job->result = (char *)mem_alloc_caps(MEM_JOBS, JOBS_RESULT_LEN, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+    if (!job->result) err = JOBS_NO_MEM;
+  }
+
+  httpd_req_t *copy = NULL;
+  if (err == JOBS_OK && spec->req && httpd_req_async_handler_begin(spec->req, &copy) != ESP_OK) {
+    err = JOBS_NO_ASYNC;
+  }
+  if (err != JOBS_OK) {
+    xSemaphoreGive(jobsLock);
+    if (spec->release) spec->release(spec->arg);
+    return err;
+  }
+
+  job->id = nextJobId++;
+  job->spec = *spec;
+  job->req = copy;
+  job->done = job->total = 0;
+  job->startUs = esp_timer_get_time();
+  job->elapsedMs = 0;
+  job->resultLen = 0;
+  job->state = JOB_RUNNING;
+  *id = job->id;
+  xSemaphoreGive(jobsLock);
+
+  if (xTaskCreatePinnedToCore(job_task, spec->kind, spec->stack ? spec->stack : TASK_JOBS_STACK,
+                              job, TASK_JOBS_PRIO, NULL, TASK_JOBS_CORE) != pdPASS) {
+    if (copy) httpd_req_async_handler_complete(copy);
+    if (spec->release) spec->release(spec->arg);
+    xSemaphoreTake(jobsLock, portMAX_DELAY);
+    job->state = JOB_IDLE;
+    xSemaphoreGive(jobsLock);
+    return JOBS_NO_MEM;
+  }
+  return JOBS_OK;
+}
+
+// ==================================================================
+//  Inside a job
+// ==================================================================
+void job_progress(job_t *job, uint32_t done, uint32_t total) {
+  xSemaphoreTake(jobsLock, portMAX_DELAY);
+  job->done = done;
+  job->total = total;
+  xSemaphoreGive(jobsLock);
+}
+
+httpd_req_t *job_request(job_t *job) {
+  return job->spec.reply ? NULL : job->req;
+}
+
+uint32_t job_id(const job_t *job) {
+  return job->id;
+}
+
+bool jobs_busy(const char *lock) {
+  if (!jobsLock) return false;
+  xSemaphoreTake(jobsLock, portMAX_DELAY);
+  bool busy = lock_busy(lock);
+  xSemaphoreGive(jobsLock);
+  return busy;
+}
+
+// ==================================================================
+//  Status
+// ==================================================================
+static void snapshot(const job_t *j, job_info_t *info) {
+  info->id = j->id;
+  info->kind = j->spec.kind;
+  info->state = j->state;
+  info->done = j->done;
+  info->total = j->total;
+  info->elapsedMs = j->state == JOB_RUNNING
+                        ? (uint32_t)((esp_timer_get_time() - j->startUs) / 1000)
+                        : j->elapsedMs;
+}
+
+// Fields only; the caller opens and closes the object
+static void write_info(json_writer_t *w, const job_info_t *info) {
+  jw_uint(w, "id", info->id);
+  jw_str(w, "kind", info->kind);
+  jw_str(w, "state", state_name(info->state));
+  jw_uint(w, "done", info->done);
+  jw_uint(w, "total", info->total);
+  jw_uint(w, "elapsed_ms", info->elapsedMs);
+}
+
+esp_err_t jobs_send(httpd_req_t *req, uint32_t id) {
+  char buf[512];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+
+  job_info_t infos[JOBS_MAX];
+  int count = 0;
+  char *result = NULL;
+  int resultLen = 0;
+
+  if (jobsLock) {
+    xSemaphoreTake(jobsLock, portMAX_DELAY);
+    for (int i = 0; i < JOBS_MAX; i++) {
+      const job_t *j = &jobs[i];
+      if (j->state == JOB_IDLE || (id && j->id != id)) continue;
+      snapshot(j, &infos[count++]);
+      if (id && j->resultLen && (result = (char *)mem_alloc(MEM_JOBS, j->resultLen))) {
+        memcpy(result, j->result, j->resultLen);
+        resultLen = j->resultLen;
+      }
+    }
+    xSemaphoreGive(jobsLock);
+  }
+
+  if (id) {
+    if (!count) {
+      jw_bool(&w, "success", false);
+      jw_str(&w, "error", "Unknown job");
+    } else {
+      jw_bool(&w, "success", true);
+      jw_obj_open(&w, "job");
+      write_info(&w, &infos[0]);
+      if (result) jw_raw(&w, "result", result, resultLen);
+      else jw_null(&w, "result");
+      jw_obj_close(&w);
+    }
+  } else {
+    jw_bool(&w, "success", true);
+    jw_arr_open(&w, "jobs");
+    for (int i = 0; i < count; i++) {
+      jw_obj_open(&w);
+      write_info(&w, &infos[i]);
+      jw_obj_close(&w);
+    }
+    jw_arr_close(&w);
+  }
+  mem_free(MEM_JOBS, result);
+
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
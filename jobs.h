@@ -0,0 +1,79 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Background Jobs (jobs.h)
+ * =============================================================
+ *  Long operations (WiFi connect and scan, bulk delete, export)
+ *  run on a task of their own instead of inside an httpd worker.
+ *  Starting one returns an id at once; /jobs/<id> reports its
+ *  progress and, once finished, its result JSON. Completion is
+ *  also pushed as an "event: job" on /events.
+ *
+ *  A job can take over the request that started it (async
+ *  handler): legacy endpoints keep their response format while
+ *  the control server stays free for other clients.
+ * =============================================================
+ */
+#ifndef JOBS_H
+#define JOBS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_http_server.h"
+#include "json_writer.h"
+
+#define JOBS_MAX          8        // finished jobs stay queryable until their slot is reused
+#define JOBS_RESULT_LEN   3072     // result JSON per job (PSRAM; the SD benchmark needs ~2.1 KB); a reply may be longer
+
+typedef enum {
+  JOB_IDLE = 0,
+  JOB_RUNNING,
+  JOB_DONE,
+  JOB_FAILED
+} job_state_t;
+
+typedef enum {
+  JOBS_OK = 0,
+  JOBS_BUSY,        // a job with the same lock is still running
+  JOBS_FULL,        // every slot holds a running job
+  JOBS_NO_MEM,
+  JOBS_NO_ASYNC     // the request could not be detached
+} jobs_err_t;
+
+typedef struct job job_t;
+
+// Runs on the job's task. Write the result value into `out`; return success.
+// With spec.reply, `out` is bound to the request and any length goes
+// out (out->req is set); otherwise it must fit JOBS_RESULT_LEN.
+typedef bool (*job_fn)(job_t *job, void *arg, json_writer_t *out);
+
+typedef struct {
+  const char *kind;             // shown in /jobs, e.g. "wifi-scan" (string literal)
+  const char *lock;             // jobs sharing a lock never overlap; NULL = none
+  job_fn run;
+  void *arg;
+  void (*release)(void *arg);   // called after run (or if the start fails); may be NULL
+  uint32_t stack;               // 0 = TASK_JOBS_STACK
+  httpd_req_t *req;             // optional: detached and handed to the job
+  bool reply;                   // with req: stream the result as the JSON response
+} job_spec_t;
+
+// Start a job; *id receives its number. On failure arg is released.
+jobs_err_t jobs_start(const job_spec_t *spec, uint32_t *id);
+const char *jobs_err_str(jobs_err_t err);
+
+// Inside run(): report progress (total 0 = unknown)
+void job_progress(job_t *job, uint32_t done, uint32_t total);
+
+// Inside run(): the detached request when spec.reply was false, else NULL
+httpd_req_t *job_request(job_t *job);
+uint32_t job_id(const job_t *job);
+
+// True while a job holding `lock` runs
+bool jobs_busy(const char *lock);
+
+// {"success":true,"job":{...}} for one job (with result), or the
+// list of all jobs (without results) when id is 0
+esp_err_t jobs_send(httpd_req_t *req, uint32_t id);
+
+#endif  // JOBS_H
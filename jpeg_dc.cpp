@@ -0,0 +1,400 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  DC-only JPEG Decoder (jpeg_dc.cpp)
+ * =============================================================
+ *  Entropy decoding follows ITU T.81 Annex F: canonical Huffman
+ *  codes, resolved JPEG_DC_LOOKAHEAD bits at a time through a
+ *  table with a maxcode walk for the rare longer codes. AC terms
+ *  are the bulk of the work, and their values are never needed:
+ *  a second, wider table maps JPEG_DC_AC_LOOKAHEAD bits straight
+ *  to "skip N bits, pass M coefficients" for every term whose
+ *  code and magnitude fit, often several and the end of block.
+ *  libjpeg-turbo's 1/8 scale resolves one term per lookup; this
+ *  is what puts the decoder ahead of it (~1.3-1.4x on the host).
+ *
+ *  The 64-bit bit reader takes four bytes at a time when none is
+ *  0xFF, removes 0xFF00 stuffing otherwise and feeds zeros once
+ *  it reaches a marker; if any of those zeros get consumed the
+ *  scan was truncated and the frame is rejected.
+ * =============================================================
+ */
+
+#include "jpeg_dc.h"
+#include <string.h>
+
+#define MAX_COMPS   3
+#define MAX_BLOCKS  10                // per MCU (T.81 B.2.3)
+
+typedef struct {
+  uint8_t id;
+  uint8_t h, v;
+  uint8_t tq;
+  uint8_t td, ta;
+} comp_t;
+
+typedef struct {
+  const uint8_t *p;
+  const uint8_t *end;
+  uint64_t bits;                      // left-aligned
+  int n;                              // valid bits in `bits`
+  int padded;                         // zero bytes fed past a marker or the end
+} bitrd_t;
+
+void jpeg_dc_reset(jpeg_dc_t *d) {
+  memset(d, 0, sizeof(*d));
+}
+
+// ==================================================================
+//  Huffman tables
+// ==================================================================
+static uint32_t fnv1a(const uint8_t *p, size_t n) {
+  uint32_t h = 2166136261u;
+  while (n--) h = (h ^ *p++) * 16777619u;
+  return h;
+}
+
+// counts[16] then the symbols; false if the code lengths do not fit
+static bool build_huff(jpeg_dc_huff_t *t, const uint8_t *counts, const uint8_t *syms, int total) {
+  memcpy(t->vals, syms, total);
+  memset(t->look, 0, sizeof(t->look));
+
+  uint32_t code = 0;
+  int k = 0;
+  for (int l = 1; l <= 16; l++) {
+    int n = counts[l - 1];
+    t->valptr[l] = k;
+    t->mincode[l] = code;
+    t->maxcode[l] = n ? (int32_t)(code + n - 1) : -1;
+    if (n && code + n > (1u << l)) return false;
+    if (l <= JPEG_DC_LOOKAHEAD) {
+      int shift = JPEG_DC_LOOKAHEAD - l;
+      for (int i = 0; i < n; i++) {
+        uint32_t first = (code + i) << shift;
+        for (uint32_t j = 0; j < (1u << shift); j++) t->look[first + j] = (l << 8) | syms[k + i];
+      }
+    }
+    code = (code + n) << 1;
+    k += n;
+  }
+  t->maxcode[17] = INT32_MAX;         // stops the walk past 16 bits
+  t->built = true;
+  return true;
+}
+
+// (code length << 8) | symbol for the code at the top of a
+// `width`-bit value; 0 when no code fits in `width` bits
+static uint16_t peek_code(const jpeg_dc_huff_t *t, uint32_t bits, int width) {
+  for (int l = 1; l <= width && l <= 16; l++) {
+    int32_t code = bits >> (width - l);
+    if (t->maxcode[l] >= 0 && code <= t->maxcode[l] && code >= t->mincode[l]) {
+      return (l << 8) | t->vals[t->valptr[l] + code - t->mincode[l]];
+    }
+  }
+  return 0;
+}
+
+// Every AC term (code and magnitude bits) that fits whole in the
+// lookahead, up to and including an end of block
+static void build_ac_skip(uint16_t *skip, const jpeg_dc_huff_t *t) {
+  for (int i = 0; i < (1 << JPEG_DC_AC_LOOKAHEAD); i++) {
+    int used = 0, coefs = 0, eob = 0;
+    while (!eob && coefs < 64) {
+      int left = JPEG_DC_AC_LOOKAHEAD - used;
+      uint16_t e = peek_code(t, i & ((1 << left) - 1), left);
+      int l = e >> 8, r = (e >> 4) & 15, s = e & 15;
+      if (!l || used + l + s > JPEG_DC_AC_LOOKAHEAD) break;
+      if (s) coefs += r + 1;
+      else if (r == 15) coefs += 16;                         // ZRL
+      else if (r == 0) eob = 1;                              // end of block
+      else break;                                            // EOBn: not baseline
+      used += l + s;
+    }
+    skip[i] = used ? (used << 8) | (eob << 7) | coefs : 0;
+  }
+}
+
+static bool parse_dht(jpeg_dc_t *d, const uint8_t *s, const uint8_t *end) {
+  while (s < end) {
+    if (end - s < 17) return false;
+    int tc = s[0] >> 4, th = s[0] & 15;
+    if (tc > 1 || th > 1) return false;   // baseline: tables 0 and 1
+    int total = 0;
+    for (int i = 1; i <= 16; i++) total += s[i];
+    if (total > 256 || s + 17 + total > end) return false;
+
+    jpeg_dc_huff_t *t = tc ? &d->ac[th] : &d->dc[th];
+    uint32_t hash = fnv1a(s, 17 + total);
+    if (!t->built || t->hash != hash) {
+      if (!build_huff(t, s + 1, s + 17, total)) {
+        t->built = false;
+        return false;
+      }
+      if (tc) build_ac_skip(d->acSkip[th], t);
+      t->hash = hash;
+      d->tableBuilds++;
+    }
+    s += 17 + total;
+  }
+  return true;
+}
+
+static bool parse_dqt(jpeg_dc_t *d, const uint8_t *s, const uint8_t *end) {
+  while (s < end) {
+    int pq = s[0] >> 4, tq = s[0] & 15;
+    size_t n = 1 + 64 * (pq ? 2 : 1);
+    if (tq > 3 || pq > 1 || s + n > end) return false;
+    d->quant0[tq] = pq ? (s[1] << 8) | s[2] : s[1];
+    s += n;
+  }
+  return true;
+}
+
+// ==================================================================
+//  Bit reader
+// ==================================================================
+// At least 32 valid bits afterwards: a code plus its magnitude bits
+static inline void fill(bitrd_t *b) {
+  if (b->n >= 32) return;
+  // Four bytes at once when none of them is 0xFF
+  if (b->end - b->p >= 4) {
+    uint32_t w = ((uint32_t)b->p[0] << 24) | (b->p[1] << 16) | (b->p[2] << 8) | b->p[3];
+    uint32_t inv = ~w;
+    if (!((inv - 0x01010101u) & ~inv & 0x80808080u)) {
+      b->bits |= (uint64_t)w << (32 - b->n);
+      b->n += 32;
+      b->p += 4;
+      return;
+    }
+  }
+  while (b->n <= 56) {
+    uint32_t c = 0;
+    if (b->p < b->end) {
+      c = *b->p;
+      if (c != 0xFF) {
+        b->p++;
+      } else if (b->p + 1 < b->end && b->p[1] == 0x00) {
+        b->p += 2;                    // stuffed 0xFF
+      } else {
+        c = 0;                        // a marker: stay on it, feed zeros
+        b->padded++;
+      }
+    } else {
+      b->padded++;
+    }
+    b->bits |= (uint64_t)c << (56 - b->n);
+    b->n += 8;
+  }
+}
+
+static inline void skip_bits(bitrd_t *b, int n) {
+  b->bits <<= n;
+  b->n -= n;
+}
+
+static inline int decode(bitrd_t *b, const jpeg_dc_huff_t *t) {
+  fill(b);
+  uint32_t look = b->bits >> (64 - JPEG_DC_LOOKAHEAD);
+  if (t->look[look]) {
+    skip_bits(b, t->look[look] >> 8);
+    return t->look[look] & 0xFF;
+  }
+  int l = JPEG_DC_LOOKAHEAD + 1;
+  int32_t code = b->bits >> (64 - l);
+  while (code > t->maxcode[l]) {
+    l++;
+    if (l > 16) return -1;
+    code = b->bits >> (64 - l);
+  }
+  skip_bits(b, l);
+  return t->vals[t->valptr[l] + code - t->mincode[l]];
+}
+
+// s-bit magnitude category -> signed value (T.81 F.2.2.1 EXTEND)
+static inline int receive_extend(bitrd_t *b, int s) {
+  fill(b);
+  int v = b->bits >> (64 - s);
+  skip_bits(b, s);
+  return v < (1 << (s - 1)) ? v - (1 << s) + 1 : v;
+}
+
+// Drop buffered bits and step over the RSTn marker that should follow
+static bool restart(bitrd_t *b) {
+  b->bits = 0;
+  b->n = 0;
+  b->padded = 0;
+  while (b->p + 1 < b->end) {
+    if (b->p[0] == 0xFF && b->p[1] >= 0xD0 && b->p[1] <= 0xD7) {
+      b->p += 2;
+      return true;
+    }
+    b->p++;
+  }
+  return false;
+}
+
+// ==================================================================
+//  Scan
+// ==================================================================
+bool jpeg_dc_luma(jpeg_dc_t *d, const uint8_t *jpg, size_t len, uint8_t *map, size_t cap,
+                  uint16_t *w, uint16_t *h) {
+  if (len < 4 || jpg[0] != 0xFF || jpg[1] != 0xD8) return false;
+
+  comp_t comps[MAX_COMPS];
+  int ncomp = 0;
+  uint16_t width = 0, height = 0, restartInterval = 0;
+  const uint8_t *p = jpg + 2, *end = jpg + len;
+  const uint8_t *scan = NULL;
+
+  // Header segments up to the start of scan
+  while (!scan) {
+    if (end - p < 4 || p[0] != 0xFF) return false;
+    uint8_t m = p[1];
+    if (m == 0xFF) {                  // fill byte before a marker
+      p++;
+      continue;
+    }
+    size_t segLen = (p[2] << 8) | p[3];
+    const uint8_t *s = p + 4, *segEnd = p + 2 + segLen;
+    if (segLen < 2 || segEnd > end) return false;
+
+    switch (m) {
+      case 0xDB:
+        if (!parse_dqt(d, s, segEnd)) return false;
+        break;
+      case 0xC4:
+        if (!parse_dht(d, s, segEnd)) return false;
+        break;
+      case 0xDD:
+        if (segLen < 4) return false;
+        restartInterval = (s[0] << 8) | s[1];
+        break;
+      case 0xC0:
+      case 0xC1: {
+        if (segLen < 8 || s[0] != 8) return false;
+        height = (s[1] << 8) | s[2];
+        width = (s[3] << 8) | s[4];
+        ncomp = s[5];
+        if (ncomp < 1 || ncomp > MAX_COMPS || segLen < 8u + 3 * ncomp || !width || !height) return false;
+        for (int i = 0; i < ncomp; i++) {
+          const uint8_t *c = s + 6 + 3 * i;
+          comps[i].id = c[0];
+          comps[i].h = c[1] >> 4;
+          comps[i].v = c[1] & 15;
+          comps[i].tq = c[2];
+          if (comps[i].h < 1 || comps[i].h > 4 || comps[i].v < 1 || comps[i].v > 4 || comps[i].tq > 3) {
+            return false;
+          }
+        }
+        break;
+      }
+      case 0xDA: {
+        // One interleaved scan over every component (baseline)
+        if (!ncomp || s[0] != ncomp || segLen < 6u + 2 * ncomp) return false;
+        for (int i = 0; i < ncomp; i++) {
+          const uint8_t *c = s + 1 + 2 * i;
+          if (c[0] != comps[i].id) return false;
+          comps[i].td = c[1] >> 4;
+          comps[i].ta = c[1] & 15;
+          if (comps[i].td > 1 || comps[i].ta > 1) return false;
+          if (!d->dc[comps[i].td].built || !d->ac[comps[i].ta].built) return false;
+        }
+        scan = segEnd;
+        break;
+      }
+      case 0xD9:
+        return false;
+      default:
+        // Progressive, lossless and arithmetic-coded frames are not handled
+        if (m >= 0xC2 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC) return false;
+        break;                        // APPn, COM, ...
+    }
+    p = segEnd;
+  }
+
+  // A lone component is coded one block per MCU whatever its factors
+  if (ncomp == 1) comps[0].h = comps[0].v = 1;
+  int hmax = 1, vmax = 1, blocks = 0;
+  for (int i = 0; i < ncomp; i++) {
+    if (comps[i].h > hmax) hmax = comps[i].h;
+    if (comps[i].v > vmax) vmax = comps[i].v;
+    blocks += comps[i].h * comps[i].v;
+  }
+  if (blocks > MAX_BLOCKS) return false;
+
+  const comp_t *y = &comps[0];
+  int mapW = ((width * y->h + hmax - 1) / hmax + 7) / 8;
+  int mapH = ((height * y->v + vmax - 1) / vmax + 7) / 8;
+  if ((size_t)mapW * mapH > cap) return false;
+  int mcusX = (width + 8 * hmax - 1) / (8 * hmax);
+  int mcusY = (height + 8 * vmax - 1) / (8 * vmax);
+
+  // DC gives 8x the block mean of the level-shifted samples
+  int q0 = d->quant0[y->tq];
+  if (!q0) return false;
+
+  bitrd_t b = { scan, end, 0, 0, 0 };
+  int pred[MAX_COMPS] = { 0 };
+  uint32_t mcu = 0;
+  for (int my = 0; my < mcusY; my++) {
+    for (int mx = 0; mx < mcusX; mx++, mcu++) {
+      if (restartInterval && mcu && mcu % restartInterval == 0) {
+        if (!restart(&b)) return false;
+        memset(pred, 0, sizeof(pred));
+      }
+      for (int c = 0; c < ncomp; c++) {
+        const comp_t *cp = &comps[c];
+        const jpeg_dc_huff_t *dc = &d->dc[cp->td];
+        const jpeg_dc_huff_t *ac = &d->ac[cp->ta];
+        const uint16_t *acSkip = d->acSkip[cp->ta];
+        for (int by = 0; by < cp->v; by++) {
+          for (int bx = 0; bx < cp->h; bx++) {
+            int t = decode(&b, dc);
+            if (t < 0 || t > 11) return false;
+            if (t) pred[c] += receive_extend(&b, t);
+
+            // Step over the AC terms without keeping them
+            for (int k = 1; k < 64;) {
+              fill(&b);
+              uint16_t fast = acSkip[b.bits >> (64 - JPEG_DC_AC_LOOKAHEAD)];
+              int passed = fast & 0x7F;
+              // Terms past coefficient 63 belong to the next block
+              if (fast && ((fast & 0x80) ? k + passed < 64 : k + passed <= 64)) {
+                skip_bits(&b, fast >> 8);
+                if (fast & 0x80) break;
+                k += passed;
+                continue;
+              }
+              int rs = decode(&b, ac);
+              if (rs < 0) return false;
+              int r = rs >> 4, sz = rs & 15;
+              if (sz) {
+                k += r + 1;
+                fill(&b);
+                skip_bits(&b, sz);
+              } else if (r == 15) {
+                k += 16;
+              } else {
+                break;                // end of block
+              }
+            }
+
+            if (c == 0) {
+              int x = mx * cp->h + bx, yy = my * cp->v + by;
+              if (x < mapW && yy < mapH) {
+                int v = 128 + pred[0] * q0 / 8;
+                map[yy * mapW + x] = v < 0 ? 0 : v > 255 ? 255 : v;
+              }
+            }
+          }
+        }
+      }
+      // Zeros fed past the data were decoded as if real: truncated
+      if (b.padded * 8 > b.n) return false;
+    }
+  }
+
+  *w = mapW;
+  *h = mapH;
+  return true;
+}
@@ -0,0 +1,71 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  DC-only JPEG Decoder (jpeg_dc.h)
+ * =============================================================
+ *  The DC coefficient of each 8x8 block is the block's mean
+ *  (times 8, level-shifted by 128). Reading only those gives a
+ *  luma image at 1/8 x 1/8 scale without any IDCT, upsampling or
+ *  colour conversion: AC codes are still Huffman-decoded to find
+ *  the next block, but never dequantised or stored.
+ *
+ *  Baseline Huffman JPEG only (SOF0/SOF1, 8-bit, up to 3
+ *  components, any sampling, restart intervals), which is what
+ *  the camera produces. Progressive or arithmetic-coded files
+ *  return false; callers fall back to the ROM decoder.
+ *
+ *  That one, jpg2rgb565(JPG_SCALE_8X), also takes only the DC
+ *  term at 1/8 scale, but walks each Huffman code a bit at a
+ *  time, decodes and converts chroma to RGB565, and the luma then
+ *  has to be recovered from the RGB565; its tables are rebuilt
+ *  for every frame.
+ *
+ *  No ESP-IDF dependencies, so tools/jpeg_dc_bench.cpp builds
+ *  the same file on the host.
+ * =============================================================
+ */
+#ifndef JPEG_DC_H
+#define JPEG_DC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JPEG_DC_LOOKAHEAD     9       // bits resolved by one table lookup
+#define JPEG_DC_AC_LOOKAHEAD  11      // bits of AC terms skipped by one lookup
+
+// Luma map size for a w x h image: one byte per 8x8 block
+#define JPEG_DC_MAP_LEN(w, h)  ((size_t)(((w) + 7) / 8) * (((h) + 7) / 8))
+
+typedef struct {
+  uint16_t look[1 << JPEG_DC_LOOKAHEAD];     // (code length << 8) | symbol; 0 = longer code
+  int32_t maxcode[18];                       // per code length; -1 = none
+  uint16_t mincode[17];
+  uint16_t valptr[17];
+  uint8_t vals[256];
+  uint32_t hash;                             // of the DHT entry it was built from
+  bool built;
+} jpeg_dc_huff_t;
+
+// Decoder context, ~14 KB. Huffman tables are kept between calls
+// and only rebuilt when a frame's DHT differs from the last one.
+typedef struct {
+  jpeg_dc_huff_t dc[2];
+  jpeg_dc_huff_t ac[2];
+  // Per AC table, for the next JPEG_DC_AC_LOOKAHEAD bits: the AC
+  // terms that fit whole, as (bits << 8) | end of block << 7 |
+  // coefficients passed; 0 = decode slowly
+  uint16_t acSkip[2][1 << JPEG_DC_AC_LOOKAHEAD];
+  uint16_t quant0[4];                        // DC entry of each quantisation table
+  uint32_t tableBuilds;                      // Huffman tables built so far (cache misses)
+} jpeg_dc_t;
+
+// Forget cached tables (e.g. before first use of a zeroed context)
+void jpeg_dc_reset(jpeg_dc_t *d);
+
+// Decode the luma DC terms of `jpg` into `map` (row-major, *w x *h
+// bytes, 0..255). False when the file is not baseline Huffman, is
+// truncated or corrupt, or the map would exceed `cap`.
+bool jpeg_dc_luma(jpeg_dc_t *d, const uint8_t *jpg, size_t len, uint8_t *map, size_t cap,
+                  uint16_t *w, uint16_t *h);
+
+#endif  // JPEG_DC_H
@@ -0,0 +1,239 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Streaming JSON Writer (json_writer.h)
+ * =============================================================
+ *  Writes JSON into a caller-supplied buffer (stack or PSRAM)
+ *  and never allocates. With a request attached, a full buffer
+ *  is sent as an HTTP chunk and reused, so output size is not
+ *  bounded by the buffer; documents that fit go out as one
+ *  plain response. Without one, overflow marks the
+ *  writer as failed instead of truncating silently.
+ *
+ *  Commas are tracked per nesting level, strings are escaped:
+ *
+ *    char buf[256];
+ *    json_writer_t w;
+ *    jw_init(&w, buf, sizeof(buf), req);
+ *    jw_obj_open(&w);
+ *    jw_str(&w, "ssid", ssid);
+ *    jw_int(&w, "rssi", rssi);
+ *    jw_obj_close(&w);
+ *    return jw_finish(&w);
+ * =============================================================
+ */
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "esp_http_server.h"
+
+#define JW_MAX_DEPTH 32
+
+typedef struct {
+  char *buf;
+  size_t cap;
+  size_t len;            // bytes pending in buf
+  size_t sent;           // bytes already flushed as chunks
+  httpd_req_t *req;      // NULL: buffer only
+  uint32_t hasItem;      // bit per depth: next item needs a comma
+  uint8_t depth;
+  bool afterKey;         // a key was written, the value follows
+  bool error;
+} json_writer_t;
+
+inline void jw_init(json_writer_t *w, char *buf, size_t cap, httpd_req_t *req) {
+  w->buf = buf;
+  w->cap = cap;
+  w->len = 0;
+  w->sent = 0;
+  w->req = req;
+  w->hasItem = 0;
+  w->depth = 0;
+  w->afterKey = false;
+  w->error = cap < 2;
+}
+
+// Send what is buffered as one chunk (no-op for buffer-only writers)
+inline bool jw_flush(json_writer_t *w) {
+  if (!w->req || w->error || w->len == 0) return !w->error;
+  if (httpd_resp_send_chunk(w->req, w->buf, w->len) != ESP_OK) {
+    w->error = true;
+    return false;
+  }
+  w->sent += w->len;
+  w->len = 0;
+  return true;
+}
+
+// Raw bytes, flushing through the buffer as needed
+inline void jw_write(json_writer_t *w, const char *s, size_t n) {
+  while (n && !w->error) {
+    size_t room = w->cap - 1 - w->len;  // keep one byte for the terminator
+    if (room == 0) {
+      if (!w->req) {
+        w->error = true;
+        break;
+      }
+      jw_flush(w);
+      continue;
+    }
+    size_t take = n < room ? n : room;
+    memcpy(w->buf + w->len, s, take);
+    w->len += take;
+    s += take;
+    n -= take;
+  }
+  if (!w->error) w->buf[w->len] = 0;
+}
+
+inline void jw_puts(json_writer_t *w, const char *s) {
+  jw_write(w, s, strlen(s));
+}
+
+// Quoted, escaped string body; runs of plain characters are copied at once
+inline void jw_escaped(json_writer_t *w, const char *s) {
+  static const char hex[] = "0123456789abcdef";
+  jw_write(w, "\"", 1);
+  const char *run = s;
+  for (; *s; s++) {
+    unsigned char c = (unsigned char)*s;
+    if (c >= 0x20 && c != '"' && c != '\\') continue;
+    jw_write(w, run, s - run);
+    char esc[6] = { '\\', 0 };
+    size_t n = 2;
+    switch (c) {
+      case '"': esc[1] = '"'; break;
+      case '\\': esc[1] = '\\'; break;
+      case '\n': esc[1] = 'n'; break;
+      case '\r': esc[1] = 'r'; break;
+      case '\t': esc[1] = 't'; break;
+      default:
+        esc[1] = 'u';
+        esc[2] = '0';
+        esc[3] = '0';
+        esc[4] = hex[c >> 4];
+        esc[5] = hex[c & 15];
+        n = 6;
+    }
+    jw_write(w, esc, n);
+    run = s + 1;
+  }
+  jw_write(w, run, s - run);
+  jw_write(w, "\"", 1);
+}
+
+// Comma and key before a value; key is NULL inside arrays
+inline void jw_prefix(json_writer_t *w, const char *key) {
+  if (w->afterKey) {
+    w->afterKey = false;
+    return;
+  }
+  uint32_t bit = 1u << w->depth;
+  if (w->hasItem & bit) jw_write(w, ",", 1);
+  w->hasItem |= bit;
+  if (key) {
+    jw_escaped(w, key);
+    jw_write(w, ":", 1);
+  }
+}
+
+// Key on its own; the next value or container belongs to it
+inline void jw_key(json_writer_t *w, const char *key) {
+  jw_prefix(w, key);
+  w->afterKey = true;
+}
+
+inline void jw_open(json_writer_t *w, const char *key, char c) {
+  jw_prefix(w, key);
+  jw_write(w, &c, 1);
+  if (w->depth + 1 >= JW_MAX_DEPTH) {
+    w->error = true;
+    return;
+  }
+  w->depth++;
+  w->hasItem &= ~(1u << w->depth);
+}
+
+inline void jw_close(json_writer_t *w, char c) {
+  if (w->depth) w->depth--;
+  jw_write(w, &c, 1);
+}
+
+inline void jw_obj_open(json_writer_t *w, const char *key = NULL) { jw_open(w, key, '{'); }
+inline void jw_obj_close(json_writer_t *w) { jw_close(w, '}'); }
+inline void jw_arr_open(json_writer_t *w, const char *key = NULL) { jw_open(w, key, '['); }
+inline void jw_arr_close(json_writer_t *w) { jw_close(w, ']'); }
+
+inline void jw_str(json_writer_t *w, const char *key, const char *value) {
+  jw_prefix(w, key);
+  if (value) jw_escaped(w, value);
+  else jw_write(w, "null", 4);
+}
+
+inline void jw_int(json_writer_t *w, const char *key, int64_t value) {
+  char num[24];
+  int n = snprintf(num, sizeof(num), "%lld", (long long)value);
+  jw_prefix(w, key);
+  jw_write(w, num, n);
+}
+
+inline void jw_uint(json_writer_t *w, const char *key, uint64_t value) {
+  char num[24];
+  int n = snprintf(num, sizeof(num), "%llu", (unsigned long long)value);
+  jw_prefix(w, key);
+  jw_write(w, num, n);
+}
+
+inline void jw_float(json_writer_t *w, const char *key, double value, int decimals = 1) {
+  jw_prefix(w, key);
+  if (isnan(value) || isinf(value)) {
+    jw_write(w, "null", 4);  // JSON has no NaN/Infinity
+    return;
+  }
+  char num[32];
+  int n = snprintf(num, sizeof(num), "%.*f", decimals, value);
+  if (n < 0 || n >= (int)sizeof(num)) n = snprintf(num, sizeof(num), "%.17g", value);  // 1e29 and up
+  jw_write(w, num, n);
+}
+
+inline void jw_bool(json_writer_t *w, const char *key, bool value) {
+  jw_prefix(w, key);
+  jw_write(w, value ? "true" : "false", value ? 4 : 5);
+}
+
+inline void jw_null(json_writer_t *w, const char *key) {
+  jw_prefix(w, key);
+  jw_write(w, "null", 4);
+}
+
+// Already-serialized JSON (a cached section, a nested document)
+inline void jw_raw(json_writer_t *w, const char *key, const char *json, size_t len) {
+  jw_prefix(w, key);
+  jw_write(w, json, len);
+}
+
+// Length of a buffer-only document, or -1 if it did not fit
+inline int jw_result(const json_writer_t *w) {
+  return w->error ? -1 : (int)w->len;
+}
+
+// Send the document: one plain response if it never overflowed the
+// buffer, otherwise the remaining chunk plus the terminating one. A
+// writer that failed before sending anything answers with a 500.
+inline esp_err_t jw_finish(json_writer_t *w) {
+  if (!w->req) return w->error ? ESP_FAIL : ESP_OK;
+  if (w->error) {
+    if (w->sent == 0) httpd_resp_send_500(w->req);
+    return ESP_FAIL;
+  }
+  if (w->sent == 0) return httpd_resp_send(w->req, w->buf, w->len);
+  if (!jw_flush(w)) return ESP_FAIL;
+  return httpd_resp_send_chunk(w->req, NULL, 0);
+}
+
+#endif  // JSON_WRITER_H
@@ -0,0 +1,181 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Streaming TAR Export (media_export.cpp)
+ * =============================================================
+ *  Archive layout per file: one 512-byte ustar header, the file
+ *  body, zero padding up to the next 512-byte boundary. Two zero
+ *  blocks end the archive. A file that disappears before its
+ *  header is sent is skipped; a read error mid-body aborts the
+ *  response, since the archive can no longer be made valid.
+ *  A range export sends each file from inside the directory walk
+ *  (one extra open handle), after a first walk that only counts.
+ * =============================================================
+ */
+
+#include "media_export.h"
+#include "media_store.h"
+#include "sd_stream.h"
+#include "mem_track.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "FS.h"
+#include "SD_MMC.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+static const uint8_t zeroBlocks[TAR_BLOCK * 2] = {0};
+
+// One export in progress: the selection is walked and each file
+// sent as it is found, so there is no list and no limit on its size
+typedef struct {
+  httpd_req_t *req;
+  const export_request_t *sel;
+  export_result_t *result;
+  uint8_t *header;
+  uint32_t done;
+  uint32_t total;           // counted beforehand, for progress only
+  esp_err_t res;
+} export_walk_t;
+
+static esp_err_t send_file(httpd_req_t *req, const char *name, uint8_t *header,
+                           export_result_t *result, bool *skipped);
+
+// ==================================================================
+//  Selection
+// ==================================================================
+static bool in_range(const export_request_t *sel, const char *name) {
+  if (sel->from && sel->from[0] && strcmp(name, sel->from) < 0) return false;
+  if (sel->to && sel->to[0] && strcmp(name, sel->to) > 0) return false;
+  return true;
+}
+
+static void export_one(export_walk_t *x, const char *name) {
+  if (name[0] == '/') name++;
+  if (!*name || strlen(name) >= EXPORT_NAME_LEN) return;
+  if (x->sel->skip && strcmp(name, x->sel->skip) == 0) return;
+  bool skipped;
+  x->res = send_file(x->req, name, x->header, x->result, &skipped);
+  if (skipped) x->result->skipped++;
+  x->done++;
+  // Captures made during the export can push the count past the estimate
+  if (x->sel->progress) {
+    x->sel->progress(x->sel->progressArg, x->done, x->done > x->total ? x->done : x->total);
+  }
+}
+
+static bool count_visit(const char *name, const char *path, size_t size, time_t mtime, void *arg) {
+  export_walk_t *x = (export_walk_t *)arg;
+  if (in_range(x->sel, name)) x->total++;
+  return true;
+}
+
+static bool send_visit(const char *name, const char *path, size_t size, time_t mtime, void *arg) {
+  export_walk_t *x = (export_walk_t *)arg;
+  if (in_range(x->sel, name)) export_one(x, name);
+  return x->res == ESP_OK;
+}
+
+static void send_selection(export_walk_t *x) {
+  char *names = x->sel->names;
+  if (!names) {
+    media_for_each(count_visit, x);
+    media_for_each(send_visit, x);
+    return;
+  }
+  for (const char *p = names; *p; p++) x->total += *p == ',';
+  x->total++;
+  char *save = NULL;
+  for (char *tok = strtok_r(names, ",", &save); tok && x->res == ESP_OK; tok = strtok_r(NULL, ",", &save)) {
+    while (*tok == ' ') tok++;
+    if (*tok) export_one(x, tok);
+  }
+}
+
+// ==================================================================
+//  ustar header
+// ==================================================================
+static void tar_header(uint8_t *h, const char *name, uint64_t size, time_t mtime) {
+  memset(h, 0, TAR_BLOCK);
+  strncpy((char *)h, name, 99);                                   // name
+  memcpy(h + 100, "0000644", 8);                                  // mode
+  memcpy(h + 108, "0000000", 8);                                  // uid
+  memcpy(h + 116, "0000000", 8);                                  // gid
+  snprintf((char *)h + 124, 12, "%011llo", (unsigned long long)size);
+  snprintf((char *)h + 136, 12, "%011lo", (unsigned long)(mtime > 0 ? mtime : 0));
+  h[156] = '0';                                                   // regular file
+  memcpy(h + 257, "ustar", 6);                                    // magic + NUL
+  memcpy(h + 263, "00", 2);                                       // version
+  strcpy((char *)h + 265, "trinetra");                            // uname
+  strcpy((char *)h + 297, "trinetra");                            // gname
+
+  // Checksum is computed with its own field read as eight spaces
+  memset(h + 148, ' ', 8);
+  uint32_t sum = 0;
+  for (int i = 0; i < TAR_BLOCK; i++) sum += h[i];
+  snprintf((char *)h + 148, 8, "%06lo", (unsigned long)sum);      // "NNNNNN\0" then ' '
+  h[155] = ' ';
+}
+
+// ==================================================================
+//  Streaming
+// ==================================================================
+static esp_err_t send_file(httpd_req_t *req, const char *name, uint8_t *header,
+                           export_result_t *result, bool *skipped) {
+  char path[MEDIA_PATH_MAX];
+  *skipped = false;
+
+  File file;
+  if (media_resolve(name, path, sizeof(path))) file = SD_MMC.open(path, FILE_READ);
+  if (!file || file.isDirectory()) {
+    *skipped = true;
+    return ESP_OK;
+  }
+
+  size_t size = file.size();
+  tar_header(header, name, size, file.getLastWrite());
+  esp_err_t res = httpd_resp_send_chunk(req, (const char *)header, TAR_BLOCK);
+
+  size_t sent = 0;
+  if (res == ESP_OK && size) res = sd_stream_send(req, file, size, &sent);
+  file.close();
+  if (res == ESP_OK && sent != size) res = ESP_FAIL;  // short read: archive is broken
+
+  size_t pad = (TAR_BLOCK - size % TAR_BLOCK) % TAR_BLOCK;
+  if (res == ESP_OK && pad) res = httpd_resp_send_chunk(req, (const char *)zeroBlocks, pad);
+
+  if (res == ESP_OK) {
+    result->files++;
+    result->bytes += TAR_BLOCK + size + pad;
+  } else {
+    log_e("Export: aborted in %s (%u of %u bytes)", name, (unsigned)sent, (unsigned)size);
+  }
+  return res;
+}
+
+esp_err_t media_export_send(httpd_req_t *req, export_request_t *sel, export_result_t *result) {
+  memset(result, 0, sizeof(*result));
+
+  uint8_t *header = (uint8_t *)mem_alloc(MEM_EXPORT, TAR_BLOCK);
+  if (!header) return ESP_ERR_NO_MEM;
+
+  int64_t startUs = esp_timer_get_time();
+  export_walk_t walk = { req, sel, result, header, 0, 0, ESP_OK };
+  send_selection(&walk);
+  esp_err_t res = walk.res;
+
+  if (res == ESP_OK) {
+    res = httpd_resp_send_chunk(req, (const char *)zeroBlocks, sizeof(zeroBlocks));
+    if (res == ESP_OK) result->bytes += sizeof(zeroBlocks);
+  }
+  if (res == ESP_OK) res = httpd_resp_send_chunk(req, NULL, 0);
+
+  uint32_t elapsedMs = (uint32_t)((esp_timer_get_time() - startUs) / 1000);
+  log_i("Export: %u files (%u skipped), %llu bytes in %ums",
+        result->files, result->skipped, (unsigned long long)result->bytes, elapsedMs);
+
+  mem_free(MEM_EXPORT, header);
+  return res;
+}
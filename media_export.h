@@ -0,0 +1,43 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Streaming TAR Export (media_export.h)
+ * =============================================================
+ *  Sends a selection of media files as one uncompressed ustar
+ *  archive. The archive is built while it is sent: headers come
+ *  from file metadata, bodies go through the sd_stream read-
+ *  ahead pipeline. Nothing is written to the card, and nothing
+ *  limits how many files one archive holds.
+ * =============================================================
+ */
+#ifndef MEDIA_EXPORT_H
+#define MEDIA_EXPORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_http_server.h"
+
+#define EXPORT_NAME_LEN    48
+#define TAR_BLOCK          512
+
+// Selection: either `names` (comma separated, modified in place) or the range
+typedef struct {
+  char *names;
+  const char *from;         // inclusive, NULL/"" = open
+  const char *to;           // inclusive, NULL/"" = open
+  const char *skip;         // never export (active recording), may be NULL
+  void (*progress)(void *arg, uint32_t done, uint32_t total);  // after each file, may be NULL
+  void *progressArg;
+} export_request_t;
+
+typedef struct {
+  uint32_t files;
+  uint32_t skipped;         // vanished or unreadable before their header was sent
+  uint64_t bytes;           // archive bytes sent
+} export_result_t;
+
+// Send the archive as the (chunked) response body, including the
+// terminating chunk. Content-Type/Disposition must be set by the caller.
+esp_err_t media_export_send(httpd_req_t *req, export_request_t *sel, export_result_t *result);
+
+#endif  // MEDIA_EXPORT_H
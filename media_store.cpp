@@ -0,0 +1,401 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Sharded Media Layout (media_store.cpp)
+ * =============================================================
+ *  Counters: at boot only the highest buckets are scanned to
+ *  find where numbering left off. media_next_name() also skips
+ *  any name that already exists (in its bucket or, while the
+ *  migration is running, in "/"), so a short scan can never
+ *  cause an existing file to be overwritten.
+ * =============================================================
+ */
+
+#include "media_store.h"
+#include "task_config.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "FS.h"
+#include "SD_MMC.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define MEDIA_MAX_BUCKETS      256   // 256k files per prefix
+#define MEDIA_MAX_PREFIXES     6
+#define MEDIA_SCAN_BUCKETS     3     // buckets scanned at boot for counters
+#define MEDIA_MIGRATE_BATCH    32
+
+typedef struct {
+  char prefix[16];
+  uint32_t max;
+} media_counter_t;
+
+static media_counter_t counters[MEDIA_MAX_PREFIXES];
+static SemaphoreHandle_t storeLock = NULL;
+static int readyBucket = -1;               // last bucket dir known to exist
+static volatile uint32_t pendingMigration = 0;
+
+// ==================================================================
+//  Name helpers
+// ==================================================================
+static const char *base_name(const char *path) {
+  const char *slash = strrchr(path, '/');
+  return slash ? slash + 1 : path;
+}
+
+static bool ends_with_ci(const char *s, const char *suffix) {
+  size_t ls = strlen(s), lx = strlen(suffix);
+  return ls >= lx && strcasecmp(s + ls - lx, suffix) == 0;
+}
+
+bool media_is_media_name(const char *name) {
+  return ends_with_ci(name, ".jpg") || ends_with_ci(name, ".mjpeg");
+}
+
+// Split "trinetra_01234.jpg" into prefix length 9 and counter 1234
+static bool parse_counter(const char *name, size_t *prefixLen, uint32_t *value) {
+  const char *dot = strrchr(name, '.');
+  if (!dot) return false;
+  const char *p = dot;
+  while (p > name && p[-1] >= '0' && p[-1] <= '9') p--;
+  if (p == dot) return false;
+  *prefixLen = p - name;
+  *value = strtoul(p, NULL, 10);
+  return true;
+}
+
+int media_bucket_of(const char *name) {
+  size_t prefixLen;
+  uint32_t value;
+  if (!parse_counter(base_name(name), &prefixLen, &value)) return -1;
+  uint32_t bucket = value / MEDIA_BUCKET_SIZE;
+  return bucket < MEDIA_MAX_BUCKETS ? (int)bucket : -1;
+}
+
+static void bucket_dir(int bucket, char *out, size_t outLen) {
+  snprintf(out, outLen, MEDIA_ROOT "/b%03d", bucket);
+}
+
+// ==================================================================
+//  Counters
+// ==================================================================
+static media_counter_t *counter_for(const char *prefix, size_t len, bool create) {
+  for (int i = 0; i < MEDIA_MAX_PREFIXES; i++) {
+    if (counters[i].prefix[0] && strlen(counters[i].prefix) == len &&
+        strncmp(counters[i].prefix, prefix, len) == 0) {
+      return &counters[i];
+    }
+  }
+  if (!create || len >= sizeof(counters[0].prefix)) return NULL;
+  for (int i = 0; i < MEDIA_MAX_PREFIXES; i++) {
+    if (!counters[i].prefix[0]) {
+      memcpy(counters[i].prefix, prefix, len);
+      counters[i].prefix[len] = '\0';
+      return &counters[i];
+    }
+  }
+  return NULL;
+}
+
+static void note_counter(const char *name) {
+  size_t prefixLen;
+  uint32_t value;
+  if (!media_is_media_name(name) || !parse_counter(name, &prefixLen, &value)) return;
+  xSemaphoreTake(storeLock, portMAX_DELAY);
+  media_counter_t *c = counter_for(name, prefixLen, true);
+  if (c && value > c->max) c->max = value;
+  xSemaphoreGive(storeLock);
+}
+
+uint32_t media_max_counter(const char *prefix) {
+  if (!storeLock) return 0;
+  xSemaphoreTake(storeLock, portMAX_DELAY);
+  media_counter_t *c = counter_for(prefix, strlen(prefix), false);
+  uint32_t max = c ? c->max : 0;
+  xSemaphoreGive(storeLock);
+  return max;
+}
+
+// ==================================================================
+//  Paths
+// ==================================================================
+bool media_create_path(const char *name, char *out, size_t outLen) {
+  name = base_name(name);
+  int bucket = media_bucket_of(name);
+  if (bucket < 0) {
+    snprintf(out, outLen, "/%s", name);
+    return true;
+  }
+
+  char dir[24];
+  bucket_dir(bucket, dir, sizeof(dir));
+  if (bucket != readyBucket) {
+    if (!SD_MMC.exists(dir) && !SD_MMC.mkdir(dir)) {
+      log_e("Media: cannot create %s", dir);
+      return false;
+    }
+    readyBucket = bucket;
+  }
+  snprintf(out, outLen, "%s/%s", dir, name);
+  return true;
+}
+
+bool media_resolve(const char *name, char *out, size_t outLen) {
+  if (name[0] == '/') name++;
+  if (strchr(name, '/')) {  // explicit directory given
+    snprintf(out, outLen, "/%s", name);
+    return SD_MMC.exists(out);
+  }
+
+  int bucket = media_bucket_of(name);
+  if (bucket >= 0) {
+    char dir[24];
+    bucket_dir(bucket, dir, sizeof(dir));
+    snprintf(out, outLen, "%s/%s", dir, name);
+    if (SD_MMC.exists(out)) return true;
+  }
+
+  // Legacy location (not migrated yet, or a name without a counter)
+  snprintf(out, outLen, "/%s", name);
+  return SD_MMC.exists(out);
+}
+
+bool media_next_name(const char *prefix, const char *ext, char *out, size_t outLen) {
+  if (!storeLock) return false;
+  char path[MEDIA_PATH_MAX];
+
+  xSemaphoreTake(storeLock, portMAX_DELAY);
+  media_counter_t *c = counter_for(prefix, strlen(prefix), true);
+  bool ok = c != NULL;
+  while (ok) {
+    uint32_t next = c->max + 1;
+    snprintf(out, outLen, "%s%05lu%s", prefix, (unsigned long)next, ext);
+    c->max = next;
+    if (!media_resolve(out, path, sizeof(path))) break;  // name is free
+  }
+  xSemaphoreGive(storeLock);
+  return ok;
+}
+
+// ==================================================================
+//  Directory walks
+// ==================================================================
+// Visit media files of one directory; returns false if the visitor stopped
+static bool walk_dir(const char *dirPath, media_visit_fn visit, void *arg) {
+  File dir = SD_MMC.open(dirPath);
+  if (!dir) return true;
+
+  bool keepGoing = true;
+  char path[MEDIA_PATH_MAX];
+  File file = dir.openNextFile();
+  while (file && keepGoing) {
+    if (!file.isDirectory()) {
+      const char *name = base_name(file.name());
+      if (media_is_media_name(name)) {
+        snprintf(path, sizeof(path), "%s/%s", strcmp(dirPath, "/") ? dirPath : "", name);
+        keepGoing = visit(name, path, file.size(), file.getLastWrite(), arg);
+      }
+    }
+    file = dir.openNextFile();
+  }
+  dir.close();
+  return keepGoing;
+}
+
+// Collect bucket numbers present under MEDIA_ROOT, sorted ascending
+static int list_buckets(uint8_t *present) {
+  memset(present, 0, MEDIA_MAX_BUCKETS);
+  File root = SD_MMC.open(MEDIA_ROOT);
+  if (!root) return 0;
+  int count = 0;
+  File entry = root.openNextFile();
+  while (entry) {
+    const char *name = base_name(entry.name());
+    if (entry.isDirectory() && name[0] == 'b') {
+      int b = atoi(name + 1);
+      if (b >= 0 && b < MEDIA_MAX_BUCKETS && !present[b]) {
+        present[b] = 1;
+        count++;
+      }
+    }
+    entry = root.openNextFile();
+  }
+  root.close();
+  return count;
+}
+
+void media_for_each(media_visit_fn visit, void *arg) {
+  if (!walk_dir("/", visit, arg)) return;
+
+  uint8_t present[MEDIA_MAX_BUCKETS];
+  list_buckets(present);
+  char dir[24];
+  for (int b = 0; b < MEDIA_MAX_BUCKETS; b++) {
+    if (!present[b]) continue;
+    bucket_dir(b, dir, sizeof(dir));
+    if (!walk_dir(dir, visit, arg)) return;
+  }
+}
+
+// ==================================================================
+//  Background migration of legacy root files
+// ==================================================================
+static bool note_visit(const char *name, const char *path, size_t size, time_t mtime, void *arg) {
+  note_counter(name);
+  return true;
+}
+
+static void migrate_task(void *arg) {
+  char names[MEDIA_MIGRATE_BATCH][40];
+  char from[MEDIA_PATH_MAX];
+  char to[MEDIA_PATH_MAX];
+  uint32_t moved = 0;
+
+  // Counters first, so new captures skip past legacy numbers
+  walk_dir("/", note_visit, NULL);
+
+  while (true) {
+    // Collect a batch of names (don't rename while the directory is open)
+    int n = 0;
+    uint32_t seen = 0;
+    File root = SD_MMC.open("/");
+    if (!root) break;
+    File file = root.openNextFile();
+    while (file) {
+      const char *name = base_name(file.name());
+      if (!file.isDirectory() && media_is_media_name(name) && media_bucket_of(name) >= 0) {
+        seen++;
+        if (n < MEDIA_MIGRATE_BATCH && strlen(name) < sizeof(names[0])) strcpy(names[n++], name);
+      }
+      file = root.openNextFile();
+    }
+    root.close();
+    pendingMigration = seen;
+    if (n == 0) break;
+
+    int movedThisBatch = 0;
+    for (int i = 0; i < n; i++) {
+      snprintf(from, sizeof(from), "/%s", names[i]);
+      xSemaphoreTake(storeLock, portMAX_DELAY);
+      bool ok = media_create_path(names[i], to, sizeof(to)) && !SD_MMC.exists(to) &&
+                SD_MMC.rename(from, to);
+      xSemaphoreGive(storeLock);
+      if (ok) {
+        moved++;
+        movedThisBatch++;
+      } else {
+        log_w("Media: left %s in / (target exists or rename failed)", from);
+      }
+      vTaskDelay(1);
+    }
+    if (movedThisBatch == 0) break;  // everything left is stuck; don't spin
+  }
+
+  pendingMigration = 0;
+  log_i("Media: migration finished, %u files moved", moved);
+  vTaskDelete(NULL);
+}
+
+// ==================================================================
+//  Init
+// ==================================================================
+void media_store_init() {
+  if (!storeLock) storeLock = xSemaphoreCreateMutex();
+  if (!SD_MMC.exists(MEDIA_ROOT)) SD_MMC.mkdir(MEDIA_ROOT);
+
+  // Numbering continues from the highest buckets
+  uint8_t present[MEDIA_MAX_BUCKETS];
+  list_buckets(present);
+  char dir[24];
+  int scanned = 0;
+  for (int b = MEDIA_MAX_BUCKETS - 1; b >= 0 && scanned < MEDIA_SCAN_BUCKETS; b--) {
+    if (!present[b]) continue;
+    bucket_dir(b, dir, sizeof(dir));
+    walk_dir(dir, note_visit, NULL);
+    scanned++;
+  }
+
+  xTaskCreatePinnedToCore(migrate_task, "media_migrate", TASK_MEDIA_MIGRATE_STACK, NULL,
+                          TASK_MEDIA_MIGRATE_PRIO, NULL, TASK_MEDIA_MIGRATE_CORE);
+}
+
+uint32_t media_pending_migration() {
+  return pendingMigration;
+}
+
+// ==================================================================
+//  File-create latency benchmark
+// ==================================================================
+#define MEDIA_BENCH_DIR "/bench_fs"
+
+static void bench_file_path(uint32_t i, bool sharded, char *out, size_t outLen) {
+  if (sharded) {
+    snprintf(out, outLen, MEDIA_BENCH_DIR "/b%03lu/f%05lu.tmp",
+             (unsigned long)(i / MEDIA_BUCKET_SIZE), (unsigned long)i);
+  } else {
+    snprintf(out, outLen, MEDIA_BENCH_DIR "/f%05lu.tmp", (unsigned long)i);
+  }
+}
+
+size_t media_bench_create(uint32_t count, bool sharded, uint32_t window,
+                          media_bench_point_t *points, size_t maxPoints,
+                          void (*progress)(void *arg, uint32_t done, uint32_t total), void *arg) {
+  char path[MEDIA_PATH_MAX];
+  char dir[32];
+  size_t nPoints = 0;
+  uint64_t windowSum = 0;
+  uint32_t windowMax = 0;
+  uint32_t created = 0;
+
+  if (window == 0) window = 100;
+  if (!SD_MMC.exists(MEDIA_BENCH_DIR)) SD_MMC.mkdir(MEDIA_BENCH_DIR);
+
+  for (uint32_t i = 0; i < count; i++) {
+    if (sharded && i % MEDIA_BUCKET_SIZE == 0) {
+      snprintf(dir, sizeof(dir), MEDIA_BENCH_DIR "/b%03lu", (unsigned long)(i / MEDIA_BUCKET_SIZE));
+      SD_MMC.mkdir(dir);
+    }
+    bench_file_path(i, sharded, path, sizeof(path));
+
+    int64_t t0 = esp_timer_get_time();
+    File f = SD_MMC.open(path, FILE_WRITE);
+    if (!f) break;
+    f.close();
+    uint32_t us = (uint32_t)(esp_timer_get_time() - t0);
+    created++;
+
+    windowSum += us;
+    if (us > windowMax) windowMax = us;
+    if (created % window == 0 && nPoints < maxPoints) {
+      points[nPoints].files = created;
+      points[nPoints].avg_us = (uint32_t)(windowSum / window);
+      points[nPoints].max_us = windowMax;
+      nPoints++;
+      windowSum = 0;
+      windowMax = 0;
+    }
+    if (i % 50 == 0) {
+      if (progress) progress(arg, created, count);
+      vTaskDelay(1);  // let the watchdog and other tasks run
+    }
+  }
+
+  // Clean up scratch files (not timed)
+  for (uint32_t i = 0; i < created; i++) {
+    bench_file_path(i, sharded, path, sizeof(path));
+    SD_MMC.remove(path);
+    if (i % 50 == 0) vTaskDelay(1);
+  }
+  if (sharded) {
+    for (uint32_t b = 0; b * MEDIA_BUCKET_SIZE < created; b++) {
+      snprintf(dir, sizeof(dir), MEDIA_BENCH_DIR "/b%03lu", (unsigned long)b);
+      SD_MMC.rmdir(dir);
+    }
+  }
+  SD_MMC.rmdir(MEDIA_BENCH_DIR);
+  return nPoints;
+}
@@ -0,0 +1,79 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Sharded Media Layout (media_store.h)
+ * =============================================================
+ *  FAT directory lookups are linear, so a card with thousands
+ *  of files in "/" gets slower at every open, create and list.
+ *  Media is stored in buckets of MEDIA_BUCKET_SIZE counter
+ *  values instead:
+ *
+ *    trinetra_01234.jpg  ->  /media/b001/trinetra_01234.jpg
+ *    video_00007.mjpeg   ->  /media/b000/video_00007.mjpeg
+ *
+ *  Clients keep using bare file names; the bucket is derived
+ *  from the number in the name. Files left in "/" by older
+ *  firmware are moved into their buckets by a background task.
+ * =============================================================
+ */
+#ifndef MEDIA_STORE_H
+#define MEDIA_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MEDIA_ROOT          "/media"
+#define MEDIA_BUCKET_SIZE   1000
+#define MEDIA_PATH_MAX      64
+
+// Called once per media file; return false to stop the walk
+typedef bool (*media_visit_fn)(const char *name, const char *path,
+                               size_t size, time_t mtime, void *arg);
+
+// Create MEDIA_ROOT, find the highest used counters, start migration
+void media_store_init();
+
+// Highest counter found on the card for a name prefix ("trinetra_", "video_")
+uint32_t media_max_counter(const char *prefix);
+
+// Bucket number for a file name, or -1 if it carries no counter
+int media_bucket_of(const char *name);
+
+// Allocate the next unused name, e.g. ("trinetra_", ".jpg") -> "trinetra_00042.jpg"
+bool media_next_name(const char *prefix, const char *ext, char *out, size_t outLen);
+
+// Path a new file with this name should be written to (bucket dir is created)
+bool media_create_path(const char *name, char *out, size_t outLen);
+
+// Path of an existing file: its bucket first, then the legacy root.
+// Names that already contain a directory are returned unchanged.
+bool media_resolve(const char *name, char *out, size_t outLen);
+
+// Visit every photo/video (legacy root first, then buckets in order)
+void media_for_each(media_visit_fn visit, void *arg);
+
+// True for the extensions the gallery shows (.jpg, .mjpeg)
+bool media_is_media_name(const char *name);
+
+// Files still waiting in "/" for the background migration
+uint32_t media_pending_migration();
+
+// ==================================================================
+//  File-create latency benchmark
+// ==================================================================
+typedef struct {
+  uint32_t files;     // directory population when the window ended
+  uint32_t avg_us;
+  uint32_t max_us;
+} media_bench_point_t;
+
+// Create `count` empty files in a scratch directory, either all in one
+// directory or sharded like real media, sampling create latency per
+// `window` files. Scratch files are removed afterwards.
+// progress(arg, files created, count) may be NULL.
+size_t media_bench_create(uint32_t count, bool sharded, uint32_t window,
+                          media_bench_point_t *points, size_t maxPoints,
+                          void (*progress)(void *arg, uint32_t done, uint32_t total), void *arg);
+
+#endif  // MEDIA_STORE_H
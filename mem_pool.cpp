@@ -0,0 +1,305 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Fixed-Block Pools (mem_pool.cpp)
+ * =============================================================
+ *  A set bit in freeMask is a free block. get() clears the
+ *  lowest set bit with a CAS, put() sets it again with an
+ *  atomic OR; ownership of a pointer is a range check, so
+ *  pool_free() needs no header in front of the block.
+ * =============================================================
+ */
+
+#include "mem_pool.h"
+#include <atomic>
+#include <string.h>
+#include "metrics.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define POOL_ALIGN 16    // block size granularity (DMA and cache friendly)
+
+struct mem_pool {
+  const char *name;
+  uint8_t *base;
+  size_t blockSize;
+  uint8_t blocks;
+  bool sizeClass;
+  std::atomic<uint32_t> freeMask;
+  std::atomic<uint32_t> hits;
+  std::atomic<uint32_t> misses;
+  std::atomic<uint32_t> peak;       // most blocks in use at once
+};
+
+static mem_pool_t pools[MEM_POOL_MAX];
+static std::atomic<uint8_t> poolCount(0);
+static std::atomic<uint32_t> oversize(0);   // pool_alloc() requests above every class
+static mem_pool_t *benchSmall = NULL;       // size classes again, used only by the benchmark
+static mem_pool_t *benchMedium = NULL;
+
+// ==================================================================
+//  Pools
+// ==================================================================
+mem_pool_t *mem_pool_create(const char *name, size_t blockSize, uint8_t blocks,
+                            uint32_t caps, uint32_t fallback, bool sizeClass) {
+  uint8_t n = poolCount.load(std::memory_order_relaxed);
+  if (n >= MEM_POOL_MAX || blocks == 0 || blocks > 32 || blockSize == 0) return NULL;
+  blockSize = (blockSize + POOL_ALIGN - 1) & ~(size_t)(POOL_ALIGN - 1);
+
+  uint8_t *base = (uint8_t *)mem_alloc_caps(MEM_POOL, blockSize * blocks, caps, fallback);
+  if (!base) {
+    log_w("Pool %s: no memory for %u x %u bytes", name, blocks, (unsigned)blockSize);
+    return NULL;
+  }
+
+  mem_pool_t *p = &pools[n];
+  p->name = name;
+  p->base = base;
+  p->blockSize = blockSize;
+  p->blocks = blocks;
+  p->sizeClass = sizeClass;
+  p->freeMask.store(blocks == 32 ? UINT32_MAX : (1u << blocks) - 1, std::memory_order_relaxed);
+  poolCount.store(n + 1, std::memory_order_release);  // visible only once complete
+  log_i("Pool %s: %u x %u bytes", name, blocks, (unsigned)blockSize);
+  return p;
+}
+
+void mem_pool_init() {
+  mem_pool_create("small", POOL_SMALL_BLOCK, POOL_SMALL_COUNT,
+                  MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, 0, true);
+  mem_pool_create("medium", POOL_MEDIUM_BLOCK, POOL_MEDIUM_COUNT, MEM_PSRAM, MALLOC_CAP_DEFAULT, true);
+  // Same geometry; get/put cost does not depend on where the blocks live
+  benchSmall = mem_pool_create("bench-small", POOL_SMALL_BLOCK, POOL_SMALL_COUNT, MEM_PSRAM,
+                               MALLOC_CAP_DEFAULT, false);
+  benchMedium = mem_pool_create("bench-medium", POOL_MEDIUM_BLOCK, POOL_MEDIUM_COUNT, MEM_PSRAM,
+                                MALLOC_CAP_DEFAULT, false);
+}
+
+static void *take(mem_pool_t *p) {
+  uint32_t mask = p->freeMask.load(std::memory_order_relaxed);
+  while (mask) {
+    uint32_t bit = mask & (~mask + 1);
+    if (p->freeMask.compare_exchange_weak(mask, mask & ~bit, std::memory_order_acquire,
+                                          std::memory_order_relaxed)) {
+      uint32_t used = p->blocks - __builtin_popcount(mask & ~bit);
+      uint32_t peak = p->peak.load(std::memory_order_relaxed);
+      while (used > peak && !p->peak.compare_exchange_weak(peak, used, std::memory_order_relaxed)) {
+      }
+      p->hits.fetch_add(1, std::memory_order_relaxed);
+      return p->base + __builtin_ctz(bit) * p->blockSize;
+    }
+  }
+  return NULL;
+}
+
+static bool owns(const mem_pool_t *p, const void *ptr) {
+  const uint8_t *b = (const uint8_t *)ptr;
+  return b >= p->base && b < p->base + p->blockSize * p->blocks;
+}
+
+void *mem_pool_get(mem_pool_t *pool) {
+  if (!pool) return NULL;
+  void *ptr = take(pool);
+  if (!ptr) pool->misses.fetch_add(1, std::memory_order_relaxed);
+  return ptr;
+}
+
+size_t mem_pool_block_size(const mem_pool_t *pool) {
+  return pool ? pool->blockSize : 0;
+}
+
+void *pool_alloc(mem_tag_t tag, size_t size) {
+  uint8_t n = poolCount.load(std::memory_order_acquire);
+  mem_pool_t *first = NULL;
+  for (uint8_t i = 0; i < n; i++) {
+    mem_pool_t *p = &pools[i];
+    if (!p->sizeClass || p->blockSize < size) continue;
+    if (!first) first = p;
+    void *ptr = take(p);   // a full class spills into the next larger one
+    if (ptr) return ptr;
+  }
+  if (first) first->misses.fetch_add(1, std::memory_order_relaxed);
+  else oversize.fetch_add(1, std::memory_order_relaxed);
+  return mem_alloc(tag, size);
+}
+
+void pool_free(mem_tag_t tag, void *ptr) {
+  if (!ptr) return;
+  uint8_t n = poolCount.load(std::memory_order_acquire);
+  for (uint8_t i = 0; i < n; i++) {
+    mem_pool_t *p = &pools[i];
+    if (!owns(p, ptr)) continue;
+    uint32_t index = ((uint8_t *)ptr - p->base) / p->blockSize;
+    p->freeMask.fetch_or(1u << index, std::memory_order_release);
+    return;
+  }
+  mem_free(tag, ptr);
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+void mem_pool_report(json_writer_t *w) {
+  uint8_t n = poolCount.load(std::memory_order_acquire);
+  jw_arr_open(w, "pools");
+  for (uint8_t i = 0; i < n; i++) {
+    const mem_pool_t *p = &pools[i];
+    uint32_t hits = p->hits.load(std::memory_order_relaxed);
+    uint32_t misses = p->misses.load(std::memory_order_relaxed);
+    jw_obj_open(w);
+    jw_str(w, "name", p->name);
+    jw_uint(w, "block", p->blockSize);
+    jw_uint(w, "blocks", p->blocks);
+    jw_uint(w, "in_use", p->blocks - __builtin_popcount(p->freeMask.load(std::memory_order_relaxed)));
+    jw_uint(w, "peak", p->peak.load(std::memory_order_relaxed));
+    jw_uint(w, "hits", hits);
+    jw_uint(w, "misses", misses);
+    if (hits + misses) jw_float(w, "hit_rate", (float)hits / (hits + misses), 3);
+    else jw_null(w, "hit_rate");
+    jw_obj_close(w);
+  }
+  jw_arr_close(w);
+  jw_uint(w, "pool_oversize", oversize.load(std::memory_order_relaxed));
+}
+
+void mem_pool_metrics(json_writer_t *w) {
+  uint8_t n = poolCount.load(std::memory_order_acquire);
+  char labels[32];
+  metrics_family(w, "trinetra_pool_hits_total", "counter", "Blocks served by each pool");
+  for (uint8_t i = 0; i < n; i++) {
+    snprintf(labels, sizeof(labels), "pool=\"%s\"", pools[i].name);
+    metrics_value(w, "trinetra_pool_hits_total", labels, pools[i].hits.load(std::memory_order_relaxed));
+  }
+  metrics_family(w, "trinetra_pool_misses_total", "counter", "Requests a full pool sent to the heap");
+  for (uint8_t i = 0; i < n; i++) {
+    snprintf(labels, sizeof(labels), "pool=\"%s\"", pools[i].name);
+    metrics_value(w, "trinetra_pool_misses_total", labels, pools[i].misses.load(std::memory_order_relaxed));
+  }
+  metrics_family(w, "trinetra_pool_blocks_in_use", "gauge", "Blocks currently handed out");
+  for (uint8_t i = 0; i < n; i++) {
+    snprintf(labels, sizeof(labels), "pool=\"%s\"", pools[i].name);
+    uint32_t used = pools[i].blocks - __builtin_popcount(pools[i].freeMask.load(std::memory_order_relaxed));
+    metrics_value(w, "trinetra_pool_blocks_in_use", labels, used);
+  }
+}
+
+// ==================================================================
+//  Benchmark
+// ==================================================================
+// A window of live buffers with request-like sizes: most are query
+// strings and form bodies, some exceed every class. Four slots are
+// long-lived and only rarely replaced, which is what strands holes
+// between short-lived blocks on a shared heap. Both passes replay
+// the same seeded sequence.
+#define BENCH_SLOTS      16
+#define BENCH_LONG_LIVED 4
+
+static uint32_t xorshift(uint32_t *s) {
+  uint32_t x = *s;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *s = x;
+}
+
+static size_t bench_size(uint32_t r) {
+  uint32_t kind = r % 100;
+  r >>= 8;
+  if (kind < 50) return 24 + r % (POOL_SMALL_BLOCK - 24);                           // query string
+  if (kind < 85) return POOL_SMALL_BLOCK + 1 + r % (POOL_MEDIUM_BLOCK - POOL_SMALL_BLOCK);  // form body
+  return POOL_MEDIUM_BLOCK + 1 + r % 4096;                                           // oversize
+}
+
+// pool_alloc() over the bench copies of the size classes
+static void *bench_alloc(size_t size) {
+  mem_pool_t *classes[2] = { benchSmall, benchMedium };
+  mem_pool_t *first = NULL;
+  for (mem_pool_t *p : classes) {
+    if (!p || p->blockSize < size) continue;
+    if (!first) first = p;
+    void *ptr = take(p);
+    if (ptr) return ptr;
+  }
+  if (first) first->misses.fetch_add(1, std::memory_order_relaxed);
+  return mem_alloc(MEM_BENCH, size);
+}
+
+static uint32_t bench_hits() {
+  uint32_t hits = 0;
+  if (benchSmall) hits += benchSmall->hits.load(std::memory_order_relaxed);
+  if (benchMedium) hits += benchMedium->hits.load(std::memory_order_relaxed);
+  return hits;
+}
+
+static void bench_pass(uint32_t ops, bool usePools, mem_pool_bench_pass_t *out) {
+  void *live[BENCH_SLOTS] = {};
+  uint64_t allocCycles = 0, freeCycles = 0;
+  uint32_t allocMax = 0, freeMax = 0, allocs = 0, frees = 0;
+  uint32_t seed = 0x9E3779B9;
+  uint32_t ticksPerUs = esp_rom_get_cpu_ticks_per_us();
+  uint32_t hitsBefore = bench_hits();
+
+  memset(out, 0, sizeof(*out));
+  out->largestBefore = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+  for (uint32_t op = 0; op < ops; op++) {
+    uint32_t r = xorshift(&seed);
+    uint8_t slot = r % BENCH_SLOTS;
+    if (slot < BENCH_LONG_LIVED && (r >> 8) % 16) slot = BENCH_LONG_LIVED + (r >> 12) % (BENCH_SLOTS - BENCH_LONG_LIVED);
+    size_t size = bench_size(xorshift(&seed));
+
+    if (live[slot]) {
+      uint32_t t0 = esp_cpu_get_cycle_count();
+      if (usePools) pool_free(MEM_BENCH, live[slot]);
+      else mem_free(MEM_BENCH, live[slot]);
+      uint32_t dt = esp_cpu_get_cycle_count() - t0;
+      freeCycles += dt;
+      if (dt > freeMax) freeMax = dt;
+      frees++;
+      live[slot] = NULL;
+    }
+
+    uint32_t t0 = esp_cpu_get_cycle_count();
+    void *ptr = usePools ? bench_alloc(size) : mem_alloc(MEM_BENCH, size);
+    uint32_t dt = esp_cpu_get_cycle_count() - t0;
+    allocCycles += dt;
+    if (dt > allocMax) allocMax = dt;
+    allocs++;
+    if (ptr) {
+      memset(ptr, (uint8_t)op, size < 64 ? size : 64);  // touch it like a real user would
+      live[slot] = ptr;
+    } else {
+      out->failures++;
+    }
+  }
+
+  out->largestLoaded = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  out->freeLoaded = heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  for (uint8_t i = 0; i < BENCH_SLOTS; i++) {
+    if (!live[i]) continue;
+    if (usePools) pool_free(MEM_BENCH, live[i]);
+    else mem_free(MEM_BENCH, live[i]);
+  }
+
+  if (usePools) out->hits = bench_hits() - hitsBefore;
+  out->allocAvgNs = allocs ? (uint32_t)(allocCycles * 1000 / ticksPerUs / allocs) : 0;
+  out->allocMaxNs = (uint32_t)((uint64_t)allocMax * 1000 / ticksPerUs);
+  out->freeAvgNs = frees ? (uint32_t)(freeCycles * 1000 / ticksPerUs / frees) : 0;
+  out->freeMaxNs = (uint32_t)((uint64_t)freeMax * 1000 / ticksPerUs);
+}
+
+bool mem_pool_bench(uint32_t ops, mem_pool_bench_t *out) {
+  static std::atomic<bool> running(false);
+  if (running.exchange(true)) return false;   // the bench pools hold one run's live set
+  if (ops == 0) ops = MEM_POOL_BENCH_OPS;
+  if (ops > MEM_POOL_BENCH_MAX_OPS) ops = MEM_POOL_BENCH_MAX_OPS;
+  out->ops = ops;
+  bench_pass(ops, false, &out->heap);
+  bench_pass(ops, true, &out->pool);
+  running.store(false);
+  return out->heap.failures < ops && out->pool.failures < ops;
+}
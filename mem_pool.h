@@ -0,0 +1,96 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Fixed-Block Pools (mem_pool.h)
+ * =============================================================
+ *  Per-request and per-frame buffers come from pools carved
+ *  once at boot instead of the system heap, so the hot paths
+ *  neither pay for a heap walk nor leave holes between
+ *  long-lived blocks. Each pool is one contiguous region split
+ *  into up to 32 equal blocks; a free bitmap taken with one
+ *  compare-and-swap hands them out, so get/put never block.
+ *
+ *  Two kinds of pool:
+ *    size classes  pool_alloc(tag, size) picks the smallest class
+ *                  the request fits with a free block (query
+ *                  strings, form bodies)
+ *    dedicated     owned by one user through its handle, e.g.
+ *                  the SD read-ahead ring or JPEG conversion
+ *
+ *  Anything a pool cannot serve falls back to the heap under
+ *  the caller's mem_track tag; pool_free() sends each block back
+ *  where it came from. Hits and misses per pool are on /mem.
+ * =============================================================
+ */
+#ifndef MEM_POOL_H
+#define MEM_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "mem_track.h"
+#include "json_writer.h"
+
+#define MEM_POOL_MAX          8
+
+// Size classes, carved by mem_pool_init()
+#define POOL_SMALL_BLOCK      256     // query strings, short forms (internal RAM)
+#define POOL_SMALL_COUNT      16
+#define POOL_MEDIUM_BLOCK     2048    // longer form bodies (PSRAM, else internal)
+#define POOL_MEDIUM_COUNT     6
+
+#define MEM_POOL_BENCH_OPS      2000
+#define MEM_POOL_BENCH_MAX_OPS  20000
+
+typedef struct mem_pool mem_pool_t;
+
+// Carve `blocks` (1-32) blocks of `blockSize` bytes from `caps`, else
+// `fallback` (0 = none). Size-class pools must be created smallest
+// first. Create pools at boot, before the servers start; NULL when
+// the memory or the pool table is exhausted.
+mem_pool_t *mem_pool_create(const char *name, size_t blockSize, uint8_t blocks,
+                            uint32_t caps, uint32_t fallback, bool sizeClass);
+
+// Create the size classes, and their copies for /bench/alloc
+void mem_pool_init();
+
+// A free block, or NULL (counted as a miss). NULL pool -> NULL.
+void *mem_pool_get(mem_pool_t *pool);
+size_t mem_pool_block_size(const mem_pool_t *pool);
+
+// Size-class block if one fits, else mem_alloc(tag, size)
+void *pool_alloc(mem_tag_t tag, size_t size);
+
+// Return a block from any pool, or mem_free(tag, ptr) anything else
+void pool_free(mem_tag_t tag, void *ptr);
+
+// "pools":[...] for the /mem report
+void mem_pool_report(json_writer_t *w);
+
+// Hit/miss counters and blocks in use for /metrics
+void mem_pool_metrics(json_writer_t *w);
+
+// Same alloc/free sequence through the heap and through copies of
+// the size classes kept for the benchmark, so request traffic keeps
+// its pools and the hit count is the benchmark's own
+typedef struct {
+  uint32_t allocAvgNs;
+  uint32_t allocMaxNs;
+  uint32_t freeAvgNs;
+  uint32_t freeMaxNs;
+  uint32_t failures;
+  uint32_t hits;              // served by a bench pool (0 on the heap pass)
+  size_t largestBefore;       // largest internal block before the pass
+  size_t largestLoaded;       // ...with the pass's live set still held
+  size_t freeLoaded;
+} mem_pool_bench_pass_t;
+
+typedef struct {
+  uint32_t ops;
+  mem_pool_bench_pass_t heap;
+  mem_pool_bench_pass_t pool;
+} mem_pool_bench_t;
+
+// False if either pass failed every allocation, or a run is in progress
+bool mem_pool_bench(uint32_t ops, mem_pool_bench_t *out);
+
+#endif  // MEM_POOL_H
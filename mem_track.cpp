@@ -0,0 +1,251 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Memory Accounting (mem_track.cpp)
+ * =============================================================
+ *  Tag counters are relaxed 32-bit atomics, like the metrics
+ *  instruments: allocating from any task costs a few adds on
+ *  top of the heap call. The largest-block low-water mark is
+ *  sampled (every MEM_SAMPLE_MS and on each report), so a dip
+ *  shorter than the interval can be missed; the heap's own
+ *  minimum-free counter is exact.
+ * =============================================================
+ */
+
+#include "mem_track.h"
+#include <atomic>
+#include <string.h>
+#include "esp_timer.h"
+#include "events.h"
+#include "metrics.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef struct {
+  std::atomic<uint32_t> bytes;
+  std::atomic<uint32_t> blocks;
+  std::atomic<uint32_t> peak;
+  std::atomic<uint32_t> allocs;
+  std::atomic<uint32_t> fails;
+} mem_tag_stats_t;
+
+static const char *const tagNames[] = {
+  "http", "stream", "download", "thumbs", "sd_writer", "burst", "jobs",
+  "delete", "export", "state", "events", "bench", "motion", "scene", "system", "pool"
+};
+static_assert(sizeof(tagNames) / sizeof(tagNames[0]) == MEM_TAG_COUNT, "one name per tag");
+
+static mem_tag_stats_t tags[MEM_TAG_COUNT];
+
+typedef struct {
+  const char *name;
+  uint32_t caps;
+} mem_heap_t;
+
+static const mem_heap_t heaps[] = {
+  { "internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+  { "dma",      MALLOC_CAP_DMA },
+  { "psram",    MALLOC_CAP_SPIRAM },
+};
+#define MEM_HEAPS (sizeof(heaps) / sizeof(heaps[0]))
+
+static std::atomic<uint32_t> minLargest[MEM_HEAPS];  // 0 = not sampled yet
+
+typedef struct {
+  size_t total;
+  size_t free;
+  size_t largest;
+  size_t minFree;
+  uint32_t minLargest;
+} heap_sample_t;
+
+// ==================================================================
+//  Tagged allocation
+// ==================================================================
+static void account(mem_tag_t tag, void *ptr) {
+  uint32_t size = heap_caps_get_allocated_size(ptr);
+  mem_tag_stats_t *t = &tags[tag];
+  uint32_t now = t->bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  t->blocks.fetch_add(1, std::memory_order_relaxed);
+  t->allocs.fetch_add(1, std::memory_order_relaxed);
+  uint32_t peak = t->peak.load(std::memory_order_relaxed);
+  while (now > peak && !t->peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {
+  }
+}
+
+void *mem_alloc_caps(mem_tag_t tag, size_t size, uint32_t caps, uint32_t fallback) {
+  if (size == 0) return NULL;
+  void *ptr = heap_caps_malloc(size, caps);
+  if (!ptr && fallback) ptr = heap_caps_malloc(size, fallback);
+  if (!ptr) {
+    tags[tag].fails.fetch_add(1, std::memory_order_relaxed);
+    log_w("Mem: %s could not get %u bytes (largest block %u)", tagNames[tag], (unsigned)size,
+          (unsigned)heap_caps_get_largest_free_block(fallback ? fallback : caps));
+    return NULL;
+  }
+  account(tag, ptr);
+  return ptr;
+}
+
+void *mem_calloc(mem_tag_t tag, size_t n, size_t size) {
+  if (size && n > SIZE_MAX / size) return NULL;
+  void *ptr = mem_alloc(tag, n * size);
+  if (ptr) memset(ptr, 0, n * size);
+  return ptr;
+}
+
+void mem_adopt(mem_tag_t tag, void *ptr) {
+  if (ptr) account(tag, ptr);
+}
+
+void mem_free(mem_tag_t tag, void *ptr) {
+  if (!ptr) return;
+  uint32_t size = heap_caps_get_allocated_size(ptr);
+  tags[tag].bytes.fetch_sub(size, std::memory_order_relaxed);
+  tags[tag].blocks.fetch_sub(1, std::memory_order_relaxed);
+  heap_caps_free(ptr);
+}
+
+// ==================================================================
+//  Heap sampling
+// ==================================================================
+static bool sample_heap(size_t i, heap_sample_t *s) {
+  s->total = heap_caps_get_total_size(heaps[i].caps);
+  if (!s->total) return false;  // e.g. no PSRAM on this board
+  s->free = heap_caps_get_free_size(heaps[i].caps);
+  s->largest = heap_caps_get_largest_free_block(heaps[i].caps);
+  s->minFree = heap_caps_get_minimum_free_size(heaps[i].caps);
+
+  uint32_t low = minLargest[i].load(std::memory_order_relaxed);
+  while ((low == 0 || s->largest < low) &&
+         !minLargest[i].compare_exchange_weak(low, s->largest, std::memory_order_relaxed)) {
+  }
+  s->minLargest = low == 0 || s->largest < low ? s->largest : low;
+  return true;
+}
+
+// Share of free memory that is not in the largest block, 0..1
+static float fragmentation(const heap_sample_t *s) {
+  return s->free ? 1.0f - (float)s->largest / s->free : 0;
+}
+
+// Edge-triggered on the internal heap, like the SD fill alert
+static void check_low(const heap_sample_t *internal) {
+  static bool alerted = false;
+  if (!alerted && internal->largest < MEM_LOW_BLOCK) {
+    log_w("Mem: largest internal block down to %u bytes (%u free)", (unsigned)internal->largest,
+          (unsigned)internal->free);
+    char json[96];
+    json_writer_t w;
+    jw_init(&w, json, sizeof(json), NULL);
+    jw_obj_open(&w);
+    jw_str(&w, "type", "mem_low");
+    jw_uint(&w, "largest", internal->largest);
+    jw_uint(&w, "free", internal->free);
+    jw_obj_close(&w);
+    if (jw_result(&w) > 0) events_publish("alert", json);
+    alerted = true;
+  } else if (alerted && internal->largest >= MEM_LOW_REARM) {
+    alerted = false;
+  }
+}
+
+void mem_track_poll() {
+  static int64_t lastUs = 0;
+  int64_t now = esp_timer_get_time();
+  if (lastUs && now - lastUs < MEM_SAMPLE_MS * 1000LL) return;
+  lastUs = now;
+
+  heap_sample_t s;
+  for (size_t i = 0; i < MEM_HEAPS; i++) {
+    if (sample_heap(i, &s) && i == 0) check_low(&s);
+  }
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+esp_err_t mem_send(httpd_req_t *req, void (*extra)(json_writer_t *w)) {
+  char buf[768];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+
+  jw_arr_open(&w, "heaps");
+  heap_sample_t s;
+  for (size_t i = 0; i < MEM_HEAPS; i++) {
+    if (!sample_heap(i, &s)) continue;
+    jw_obj_open(&w);
+    jw_str(&w, "name", heaps[i].name);
+    jw_uint(&w, "total", s.total);
+    jw_uint(&w, "free", s.free);
+    jw_uint(&w, "largest", s.largest);
+    jw_uint(&w, "min_free", s.minFree);
+    jw_uint(&w, "min_largest", s.minLargest);
+    jw_float(&w, "frag", fragmentation(&s));
+    jw_obj_close(&w);
+  }
+  jw_arr_close(&w);
+
+  uint32_t tracked = 0;
+  jw_arr_open(&w, "tags");
+  for (int i = 0; i < MEM_TAG_COUNT; i++) {
+    const mem_tag_stats_t *t = &tags[i];
+    uint32_t bytes = t->bytes.load(std::memory_order_relaxed);
+    tracked += bytes;
+    jw_obj_open(&w);
+    jw_str(&w, "name", tagNames[i]);
+    jw_uint(&w, "bytes", bytes);
+    jw_uint(&w, "blocks", t->blocks.load(std::memory_order_relaxed));
+    jw_uint(&w, "peak", t->peak.load(std::memory_order_relaxed));
+    jw_uint(&w, "allocs", t->allocs.load(std::memory_order_relaxed));
+    jw_uint(&w, "fails", t->fails.load(std::memory_order_relaxed));
+    jw_obj_close(&w);
+  }
+  jw_arr_close(&w);
+  jw_uint(&w, "tracked", tracked);
+  if (extra) extra(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
+
+void mem_track_metrics(json_writer_t *w) {
+  heap_sample_t samples[MEM_HEAPS];
+  bool present[MEM_HEAPS];
+  for (size_t i = 0; i < MEM_HEAPS; i++) present[i] = sample_heap(i, &samples[i]);
+
+  static const struct {
+    const char *name;
+    const char *help;
+  } heapGauges[] = {
+    { "trinetra_heap_largest_block_bytes", "Largest free block per heap" },
+    { "trinetra_heap_min_largest_block_bytes", "Lowest sampled largest free block since boot" },
+    { "trinetra_heap_fragmentation_ratio", "Free memory outside the largest block, 0..1" },
+  };
+  char labels[32];
+  for (size_t g = 0; g < sizeof(heapGauges) / sizeof(heapGauges[0]); g++) {
+    metrics_family(w, heapGauges[g].name, "gauge", heapGauges[g].help);
+    for (size_t i = 0; i < MEM_HEAPS; i++) {
+      if (!present[i]) continue;
+      const heap_sample_t *s = &samples[i];
+      snprintf(labels, sizeof(labels), "heap=\"%s\"", heaps[i].name);
+      double v = g == 0 ? s->largest : g == 1 ? s->minLargest : fragmentation(s);
+      metrics_value(w, heapGauges[g].name, labels, v);
+    }
+  }
+
+  metrics_family(w, "trinetra_mem_bytes", "gauge", "Live heap bytes per subsystem");
+  for (int i = 0; i < MEM_TAG_COUNT; i++) {
+    snprintf(labels, sizeof(labels), "tag=\"%s\"", tagNames[i]);
+    metrics_value(w, "trinetra_mem_bytes", labels, tags[i].bytes.load(std::memory_order_relaxed));
+  }
+  metrics_family(w, "trinetra_mem_alloc_failures_total", "counter", "Failed allocations per subsystem");
+  for (int i = 0; i < MEM_TAG_COUNT; i++) {
+    snprintf(labels, sizeof(labels), "tag=\"%s\"", tagNames[i]);
+    metrics_value(w, "trinetra_mem_alloc_failures_total", labels,
+                  tags[i].fails.load(std::memory_order_relaxed));
+  }
+}
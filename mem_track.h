@@ -0,0 +1,84 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Memory Accounting (mem_track.h)
+ * =============================================================
+ *  Heap allocations made by the sketch go through mem_alloc()
+ *  with a subsystem tag, so /mem can say who holds what: live
+ *  bytes and blocks, peak, allocation count and failures per
+ *  tag. Sizes come from the heap itself on free, so there is no
+ *  header in front of the block and alignment is unchanged.
+ *
+ *  Alongside the tags, each heap capability (internal, DMA,
+ *  PSRAM) is sampled for free size, largest free block and their
+ *  lowest values since boot. Fragmentation shows up as a falling
+ *  largest block while free size stays flat, long before
+ *  esp_camera_fb_get() or an httpd allocation fails; crossing
+ *  MEM_LOW_BLOCK raises a "mem_low" alert on /events.
+ * =============================================================
+ */
+#ifndef MEM_TRACK_H
+#define MEM_TRACK_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_heap_caps.h"
+#include "esp_http_server.h"
+#include "json_writer.h"
+
+#define MEM_PSRAM        (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define MEM_DMA          (MALLOC_CAP_DMA | MALLOC_CAP_8BIT)
+
+#define MEM_SAMPLE_MS    1000      // largest-block sampling interval (mem_track_poll)
+#define MEM_LOW_BLOCK    16384     // alert when the largest internal block drops below this
+#define MEM_LOW_REARM    24576     // ...and again only after it recovers past this
+
+typedef enum {
+  MEM_HTTP = 0,      // request bodies, query strings, handler scratch
+  MEM_STREAM,        // frame2jpg output for /stream and /capture
+  MEM_DOWNLOAD,      // SD read-ahead buffers
+  MEM_THUMBS,
+  MEM_SD_WRITER,     // queued photo copies
+  MEM_BURST,
+  MEM_JOBS,          // job results and arguments
+  MEM_DELETE,
+  MEM_EXPORT,
+  MEM_STATE,         // device state cache and render buffers
+  MEM_EVENTS,
+  MEM_BENCH,
+  MEM_MOTION,        // detector state, decode scratch, replay buffers
+  MEM_SCENE,         // per-frame luma statistics (DC map, decoder tables)
+  MEM_SYSTEM,        // task report samples and other one-offs
+  MEM_POOL,          // regions carved into fixed-block pools (mem_pool.h)
+  MEM_TAG_COUNT
+} mem_tag_t;
+
+// heap_caps_malloc(size, caps); on failure retry with `fallback` (0 = none)
+void *mem_alloc_caps(mem_tag_t tag, size_t size, uint32_t caps, uint32_t fallback = 0);
+
+// Plain malloc() placement
+inline void *mem_alloc(mem_tag_t tag, size_t size) {
+  return mem_alloc_caps(tag, size, MALLOC_CAP_DEFAULT);
+}
+
+// Zeroed, plain malloc() placement
+void *mem_calloc(mem_tag_t tag, size_t n, size_t size);
+
+// Count a block a library allocated (frame2jpg, fmt2jpg); NULL is ignored
+void mem_adopt(mem_tag_t tag, void *ptr);
+
+// Free a block from mem_alloc*() or mem_adopt() under the same tag; NULL is ignored
+void mem_free(mem_tag_t tag, void *ptr);
+
+// Update the largest-block watermarks and the low-memory alert.
+// Rate limited to MEM_SAMPLE_MS; call often (loop()).
+void mem_track_poll();
+
+// {"success":true,"heaps":[...],"tags":[...]}; `extra` appends
+// further keys to the object (may be NULL)
+esp_err_t mem_send(httpd_req_t *req, void (*extra)(json_writer_t *w));
+
+// Gauges for /metrics: per-heap sizes and per-tag live bytes
+void mem_track_metrics(json_writer_t *w);
+
+#endif  // MEM_TRACK_H
@@ -0,0 +1,220 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Prometheus Metrics (metrics.cpp)
+ * =============================================================
+ *  The exposition is written through json_writer's raw chunked
+ *  buffer: it streams from the stack and flushes as it fills,
+ *  however many endpoints are registered. Histograms are read
+ *  bucket by bucket without stopping writers, so a scrape that
+ *  races an observation may be off by one in _count vs _sum;
+ *  the next scrape is exact again.
+ * =============================================================
+ */
+
+#include "metrics.h"
+#include <stdarg.h>
+#include "esp_timer.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+// Bucket bounds; values are in the raw unit of each histogram
+static const uint32_t httpBoundsUs[] = { 1000, 5000, 10000, 25000, 50000, 100000,
+                                         250000, 500000, 1000000, 2500000, 10000000 };
+static const uint32_t captureBoundsUs[] = { 5000, 10000, 20000, 33000, 50000, 66000,
+                                            100000, 200000, 500000 };
+static const uint32_t frameBoundsBytes[] = { 8192, 16384, 32768, 65536, 131072, 262144 };
+static const uint32_t sendBoundsUs[] = { 1000, 5000, 10000, 20000, 50000, 100000,
+                                         250000, 1000000 };
+static const uint32_t sdBoundsUs[] = { 1000, 5000, 10000, 25000, 50000, 100000,
+                                       250000, 500000, 1000000 };
+static const uint32_t sceneBoundsUs[] = { 500, 1000, 2000, 5000, 10000, 20000, 50000 };
+
+#define BOUNDS(a) a, (uint8_t)(sizeof(a) / sizeof(a[0]))
+
+metrics_hist_t metrics_capture_us = { BOUNDS(captureBoundsUs) };
+metrics_hist_t metrics_frame_bytes = { BOUNDS(frameBoundsBytes) };
+metrics_hist_t metrics_stream_send_us = { BOUNDS(sendBoundsUs) };
+metrics_hist_t metrics_sd_write_us = { BOUNDS(sdBoundsUs) };
+metrics_hist_t metrics_scene_us = { BOUNDS(sceneBoundsUs) };
+metrics_u64_t metrics_stream_frames;
+metrics_u64_t metrics_stream_bytes;
+std::atomic<uint32_t> metrics_capture_failures(0);
+
+typedef struct {
+  const char *uri;
+  httpd_method_t method;
+  esp_err_t (*handler)(httpd_req_t *req);
+  void *userCtx;
+  metrics_hist_t latency;
+  std::atomic<uint32_t> errors;
+} metrics_endpoint_t;
+
+static metrics_endpoint_t endpoints[METRICS_MAX_ENDPOINTS];
+static uint8_t endpointCount = 0;
+
+static_assert(sizeof(httpBoundsUs) / sizeof(httpBoundsUs[0]) <= METRICS_MAX_BUCKETS, "too many buckets");
+
+// ==================================================================
+//  Per-URI timing
+// ==================================================================
+static esp_err_t timed_handler(httpd_req_t *req) {
+  metrics_endpoint_t *ep = (metrics_endpoint_t *)req->user_ctx;
+  req->user_ctx = ep->userCtx;  // the real handler sees its own context
+  int64_t start = esp_timer_get_time();
+  esp_err_t res = ep->handler(req);
+  metrics_observe(&ep->latency, metrics_us_since(start, esp_timer_get_time()));
+  if (res != ESP_OK) ep->errors.fetch_add(1, std::memory_order_relaxed);
+  return res;
+}
+
+void metrics_wrap(httpd_uri_t *uri) {
+  if (endpointCount >= METRICS_MAX_ENDPOINTS) {
+    log_w("Metrics: no slot for %s", uri->uri);
+    return;
+  }
+  metrics_endpoint_t *ep = &endpoints[endpointCount++];
+  ep->uri = uri->uri;
+  ep->method = uri->method;
+  ep->handler = uri->handler;
+  ep->userCtx = uri->user_ctx;
+  ep->latency.bounds = httpBoundsUs;
+  ep->latency.count = sizeof(httpBoundsUs) / sizeof(httpBoundsUs[0]);
+  uri->handler = timed_handler;
+  uri->user_ctx = ep;
+}
+
+// ==================================================================
+//  Exposition
+// ==================================================================
+static void putf(json_writer_t *w, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+static void putf(json_writer_t *w, const char *fmt, ...) {
+  char line[192];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+  if (n > 0) jw_write(w, line, n < (int)sizeof(line) ? n : sizeof(line) - 1);
+}
+
+static void header(json_writer_t *w, const char *name, const char *type, const char *help) {
+  putf(w, "# HELP %s %s\n", name, help);
+  putf(w, "# TYPE %s %s\n", name, type);
+}
+
+static const char *method_name(httpd_method_t m) {
+  switch (m) {
+    case HTTP_GET:    return "GET";
+    case HTTP_POST:   return "POST";
+    case HTTP_PUT:    return "PUT";
+    case HTTP_DELETE: return "DELETE";
+    default:          return "OTHER";
+  }
+}
+
+static uint64_t hist_count(const metrics_hist_t *h) {
+  uint64_t n = 0;
+  for (uint8_t i = 0; i <= h->count; i++) n += h->buckets[i].load(std::memory_order_relaxed);
+  return n;
+}
+
+// `name_suffix{labels}` or `name_suffix` without labels
+static void series(json_writer_t *w, const char *name, const char *suffix, const char *labels) {
+  if (labels[0]) putf(w, "%s%s{%s}", name, suffix, labels);
+  else putf(w, "%s%s", name, suffix);
+}
+
+// Cumulative buckets, sum and count; `labels` is "" or `k="v",...`
+static void hist_lines(json_writer_t *w, const char *name, const char *labels,
+                       const metrics_hist_t *h, float scale) {
+  const char *sep = labels[0] ? "," : "";
+  uint64_t cumulative = 0;
+  for (uint8_t i = 0; i <= h->count; i++) {
+    cumulative += h->buckets[i].load(std::memory_order_relaxed);
+    if (i == h->count) {
+      putf(w, "%s_bucket{%s%sle=\"+Inf\"} %llu\n", name, labels, sep, (unsigned long long)cumulative);
+    } else if (scale == 1.0f) {
+      putf(w, "%s_bucket{%s%sle=\"%u\"} %llu\n", name, labels, sep, (unsigned)h->bounds[i],
+           (unsigned long long)cumulative);
+    } else {
+      putf(w, "%s_bucket{%s%sle=\"%g\"} %llu\n", name, labels, sep, h->bounds[i] * scale,
+           (unsigned long long)cumulative);
+    }
+  }
+  series(w, name, "_sum", labels);
+  putf(w, " %.6f\n", metrics_read64(&h->sum) * (double)scale);
+  series(w, name, "_count", labels);
+  putf(w, " %llu\n", (unsigned long long)cumulative);
+}
+
+static void histogram(json_writer_t *w, const char *name, const char *help,
+                      const metrics_hist_t *h, float scale) {
+  header(w, name, "histogram", help);
+  hist_lines(w, name, "", h, scale);
+}
+
+static void counter(json_writer_t *w, const char *name, const char *help, uint64_t value) {
+  header(w, name, "counter", help);
+  putf(w, "%s %llu\n", name, (unsigned long long)value);
+}
+
+void metrics_gauge(json_writer_t *w, const char *name, const char *help, double value) {
+  header(w, name, "gauge", help);
+  putf(w, "%s %.10g\n", name, value);
+}
+
+void metrics_family(json_writer_t *w, const char *name, const char *type, const char *help) {
+  header(w, name, type, help);
+}
+
+void metrics_value(json_writer_t *w, const char *name, const char *labels, double value) {
+  if (labels && *labels) putf(w, "%s{%s} %.10g\n", name, labels, value);
+  else putf(w, "%s %.10g\n", name, value);
+}
+
+esp_err_t metrics_send(httpd_req_t *req, void (*gauges)(json_writer_t *w)) {
+  char buf[1024];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  char labels[96];
+
+  header(&w, "trinetra_http_requests_total", "counter", "Requests handled per URI");
+  for (uint8_t i = 0; i < endpointCount; i++) {
+    const metrics_endpoint_t *ep = &endpoints[i];
+    putf(&w, "trinetra_http_requests_total{uri=\"%s\",method=\"%s\"} %llu\n", ep->uri,
+         method_name(ep->method), (unsigned long long)hist_count(&ep->latency));
+  }
+  header(&w, "trinetra_http_request_errors_total", "counter", "Handlers that returned an error");
+  for (uint8_t i = 0; i < endpointCount; i++) {
+    const metrics_endpoint_t *ep = &endpoints[i];
+    putf(&w, "trinetra_http_request_errors_total{uri=\"%s\",method=\"%s\"} %u\n", ep->uri,
+         method_name(ep->method), (unsigned)ep->errors.load(std::memory_order_relaxed));
+  }
+  header(&w, "trinetra_http_request_duration_seconds", "histogram",
+         "Handler run time per URI (streams count their whole duration)");
+  for (uint8_t i = 0; i < endpointCount; i++) {
+    const metrics_endpoint_t *ep = &endpoints[i];
+    snprintf(labels, sizeof(labels), "uri=\"%s\",method=\"%s\"", ep->uri, method_name(ep->method));
+    hist_lines(&w, "trinetra_http_request_duration_seconds", labels, &ep->latency, 1e-6f);
+  }
+
+  histogram(&w, "trinetra_frame_capture_seconds", "esp_camera_fb_get() time", &metrics_capture_us, 1e-6f);
+  histogram(&w, "trinetra_frame_bytes", "JPEG size of streamed frames", &metrics_frame_bytes, 1.0f);
+  histogram(&w, "trinetra_stream_send_seconds", "Time to send one frame to a viewer",
+            &metrics_stream_send_us, 1e-6f);
+  histogram(&w, "trinetra_sd_write_seconds", "SD write time per photo or recorded frame",
+            &metrics_sd_write_us, 1e-6f);
+  histogram(&w, "trinetra_scene_analysis_seconds", "DC-only luma analysis per streamed frame",
+            &metrics_scene_us, 1e-6f);
+  counter(&w, "trinetra_stream_frames_total", "Frames sent to stream viewers",
+          metrics_read64(&metrics_stream_frames));
+  counter(&w, "trinetra_stream_bytes_total", "JPEG bytes sent to stream viewers",
+          metrics_read64(&metrics_stream_bytes));
+  counter(&w, "trinetra_capture_failures_total", "esp_camera_fb_get() returned no frame",
+          metrics_capture_failures.load(std::memory_order_relaxed));
+
+  if (gauges) gauges(&w);
+  return jw_finish(&w);
+}
@@ -0,0 +1,93 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Prometheus Metrics (metrics.h)
+ * =============================================================
+ *  Counters and fixed-bucket histograms, served as Prometheus
+ *  text on /metrics. Recording is a bucket scan plus relaxed
+ *  32-bit atomic adds (S32C1I on Xtensa): no lock, no heap, safe
+ *  from any task. 64-bit totals are two 32-bit words with a
+ *  carry, since 64-bit atomics on this chip take a lock.
+ *
+ *  Every URI registered through metrics_wrap() gets a request
+ *  counter, an error counter and a latency histogram.
+ * =============================================================
+ */
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include "esp_http_server.h"
+#include "json_writer.h"
+
+#define METRICS_MAX_BUCKETS    12
+#define METRICS_MAX_ENDPOINTS  48
+
+// 64-bit counter from two atomic words. A reader racing the carry can
+// see one value 2^32 low, which Prometheus treats as a counter reset.
+typedef struct {
+  std::atomic<uint32_t> lo;
+  std::atomic<uint32_t> hi;
+} metrics_u64_t;
+
+inline void metrics_add64(metrics_u64_t *c, uint32_t v) {
+  uint32_t old = c->lo.fetch_add(v, std::memory_order_relaxed);
+  if (old + v < old) c->hi.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline uint64_t metrics_read64(const metrics_u64_t *c) {
+  uint32_t hi, lo;
+  do {
+    hi = c->hi.load(std::memory_order_relaxed);
+    lo = c->lo.load(std::memory_order_relaxed);
+  } while (hi != c->hi.load(std::memory_order_relaxed));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+typedef struct {
+  const uint32_t *bounds;       // ascending upper bounds, in raw units
+  uint8_t count;                // number of bounds; buckets[count] is +Inf
+  std::atomic<uint32_t> buckets[METRICS_MAX_BUCKETS + 1];  // per bucket, not cumulative
+  metrics_u64_t sum;
+} metrics_hist_t;
+
+inline void metrics_observe(metrics_hist_t *h, uint32_t v) {
+  uint8_t i = 0;
+  while (i < h->count && v > h->bounds[i]) i++;
+  h->buckets[i].fetch_add(1, std::memory_order_relaxed);
+  metrics_add64(&h->sum, v);
+}
+
+// Saturating microsecond delta for metrics_observe()
+inline uint32_t metrics_us_since(int64_t startUs, int64_t nowUs) {
+  int64_t d = nowUs - startUs;
+  return d < 0 ? 0 : d > UINT32_MAX ? UINT32_MAX : (uint32_t)d;
+}
+
+// Hot-path instruments (raw units in the name)
+extern metrics_hist_t metrics_capture_us;       // esp_camera_fb_get()
+extern metrics_hist_t metrics_frame_bytes;      // JPEG size per streamed frame
+extern metrics_hist_t metrics_stream_send_us;   // one frame's part header + body
+extern metrics_hist_t metrics_sd_write_us;      // photo writes and recording frames
+extern metrics_hist_t metrics_scene_us;         // DC-only analysis of a streamed frame
+extern metrics_u64_t metrics_stream_frames;
+extern metrics_u64_t metrics_stream_bytes;
+extern std::atomic<uint32_t> metrics_capture_failures;
+
+// Route the URI through a timing trampoline; call before registering it
+void metrics_wrap(httpd_uri_t *uri);
+
+// Prometheus text lines, for the gauges callback of metrics_send()
+void metrics_gauge(json_writer_t *w, const char *name, const char *help, double value);
+
+// Labelled family: one header ("gauge" or "counter"), then one line
+// per series with `k="v",...` labels (NULL: an unlabelled series)
+void metrics_family(json_writer_t *w, const char *name, const char *type, const char *help);
+void metrics_value(json_writer_t *w, const char *name, const char *labels, double value);
+
+// Whole exposition; `gauges` appends scrape-time values (may be NULL)
+esp_err_t metrics_send(httpd_req_t *req, void (*gauges)(json_writer_t *w));
+
+#endif  // METRICS_H
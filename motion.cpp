@@ -0,0 +1,684 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Motion Detection (motion.cpp)
+ * =============================================================
+ *  Cost per analysed frame is dominated by the DC-only decode,
+ *  which still has to Huffman-decode every coefficient to find
+ *  the next block; differencing 80x60 pixels is noise next to
+ *  it. The task measures both together and sets the next
+ *  analysis time from that, so a bigger framesize lowers the
+ *  analysis rate instead of taking cycles from the stream.
+ * =============================================================
+ */
+
+#include "motion.h"
+#include "thumbs.h"
+#include "mem_track.h"
+#include "task_config.h"
+#include "events.h"
+#include "metrics.h"
+#include "esp_timer.h"
+#include "img_converters.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include <Preferences.h>
+#include <atomic>
+#include "FS.h"
+#include "SD_MMC.h"
+#include <string.h>
+#include <stdlib.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef struct {
+  bool active;
+  uint16_t changed;
+  uint8_t peak;
+  uint8_t score[MOTION_CELLS];
+  uint32_t analysed;
+  uint32_t undecodable;
+  uint32_t starts;
+  uint32_t lightingChanges;
+  uint32_t lastStartMs;
+  uint32_t lastProcUs;
+  uint32_t maxProcUs;
+  uint64_t totalProcUs;
+  float cpuShare;           // smoothed analysis time / analysis interval
+  uint32_t intervalMs;
+} motion_status_t;
+
+static motion_config_t cfg = {
+  false, 20, 3, 2, 3000, 4, 10, 5, false, false, 0, {}
+};
+static motion_hooks_t hooks = { NULL, NULL, NULL, NULL, NULL };
+static SemaphoreHandle_t motionLock = NULL;
+static motion_status_t status = {};
+
+// Live analysis: the task's state, and the frame handed over by the stream
+static TaskHandle_t motionTask = NULL;
+static std::atomic<uint32_t> nextMs(0);          // uptime of the next analysis
+static SemaphoreHandle_t offerFree = NULL;       // binary: given while the copy below is unused
+static camera_fb_t offered;                      // stream frame, buf pointing at offerBuf
+static uint8_t *offerBuf = NULL;
+static size_t offerCap = 0;
+
+// ==================================================================
+//  Engine
+// ==================================================================
+motion_engine_t *motion_engine_new() {
+  motion_engine_t *e = (motion_engine_t *)mem_alloc_caps(MEM_MOTION, sizeof(motion_engine_t),
+                                                          MALLOC_CAP_DEFAULT);
+  if (e) motion_engine_reset(e);
+  return e;
+}
+
+void motion_engine_free(motion_engine_t *e) {
+  mem_free(MEM_MOTION, e);
+}
+
+void motion_engine_reset(motion_engine_t *e) {
+  memset(e, 0, sizeof(*e));
+}
+
+void motion_scratch_free(motion_scratch_t *s) {
+  mem_free(MEM_MOTION, s->dc);
+  mem_free(MEM_MOTION, s->map);
+  mem_free(MEM_MOTION, s->rgb);
+  memset(s, 0, sizeof(*s));
+}
+
+// Grow a scratch buffer; false when out of memory
+static bool reserve(uint8_t **buf, size_t *cap, size_t need) {
+  if (*cap >= need) return true;
+  mem_free(MEM_MOTION, *buf);
+  *buf = (uint8_t *)mem_alloc_caps(MEM_MOTION, need, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+  *cap = *buf ? need : 0;
+  return *buf != NULL;
+}
+
+// The ROM decoder's 1/8-scale output as luma, for what jpeg_dc rejects
+static bool rom_luma(motion_scratch_t *s, const uint8_t *jpg, size_t len, uint16_t jw, uint16_t jh,
+                     uint16_t *dw, uint16_t *dh) {
+  // Same sizing as the thumbnails: the decoder emits whole MCUs
+  size_t need = (size_t)((jw + 15) / 8) * ((jh + 15) / 8) * 2;
+  if (!reserve(&s->rgb, &s->rgbCap, need)) return false;
+  if (!jpg2rgb565(jpg, len, s->rgb, JPG_SCALE_8X)) return false;
+
+  *dw = jw / 8;
+  *dh = jh / 8;
+  for (size_t i = 0; i < (size_t)*dw * *dh; i++) {
+    const uint8_t *p = s->rgb + i * 2;
+    uint16_t c = (p[0] << 8) | p[1];                // jpg2rgb565 stores pixels big-endian
+    uint32_t r = (c >> 8) & 0xF8, g = (c >> 3) & 0xFC, b = (c << 3) & 0xF8;
+    s->map[i] = (77 * r + 150 * g + 29 * b) >> 8;
+  }
+  return true;
+}
+
+bool motion_luma(motion_scratch_t *s, const uint8_t *jpg, size_t len, uint8_t *luma, uint8_t *w, uint8_t *h) {
+  uint16_t jw, jh;
+  if (!jpeg_dimensions(jpg, len, &jw, &jh) || jw < 8 || jh < 8) return false;
+  if (!reserve(&s->map, &s->mapCap, JPEG_DC_MAP_LEN(jw, jh))) return false;
+  if (!s->dc) {
+    s->dc = (jpeg_dc_t *)mem_alloc_caps(MEM_MOTION, sizeof(jpeg_dc_t), MALLOC_CAP_DEFAULT);
+    if (!s->dc) return false;
+    jpeg_dc_reset(s->dc);
+  }
+
+  uint16_t dw, dh;
+  if (!jpeg_dc_luma(s->dc, jpg, len, s->map, s->mapCap, &dw, &dh) &&
+      !rom_luma(s, jpg, len, jw, jh, &dw, &dh)) {
+    return false;
+  }
+
+  // Box-average down to the analysis bound
+  int fx = (dw + MOTION_LUMA_W - 1) / MOTION_LUMA_W;
+  int fy = (dh + MOTION_LUMA_H - 1) / MOTION_LUMA_H;
+  int f = fx > fy ? fx : fy;
+  int ow = dw / f, oh = dh / f;
+  if (ow < 1 || oh < 1) return false;
+
+  for (int oy = 0; oy < oh; oy++) {
+    for (int ox = 0; ox < ow; ox++) {
+      uint32_t sum = 0;
+      for (int y = oy * f; y < (oy + 1) * f; y++) {
+        const uint8_t *p = s->map + (size_t)y * dw + ox * f;
+        for (int x = 0; x < f; x++) sum += p[x];
+      }
+      luma[oy * ow + ox] = sum / (f * f);
+    }
+  }
+  *w = ow;
+  *h = oh;
+  return true;
+}
+
+// Cells covered by the zones; returns how many
+static int zone_mask(const motion_config_t *c, bool *mask) {
+  if (c->zoneCount == 0) {
+    for (int i = 0; i < MOTION_CELLS; i++) mask[i] = true;
+    return MOTION_CELLS;
+  }
+  memset(mask, 0, MOTION_CELLS);
+  for (uint8_t z = 0; z < c->zoneCount; z++) {
+    const motion_zone_t *r = &c->zones[z];
+    for (int y = r->y; y < r->y + r->h; y++) {
+      for (int x = r->x; x < r->x + r->w; x++) mask[y * MOTION_GRID_W + x] = true;
+    }
+  }
+  int n = 0;
+  for (int i = 0; i < MOTION_CELLS; i++) n += mask[i];
+  return n;
+}
+
+motion_edge_t motion_engine_feed(motion_engine_t *e, const motion_config_t *c, const uint8_t *luma,
+                                 uint8_t w, uint8_t h, uint32_t ms) {
+  int n = w * h;
+  if (!e->seeded || w != e->lw || h != e->lh) {
+    for (int i = 0; i < n; i++) e->bg[i] = luma[i] << 8;
+    e->lw = w;
+    e->lh = h;
+    e->seeded = true;
+    e->changed = 0;
+    e->peak = 0;
+    memset(e->score, 0, sizeof(e->score));
+    return MOTION_NONE;
+  }
+
+  // Per-cell mean absolute difference against the background
+  uint32_t sum[MOTION_CELLS] = {0};
+  uint16_t count[MOTION_CELLS] = {0};
+  for (int y = 0; y < h; y++) {
+    int rowCell = (y * MOTION_GRID_H / h) * MOTION_GRID_W;
+    for (int x = 0; x < w; x++) {
+      int i = y * w + x;
+      int cell = rowCell + x * MOTION_GRID_W / w;
+      sum[cell] += abs((int)luma[i] - (e->bg[i] >> 8));
+      count[cell]++;
+    }
+  }
+
+  bool mask[MOTION_CELLS];
+  int zoneCells = zone_mask(c, mask);
+  e->changed = 0;
+  e->peak = 0;
+  for (int i = 0; i < MOTION_CELLS; i++) {
+    uint32_t s = count[i] ? sum[i] / count[i] : 0;
+    e->score[i] = s > 255 ? 255 : s;
+    if (!mask[i]) continue;
+    if (e->score[i] >= c->threshold) e->changed++;
+    if (e->score[i] > e->peak) e->peak = e->score[i];
+  }
+  e->lighting = zoneCells && e->changed >= zoneCells * MOTION_LIGHTING;
+
+  // Background: reseed on a lighting change, otherwise follow slowly
+  // (four times slower where something changed, so it is not absorbed)
+  for (int y = 0; y < h; y++) {
+    int rowCell = (y * MOTION_GRID_H / h) * MOTION_GRID_W;
+    for (int x = 0; x < w; x++) {
+      int i = y * w + x;
+      int target = luma[i] << 8;
+      if (e->lighting) {
+        e->bg[i] = target;
+        continue;
+      }
+      int shift = c->learn + (e->score[rowCell + x * MOTION_GRID_W / w] >= c->threshold ? 2 : 0);
+      e->bg[i] += (target - (int)e->bg[i]) >> shift;
+    }
+  }
+
+  bool moving = !e->lighting && e->changed >= c->minCells;
+  if (moving) {
+    if (e->streak < 255) e->streak++;
+    if (e->active) e->lastMotionMs = ms;
+  } else {
+    e->streak = 0;
+  }
+  if (!e->active && e->streak >= c->startFrames) {
+    e->active = true;
+    e->startMs = e->lastMotionMs = ms;
+    return MOTION_START;
+  }
+  if (e->active && !moving && ms - e->lastMotionMs >= (uint32_t)c->holdMs) {
+    e->active = false;
+    return MOTION_STOP;
+  }
+  return MOTION_NONE;
+}
+
+// ==================================================================
+//  Replay over a recording
+// ==================================================================
+typedef struct {
+  uint32_t frame;
+  uint32_t ms;
+  motion_edge_t edge;
+  uint16_t changed;
+  uint8_t peak;
+} replay_edge_t;
+
+// Next part of an MJPEG recording: JPEG offset and length, or false at the end
+static bool next_part(File &file, size_t *offset, size_t *len) {
+  char head[256];
+  if (!file.seek(*offset)) return false;
+  size_t n = file.read((uint8_t *)head, sizeof(head) - 1);
+  head[n] = '\0';
+  const char *cl = strstr(head, "Content-Length:");
+  const char *body = cl ? strstr(cl, "\r\n\r\n") : NULL;
+  if (!body) return false;
+  *len = strtoul(cl + strlen("Content-Length:"), NULL, 10);
+  *offset += (body - head) + 4;
+  return *len > 0 && *offset + *len <= file.size();
+}
+
+bool motion_replay(const char *path, int fps, json_writer_t *out,
+                   void (*progress)(void *arg, uint32_t done, uint32_t total), void *arg) {
+  File file = SD_MMC.open(path, FILE_READ);
+  if (!file) return false;
+  size_t total = file.size();
+
+  motion_config_t c;
+  motion_get_config(&c);
+  motion_engine_t *e = motion_engine_new();
+  uint8_t *luma = (uint8_t *)mem_alloc(MEM_MOTION, MOTION_LUMA_W * MOTION_LUMA_H);
+  replay_edge_t *edges = (replay_edge_t *)mem_alloc(MEM_MOTION, MOTION_REPLAY_EVENTS * sizeof(replay_edge_t));
+  motion_scratch_t scratch = {};
+  uint8_t *jpg = NULL;
+  size_t jpgCap = 0;
+  bool ok = e && luma && edges;
+
+  uint32_t frames = 0, undecodable = 0, edgeCount = 0, starts = 0, maxUs = 0;
+  uint64_t totalUs = 0;
+  size_t offset = 0, len = 0;
+  while (ok && next_part(file, &offset, &len)) {
+    if (len > THUMB_MAX_SOURCE) break;
+    if (len > jpgCap) {
+      mem_free(MEM_MOTION, jpg);
+      jpg = (uint8_t *)mem_alloc_caps(MEM_MOTION, len, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+      jpgCap = jpg ? len : 0;
+      if (!jpg) break;
+    }
+    if (!file.seek(offset) || file.read(jpg, len) != len) break;
+    offset += len;
+
+    uint32_t ms = frames * 1000 / fps;
+    int64_t t0 = esp_timer_get_time();
+    uint8_t w = 0, h = 0;
+    motion_edge_t edge = MOTION_NONE;
+    if (motion_luma(&scratch, jpg, len, luma, &w, &h)) edge = motion_engine_feed(e, &c, luma, w, h, ms);
+    else undecodable++;
+    uint32_t us = metrics_us_since(t0, esp_timer_get_time());
+    totalUs += us;
+    if (us > maxUs) maxUs = us;
+
+    if (edge != MOTION_NONE) {
+      if (edge == MOTION_START) starts++;
+      if (edgeCount < MOTION_REPLAY_EVENTS) edges[edgeCount] = { frames, ms, edge, e->changed, e->peak };
+      edgeCount++;
+    }
+    frames++;
+    if (progress && frames % 10 == 0) progress(arg, offset, total);
+  }
+  file.close();
+
+  if (ok) {
+    jw_obj_open(out);
+    jw_uint(out, "frames", frames);
+    jw_uint(out, "undecodable", undecodable);
+    jw_uint(out, "fps", fps);
+    jw_uint(out, "avg_us", frames ? (uint32_t)(totalUs / frames) : 0);
+    jw_uint(out, "max_us", maxUs);
+    jw_uint(out, "events", starts);
+    jw_bool(out, "open_at_end", e->active);
+    jw_arr_open(out, "edges");
+    for (uint32_t i = 0; i < edgeCount && i < MOTION_REPLAY_EVENTS; i++) {
+      jw_obj_open(out);
+      jw_uint(out, "frame", edges[i].frame);
+      jw_uint(out, "ms", edges[i].ms);
+      jw_str(out, "state", edges[i].edge == MOTION_START ? "start" : "stop");
+      if (edges[i].edge == MOTION_START) {
+        jw_uint(out, "cells", edges[i].changed);
+        jw_uint(out, "peak", edges[i].peak);
+      }
+      jw_obj_close(out);
+    }
+    jw_arr_close(out);
+    jw_bool(out, "truncated", edgeCount > MOTION_REPLAY_EVENTS);
+    jw_obj_close(out);
+  }
+
+  mem_free(MEM_MOTION, jpg);
+  motion_scratch_free(&scratch);
+  mem_free(MEM_MOTION, edges);
+  mem_free(MEM_MOTION, luma);
+  motion_engine_free(e);
+  return ok && frames > 0;
+}
+
+// ==================================================================
+//  Configuration
+// ==================================================================
+static bool valid(const motion_config_t *c) {
+  if (c->threshold < 1 || c->threshold > 255 || c->minCells < 1 || c->minCells > MOTION_CELLS ||
+      c->startFrames < 1 || c->startFrames > 10 || c->holdMs < 500 || c->holdMs > 600000 ||
+      c->learn < 1 || c->learn > 8 || c->cpuPct < 1 || c->cpuPct > 50 || c->maxFps < 1 ||
+      c->maxFps > 15 || c->zoneCount > MOTION_MAX_ZONES) {
+    return false;
+  }
+  for (uint8_t z = 0; z < c->zoneCount; z++) {
+    const motion_zone_t *r = &c->zones[z];
+    if (r->w < 1 || r->h < 1 || r->x + r->w > MOTION_GRID_W || r->y + r->h > MOTION_GRID_H) return false;
+  }
+  return true;
+}
+
+bool motion_parse_zones(const char *text, motion_config_t *c) {
+  c->zoneCount = 0;
+  const char *p = text;
+  while (*p) {
+    unsigned x, y, w, h;
+    int used = 0;
+    if (c->zoneCount >= MOTION_MAX_ZONES || sscanf(p, "%u,%u,%u,%u%n", &x, &y, &w, &h, &used) != 4 ||
+        x >= MOTION_GRID_W || y >= MOTION_GRID_H || w > MOTION_GRID_W || h > MOTION_GRID_H) {
+      return false;
+    }
+    c->zones[c->zoneCount++] = { (uint8_t)x, (uint8_t)y, (uint8_t)w, (uint8_t)h };
+    p += used;
+    if (*p == ';') p++;
+    else if (*p) return false;
+  }
+  return true;
+}
+
+static void load_config() {
+  Preferences prefs;
+  if (!prefs.begin(MOTION_NS, true)) return;
+  motion_config_t c = cfg;
+  c.enabled = prefs.getBool("enabled", c.enabled);
+  c.threshold = prefs.getInt("threshold", c.threshold);
+  c.minCells = prefs.getInt("min_cells", c.minCells);
+  c.startFrames = prefs.getInt("start", c.startFrames);
+  c.holdMs = prefs.getInt("hold_ms", c.holdMs);
+  c.learn = prefs.getInt("learn", c.learn);
+  c.cpuPct = prefs.getInt("cpu", c.cpuPct);
+  c.maxFps = prefs.getInt("fps", c.maxFps);
+  c.snapshot = prefs.getBool("snapshot", c.snapshot);
+  c.record = prefs.getBool("record", c.record);
+  c.zoneCount = prefs.getUChar("zones_n", 0);
+  if (c.zoneCount > MOTION_MAX_ZONES ||
+      (c.zoneCount && prefs.getBytes("zones", c.zones, sizeof(c.zones)) != sizeof(c.zones))) {
+    c.zoneCount = 0;
+  }
+  prefs.end();
+  if (valid(&c)) cfg = c;
+}
+
+void motion_get_config(motion_config_t *out) {
+  xSemaphoreTake(motionLock, portMAX_DELAY);
+  *out = cfg;
+  xSemaphoreGive(motionLock);
+}
+
+bool motion_set_config(const motion_config_t *c) {
+  if (!valid(c)) return false;
+  xSemaphoreTake(motionLock, portMAX_DELAY);
+  cfg = *c;
+  xSemaphoreGive(motionLock);
+
+  Preferences prefs;
+  if (prefs.begin(MOTION_NS, false)) {
+    prefs.putBool("enabled", c->enabled);
+    prefs.putInt("threshold", c->threshold);
+    prefs.putInt("min_cells", c->minCells);
+    prefs.putInt("start", c->startFrames);
+    prefs.putInt("hold_ms", c->holdMs);
+    prefs.putInt("learn", c->learn);
+    prefs.putInt("cpu", c->cpuPct);
+    prefs.putInt("fps", c->maxFps);
+    prefs.putBool("snapshot", c->snapshot);
+    prefs.putBool("record", c->record);
+    prefs.putUChar("zones_n", c->zoneCount);
+    prefs.putBytes("zones", c->zones, sizeof(c->zones));
+    prefs.end();
+  }
+  log_i("Motion: %s, threshold %d, %d cells, %d zones", c->enabled ? "on" : "off", c->threshold,
+        c->minCells, c->zoneCount);
+  return true;
+}
+
+// ==================================================================
+//  Live detector
+// ==================================================================
+static void publish_edge(motion_edge_t edge, const motion_engine_t *e, uint32_t ms) {
+  char json[96];
+  json_writer_t w;
+  jw_init(&w, json, sizeof(json), NULL);
+  jw_obj_open(&w);
+  jw_str(&w, "state", edge == MOTION_START ? "start" : "stop");
+  if (edge == MOTION_START) {
+    jw_uint(&w, "cells", e->changed);
+    jw_uint(&w, "peak", e->peak);
+  } else {
+    jw_uint(&w, "duration_ms", ms - e->startMs);
+  }
+  jw_obj_close(&w);
+  if (jw_result(&w) > 0) events_publish("motion", json);
+}
+
+static void update_status(const motion_engine_t *e, bool decoded, uint32_t procUs, uint32_t intervalUs,
+                          motion_edge_t edge, uint32_t ms) {
+  xSemaphoreTake(motionLock, portMAX_DELAY);
+  motion_status_t *s = &status;
+  s->analysed++;
+  if (!decoded) s->undecodable++;
+  s->active = e->active;
+  s->changed = e->changed;
+  s->peak = e->peak;
+  memcpy(s->score, e->score, sizeof(s->score));
+  if (e->lighting) s->lightingChanges++;
+  if (edge == MOTION_START) {
+    s->starts++;
+    s->lastStartMs = ms;
+  }
+  s->lastProcUs = procUs;
+  if (procUs > s->maxProcUs) s->maxProcUs = procUs;
+  s->totalProcUs += procUs;
+  float share = (float)procUs / intervalUs;
+  s->cpuShare = s->analysed == 1 ? share : s->cpuShare + 0.2f * (share - s->cpuShare);
+  s->intervalMs = intervalUs / 1000;
+  xSemaphoreGive(motionLock);
+}
+
+// Analyse one frame, set the next analysis time from its cost and act on an edge
+static void analyse(motion_engine_t *engine, motion_scratch_t *scratch, const motion_config_t *c,
+                    camera_fb_t *fb) {
+  static uint8_t luma[MOTION_LUMA_W * MOTION_LUMA_H];
+  int64_t t0 = esp_timer_get_time();
+  uint8_t w = 0, h = 0;
+  bool decoded = fb->format == PIXFORMAT_JPEG && motion_luma(scratch, fb->buf, fb->len, luma, &w, &h);
+  uint32_t ms = (uint32_t)(t0 / 1000);
+  motion_edge_t edge = decoded ? motion_engine_feed(engine, c, luma, w, h, ms) : MOTION_NONE;
+  uint32_t procUs = metrics_us_since(t0, esp_timer_get_time());
+
+  // Next analysis: no sooner than maxFps allows, and late enough
+  // that procUs is at most cpuPct of the interval
+  uint32_t intervalUs = 1000000 / c->maxFps;
+  uint32_t budgetUs = procUs * 100 / c->cpuPct;
+  if (budgetUs > intervalUs) intervalUs = budgetUs;
+  nextMs.store(ms + intervalUs / 1000);
+  update_status(engine, decoded, procUs, intervalUs, edge, ms);
+
+  if (edge == MOTION_START) {
+    log_i("Motion: start (%u cells, peak %u)", engine->changed, engine->peak);
+    if (c->snapshot && hooks.snapshot) hooks.snapshot(fb);
+    if (c->record && hooks.record) hooks.record(true);
+  } else if (edge == MOTION_STOP) {
+    log_i("Motion: stop after %u ms", ms - engine->startMs);
+    // Whatever `record` says now: the hook only ends a recording motion started
+    if (hooks.record) hooks.record(false);
+  }
+  if (edge != MOTION_NONE) publish_edge(edge, engine, ms);
+}
+
+static bool due(uint32_t now) {
+  return (int32_t)(now - nextMs.load()) >= 0;
+}
+
+void motion_offer(camera_fb_t *fb) {
+  if (!motionTask || !cfg.enabled || fb->format != PIXFORMAT_JPEG) return;
+  if (!due((uint32_t)(esp_timer_get_time() / 1000))) return;
+  // Taken until the task is done with the copy; other viewers skip
+  if (xSemaphoreTake(offerFree, 0) != pdTRUE) return;
+  if (offerCap < fb->len) {
+    mem_free(MEM_MOTION, offerBuf);
+    offerBuf = (uint8_t *)mem_alloc_caps(MEM_MOTION, fb->len, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+    offerCap = offerBuf ? fb->len : 0;
+    if (!offerBuf) {
+      xSemaphoreGive(offerFree);
+      return;
+    }
+  }
+  memcpy(offerBuf, fb->buf, fb->len);
+  offered = *fb;
+  offered.buf = offerBuf;
+  xTaskNotifyGive(motionTask);
+}
+
+static void motion_task(void *arg) {
+  motion_engine_t *engine = (motion_engine_t *)arg;
+  motion_scratch_t scratch = {};
+
+  while (true) {
+    motion_config_t c;
+    motion_get_config(&c);
+    if (!c.enabled) {
+      if (engine->active && hooks.record) hooks.record(false);
+      if (engine->seeded) {
+        motion_engine_reset(engine);
+        motion_scratch_free(&scratch);
+      }
+      if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MOTION_IDLE_MS))) xSemaphoreGive(offerFree);
+      continue;
+    }
+
+    // While the stream has viewers, analyse copies of the frames it
+    // sends (motion_offer) rather than take frames from it
+    bool streaming = hooks.streaming && hooks.streaming();
+    if (ulTaskNotifyTake(pdTRUE, streaming ? pdMS_TO_TICKS(MOTION_IDLE_MS) : 0)) {
+      analyse(engine, &scratch, &c, &offered);
+      xSemaphoreGive(offerFree);
+      continue;
+    }
+    if (streaming) continue;
+
+    // No viewer: grab frames here. A recording then gets every
+    // frame; analysis keeps its pace
+    bool feeding = hooks.wants_frames && hooks.frame && hooks.wants_frames();
+    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
+    bool analyse_now = due(now);
+    if (!analyse_now && !feeding) {
+      vTaskDelay(pdMS_TO_TICKS(nextMs.load() - now + 1));
+      continue;
+    }
+
+    camera_fb_t *fb = esp_camera_fb_get();
+    if (!fb) {
+      vTaskDelay(pdMS_TO_TICKS(100));
+      continue;
+    }
+    if (feeding) hooks.frame(fb);
+    if (analyse_now) analyse(engine, &scratch, &c, fb);
+    esp_camera_fb_return(fb);
+  }
+}
+
+bool motion_init(const motion_hooks_t *h) {
+  if (motionLock) return true;
+  motionLock = xSemaphoreCreateMutex();
+  offerFree = xSemaphoreCreateBinary();
+  if (!motionLock || !offerFree) return false;
+  xSemaphoreGive(offerFree);
+  if (h) hooks = *h;
+  load_config();
+
+  motion_engine_t *engine = motion_engine_new();
+  if (!engine) return false;
+  if (xTaskCreatePinnedToCore(motion_task, "motion", TASK_MOTION_STACK, engine, TASK_MOTION_PRIO,
+                              &motionTask, TASK_MOTION_CORE) != pdPASS) {
+    motion_engine_free(engine);
+    return false;
+  }
+  log_i("Motion: %s, threshold %d, %d cells", cfg.enabled ? "on" : "off", cfg.threshold, cfg.minCells);
+  return true;
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+void motion_report(json_writer_t *w) {
+  xSemaphoreTake(motionLock, portMAX_DELAY);
+  motion_config_t c = cfg;
+  motion_status_t s = status;
+  xSemaphoreGive(motionLock);
+
+  jw_bool(w, "enabled", c.enabled);
+  jw_key(w, "config");
+  jw_obj_open(w);
+  jw_int(w, "threshold", c.threshold);
+  jw_int(w, "min_cells", c.minCells);
+  jw_int(w, "start_frames", c.startFrames);
+  jw_int(w, "hold_ms", c.holdMs);
+  jw_int(w, "learn", c.learn);
+  jw_int(w, "cpu_pct", c.cpuPct);
+  jw_int(w, "max_fps", c.maxFps);
+  jw_bool(w, "snapshot", c.snapshot);
+  jw_bool(w, "record", c.record);
+  jw_arr_open(w, "zones");
+  for (uint8_t z = 0; z < c.zoneCount; z++) {
+    char zone[20];
+    snprintf(zone, sizeof(zone), "%u,%u,%u,%u", c.zones[z].x, c.zones[z].y, c.zones[z].w, c.zones[z].h);
+    jw_str(w, NULL, zone);
+  }
+  jw_arr_close(w);
+  jw_obj_close(w);
+
+  jw_bool(w, "active", s.active);
+  jw_uint(w, "events", s.starts);
+  if (s.starts) jw_uint(w, "last_start_ms", s.lastStartMs);
+  jw_uint(w, "changed", s.changed);
+  jw_uint(w, "peak", s.peak);
+  jw_uint(w, "lighting_changes", s.lightingChanges);
+  jw_uint(w, "analysed", s.analysed);
+  jw_uint(w, "undecodable", s.undecodable);
+  jw_uint(w, "avg_us", s.analysed ? (uint32_t)(s.totalProcUs / s.analysed) : 0);
+  jw_uint(w, "max_us", s.maxProcUs);
+  jw_uint(w, "interval_ms", s.intervalMs);
+  jw_float(w, "cpu_pct", s.cpuShare * 100);
+
+  // Last scores, one row of the grid per string (hex bytes), for zone tuning
+  jw_arr_open(w, "scores");
+  for (int y = 0; y < MOTION_GRID_H; y++) {
+    char row[MOTION_GRID_W * 2 + 1];
+    for (int x = 0; x < MOTION_GRID_W; x++) snprintf(row + x * 2, 3, "%02x", s.score[y * MOTION_GRID_W + x]);
+    jw_str(w, NULL, row);
+  }
+  jw_arr_close(w);
+}
+
+void motion_metrics(json_writer_t *w) {
+  xSemaphoreTake(motionLock, portMAX_DELAY);
+  motion_status_t s = status;
+  bool enabled = cfg.enabled;
+  xSemaphoreGive(motionLock);
+
+  metrics_gauge(w, "trinetra_motion_active", "1 while a motion event is open", enabled && s.active ? 1 : 0);
+  metrics_family(w, "trinetra_motion_events_total", "counter", "Motion events started");
+  metrics_value(w, "trinetra_motion_events_total", NULL, s.starts);
+  metrics_family(w, "trinetra_motion_frames_total", "counter", "Frames analysed for motion");
+  metrics_value(w, "trinetra_motion_frames_total", NULL, s.analysed);
+  metrics_gauge(w, "trinetra_motion_cpu_ratio", "Share of one core spent on motion analysis", s.cpuShare);
+}
@@ -0,0 +1,154 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Motion Detection (motion.h)
+ * =============================================================
+ *  Frame differencing on a small luma image. Only the DC term of
+ *  each 8x8 luma block is read from the JPEG (jpeg_dc.h; the ROM
+ *  decoder's 1/8 scale when that fails) and the 1/8-scale map is
+ *  box-averaged down to at most MOTION_LUMA_W x MOTION_LUMA_H.
+ *  A running background (per pixel, Q8, updated by 1/2^learn
+ *  per frame, slower where change was seen) is subtracted, and
+ *  the mean absolute difference per cell of a MOTION_GRID_W x
+ *  MOTION_GRID_H grid is the cell's score.
+ *
+ *  Cells at or above `threshold` that lie inside a zone count
+ *  as changed. `minCells` changed cells in `startFrames` frames
+ *  in a row start a motion event; `holdMs` without one stops
+ *  it. A frame where most zone cells change at once is taken as
+ *  a lighting change: no trigger, the background is reseeded.
+ *
+ *  The live engine runs on its own task at low priority, paced
+ *  so analysis stays within `cpuPct` of one core (and `maxFps`).
+ *  While /stream has viewers it only sees frames the stream
+ *  sends: when an analysis is due, the stream loop hands over a
+ *  copy (motion_offer) and takes no extra frame from the driver.
+ *  With no viewer the task grabs frames itself. Start and stop
+ *  are published as "event: motion" and can take a snapshot
+ *  and start/stop a recording through the hooks. The engine
+ *  state is a plain struct, so /motion/replay runs a second one
+ *  over a recorded .mjpeg clip with the same settings.
+ * =============================================================
+ */
+#ifndef MOTION_H
+#define MOTION_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+#include "json_writer.h"
+#include "jpeg_dc.h"
+
+#define MOTION_NS          "motion"
+#define MOTION_LUMA_W      80         // analysis image bound (VGA at 1/8)
+#define MOTION_LUMA_H      60
+#define MOTION_GRID_W      16         // score cells; zones are given in cells
+#define MOTION_GRID_H      12
+#define MOTION_CELLS       (MOTION_GRID_W * MOTION_GRID_H)
+#define MOTION_MAX_ZONES   4
+#define MOTION_LIGHTING    0.6f       // share of zone cells changing at once = lighting
+#define MOTION_IDLE_MS     500        // poll interval while disabled
+#define MOTION_REPLAY_EVENTS 20       // edges listed in a replay result
+
+typedef struct {
+  uint8_t x, y, w, h;                 // in grid cells
+} motion_zone_t;
+
+typedef struct {
+  bool enabled;
+  int threshold;                      // 1..255 mean |luma - background| per cell
+  int minCells;                       // 1..MOTION_CELLS
+  int startFrames;                    // 1..10 consecutive analysed frames
+  int holdMs;                         // 500..600000
+  int learn;                          // 1..8: background follows by 1/2^learn per frame
+  int cpuPct;                         // 1..50 of one core
+  int maxFps;                         // 1..15 analysed frames per second
+  bool snapshot;                      // save a photo on start
+  bool record;                        // record while motion lasts
+  uint8_t zoneCount;                  // 0 = whole frame
+  motion_zone_t zones[MOTION_MAX_ZONES];
+} motion_config_t;
+
+typedef enum {
+  MOTION_NONE = 0,
+  MOTION_START,
+  MOTION_STOP
+} motion_edge_t;
+
+// Detector state; ~10 KB, allocate it (motion_engine_new)
+typedef struct {
+  uint16_t bg[MOTION_LUMA_W * MOTION_LUMA_H];   // background, Q8
+  uint8_t lw, lh;                               // analysis image of the last frame
+  bool seeded;
+  bool active;
+  uint8_t streak;
+  uint32_t lastMotionMs;
+  uint32_t startMs;
+  // Last frame
+  uint16_t changed;                             // changed cells inside the zones
+  uint8_t peak;                                 // highest cell score inside the zones
+  bool lighting;
+  uint8_t score[MOTION_CELLS];
+} motion_engine_t;
+
+// Decoder scratch, grown to the largest frame seen; start zeroed
+typedef struct {
+  jpeg_dc_t *dc;
+  uint8_t *map;                       // 1/8-scale luma
+  size_t mapCap;
+  uint8_t *rgb;                       // 1/8-scale RGB565 (fallback decode)
+  size_t rgbCap;
+} motion_scratch_t;
+
+// Actions on the live engine's edges (any may be NULL)
+typedef struct {
+  void (*snapshot)(camera_fb_t *fb);
+  void (*record)(bool on);            // off: end a recording started by on (always called on stop)
+  bool (*wants_frames)();             // a recording needs frames nobody else captures
+  void (*frame)(camera_fb_t *fb);     // ...then every grabbed frame goes here
+  bool (*streaming)();                // frames come from motion_offer, not the driver
+} motion_hooks_t;
+
+// ---- Engine (no camera, no globals) ----
+motion_engine_t *motion_engine_new();
+void motion_engine_free(motion_engine_t *e);
+void motion_engine_reset(motion_engine_t *e);
+
+// JPEG -> luma (at most MOTION_LUMA_W x MOTION_LUMA_H); false if undecodable
+bool motion_luma(motion_scratch_t *s, const uint8_t *jpg, size_t len, uint8_t *luma, uint8_t *w, uint8_t *h);
+void motion_scratch_free(motion_scratch_t *s);
+
+// One analysed frame at time `ms`
+motion_edge_t motion_engine_feed(motion_engine_t *e, const motion_config_t *cfg, const uint8_t *luma,
+                                 uint8_t w, uint8_t h, uint32_t ms);
+
+// Run a fresh engine with the current settings over an MJPEG
+// recording. The file stores no frame times, so frame i is taken to
+// be at i * 1000 / fps ms. Writes the result object into `out`;
+// progress(arg, bytes done, bytes total) may be NULL.
+bool motion_replay(const char *path, int fps, json_writer_t *out,
+                   void (*progress)(void *arg, uint32_t done, uint32_t total), void *arg);
+
+// ---- Live detector ----
+// Load the configuration (NVS) and start the task
+bool motion_init(const motion_hooks_t *hooks);
+
+void motion_get_config(motion_config_t *cfg);
+
+// Validate, apply and persist; false when out of range
+bool motion_set_config(const motion_config_t *cfg);
+
+// "x,y,w,h;x,y,w,h" in cells ("" = whole frame); false if malformed
+bool motion_parse_zones(const char *text, motion_config_t *cfg);
+
+// Stream loop, per sent JPEG frame: copied for analysis when one
+// is due and the previous copy is done with, otherwise ignored
+void motion_offer(camera_fb_t *fb);
+
+// Keys for an open object: config, state, last scores, CPU use
+void motion_report(json_writer_t *w);
+
+// Gauges/counters for /metrics
+void motion_metrics(json_writer_t *w);
+
+#endif  // MOTION_H
@@ -0,0 +1,256 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Recording Rate Control (rec_rate.cpp)
+ * =============================================================
+ *  JPEG size falls roughly geometrically as quality coarsens, so
+ *  the step grows with how far over target the rate is; under
+ *  target it creeps back one step per window. Both the rate and
+ *  the live card throughput are smoothed (EWMA, REC_RATE_ALPHA)
+ *  so one busy second does not swing quality on its own.
+ * =============================================================
+ */
+
+#include "rec_rate.h"
+#include "camera_control.h"
+#include "device_state.h"
+#include "metrics.h"
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <Preferences.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define REC_RATE_ALPHA 0.5f
+
+static rec_rate_config_t cfg = { false, 250000, 8, 40 };
+static SemaphoreHandle_t rateLock = NULL;
+static uint32_t cardRate = 0;         // from /bench/sd, bytes/s; 0 = never measured
+
+static bool recording = false;
+static int64_t windowStartUs = 0;
+static uint64_t windowBytes = 0;
+static uint64_t windowWriteUs = 0;
+static uint8_t settle = 0;
+static float rate = 0;                // smoothed bytes/s of this recording
+static float liveCardRate = 0;        // smoothed bytes/s while inside write()
+static uint32_t stepsCoarser = 0;
+static uint32_t stepsFiner = 0;
+
+// ==================================================================
+//  Configuration
+// ==================================================================
+static bool valid(const rec_rate_config_t *c) {
+  return c->target >= REC_RATE_MIN_TARGET && c->target <= REC_RATE_MAX_TARGET &&
+         c->qualityBest >= 4 && c->qualityWorst <= 63 && c->qualityBest <= c->qualityWorst;
+}
+
+void rec_rate_init() {
+  if (!rateLock) rateLock = xSemaphoreCreateMutex();
+
+  Preferences prefs;
+  if (!prefs.begin(REC_RATE_NS, true)) return;
+  rec_rate_config_t c = cfg;
+  c.enabled = prefs.getBool("enabled", c.enabled);
+  c.target = prefs.getUInt("target", c.target);
+  c.qualityBest = prefs.getInt("q_best", c.qualityBest);
+  c.qualityWorst = prefs.getInt("q_worst", c.qualityWorst);
+  cardRate = prefs.getUInt("card", 0);
+  prefs.end();
+  if (valid(&c)) cfg = c;
+  log_i("RecRate: %s, target %u B/s, card %u B/s", cfg.enabled ? "on" : "off", cfg.target, cardRate);
+}
+
+void rec_rate_get_config(rec_rate_config_t *out) {
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  *out = cfg;
+  xSemaphoreGive(rateLock);
+}
+
+bool rec_rate_set_config(const rec_rate_config_t *c) {
+  if (!valid(c)) return false;
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  cfg = *c;
+  xSemaphoreGive(rateLock);
+
+  Preferences prefs;
+  if (prefs.begin(REC_RATE_NS, false)) {
+    prefs.putBool("enabled", c->enabled);
+    prefs.putUInt("target", c->target);
+    prefs.putInt("q_best", c->qualityBest);
+    prefs.putInt("q_worst", c->qualityWorst);
+    prefs.end();
+  }
+  log_i("RecRate: %s, target %u B/s", c->enabled ? "on" : "off", c->target);
+  return true;
+}
+
+void rec_rate_set_card_rate(uint32_t bytesPerSec) {
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  cardRate = bytesPerSec;
+  xSemaphoreGive(rateLock);
+
+  Preferences prefs;
+  if (prefs.begin(REC_RATE_NS, false)) {
+    prefs.putUInt("card", bytesPerSec);
+    prefs.end();
+  }
+}
+
+// ==================================================================
+//  Control loop
+// ==================================================================
+void rec_rate_start() {
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  recording = true;
+  windowStartUs = esp_timer_get_time();
+  windowBytes = windowWriteUs = 0;
+  settle = 0;
+  rate = 0;
+  xSemaphoreGive(rateLock);
+}
+
+void rec_rate_stop() {
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  recording = false;
+  rate = 0;
+  xSemaphoreGive(rateLock);
+}
+
+bool rec_rate_active() {
+  return recording && cfg.enabled;
+}
+
+// Target after the card cap; called with the lock held
+static float effective_target() {
+  float card = cardRate ? (float)cardRate : liveCardRate;
+  float cap = card * REC_RATE_CARD_SHARE;
+  return cap > 0 && cap < cfg.target ? cap : (float)cfg.target;
+}
+
+void rec_rate_frame(size_t bytes, uint32_t writeUs) {
+  if (!rateLock || !recording) return;
+  int64_t now = esp_timer_get_time();
+
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  if (settle) {
+    // Frames already captured at the old quality say nothing about the new one
+    settle--;
+    windowStartUs = now;
+    xSemaphoreGive(rateLock);
+    return;
+  }
+  windowBytes += bytes;
+  windowWriteUs += writeUs;
+  int64_t elapsed = now - windowStartUs;
+  if (elapsed < REC_RATE_WINDOW_MS * 1000LL) {
+    xSemaphoreGive(rateLock);
+    return;
+  }
+
+  float bps = windowBytes * 1000000.0f / elapsed;
+  rate = rate > 0 ? rate + REC_RATE_ALPHA * (bps - rate) : bps;
+  if (windowWriteUs) {
+    float card = windowBytes * 1000000.0f / windowWriteUs;
+    liveCardRate = liveCardRate > 0 ? liveCardRate + REC_RATE_ALPHA * (card - liveCardRate) : card;
+  }
+  windowStartUs = now;
+  windowBytes = windowWriteUs = 0;
+
+  bool enabled = cfg.enabled;
+  rec_rate_config_t c = cfg;
+  float ratio = rate / effective_target();
+  xSemaphoreGive(rateLock);
+  if (!enabled) return;
+
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s || s->pixformat != PIXFORMAT_JPEG) return;
+  int q = s->status.quality;
+  int next = q;
+  if (ratio > 1 + REC_RATE_DEADBAND) {
+    next = q + (ratio > 1.5f ? 4 : ratio > 1.25f ? 2 : 1);   // higher value = smaller frames
+    if (next > c.qualityWorst) next = c.qualityWorst;
+  } else if (ratio < 1 - REC_RATE_DEADBAND) {
+    next = q - 1;
+    if (next < c.qualityBest) next = c.qualityBest;
+  }
+  if (next == q) return;
+  if (control_set("quality", next) != CONTROL_OK) {
+    log_w("RecRate: could not set quality=%d", next);
+    return;
+  }
+  device_state_invalidate(STATE_CAMERA);
+
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  if (next > q) stepsCoarser++;
+  else stepsFiner++;
+  settle = REC_RATE_SETTLE_FRAMES;
+  windowBytes = windowWriteUs = 0;
+  xSemaphoreGive(rateLock);
+  log_d("RecRate: %.0f B/s (%.2fx target), quality %d -> %d", rate, ratio, q, next);
+}
+
+uint32_t rec_rate_current() {
+  return recording ? (uint32_t)rate : 0;
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+void rec_rate_report(json_writer_t *w, uint64_t cardTotal, uint64_t cardFree) {
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  rec_rate_config_t c = cfg;
+  uint32_t bench = cardRate;
+  float live = liveCardRate;
+  float effective = effective_target();
+  float now = recording ? rate : 0;
+  uint32_t coarser = stepsCoarser, finer = stepsFiner;
+  xSemaphoreGive(rateLock);
+
+  jw_bool(w, "enabled", c.enabled);
+  jw_uint(w, "target", c.target);
+  jw_uint(w, "q_best", c.qualityBest);
+  jw_uint(w, "q_worst", c.qualityWorst);
+
+  // What the card can take, and where that figure came from
+  jw_key(w, "card");
+  jw_obj_open(w);
+  jw_str(w, "source", bench ? "bench" : live > 0 ? "live" : "none");
+  jw_uint(w, "write_rate", bench ? bench : (uint32_t)live);
+  jw_uint(w, "cap", (uint32_t)((bench ? bench : live) * REC_RATE_CARD_SHARE));
+  jw_obj_close(w);
+  jw_uint(w, "effective_target", (uint32_t)effective);
+
+  jw_bool(w, "recording", recording);
+  jw_uint(w, "rate", (uint32_t)now);
+  sensor_t *s = esp_camera_sensor_get();
+  if (s) jw_uint(w, "quality", s->status.quality);
+  jw_uint(w, "steps_coarser", coarser);
+  jw_uint(w, "steps_finer", finer);
+
+  // Retention at the target: a full card, and what is left on this one
+  if (cardTotal && effective > 0) {
+    jw_float(w, "retention_h", cardTotal / effective / 3600.0f);
+    jw_float(w, "remaining_h", cardFree / effective / 3600.0f);
+  }
+}
+
+void rec_rate_metrics(json_writer_t *w) {
+  xSemaphoreTake(rateLock, portMAX_DELAY);
+  float now = recording ? rate : 0;
+  float effective = effective_target();
+  uint32_t coarser = stepsCoarser, finer = stepsFiner;
+  xSemaphoreGive(rateLock);
+
+  metrics_gauge(w, "trinetra_recording_rate_bytes_per_second", "Smoothed write rate of the current recording",
+                now);
+  metrics_gauge(w, "trinetra_recording_target_bytes_per_second", "Recording rate target after the card cap",
+                effective);
+  metrics_family(w, "trinetra_recording_quality_steps_total", "counter", "Recording quality adjustments");
+  metrics_value(w, "trinetra_recording_quality_steps_total", "direction=\"coarser\"", coarser);
+  metrics_value(w, "trinetra_recording_quality_steps_total", "direction=\"finer\"", finer);
+}
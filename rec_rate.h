@@ -0,0 +1,78 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Recording Rate Control (rec_rate.h)
+ * =============================================================
+ *  At a fixed JPEG quality a recording's bytes per second follow
+ *  the scene: a busy street can outrun a slow card, a quiet room
+ *  fills the card with detail nobody needs. While recording, the
+ *  controller measures the bytes written per second (smoothed
+ *  over REC_RATE_WINDOW_MS windows) and moves sensor quality to
+ *  hold a target rate, so retention = card size / target.
+ *
+ *  The target is capped at REC_RATE_CARD_SHARE of what the card
+ *  sustains for recording-style (unaligned) writes: the figure
+ *  from the last /bench/sd, kept in NVS, or until one has run,
+ *  the write throughput measured on the recording itself.
+ *
+ *  Quality moves faster when the rate is over target (the card
+ *  falling behind drops frames) than when it is under, and not
+ *  at all inside a +-REC_RATE_DEADBAND band. Framesize is left
+ *  alone; recordings keep the resolution they started with.
+ *  While the controller runs it owns quality, and the stream's
+ *  adaptive bitrate (abr.h) stands down for the recording.
+ * =============================================================
+ */
+#ifndef REC_RATE_H
+#define REC_RATE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "json_writer.h"
+
+#define REC_RATE_NS            "recrate"
+#define REC_RATE_WINDOW_MS     1000
+#define REC_RATE_SETTLE_FRAMES 2        // frames after a step still at the old quality
+#define REC_RATE_DEADBAND      0.10f    // +-10% of target: no step
+#define REC_RATE_CARD_SHARE    0.75f    // of the card's write throughput (25% headroom)
+#define REC_RATE_MIN_TARGET    20000    // bytes/s
+#define REC_RATE_MAX_TARGET    4000000
+
+typedef struct {
+  bool enabled;
+  uint32_t target;          // bytes per second
+  int qualityBest;          // 4..63, lower = finer
+  int qualityWorst;
+} rec_rate_config_t;
+
+// Load the configuration and the card's benchmark figure from NVS
+void rec_rate_init();
+
+void rec_rate_get_config(rec_rate_config_t *cfg);
+
+// Validate, apply and persist; false when out of range
+bool rec_rate_set_config(const rec_rate_config_t *cfg);
+
+// Sustained recording write throughput from /bench/sd (bytes/s), persisted
+void rec_rate_set_card_rate(uint32_t bytesPerSec);
+
+// A recording starts/stops (resets the measurement)
+void rec_rate_start();
+void rec_rate_stop();
+
+// True while a recording is under rate control (ABR stands down)
+bool rec_rate_active();
+
+// Per recorded frame: bytes written and the time the write took
+void rec_rate_frame(size_t bytes, uint32_t writeUs);
+
+// Smoothed bytes/s of the current recording (0 when idle)
+uint32_t rec_rate_current();
+
+// Keys for an open object; card size/free give the retention estimate
+void rec_rate_report(json_writer_t *w, uint64_t cardTotal, uint64_t cardFree);
+
+// Gauges/counters for /metrics
+void rec_rate_metrics(json_writer_t *w);
+
+#endif  // REC_RATE_H
@@ -0,0 +1,405 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Region of Interest (roi.cpp)
+ * =============================================================
+ *  Register writes go through control_with_sensor(), so they
+ *  never interleave with a /control batch or an ABR step. The
+ *  settle state is two atomics: the stream loop checks them on
+ *  every frame without taking a lock.
+ * =============================================================
+ */
+
+#include "roi.h"
+#include "camera_control.h"
+#include "thumbs.h"
+#include "metrics.h"
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <Preferences.h>
+#include <atomic>
+#include <math.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define ROI_SMOOTH  0.1f      // weight of a new frame in the averages
+
+// Full-resolution output and the driver's 4:3 timing for it
+typedef struct {
+  uint16_t pid;
+  const char *name;
+  uint16_t width, height;
+  uint16_t offsetX, offsetY;  // ISP margin on each side of the array window
+  uint16_t totalX, totalY;    // HTS / VTS
+} roi_sensor_t;
+
+static const roi_sensor_t sensors[] = {
+  { OV2640_PID, "OV2640", 1600, 1200, 0, 0, 0, 0 },
+  { OV3660_PID, "OV3660", 2048, 1536, 16, 6, 2300, 1564 },
+  { OV5640_PID, "OV5640", 2560, 1920, 32, 16, 2844, 1968 },
+};
+
+// ov2640_sensor_mode_t, passed to set_res_raw() as startX
+enum { OV2640_UXGA = 0, OV2640_SVGA = 1, OV2640_CIF = 2 };
+
+typedef struct {
+  uint32_t frames;
+  float bytes;
+  float captureUs;
+} roi_seen_t;
+
+static SemaphoreHandle_t roiLock = NULL;
+static const roi_sensor_t *model = NULL;
+static roi_config_t cfg = { false, 0, 0, 0, 0, 0, 0, 0 };
+static const char *readout = "full";
+static roi_seen_t seen[2];                    // [0] full frame, [1] window
+
+static std::atomic<int> settle(0);            // frames left to wait for `expected`
+static std::atomic<uint32_t> expected(0);     // (width << 16) | height
+static std::atomic<uint32_t> settleDrops(0);
+
+const char *roi_err_str(roi_err_t err) {
+  switch (err) {
+    case ROI_OK: return "OK";
+    case ROI_ERR_SENSOR: return "No sensor with a raw window (OV2640, OV3660, OV5640)";
+    case ROI_ERR_WINDOW: return "Window outside the sensor array or under 64 px";
+    case ROI_ERR_OUTPUT: return "Output larger than the window or the framesize, or under 32 px";
+    case ROI_ERR_ASPECT: return "out_w:out_h must match the window's aspect";
+    case ROI_ERR_APPLY: return "Sensor rejected the window";
+  }
+  return "Unknown error";
+}
+
+// ==================================================================
+//  Validation
+// ==================================================================
+static const roi_sensor_t *find_model(sensor_t *s) {
+  if (!s || !s->set_res_raw) return NULL;
+  for (size_t i = 0; i < sizeof(sensors) / sizeof(sensors[0]); i++) {
+    if (sensors[i].pid == s->id.PID) return &sensors[i];
+  }
+  return NULL;
+}
+
+static int align(int v) {
+  return v / ROI_ALIGN * ROI_ALIGN;
+}
+
+// Align the window, fill in the output and check both against the
+// array and the framesize (fsW x fsH)
+static roi_err_t normalize(roi_config_t *c, int fsW, int fsH) {
+  if (c->x < 0 || c->y < 0) return ROI_ERR_WINDOW;
+  if (c->outW < 0 || c->outH < 0) return ROI_ERR_OUTPUT;
+  c->x = align(c->x);
+  c->y = align(c->y);
+  c->w = align(c->w);
+  c->h = align(c->h);
+  if (c->w < ROI_MIN_WINDOW || c->h < ROI_MIN_WINDOW || c->x + c->w > model->width ||
+      c->y + c->h > model->height) {
+    return ROI_ERR_WINDOW;
+  }
+
+  float aspect = (float)c->w / c->h;
+  if (!c->outW && !c->outH) {
+    float k = fminf(fminf((float)fsW / c->w, (float)fsH / c->h), 1.0f);
+    c->outW = c->w * k;
+    c->outH = c->h * k;
+  } else if (!c->outW) {
+    c->outW = c->outH * aspect;
+  } else if (!c->outH) {
+    c->outH = c->outW / aspect;
+  } else if (fabsf((float)c->outW / c->outH / aspect - 1) > ROI_ASPECT_SLACK) {
+    return ROI_ERR_ASPECT;
+  }
+  c->outW = align(c->outW);
+  c->outH = align(c->outH);
+  if (c->outW < ROI_MIN_OUTPUT || c->outH < ROI_MIN_OUTPUT || c->outW > c->w || c->outH > c->h ||
+      c->outW > fsW || c->outH > fsH) {
+    return ROI_ERR_OUTPUT;
+  }
+  return ROI_OK;
+}
+
+// ==================================================================
+//  Sensor programming (under the sensor lock)
+// ==================================================================
+typedef struct {
+  const roi_config_t *cfg;
+  const char *readout;        // filled in
+} roi_program_t;
+
+static int program_window(sensor_t *s, void *arg) {
+  roi_program_t *p = (roi_program_t *)arg;
+  const roi_config_t *c = p->cfg;
+
+  if (model->pid == OV2640_PID) {
+    // Coarsest readout whose window (in that mode's pixels, a multiple
+    // of 8) still has at least the output's pixels
+    int f = 4;
+    while (f > 1 && (((c->w / f) & ~7) < c->outW || ((c->h / f) & ~7) < c->outH)) f /= 2;
+    int mode = f == 4 ? OV2640_CIF : f == 2 ? OV2640_SVGA : OV2640_UXGA;
+    p->readout = f == 4 ? "cif" : f == 2 ? "svga" : "uxga";
+    return s->set_res_raw(s, mode, 0, 0, 0, c->x / f, c->y / f, (c->w / f) & ~7, (c->h / f) & ~7,
+                          c->outW, c->outH, false, false);
+  }
+
+  // OV3660/OV5640: shrink the array window and the frame's line count,
+  // keeping the driver's margins and vertical blanking
+  bool binning = c->w >= 2 * c->outW && c->h >= 2 * c->outH;
+  int blank = model->totalY - (model->height + 2 * model->offsetY);
+  int totalY = c->h + 2 * model->offsetY + blank;
+  int offX = model->offsetX, offY = model->offsetY;
+  if (binning) {
+    offX /= 2;           // as set_framesize() does for binned sizes
+    offY /= 2;
+    totalY = totalY / 2 + 1;
+  }
+  bool scale = c->outW != c->w >> binning || c->outH != c->h >> binning;
+  p->readout = binning ? "binned" : "window";
+  return s->set_res_raw(s, c->x, c->y, c->x + c->w + 2 * model->offsetX - 1,
+                        c->y + c->h + 2 * model->offsetY - 1, offX, offY, model->totalX, totalY,
+                        c->outW, c->outH, scale, binning);
+}
+
+// set_framesize() programs the full-frame window again
+static int program_full(sensor_t *s, void *arg) {
+  return s->set_framesize(s, s->status.framesize);
+}
+
+static void begin_settle(int w, int h) {
+  expected.store((uint32_t)w << 16 | (uint16_t)h);
+  settle.store(ROI_SETTLE_FRAMES);
+}
+
+static void save(const roi_config_t *c) {
+  Preferences prefs;
+  if (!prefs.begin(ROI_NS, false)) return;
+  prefs.putBool("active", c->active);
+  prefs.putInt("x", c->x);
+  prefs.putInt("y", c->y);
+  prefs.putInt("w", c->w);
+  prefs.putInt("h", c->h);
+  prefs.putInt("out_w", c->outW);
+  prefs.putInt("out_h", c->outH);
+  prefs.putInt("fs", c->framesize);
+  prefs.end();
+}
+
+// Program a validated window and make it current
+static roi_err_t apply(const roi_config_t *c) {
+  roi_program_t p = { c, NULL };
+  if (!control_with_sensor(program_window, &p)) {
+    // Registers may be half written: fall back to the full frame
+    control_with_sensor(program_full, NULL);
+    sensor_t *s = esp_camera_sensor_get();
+    begin_settle(resolution[s->status.framesize].width, resolution[s->status.framesize].height);
+    xSemaphoreTake(roiLock, portMAX_DELAY);
+    cfg.active = false;
+    readout = "full";
+    xSemaphoreGive(roiLock);
+    return ROI_ERR_APPLY;
+  }
+  begin_settle(c->outW, c->outH);
+
+  xSemaphoreTake(roiLock, portMAX_DELAY);
+  cfg = *c;
+  cfg.active = true;
+  readout = p.readout;
+  xSemaphoreGive(roiLock);
+  log_i("ROI: %dx%d at %d,%d -> %dx%d (%s)", c->w, c->h, c->x, c->y, c->outW, c->outH, p.readout);
+  return ROI_OK;
+}
+
+// ==================================================================
+//  Configuration
+// ==================================================================
+void roi_init() {
+  if (!roiLock) roiLock = xSemaphoreCreateMutex();
+  sensor_t *s = esp_camera_sensor_get();
+  model = find_model(s);
+
+  Preferences prefs;
+  if (!prefs.begin(ROI_NS, true)) return;  // namespace not created yet: full frame
+  roi_config_t c = cfg;
+  c.active = prefs.getBool("active", false);
+  c.x = prefs.getInt("x", 0);
+  c.y = prefs.getInt("y", 0);
+  c.w = prefs.getInt("w", 0);
+  c.h = prefs.getInt("h", 0);
+  c.outW = prefs.getInt("out_w", 0);
+  c.outH = prefs.getInt("out_h", 0);
+  c.framesize = prefs.getInt("fs", 0);
+  prefs.end();
+  if (!c.active) return;
+
+  // The window was sized for the framesize it was set under
+  if (c.framesize >= 0 && c.framesize < FRAMESIZE_INVALID && s && c.framesize != s->status.framesize) {
+    control_set("framesize", c.framesize);
+  }
+  roi_err_t err = roi_set(&c);
+  if (err != ROI_OK) log_w("ROI: saved window not applied (%s)", roi_err_str(err));
+}
+
+void roi_get(roi_config_t *out) {
+  xSemaphoreTake(roiLock, portMAX_DELAY);
+  *out = cfg;
+  xSemaphoreGive(roiLock);
+}
+
+roi_err_t roi_set(const roi_config_t *in) {
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s || !model || !roiLock) return ROI_ERR_SENSOR;
+  roi_config_t c = *in;
+  c.framesize = s->status.framesize;
+  roi_err_t err = normalize(&c, resolution[c.framesize].width, resolution[c.framesize].height);
+  if (err == ROI_OK) err = apply(&c);
+  if (err == ROI_OK) {
+    c.active = true;
+    save(&c);
+  }
+  return err;
+}
+
+roi_err_t roi_reset() {
+  if (!roiLock) return ROI_ERR_SENSOR;
+  roi_config_t c;
+  roi_get(&c);
+  if (!c.active) return ROI_OK;
+  if (!control_with_sensor(program_full, NULL)) return ROI_ERR_SENSOR;
+  sensor_t *s = esp_camera_sensor_get();
+  begin_settle(resolution[s->status.framesize].width, resolution[s->status.framesize].height);
+
+  xSemaphoreTake(roiLock, portMAX_DELAY);
+  cfg.active = false;
+  readout = "full";
+  c = cfg;
+  xSemaphoreGive(roiLock);
+  save(&c);
+  log_i("ROI: full frame");
+  return ROI_OK;
+}
+
+bool roi_active() {
+  if (!cfg.active) return false;
+  sensor_t *s = esp_camera_sensor_get();
+  return s && s->status.framesize == cfg.framesize;
+}
+
+void roi_sync() {
+  sensor_t *s = esp_camera_sensor_get();
+  if (!roiLock || !s || !cfg.active) return;
+  xSemaphoreTake(roiLock, portMAX_DELAY);
+  bool cleared = cfg.active && s->status.framesize != cfg.framesize;
+  if (cleared) {
+    cfg.active = false;
+    readout = "full";
+  }
+  roi_config_t c = cfg;
+  xSemaphoreGive(roiLock);
+  if (!cleared) return;
+  save(&c);
+  log_i("ROI: cleared by a framesize change");
+}
+
+void roi_restore() {
+  roi_config_t c;
+  if (!roi_active()) return;
+  roi_get(&c);
+  if (apply(&c) != ROI_OK) log_w("ROI: could not restore the window");
+}
+
+// ==================================================================
+//  Stream hooks
+// ==================================================================
+bool roi_frame_ready(const uint8_t *jpg, size_t len) {
+  if (settle.load(std::memory_order_relaxed) <= 0) return true;
+  uint16_t w, h;
+  if (jpeg_dimensions(jpg, len, &w, &h) && ((uint32_t)w << 16 | h) == expected.load()) {
+    settle.store(0);
+    return true;
+  }
+  settle.fetch_sub(1);
+  settleDrops.fetch_add(1, std::memory_order_relaxed);
+  return false;
+}
+
+void roi_observe(size_t bytes, uint32_t captureUs) {
+  if (!roiLock) return;
+  int i = roi_active() ? 1 : 0;
+  xSemaphoreTake(roiLock, portMAX_DELAY);
+  roi_seen_t *r = &seen[i];
+  if (!r->frames) {
+    r->bytes = bytes;
+    r->captureUs = captureUs;
+  } else {
+    r->bytes += ROI_SMOOTH * ((float)bytes - r->bytes);
+    r->captureUs += ROI_SMOOTH * ((float)captureUs - r->captureUs);
+  }
+  r->frames++;
+  xSemaphoreGive(roiLock);
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+static void write_seen(json_writer_t *w, const char *key, const roi_seen_t *r) {
+  jw_obj_open(w, key);
+  jw_uint(w, "frames", r->frames);
+  jw_uint(w, "bytes", (uint32_t)r->bytes);
+  jw_float(w, "capture_ms", r->captureUs / 1000);
+  jw_obj_close(w);
+}
+
+void roi_report(json_writer_t *w) {
+  xSemaphoreTake(roiLock, portMAX_DELAY);
+  roi_config_t c = cfg;
+  const char *mode = readout;
+  roi_seen_t full = seen[0], win = seen[1];
+  xSemaphoreGive(roiLock);
+
+  bool on = roi_active();
+  jw_bool(w, "supported", model != NULL);
+  if (model) {
+    jw_str(w, "sensor", model->name);
+    jw_obj_open(w, "array");
+    jw_uint(w, "w", model->width);
+    jw_uint(w, "h", model->height);
+    jw_obj_close(w);
+  }
+  jw_bool(w, "active", on);
+  if (on) {
+    jw_obj_open(w, "window");
+    jw_uint(w, "x", c.x);
+    jw_uint(w, "y", c.y);
+    jw_uint(w, "w", c.w);
+    jw_uint(w, "h", c.h);
+    jw_obj_close(w);
+    jw_obj_open(w, "output");
+    jw_uint(w, "w", c.outW);
+    jw_uint(w, "h", c.outH);
+    jw_obj_close(w);
+    jw_str(w, "readout", mode);
+    jw_float(w, "area_pct", 100.0f * c.w * c.h / ((float)model->width * model->height));
+  }
+  sensor_t *s = esp_camera_sensor_get();
+  if (s) jw_uint(w, "framesize", s->status.framesize);
+  jw_uint(w, "settle_drops", settleDrops.load());
+  write_seen(w, "full", &full);
+  write_seen(w, "roi", &win);
+}
+
+void roi_metrics(json_writer_t *w) {
+  if (!roiLock) return;
+  roi_config_t c;
+  roi_get(&c);
+  bool on = roi_active();
+  metrics_gauge(w, "trinetra_roi_active", "1 while the sensor outputs a window of the image", on ? 1 : 0);
+  metrics_gauge(w, "trinetra_roi_area_ratio", "Share of the sensor array inside the window (1 without one)",
+                on ? (double)c.w * c.h / ((double)model->width * model->height) : 1.0);
+  metrics_family(w, "trinetra_roi_settle_drops_total", "counter",
+                 "Stream frames dropped while the sensor switched window");
+  metrics_value(w, "trinetra_roi_settle_drops_total", NULL, settleDrops.load());
+}
@@ -0,0 +1,107 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Region of Interest (roi.h)
+ * =============================================================
+ *  Sensor windowing: the camera outputs only a rectangle of the
+ *  image, scaled to the requested size, instead of the whole
+ *  scene. A doorway that fills a quarter of the view costs a
+ *  quarter of the pixels to encode and send, and on the sensors
+ *  below the readout itself gets shorter.
+ *
+ *  The window is given in sensor pixels at full resolution
+ *  (OV2640 1600x1200, OV3660 2048x1536, OV5640 2560x1920) and
+ *  programmed through the driver's set_res_raw():
+ *
+ *    OV2640   readout mode CIF (1/4), SVGA (1/2) or UXGA, the
+ *             coarsest that still has the output's pixels across
+ *             the window; the subsampled modes read fewer lines,
+ *             so frames come faster. The DSP crops and scales.
+ *    OV3660/  the array window itself (start/end address) and the
+ *    OV5640   frame's line count shrink with it; 2x2 binning when
+ *             the window is at least twice the output.
+ *
+ *  The output may not exceed the current framesize: the frame
+ *  buffers and the pixel clock set_framesize() picked are sized
+ *  for it. Left out, it is the largest size at the window's aspect
+ *  that fits. set_pll() is not touched for the same reason.
+ *
+ *  Switching while streaming: until a frame of the new size
+ *  arrives (at most ROI_SETTLE_FRAMES), the stream drops frames
+ *  whose JPEG size is not the expected one, so viewers never see
+ *  one the sensor produced mid-change.
+ *
+ *  set_framesize() reprograms the window, so a framesize change
+ *  from /control or a preset ends the ROI, ABR only steps quality
+ *  while one is set, and a burst at another size re-applies it
+ *  afterwards. Kept in NVS (namespace ROI_NS) and applied at boot.
+ * =============================================================
+ */
+#ifndef ROI_H
+#define ROI_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "json_writer.h"
+
+#define ROI_NS              "roi"
+#define ROI_ALIGN           8         // window and output granularity, pixels
+#define ROI_MIN_WINDOW      64        // smallest window side, sensor pixels
+#define ROI_MIN_OUTPUT      32        // smallest output side
+#define ROI_ASPECT_SLACK    0.03f     // output vs window aspect, when both sizes are given
+#define ROI_SETTLE_FRAMES   4         // frames dropped at most after a change
+
+typedef struct {
+  bool active;
+  int x, y, w, h;            // window, full-resolution sensor pixels
+  int outW, outH;            // output frame size; 0 = derive
+  int framesize;             // framesize_t the window was set under
+} roi_config_t;
+
+typedef enum {
+  ROI_OK = 0,
+  ROI_ERR_SENSOR,            // no sensor, or not one with a raw window
+  ROI_ERR_WINDOW,            // outside the array or too small
+  ROI_ERR_OUTPUT,            // larger than the window or the framesize, or too small
+  ROI_ERR_ASPECT,            // output aspect differs from the window's
+  ROI_ERR_APPLY              // the sensor rejected the registers
+} roi_err_t;
+
+// Load the ROI from NVS and program it; after the camera is up
+void roi_init();
+
+void roi_get(roi_config_t *cfg);
+
+// Validate (aligning the window, deriving missing output sizes),
+// program the sensor and persist. `cfg->active` is ignored.
+roi_err_t roi_set(const roi_config_t *cfg);
+
+// Back to the full frame at the current framesize
+roi_err_t roi_reset();
+
+const char *roi_err_str(roi_err_t err);
+
+// True while a window is programmed
+bool roi_active();
+
+// After /control or a preset: forget the ROI if the framesize moved
+void roi_sync();
+
+// After a temporary framesize change (burst): program the window again
+void roi_restore();
+
+// Stream loop, per JPEG frame: false while settling and the frame
+// is not of the expected size (drop it)
+bool roi_frame_ready(const uint8_t *jpg, size_t len);
+
+// Stream loop, per sent frame: its size and the time the grab took
+void roi_observe(size_t bytes, uint32_t captureUs);
+
+// Keys for an open object: sensor, window, output, readout and the
+// frame size / capture time measured with and without the ROI
+void roi_report(json_writer_t *w);
+
+// Gauges for /metrics
+void roi_metrics(json_writer_t *w);
+
+#endif  // ROI_H
@@ -0,0 +1,269 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Scene Statistics (scene.cpp)
+ * =============================================================
+ *  One pass over the DC map fills the histogram, the moments,
+ *  the clip counts and the change grid. Decoding runs under a
+ *  try-lock (a second viewer skips the frame rather than wait);
+ *  the results sit behind their own lock so /status never waits
+ *  on a decode.
+ * =============================================================
+ */
+
+#include "scene.h"
+#include "jpeg_dc.h"
+#include "thumbs.h"
+#include "mem_track.h"
+#include "events.h"
+#include "metrics.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define SCENE_CELLS (SCENE_GRID_W * SCENE_GRID_H)
+
+typedef enum {
+  SCENE_OK = 0,
+  SCENE_DARK,
+  SCENE_COVERED
+} scene_condition_t;
+
+static const char *const conditionNames[] = { "ok", "dark", "covered" };
+
+typedef struct {
+  uint32_t frames;
+  uint32_t undecodable;
+  int64_t lastUs;
+  uint16_t mapW, mapH;
+  float mean;
+  float stddev;
+  uint8_t hist[SCENE_BINS];           // percent of blocks
+  float darkShare;
+  float brightShare;
+  const char *exposure;
+  scene_condition_t condition;        // settled (after SCENE_ALERT_FRAMES)
+  scene_condition_t pending;
+  uint8_t streak;
+  float change;                       // last frame
+  float activity;                     // smoothed change
+  uint32_t cuts;
+  uint32_t lastAnalysisUs;
+  uint32_t maxAnalysisUs;
+  uint64_t totalAnalysisUs;
+} scene_status_t;
+
+static SemaphoreHandle_t workLock = NULL;   // decoder context and buffers
+static SemaphoreHandle_t statsLock = NULL;
+static jpeg_dc_t *dc = NULL;
+static uint8_t *map = NULL;
+static size_t mapCap = 0;
+static uint8_t grid[SCENE_CELLS];
+static uint32_t cellSum[SCENE_CELLS];         // per-frame scratch, off the stream task's stack
+static uint16_t cellCount[SCENE_CELLS];
+static uint16_t gridW = 0, gridH = 0;         // map size the grid was taken from
+static scene_status_t stats = {};
+
+bool scene_init() {
+  if (workLock) return true;
+  workLock = xSemaphoreCreateMutex();
+  statsLock = xSemaphoreCreateMutex();
+  dc = (jpeg_dc_t *)mem_alloc_caps(MEM_SCENE, sizeof(jpeg_dc_t), MALLOC_CAP_DEFAULT);
+  if (!workLock || !statsLock || !dc) return false;
+  jpeg_dc_reset(dc);
+  stats.exposure = "unknown";
+  return true;
+}
+
+// ==================================================================
+//  Analysis
+// ==================================================================
+static const char *exposure_of(float mean, float dark, float bright) {
+  if (mean < SCENE_UNDER_MEAN || dark > SCENE_CLIP_SHARE) return "under";
+  if (mean > SCENE_OVER_MEAN || bright > SCENE_CLIP_SHARE) return "over";
+  return "ok";
+}
+
+// Condition with hysteresis; returns the new one when it settles, else -1
+static int settle_condition(scene_status_t *s, scene_condition_t now) {
+  if (now == s->condition) {
+    s->streak = 0;
+    return -1;
+  }
+  if (now != s->pending) {
+    s->pending = now;
+    s->streak = 0;
+  }
+  if (++s->streak < SCENE_ALERT_FRAMES) return -1;
+  s->condition = now;
+  s->streak = 0;
+  return now;
+}
+
+void scene_observe(const uint8_t *jpg, size_t len) {
+  if (!workLock || xSemaphoreTake(workLock, 0) != pdTRUE) return;
+  int64_t t0 = esp_timer_get_time();
+
+  uint16_t jw, jh, w = 0, h = 0;
+  bool ok = jpeg_dimensions(jpg, len, &jw, &jh);
+  size_t need = ok ? JPEG_DC_MAP_LEN(jw, jh) : 0;
+  if (ok && mapCap < need) {
+    mem_free(MEM_SCENE, map);
+    map = (uint8_t *)mem_alloc_caps(MEM_SCENE, need, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+    mapCap = map ? need : 0;
+  }
+  ok = ok && map && jpeg_dc_luma(dc, jpg, len, map, mapCap, &w, &h);
+  if (!ok) {
+    xSemaphoreGive(workLock);
+    xSemaphoreTake(statsLock, portMAX_DELAY);
+    stats.undecodable++;
+    xSemaphoreGive(statsLock);
+    return;
+  }
+
+  // One pass: histogram, moments, clipping, grid sums
+  uint32_t hist[SCENE_BINS] = {0};
+  memset(cellSum, 0, sizeof(cellSum));
+  memset(cellCount, 0, sizeof(cellCount));
+  uint64_t sum = 0, sumSq = 0;
+  uint32_t dark = 0, bright = 0;
+  for (int y = 0; y < h; y++) {
+    const uint8_t *row = map + (size_t)y * w;
+    int rowCell = (y * SCENE_GRID_H / h) * SCENE_GRID_W;
+    for (int x = 0; x < w; x++) {
+      uint8_t v = row[x];
+      hist[v >> 4]++;
+      sum += v;
+      sumSq += v * v;
+      dark += v <= SCENE_CLIP_LOW;
+      bright += v >= SCENE_CLIP_HIGH;
+      int cell = rowCell + x * SCENE_GRID_W / w;
+      cellSum[cell] += v;
+      cellCount[cell]++;
+    }
+  }
+  uint32_t n = (uint32_t)w * h;
+  float mean = (float)sum / n;
+  float var = (float)sumSq / n - mean * mean;
+  float stddev = var > 0 ? sqrtf(var) : 0;
+
+  // Scene change against the previous frame's grid (same map size only)
+  bool comparable = w == gridW && h == gridH;
+  uint32_t diff = 0, cells = 0;
+  for (int i = 0; i < SCENE_CELLS; i++) {
+    if (!cellCount[i]) continue;
+    uint8_t m = cellSum[i] / cellCount[i];
+    if (comparable) diff += abs((int)m - grid[i]);
+    grid[i] = m;
+    cells++;
+  }
+  gridW = w;
+  gridH = h;
+  float change = comparable && cells ? (float)diff / cells : 0;
+  xSemaphoreGive(workLock);
+
+  uint32_t us = metrics_us_since(t0, esp_timer_get_time());
+  metrics_observe(&metrics_scene_us, us);
+
+  scene_condition_t now = mean < SCENE_DARK_MEAN ? SCENE_DARK
+                        : stddev < SCENE_FLAT_STDDEV ? SCENE_COVERED : SCENE_OK;
+  xSemaphoreTake(statsLock, portMAX_DELAY);
+  scene_status_t *s = &stats;
+  s->frames++;
+  s->lastUs = t0;
+  s->mapW = w;
+  s->mapH = h;
+  s->mean = mean;
+  s->stddev = stddev;
+  for (int i = 0; i < SCENE_BINS; i++) s->hist[i] = (hist[i] * 100 + n / 2) / n;
+  s->darkShare = (float)dark / n;
+  s->brightShare = (float)bright / n;
+  s->exposure = exposure_of(mean, s->darkShare, s->brightShare);
+  if (comparable && change >= SCENE_CUT && s->change < SCENE_CUT) s->cuts++;
+  s->change = change;
+  s->activity = s->frames == 1 ? change : s->activity + 0.1f * (change - s->activity);
+  s->lastAnalysisUs = us;
+  if (us > s->maxAnalysisUs) s->maxAnalysisUs = us;
+  s->totalAnalysisUs += us;
+  int settled = settle_condition(s, now);
+  xSemaphoreGive(statsLock);
+
+  if (settled < 0) return;
+  log_i("Scene: %s (mean %.0f, std dev %.1f)", conditionNames[settled], mean, stddev);
+  if (settled == SCENE_OK) return;
+  char json[96];
+  json_writer_t out;
+  jw_init(&out, json, sizeof(json), NULL);
+  jw_obj_open(&out);
+  jw_str(&out, "type", settled == SCENE_DARK ? "camera_dark" : "camera_covered");
+  jw_float(&out, "mean", mean);
+  jw_float(&out, "stddev", stddev);
+  jw_obj_close(&out);
+  if (jw_result(&out) > 0) events_publish("alert", json);
+}
+
+// ==================================================================
+//  Reports
+// ==================================================================
+int scene_render(char *buf, size_t len) {
+  if (!statsLock) return snprintf(buf, len, "{}");
+  xSemaphoreTake(statsLock, portMAX_DELAY);
+  scene_status_t s = stats;
+  xSemaphoreGive(statsLock);
+
+  json_writer_t w;
+  jw_init(&w, buf, len, NULL);
+  jw_obj_open(&w);
+  jw_uint(&w, "frames", s.frames);
+  if (s.frames) {
+    jw_uint(&w, "age_ms", (esp_timer_get_time() - s.lastUs) / 1000);
+    jw_uint(&w, "map_w", s.mapW);
+    jw_uint(&w, "map_h", s.mapH);
+    jw_float(&w, "mean", s.mean);
+    jw_float(&w, "stddev", s.stddev);
+    jw_arr_open(&w, "hist");
+    for (int i = 0; i < SCENE_BINS; i++) jw_uint(&w, NULL, s.hist[i]);
+    jw_arr_close(&w);
+    jw_float(&w, "dark_pct", s.darkShare * 100);
+    jw_float(&w, "bright_pct", s.brightShare * 100);
+    jw_str(&w, "exposure", s.exposure);
+    jw_str(&w, "condition", conditionNames[s.condition]);
+    jw_float(&w, "change", s.change);
+    jw_float(&w, "activity", s.activity);
+    jw_uint(&w, "cuts", s.cuts);
+    jw_uint(&w, "analysis_us", s.totalAnalysisUs / s.frames);
+    jw_uint(&w, "analysis_max_us", s.maxAnalysisUs);
+  }
+  jw_uint(&w, "undecodable", s.undecodable);
+  jw_obj_close(&w);
+  return jw_result(&w);
+}
+
+void scene_metrics(json_writer_t *w) {
+  if (!statsLock) return;
+  xSemaphoreTake(statsLock, portMAX_DELAY);
+  scene_status_t s = stats;
+  xSemaphoreGive(statsLock);
+
+  metrics_gauge(w, "trinetra_scene_luma_mean", "Mean luma of the last analysed frame (0-255)", s.mean);
+  metrics_gauge(w, "trinetra_scene_luma_stddev", "Luma standard deviation of the last analysed frame",
+                s.stddev);
+  metrics_family(w, "trinetra_scene_clipped_ratio", "gauge", "Share of 8x8 blocks crushed or blown out");
+  metrics_value(w, "trinetra_scene_clipped_ratio", "side=\"dark\"", s.darkShare);
+  metrics_value(w, "trinetra_scene_clipped_ratio", "side=\"bright\"", s.brightShare);
+  metrics_gauge(w, "trinetra_scene_change", "Smoothed frame-to-frame change of the block grid", s.activity);
+  metrics_gauge(w, "trinetra_scene_obstructed", "1 while the frame is dark or flat (lens covered)",
+                s.condition != SCENE_OK ? 1 : 0);
+  metrics_family(w, "trinetra_scene_cuts_total", "counter", "Frame-to-frame changes over the cut threshold");
+  metrics_value(w, "trinetra_scene_cuts_total", NULL, s.cuts);
+  metrics_family(w, "trinetra_scene_frames_total", "counter", "Streamed frames analysed");
+  metrics_value(w, "trinetra_scene_frames_total", NULL, s.frames);
+}
@@ -0,0 +1,59 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Scene Statistics (scene.h)
+ * =============================================================
+ *  Cheap image statistics for every streamed frame, read from
+ *  the JPEG's DC terms (jpeg_dc.h: one luma value per 8x8 block,
+ *  no full decode):
+ *
+ *    - 16-bin luma histogram, mean, standard deviation
+ *    - share of blocks clipped dark (<= SCENE_CLIP_LOW) or
+ *      bright (>= SCENE_CLIP_HIGH), and an exposure verdict
+ *    - "dark" (blackout) and "covered" (a flat, featureless
+ *      frame: something on the lens) after SCENE_ALERT_FRAMES
+ *      frames in a row, pushed once as an /events alert
+ *    - scene change: mean |difference| of a 16x12 grid of block
+ *      means against the previous frame; jumps over SCENE_CUT
+ *      are counted as cuts
+ *
+ *  The stream loop feeds it after each frame is sent. With no
+ *  viewer nothing is analysed, and "age_ms" says how old the
+ *  figures are. Reported in /status ("scene"), /state and
+ *  /metrics.
+ * =============================================================
+ */
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "json_writer.h"
+
+#define SCENE_BINS          16
+#define SCENE_CLIP_LOW      16        // block mean at or below: crushed to black
+#define SCENE_CLIP_HIGH     240       // at or above: blown out
+#define SCENE_CLIP_SHARE    0.25f     // clipped share that fails exposure
+#define SCENE_UNDER_MEAN    50        // mean luma below: underexposed
+#define SCENE_OVER_MEAN     200       // above: overexposed
+#define SCENE_DARK_MEAN     12        // mean luma below: blackout
+#define SCENE_FLAT_STDDEV   3.0f      // luma std dev below: covered lens
+#define SCENE_ALERT_FRAMES  15        // frames in a row before "dark"/"covered" (and back)
+#define SCENE_GRID_W        16
+#define SCENE_GRID_H        12
+#define SCENE_CUT           24        // grid mean |difference| counted as a scene cut
+#define SCENE_JSON_LEN      448
+
+// Allocate the decoder context; before the stream starts
+bool scene_init();
+
+// Analyse one JPEG frame (skipped if another caller is mid-frame)
+void scene_observe(const uint8_t *jpg, size_t len);
+
+// The statistics as one JSON object (state section renderer)
+int scene_render(char *buf, size_t len);
+
+// Gauges/counters for /metrics
+void scene_metrics(json_writer_t *w);
+
+#endif  // SCENE_H
@@ -0,0 +1,173 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  SD Card Benchmark (sd_bench.cpp)
+ * =============================================================
+ *  Buffers are DMA-capable internal RAM, like the download
+ *  pipeline. The unaligned passes shift both the buffer address
+ *  and the file position by one byte, which is what the MJPEG
+ *  recorder does after its text part headers; FATFS then has to
+ *  split each write into partial-sector read-modify-writes.
+ * =============================================================
+ */
+
+#include "sd_bench.h"
+#include "mem_track.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "FS.h"
+#include "SD_MMC.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+static const uint32_t benchChunks[SD_BENCH_CHUNKS] = { 4096, 8192, 16384, 32768 };
+static const uint8_t benchAligns[SD_BENCH_ALIGNS] = { 0, 1 };
+
+// ==================================================================
+//  Latency statistics
+// ==================================================================
+static int cmp_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return x < y ? -1 : x > y;
+}
+
+static void summarize(sd_bench_pass_t *pass, uint32_t *lat, uint32_t n, uint64_t bytes, int64_t elapsedUs) {
+  pass->ops = n;
+  pass->mbps = elapsedUs > 0 ? (float)bytes / elapsedUs : 0;  // bytes/us == MB/s
+  if (n == 0) return;
+  qsort(lat, n, sizeof(uint32_t), cmp_u32);
+  pass->p50_us = lat[n / 2];
+  pass->p99_us = lat[(n * 99) / 100 < n ? (n * 99) / 100 : n - 1];
+  pass->max_us = lat[n - 1];
+}
+
+// ==================================================================
+//  Passes
+// ==================================================================
+static bool seq_write(uint8_t *buf, uint32_t chunk, uint8_t align, uint32_t fileBytes,
+                      uint32_t *lat, sd_bench_pass_t *pass) {
+  File file = SD_MMC.open(SD_BENCH_FILE, FILE_WRITE);
+  if (!file) return false;
+  if (align) file.write(buf, align);  // shift every following write off the sector grid
+
+  uint32_t n = 0;
+  uint64_t bytes = 0;
+  int64_t start = esp_timer_get_time();
+  while (bytes + chunk <= fileBytes) {
+    int64_t t0 = esp_timer_get_time();
+    if (file.write(buf + align, chunk) != chunk) break;
+    lat[n++] = (uint32_t)(esp_timer_get_time() - t0);
+    bytes += chunk;
+  }
+  file.close();  // include the final flush in the throughput
+  summarize(pass, lat, n, bytes, esp_timer_get_time() - start);
+  return bytes > 0;
+}
+
+static bool seq_read(uint8_t *buf, uint32_t chunk, uint8_t align, uint32_t fileBytes,
+                     uint32_t *lat, sd_bench_pass_t *pass) {
+  File file = SD_MMC.open(SD_BENCH_FILE, FILE_READ);
+  if (!file) return false;
+  if (align) file.seek(align);
+
+  uint32_t n = 0;
+  uint64_t bytes = 0;
+  int64_t start = esp_timer_get_time();
+  while (bytes + chunk <= fileBytes) {
+    int64_t t0 = esp_timer_get_time();
+    if (file.read(buf + align, chunk) != chunk) break;
+    lat[n++] = (uint32_t)(esp_timer_get_time() - t0);
+    bytes += chunk;
+  }
+  summarize(pass, lat, n, bytes, esp_timer_get_time() - start);
+  file.close();
+  return bytes > 0;
+}
+
+static bool random_write(uint8_t *buf, uint32_t fileBytes, uint32_t *lat, sd_bench_pass_t *pass) {
+  File file = SD_MMC.open(SD_BENCH_FILE, "r+");
+  if (!file) return false;
+
+  uint32_t slots = fileBytes / SD_BENCH_RANDOM_SIZE;
+  uint32_t n = 0;
+  int64_t start = esp_timer_get_time();
+  for (uint32_t i = 0; i < SD_BENCH_RANDOM_OPS && slots; i++) {
+    uint32_t offset = (esp_random() % slots) * SD_BENCH_RANDOM_SIZE;
+    int64_t t0 = esp_timer_get_time();
+    if (!file.seek(offset) || file.write(buf, SD_BENCH_RANDOM_SIZE) != SD_BENCH_RANDOM_SIZE) break;
+    file.flush();  // force each write to the card, like a small metadata update
+    lat[n++] = (uint32_t)(esp_timer_get_time() - t0);
+  }
+  summarize(pass, lat, n, (uint64_t)n * SD_BENCH_RANDOM_SIZE, esp_timer_get_time() - start);
+  pass->chunk = SD_BENCH_RANDOM_SIZE;
+  pass->align = 0;
+  file.close();
+  return n > 0;
+}
+
+// ==================================================================
+//  Sweep
+// ==================================================================
+const sd_bench_pass_t *sd_bench_best(const sd_bench_pass_t *passes, uint8_t count, uint8_t align) {
+  const sd_bench_pass_t *best = NULL;
+  for (uint8_t i = 0; i < count; i++) {
+    if (passes[i].align != align || passes[i].ops == 0) continue;
+    if (!best || passes[i].mbps > best->mbps) best = &passes[i];
+  }
+  return best;
+}
+
+bool sd_bench_run(uint32_t fileBytes, sd_bench_report_t *report,
+                  void (*progress)(void *arg, uint32_t done, uint32_t total), void *arg) {
+  memset(report, 0, sizeof(*report));
+  if (fileBytes < benchChunks[SD_BENCH_CHUNKS - 1]) fileBytes = SD_BENCH_DEFAULT_BYTES;
+  if (fileBytes > SD_BENCH_MAX_BYTES) fileBytes = SD_BENCH_MAX_BYTES;
+  report->fileBytes = fileBytes;
+
+  size_t bufSize = benchChunks[SD_BENCH_CHUNKS - 1] + 4;
+  uint8_t *buf = (uint8_t *)mem_alloc_caps(MEM_BENCH, bufSize, MEM_DMA, MALLOC_CAP_DEFAULT);
+  uint32_t maxOps = fileBytes / benchChunks[0];
+  if (maxOps < SD_BENCH_RANDOM_OPS) maxOps = SD_BENCH_RANDOM_OPS;
+  uint32_t *lat = (uint32_t *)mem_alloc_caps(MEM_BENCH, maxOps * sizeof(uint32_t), MEM_PSRAM,
+                                              MALLOC_CAP_DEFAULT);
+  if (!buf || !lat) {
+    mem_free(MEM_BENCH, buf);
+    mem_free(MEM_BENCH, lat);
+    return false;
+  }
+  for (size_t i = 0; i < bufSize; i++) buf[i] = (uint8_t)esp_random();
+
+  int64_t start = esp_timer_get_time();
+  bool ok = true;
+  for (uint8_t c = 0; c < SD_BENCH_CHUNKS && ok; c++) {
+    for (uint8_t a = 0; a < SD_BENCH_ALIGNS && ok; a++) {
+      uint8_t i = report->passes;
+      report->write[i].chunk = report->read[i].chunk = benchChunks[c];
+      report->write[i].align = report->read[i].align = benchAligns[a];
+      ok = seq_write(buf, benchChunks[c], benchAligns[a], fileBytes, lat, &report->write[i]) &&
+           seq_read(buf, benchChunks[c], benchAligns[a], fileBytes, lat, &report->read[i]);
+      if (ok) report->passes++;
+      if (progress) progress(arg, report->passes, SD_BENCH_PASSES + 1);
+      vTaskDelay(1);
+    }
+  }
+  if (ok) {
+    random_write(buf, fileBytes, lat, &report->random);
+    if (progress) progress(arg, SD_BENCH_PASSES + 1, SD_BENCH_PASSES + 1);
+  }
+
+  SD_MMC.remove(SD_BENCH_FILE);
+  mem_free(MEM_BENCH, buf);
+  mem_free(MEM_BENCH, lat);
+
+  const sd_bench_pass_t *bestRead = sd_bench_best(report->read, report->passes, 0);
+  report->bestReadChunk = bestRead ? bestRead->chunk : 0;
+  report->elapsedMs = (uint32_t)((esp_timer_get_time() - start) / 1000);
+  log_i("SD bench: %u passes in %ums", report->passes, report->elapsedMs);
+  return report->passes > 0;
+}
@@ -0,0 +1,55 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  SD Card Benchmark (sd_bench.h)
+ * =============================================================
+ *  Qualifies a card in the field: sequential write and read over
+ *  a sweep of chunk sizes and alignments, plus small random
+ *  writes, all on a scratch file that is removed afterwards.
+ *  Every pass reports MB/s and per-operation latency percentiles.
+ * =============================================================
+ */
+#ifndef SD_BENCH_H
+#define SD_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SD_BENCH_FILE          "/bench_sd.tmp"
+#define SD_BENCH_DEFAULT_BYTES (2 * 1024 * 1024)
+#define SD_BENCH_MAX_BYTES     (16 * 1024 * 1024)
+#define SD_BENCH_CHUNKS        4        // 4K, 8K, 16K, 32K
+#define SD_BENCH_ALIGNS        2        // 0 = sector aligned, 1 = off by one byte
+#define SD_BENCH_PASSES        (SD_BENCH_CHUNKS * SD_BENCH_ALIGNS)
+#define SD_BENCH_RANDOM_OPS    64
+#define SD_BENCH_RANDOM_SIZE   4096
+
+typedef struct {
+  uint32_t chunk;
+  uint8_t align;          // byte offset of buffer and file position
+  uint32_t ops;
+  float mbps;
+  uint32_t p50_us;
+  uint32_t p99_us;
+  uint32_t max_us;
+} sd_bench_pass_t;
+
+typedef struct {
+  uint32_t fileBytes;
+  uint8_t passes;
+  sd_bench_pass_t write[SD_BENCH_PASSES];
+  sd_bench_pass_t read[SD_BENCH_PASSES];
+  sd_bench_pass_t random;       // chunk = SD_BENCH_RANDOM_SIZE, flushed per op
+  uint32_t bestReadChunk;       // fastest aligned read
+  uint32_t elapsedMs;
+} sd_bench_report_t;
+
+// Run the full sweep; false if the scratch file or buffers are unavailable.
+// progress(arg, passes done, SD_BENCH_PASSES + 1) may be NULL.
+bool sd_bench_run(uint32_t fileBytes, sd_bench_report_t *report,
+                  void (*progress)(void *arg, uint32_t done, uint32_t total), void *arg);
+
+// Fastest pass for an alignment (NULL if none ran)
+const sd_bench_pass_t *sd_bench_best(const sd_bench_pass_t *passes, uint8_t count, uint8_t align);
+
+#endif  // SD_BENCH_H
@@ -0,0 +1,270 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  SD Read-Ahead Streaming (sd_stream.cpp)
+ * =============================================================
+ *  Buffers are handed between the reader task and the sender
+ *  through two queues: "free" (empty, ready to be filled) and
+ *  "full" (filled, ready to be sent). With SD_STREAM_BUFFERS
+ *  tokens in circulation the reader is always one buffer ahead.
+ * =============================================================
+ */
+
+#include "sd_stream.h"
+#include "task_config.h"
+#include "mem_pool.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "SD_MMC.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+// Chunk size of the pre-pipeline download loop (kept for the benchmark)
+#define SD_STREAM_LEGACY_CHUNK 8192
+
+static size_t streamChunk = 8 * 1024;
+static mem_pool_t *ioPool = NULL;   // one ring at the boot-time chunk size
+
+// Sink callback: consumes one filled buffer
+typedef esp_err_t (*sd_sink_fn)(void *arg, const uint8_t *data, size_t len);
+
+// One filled buffer passed from reader to sender
+typedef struct {
+  int index;   // buffer slot
+  int len;     // bytes filled, 0 = end of data, <0 = read error
+} sd_chunk_msg_t;
+
+typedef struct {
+  File *file;
+  size_t remaining;
+  size_t chunk;
+  uint8_t *bufs[SD_STREAM_BUFFERS];
+  QueueHandle_t freeQ;
+  QueueHandle_t fullQ;
+  volatile bool abort;
+  TaskHandle_t owner;
+} sd_pipeline_t;
+
+// ==================================================================
+//  Chunk size selection
+// ==================================================================
+void sd_stream_init() {
+  // Larger transfers amortise the per-command SDMMC overhead. High
+  // capacity cards handle multi-block reads well; older cards less so.
+  size_t chunk;
+  switch (SD_MMC.cardType()) {
+    case CARD_SDHC: chunk = 32 * 1024; break;
+    case CARD_SD:   chunk = 16 * 1024; break;
+    default:        chunk = 8 * 1024;  break;
+  }
+
+  // Keep all buffers within a quarter of the largest DMA-capable block
+  size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_DMA);
+  while (chunk > SD_STREAM_MIN_CHUNK && chunk * SD_STREAM_BUFFERS > largest / 4) {
+    chunk /= 2;
+  }
+
+  sd_stream_set_chunk_size(chunk);
+  log_i("SD stream chunk: %u bytes x %d buffers", streamChunk, SD_STREAM_BUFFERS);
+
+  // Carve the ring now, while the DMA heap is still in one piece;
+  // a second concurrent download or a larger chunk uses the heap
+  if (!ioPool) ioPool = mem_pool_create("io", streamChunk, SD_STREAM_BUFFERS, MEM_DMA, 0, false);
+}
+
+size_t sd_stream_chunk_size() {
+  return streamChunk;
+}
+
+void sd_stream_set_chunk_size(size_t chunk) {
+  if (chunk < SD_STREAM_MIN_CHUNK) chunk = SD_STREAM_MIN_CHUNK;
+  if (chunk > SD_STREAM_MAX_CHUNK) chunk = SD_STREAM_MAX_CHUNK;
+  streamChunk = chunk & ~(size_t)511;  // whole sectors
+}
+
+// ==================================================================
+//  Buffer allocation
+// ==================================================================
+// SDMMC can only DMA into internal RAM; a PSRAM destination makes
+// the driver fall back to sector-by-sector bounce copies. Prefer
+// DMA-capable memory and only use PSRAM when internal RAM is short.
+static uint8_t *alloc_chunk(size_t size) {
+  uint8_t *buf = size <= mem_pool_block_size(ioPool) ? (uint8_t *)mem_pool_get(ioPool) : NULL;
+  if (buf) return buf;
+  return (uint8_t *)mem_alloc_caps(MEM_DOWNLOAD, size, MEM_DMA, MEM_PSRAM);
+}
+
+static void free_bufs(sd_pipeline_t *p) {
+  for (int i = 0; i < SD_STREAM_BUFFERS; i++) {
+    pool_free(MEM_DOWNLOAD, p->bufs[i]);
+    p->bufs[i] = NULL;
+  }
+}
+
+// ==================================================================
+//  Reader task: fill free buffers, hand them over as full
+// ==================================================================
+static void reader_task(void *arg) {
+  sd_pipeline_t *p = (sd_pipeline_t *)arg;
+  sd_chunk_msg_t msg;
+
+  while (true) {
+    if (xQueueReceive(p->freeQ, &msg.index, portMAX_DELAY) != pdTRUE) continue;
+    if (p->abort) break;
+
+    size_t want = p->remaining < p->chunk ? p->remaining : p->chunk;
+    if (want == 0) {
+      msg.len = 0;
+    } else {
+      size_t got = p->file->read(p->bufs[msg.index], want);
+      msg.len = got > 0 ? (int)got : -1;  // short read before EOF = error
+      if (got > 0) p->remaining -= got;
+    }
+
+    xQueueSend(p->fullQ, &msg, portMAX_DELAY);
+    if (msg.len <= 0) break;
+  }
+
+  xTaskNotifyGive(p->owner);
+  vTaskDelete(NULL);
+}
+
+// ==================================================================
+//  Pipeline driver: runs the sink on the calling task
+// ==================================================================
+static esp_err_t pipeline_run(File &file, size_t len, size_t chunk,
+                              sd_sink_fn sink, void *arg, size_t *sent) {
+  sd_pipeline_t p;
+  memset(&p, 0, sizeof(p));
+  p.file = &file;
+  p.remaining = len;
+  p.chunk = chunk;
+  p.owner = xTaskGetCurrentTaskHandle();
+  if (sent) *sent = 0;
+
+  for (int i = 0; i < SD_STREAM_BUFFERS; i++) {
+    p.bufs[i] = alloc_chunk(chunk);
+    if (!p.bufs[i]) {
+      log_e("SD stream: failed to allocate %u byte buffer", chunk);
+      free_bufs(&p);
+      return ESP_ERR_NO_MEM;
+    }
+  }
+
+  p.freeQ = xQueueCreate(SD_STREAM_BUFFERS, sizeof(int));
+  p.fullQ = xQueueCreate(SD_STREAM_BUFFERS, sizeof(sd_chunk_msg_t));
+  if (!p.freeQ || !p.fullQ) {
+    if (p.freeQ) vQueueDelete(p.freeQ);
+    if (p.fullQ) vQueueDelete(p.fullQ);
+    free_bufs(&p);
+    return ESP_ERR_NO_MEM;
+  }
+  for (int i = 0; i < SD_STREAM_BUFFERS; i++) {
+    xQueueSend(p.freeQ, &i, 0);
+  }
+
+  if (xTaskCreatePinnedToCore(reader_task, "sd_reader", TASK_SD_READER_STACK, &p,
+                              TASK_SD_READER_PRIO, NULL, TASK_SD_READER_CORE) != pdPASS) {
+    vQueueDelete(p.freeQ);
+    vQueueDelete(p.fullQ);
+    free_bufs(&p);
+    return ESP_ERR_NO_MEM;
+  }
+
+  esp_err_t res = ESP_OK;
+  sd_chunk_msg_t msg;
+  while (true) {
+    xQueueReceive(p.fullQ, &msg, portMAX_DELAY);
+    if (msg.len == 0) break;
+    if (msg.len < 0) {
+      log_e("SD stream: read failed with %u bytes left", p.remaining);
+      res = ESP_FAIL;
+      break;
+    }
+    if (sink(arg, p.bufs[msg.index], msg.len) != ESP_OK) {
+      // Stop the reader: flag first, then return the token it waits on
+      p.abort = true;
+      xQueueSend(p.freeQ, &msg.index, 0);
+      res = ESP_FAIL;
+      break;
+    }
+    if (sent) *sent += msg.len;
+    xQueueSend(p.freeQ, &msg.index, 0);
+  }
+
+  // Wait for the reader to exit before its buffers go away
+  ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  vQueueDelete(p.freeQ);
+  vQueueDelete(p.fullQ);
+  free_bufs(&p);
+  return res;
+}
+
+// ==================================================================
+//  HTTP sink
+// ==================================================================
+static esp_err_t http_sink(void *arg, const uint8_t *data, size_t len) {
+  return httpd_resp_send_chunk((httpd_req_t *)arg, (const char *)data, len);
+}
+
+esp_err_t sd_stream_send(httpd_req_t *req, File &file, size_t len, size_t *sent) {
+  return pipeline_run(file, len, streamChunk, http_sink, req, sent);
+}
+
+// ==================================================================
+//  Benchmark: legacy loop vs read-ahead pipeline
+// ==================================================================
+static void finish_pass(sd_stream_pass_t *pass, size_t bytes, int64_t start_us) {
+  int64_t us = esp_timer_get_time() - start_us;
+  pass->bytes = bytes;
+  pass->elapsed_ms = (uint32_t)(us / 1000);
+  pass->mbps = us > 0 ? (float)bytes / (float)us : 0;  // bytes/us == MB/s
+}
+
+esp_err_t sd_stream_bench(httpd_req_t *req, const char *path, sd_stream_bench_t *out) {
+  memset(out, 0, sizeof(*out));
+  out->chunk = streamChunk;
+
+  // Pass 1: the original download loop (8 KB read, send, 1 tick sleep)
+  File file = SD_MMC.open(path, FILE_READ);
+  if (!file) return ESP_ERR_NOT_FOUND;
+  size_t fileSize = file.size();
+
+  uint8_t *buffer = (uint8_t *)mem_alloc(MEM_BENCH, SD_STREAM_LEGACY_CHUNK);
+  if (!buffer) {
+    file.close();
+    return ESP_ERR_NO_MEM;
+  }
+  esp_err_t res = ESP_OK;
+  size_t total = 0;
+  size_t bytesRead;
+  int64_t start = esp_timer_get_time();
+  while ((bytesRead = file.read(buffer, SD_STREAM_LEGACY_CHUNK)) > 0) {
+    res = httpd_resp_send_chunk(req, (const char *)buffer, bytesRead);
+    if (res != ESP_OK) break;
+    total += bytesRead;
+    vTaskDelay(1);
+  }
+  finish_pass(&out->legacy, total, start);
+  mem_free(MEM_BENCH, buffer);
+  file.close();
+  if (res != ESP_OK) return res;
+
+  // Pass 2: read-ahead pipeline with the tuned chunk size, same response
+  file = SD_MMC.open(path, FILE_READ);
+  if (!file) return ESP_FAIL;
+  start = esp_timer_get_time();
+  res = pipeline_run(file, fileSize, streamChunk, http_sink, req, &total);
+  finish_pass(&out->pipeline, total, start);
+  file.close();
+  if (res != ESP_OK) return res;
+
+  log_i("SD bench %s: legacy %.2f MB/s, pipeline %.2f MB/s (%u B chunks)",
+        path, out->legacy.mbps, out->pipeline.mbps, out->chunk);
+  return httpd_resp_send_chunk(req, NULL, 0);
+}
@@ -0,0 +1,54 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  SD Read-Ahead Streaming (sd_stream.h)
+ * =============================================================
+ *  A reader task fills a ring of large buffers from the SD card
+ *  while the HTTP task sends the previous one, so card reads and
+ *  WiFi sends overlap instead of alternating.
+ * =============================================================
+ */
+#ifndef SD_STREAM_H
+#define SD_STREAM_H
+
+#include "esp_http_server.h"
+#include "FS.h"
+
+// Number of buffers in flight (2 = classic double buffering)
+#define SD_STREAM_BUFFERS     2
+
+// Chunk size bounds; the actual size is picked per card in sd_stream_init()
+#define SD_STREAM_MIN_CHUNK   (4 * 1024)
+#define SD_STREAM_MAX_CHUNK   (32 * 1024)
+
+// Result of one benchmark pass
+typedef struct {
+  size_t bytes;
+  uint32_t elapsed_ms;
+  float mbps;
+} sd_stream_pass_t;
+
+// Full benchmark result (legacy loop vs read-ahead pipeline)
+typedef struct {
+  size_t chunk;
+  sd_stream_pass_t legacy;
+  sd_stream_pass_t pipeline;
+} sd_stream_bench_t;
+
+// Pick the chunk size for the mounted card (call after SD_MMC.begin)
+void sd_stream_init();
+
+size_t sd_stream_chunk_size();
+void sd_stream_set_chunk_size(size_t chunk);
+
+// Send `len` bytes of an open file as HTTP chunks. Does NOT send the
+// terminating empty chunk, so several files can share one response.
+esp_err_t sd_stream_send(httpd_req_t *req, File &file, size_t len, size_t *sent);
+
+// Send `path` to the client twice in one chunked response, first with
+// the old 8 KB + vTaskDelay(1) loop and then through the read-ahead
+// pipeline, timing each pass. Sends the terminating chunk on success.
+// ESP_ERR_NOT_FOUND / ESP_ERR_NO_MEM mean nothing was sent yet.
+esp_err_t sd_stream_bench(httpd_req_t *req, const char *path, sd_stream_bench_t *out);
+
+#endif  // SD_STREAM_H
@@ -0,0 +1,309 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Write-Behind SD Writer (sd_writer.cpp)
+ * =============================================================
+ *  Jobs go into a FreeRTOS queue by value; the JPEG data lives
+ *  in PSRAM and is owned by the job until the writer frees it.
+ *  Submission is rejected (never blocks) when the queue or the
+ *  byte budget is full, so a stalled card cannot eat all PSRAM.
+ * =============================================================
+ */
+
+#include "sd_writer.h"
+#include "media_store.h"
+#include "json_writer.h"
+#include "task_config.h"
+#include "metrics.h"
+#include "mem_track.h"
+#include "img_converters.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "FS.h"
+#include "SD_MMC.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+typedef struct {
+  uint32_t seq;
+  char name[SD_WRITER_NAME_LEN];
+  uint8_t *data;
+  size_t len;
+  bool owned;     // writer frees `data` when done
+} sd_write_job_t;
+
+typedef struct {
+  uint32_t seq;
+  char name[SD_WRITER_NAME_LEN];
+  uint32_t len;
+  uint32_t ms;
+  sd_write_state_t state;
+} sd_write_record_t;
+
+static QueueHandle_t jobQueue = NULL;
+static SemaphoreHandle_t writerLock = NULL;
+static sd_write_record_t history[SD_WRITER_HISTORY];
+static uint32_t nextSeq = 1;
+static volatile uint32_t completedSeq = 0;   // jobs are written in order
+static uint32_t pending = 0;
+static size_t queuedBytes = 0;
+static uint32_t writtenCount = 0;
+static uint32_t failedCount = 0;
+static uint64_t bytesWritten = 0;
+static uint64_t totalWriteMs = 0;
+static uint32_t maxWriteMs = 0;
+
+static const char *state_name(sd_write_state_t st) {
+  switch (st) {
+    case SD_WRITE_DONE:   return "written";
+    case SD_WRITE_FAILED: return "failed";
+    default:              return "queued";
+  }
+}
+
+// ==================================================================
+//  Writer task
+// ==================================================================
+static bool write_job(const sd_write_job_t *job) {
+  char path[MEDIA_PATH_MAX];
+  if (!media_create_path(job->name, path, sizeof(path))) return false;
+
+  File file = SD_MMC.open(path, FILE_WRITE);
+  if (!file) return false;
+  size_t written = file.write(job->data, job->len);
+  file.close();
+
+  if (written != job->len) {
+    SD_MMC.remove(path);  // never leave a truncated photo behind
+    return false;
+  }
+  return true;
+}
+
+static void sd_writer_task(void *arg) {
+  sd_write_job_t job;
+  while (true) {
+    if (xQueueReceive(jobQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+
+    int64_t start = esp_timer_get_time();
+    bool ok = write_job(&job);
+    int64_t end = esp_timer_get_time();
+    uint32_t ms = (uint32_t)((end - start) / 1000);
+    metrics_observe(&metrics_sd_write_us, metrics_us_since(start, end));
+    if (job.owned) mem_free(MEM_SD_WRITER, job.data);
+
+    xSemaphoreTake(writerLock, portMAX_DELAY);
+    sd_write_record_t *rec = &history[job.seq % SD_WRITER_HISTORY];
+    if (rec->seq == job.seq) {
+      rec->state = ok ? SD_WRITE_DONE : SD_WRITE_FAILED;
+      rec->ms = ms;
+    }
+    completedSeq = job.seq;
+    pending--;
+    if (job.owned) queuedBytes -= job.len;
+    if (ok) {
+      writtenCount++;
+      bytesWritten += job.len;
+      totalWriteMs += ms;
+      if (ms > maxWriteMs) maxWriteMs = ms;
+    } else {
+      failedCount++;
+    }
+    xSemaphoreGive(writerLock);
+
+    if (ok) log_i("Writer: %s saved (%u bytes, %ums)", job.name, (unsigned)job.len, ms);
+    else log_e("Writer: failed to save %s", job.name);
+  }
+}
+
+bool sd_writer_init() {
+  if (jobQueue) return true;
+  writerLock = xSemaphoreCreateMutex();
+  jobQueue = xQueueCreate(SD_WRITER_QUEUE_LEN, sizeof(sd_write_job_t));
+  if (!writerLock || !jobQueue) return false;
+  return xTaskCreatePinnedToCore(sd_writer_task, "sd_writer", TASK_SD_WRITER_STACK, NULL,
+                                 TASK_SD_WRITER_PRIO, NULL, TASK_SD_WRITER_CORE) == pdPASS;
+}
+
+// ==================================================================
+//  Submission
+// ==================================================================
+// Try to queue a prepared job once; never blocks on the queue
+static bool enqueue(sd_write_job_t *job) {
+  // Sequence numbers follow queue order because both happen under the lock
+  xSemaphoreTake(writerLock, portMAX_DELAY);
+  bool ok = !job->owned || queuedBytes + job->len <= SD_WRITER_MAX_BYTES;
+  if (ok) {
+    job->seq = nextSeq;
+    ok = xQueueSend(jobQueue, job, 0) == pdTRUE;
+  }
+  if (ok) {
+    nextSeq++;
+    pending++;
+    if (job->owned) queuedBytes += job->len;
+    sd_write_record_t *rec = &history[job->seq % SD_WRITER_HISTORY];
+    rec->seq = job->seq;
+    strlcpy(rec->name, job->name, sizeof(rec->name));
+    rec->len = job->len;
+    rec->ms = 0;
+    rec->state = SD_WRITE_QUEUED;
+  }
+  xSemaphoreGive(writerLock);
+  return ok;
+}
+
+static void prepare(sd_write_job_t *job, const char *name, const uint8_t *data, size_t len, bool owned) {
+  if (name[0] == '/') name++;
+  strlcpy(job->name, name, sizeof(job->name));
+  job->data = (uint8_t *)data;
+  job->len = len;
+  job->owned = owned;
+}
+
+bool sd_writer_submit(const char *name, uint8_t *data, size_t len, uint32_t *seq) {
+  if (!jobQueue || !data || !len) return false;
+
+  sd_write_job_t job;
+  prepare(&job, name, data, len, true);
+  if (!enqueue(&job)) {
+    log_e("Writer: queue full, rejected %s", job.name);
+    return false;
+  }
+  if (seq) *seq = job.seq;
+  return true;
+}
+
+bool sd_writer_submit_borrowed(const char *name, const uint8_t *data, size_t len,
+                               uint32_t *seq, uint32_t waitMs) {
+  if (!jobQueue || !data || !len) return false;
+
+  sd_write_job_t job;
+  prepare(&job, name, data, len, false);
+
+  // The lock is never held while waiting, or the writer could not finish a job
+  int64_t deadline = esp_timer_get_time() + (int64_t)waitMs * 1000;
+  while (!enqueue(&job)) {
+    if (esp_timer_get_time() >= deadline) {
+      log_e("Writer: no queue slot for %s", job.name);
+      return false;
+    }
+    vTaskDelay(5 / portTICK_PERIOD_MS);
+  }
+  if (seq) *seq = job.seq;
+  return true;
+}
+
+bool sd_writer_submit_fb(camera_fb_t *fb, const char *name, uint32_t *seq, size_t *len) {
+  uint8_t *data = NULL;
+  size_t dataLen = 0;
+
+  if (fb->format == PIXFORMAT_JPEG) {
+    // Internal RAM fallback for boards without PSRAM
+    data = (uint8_t *)mem_alloc_caps(MEM_SD_WRITER, fb->len, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+    if (!data) return false;
+    memcpy(data, fb->buf, fb->len);
+    dataLen = fb->len;
+  } else if (!frame2jpg(fb, 80, &data, &dataLen)) {
+    return false;
+  } else {
+    mem_adopt(MEM_SD_WRITER, data);
+  }
+
+  if (!sd_writer_submit(name, data, dataLen, seq)) {
+    mem_free(MEM_SD_WRITER, data);
+    return false;
+  }
+  if (len) *len = dataLen;
+  return true;
+}
+
+// ==================================================================
+//  Queries
+// ==================================================================
+uint32_t sd_writer_pending() {
+  if (!writerLock) return 0;
+  xSemaphoreTake(writerLock, portMAX_DELAY);
+  uint32_t n = pending;
+  xSemaphoreGive(writerLock);
+  return n;
+}
+
+bool sd_writer_wait_idle(uint32_t timeoutMs) {
+  int64_t deadline = esp_timer_get_time() + (int64_t)timeoutMs * 1000;
+  while (sd_writer_pending() > 0) {
+    if (esp_timer_get_time() >= deadline) return false;
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+  return true;
+}
+
+bool sd_writer_wait_seq(uint32_t seq, uint32_t timeoutMs) {
+  int64_t deadline = esp_timer_get_time() + (int64_t)timeoutMs * 1000;
+  while (completedSeq < seq) {
+    if (esp_timer_get_time() >= deadline) return false;
+    vTaskDelay(10 / portTICK_PERIOD_MS);
+  }
+  return true;
+}
+
+bool sd_writer_state(uint32_t seq, sd_write_state_t *state) {
+  if (!writerLock) return false;
+  xSemaphoreTake(writerLock, portMAX_DELAY);
+  const sd_write_record_t *rec = &history[seq % SD_WRITER_HISTORY];
+  bool found = rec->seq == seq && seq != 0;
+  if (found) *state = rec->state;
+  xSemaphoreGive(writerLock);
+  return found;
+}
+
+esp_err_t sd_writer_send_status(httpd_req_t *req) {
+  char chunk[512];
+  json_writer_t w;
+  jw_init(&w, chunk, sizeof(chunk), req);
+  jw_obj_open(&w);
+
+  if (!writerLock) {
+    jw_bool(&w, "success", false);
+    jw_str(&w, "error", "Writer not running");
+    jw_obj_close(&w);
+    return jw_finish(&w);
+  }
+
+  // Snapshot under the lock, format outside it
+  sd_write_record_t recent[SD_WRITER_HISTORY];
+  xSemaphoreTake(writerLock, portMAX_DELAY);
+  memcpy(recent, history, sizeof(recent));
+  uint32_t last = nextSeq - 1;
+  jw_bool(&w, "success", true);
+  jw_uint(&w, "pending", pending);
+  jw_uint(&w, "queued_bytes", queuedBytes);
+  jw_uint(&w, "written", writtenCount);
+  jw_uint(&w, "failed", failedCount);
+  jw_uint(&w, "bytes_written", bytesWritten);
+  jw_uint(&w, "avg_write_ms", writtenCount ? totalWriteMs / writtenCount : 0);
+  jw_uint(&w, "max_write_ms", maxWriteMs);
+  xSemaphoreGive(writerLock);
+
+  // Newest first
+  jw_arr_open(&w, "recent");
+  for (uint32_t i = 0; i < SD_WRITER_HISTORY && i < last && !w.error; i++) {
+    const sd_write_record_t *rec = &recent[(last - i) % SD_WRITER_HISTORY];
+    if (rec->seq != last - i) continue;
+    jw_obj_open(&w);
+    jw_uint(&w, "seq", rec->seq);
+    jw_str(&w, "name", rec->name);
+    jw_uint(&w, "bytes", rec->len);
+    jw_str(&w, "state", state_name(rec->state));
+    jw_uint(&w, "ms", rec->ms);
+    jw_obj_close(&w);
+  }
+  jw_arr_close(&w);
+  jw_obj_close(&w);
+  return jw_finish(&w);
+}
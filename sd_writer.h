@@ -0,0 +1,64 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Write-Behind SD Writer (sd_writer.h)
+ * =============================================================
+ *  Photo captures hand their JPEG to this queue and return at
+ *  once; the camera frame buffer goes back to the driver right
+ *  after the copy instead of after the FAT write. One writer
+ *  task persists the queue in submission order.
+ * =============================================================
+ */
+#ifndef SD_WRITER_H
+#define SD_WRITER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_camera.h"
+#include "esp_http_server.h"
+
+#define SD_WRITER_QUEUE_LEN     16
+#define SD_WRITER_MAX_BYTES     (3 * 1024 * 1024)   // queued JPEG bytes (PSRAM)
+#define SD_WRITER_NAME_LEN      40
+#define SD_WRITER_HISTORY       16                  // recent jobs kept for /save-status
+
+typedef enum {
+  SD_WRITE_QUEUED = 0,
+  SD_WRITE_DONE,
+  SD_WRITE_FAILED
+} sd_write_state_t;
+
+// Create the queue and start the writer task
+bool sd_writer_init();
+
+// Queue a mem_alloc(MEM_SD_WRITER) buffer under a media name; the
+// writer frees it.
+// On false the caller still owns `data`.
+bool sd_writer_submit(const char *name, uint8_t *data, size_t len, uint32_t *seq);
+
+// Copy (or encode) a frame into a queue buffer and submit it.
+// The frame buffer can be returned as soon as this returns.
+bool sd_writer_submit_fb(camera_fb_t *fb, const char *name, uint32_t *seq, size_t *len);
+
+// Queue a buffer the caller keeps owning (e.g. a burst arena). Waits up
+// to `waitMs` for a queue slot; not counted against SD_WRITER_MAX_BYTES.
+// The buffer must stay valid until sd_writer_wait_seq(seq) returns true.
+bool sd_writer_submit_borrowed(const char *name, const uint8_t *data, size_t len,
+                               uint32_t *seq, uint32_t waitMs);
+
+// Block until job `seq` (and, jobs being in order, all before it) is done
+bool sd_writer_wait_seq(uint32_t seq, uint32_t timeoutMs);
+
+// Jobs submitted but not yet written
+uint32_t sd_writer_pending();
+
+// Block until the queue is empty (or the timeout expires)
+bool sd_writer_wait_idle(uint32_t timeoutMs);
+
+// State of a job, if it is still in the history window
+bool sd_writer_state(uint32_t seq, sd_write_state_t *state);
+
+// JSON: totals and the most recent jobs
+esp_err_t sd_writer_send_status(httpd_req_t *req);
+
+#endif  // SD_WRITER_H
@@ -0,0 +1,112 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Sensor Parameter Registry (sensor_params.h)
+ * =============================================================
+ *  The one list of camera settings: name, setter, getter and
+ *  accepted range. /control dispatch, range checks, the status
+ *  JSON and preset capture are all generated from it, so adding
+ *  a setting here is the only change needed.
+ *
+ *  The table must stay sorted by name; a static_assert checks
+ *  it at compile time and lookups are a binary search.
+ * =============================================================
+ */
+#ifndef SENSOR_PARAMS_H
+#define SENSOR_PARAMS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "esp_camera.h"
+#include "json_writer.h"
+
+#define SENSOR_PARAM_NO_PRESET  0x01    // not captured into presets
+
+typedef int (*sensor_param_set_fn)(sensor_t *s, int val);
+typedef int (*sensor_param_get_fn)(const sensor_t *s);
+
+typedef struct {
+  const char *name;
+  sensor_param_set_fn set;
+  sensor_param_get_fn get;
+  int16_t min;
+  int16_t max;
+  uint8_t flags;
+} sensor_param_t;
+
+#define SP_SET(fn)     [](sensor_t *s, int v) { return s->fn(s, v); }
+#define SP_GET(field)  [](const sensor_t *s) { return (int)s->status.field; }
+
+// Sorted by name (strcmp order)
+constexpr sensor_param_t SENSOR_PARAMS[] = {
+  { "ae_level",       SP_SET(set_ae_level),       SP_GET(ae_level),       -2, 2,    0 },
+  { "aec",            SP_SET(set_exposure_ctrl),  SP_GET(aec),             0, 1,    0 },
+  { "aec2",           SP_SET(set_aec2),           SP_GET(aec2),            0, 1,    0 },
+  { "aec_value",      SP_SET(set_aec_value),      SP_GET(aec_value),       0, 1200, 0 },
+  { "agc",            SP_SET(set_gain_ctrl),      SP_GET(agc),             0, 1,    0 },
+  { "agc_gain",       SP_SET(set_agc_gain),       SP_GET(agc_gain),        0, 30,   0 },
+  { "awb",            SP_SET(set_whitebal),       SP_GET(awb),             0, 1,    0 },
+  { "awb_gain",       SP_SET(set_awb_gain),       SP_GET(awb_gain),        0, 1,    0 },
+  { "bpc",            SP_SET(set_bpc),            SP_GET(bpc),             0, 1,    0 },
+  { "brightness",     SP_SET(set_brightness),     SP_GET(brightness),     -2, 2,    0 },
+  { "colorbar",       SP_SET(set_colorbar),       SP_GET(colorbar),        0, 1,    SENSOR_PARAM_NO_PRESET },
+  { "contrast",       SP_SET(set_contrast),       SP_GET(contrast),       -2, 2,    0 },
+  { "dcw",            SP_SET(set_dcw),            SP_GET(dcw),             0, 1,    0 },
+  { "framesize",
+    [](sensor_t *s, int v) { return s->pixformat == PIXFORMAT_JPEG ? s->set_framesize(s, (framesize_t)v) : 0; },
+    SP_GET(framesize),                                                     0, FRAMESIZE_INVALID - 1, 0 },
+  { "gainceiling",
+    [](sensor_t *s, int v) { return s->set_gainceiling(s, (gainceiling_t)v); },
+    SP_GET(gainceiling),                                                   0, 6,    0 },
+  { "hmirror",        SP_SET(set_hmirror),        SP_GET(hmirror),         0, 1,    0 },
+  { "lenc",           SP_SET(set_lenc),           SP_GET(lenc),            0, 1,    0 },
+  { "quality",        SP_SET(set_quality),        SP_GET(quality),         4, 63,   0 },
+  { "raw_gma",        SP_SET(set_raw_gma),        SP_GET(raw_gma),         0, 1,    0 },
+  { "saturation",     SP_SET(set_saturation),     SP_GET(saturation),     -2, 2,    0 },
+  { "sharpness",      SP_SET(set_sharpness),      SP_GET(sharpness),      -2, 2,    SENSOR_PARAM_NO_PRESET },  // OV2640 rejects
+  { "special_effect", SP_SET(set_special_effect), SP_GET(special_effect),  0, 6,    0 },
+  { "vflip",          SP_SET(set_vflip),          SP_GET(vflip),           0, 1,    0 },
+  { "wb_mode",        SP_SET(set_wb_mode),        SP_GET(wb_mode),         0, 4,    0 },
+  { "wpc",            SP_SET(set_wpc),            SP_GET(wpc),             0, 1,    0 },
+};
+
+#undef SP_SET
+#undef SP_GET
+
+constexpr size_t SENSOR_PARAM_COUNT = sizeof(SENSOR_PARAMS) / sizeof(SENSOR_PARAMS[0]);
+
+constexpr int sensor_param_strcmp(const char *a, const char *b) {
+  return (*a != *b || !*a) ? (int)(unsigned char)*a - (int)(unsigned char)*b
+                           : sensor_param_strcmp(a + 1, b + 1);
+}
+
+constexpr bool sensor_params_sorted(size_t i = 1) {
+  return i >= SENSOR_PARAM_COUNT ||
+         (sensor_param_strcmp(SENSOR_PARAMS[i - 1].name, SENSOR_PARAMS[i].name) < 0 &&
+          sensor_params_sorted(i + 1));
+}
+
+static_assert(sensor_params_sorted(), "SENSOR_PARAMS must be sorted by name with no duplicates");
+
+// Binary search; NULL if the name is not a sensor parameter
+inline const sensor_param_t *sensor_param_find(const char *name) {
+  size_t lo = 0, hi = SENSOR_PARAM_COUNT;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    int c = strcmp(name, SENSOR_PARAMS[mid].name);
+    if (c == 0) return &SENSOR_PARAMS[mid];
+    if (c < 0) hi = mid;
+    else lo = mid + 1;
+  }
+  return NULL;
+}
+
+// "name":value for every parameter, into the writer's current object
+inline void sensor_params_write(const sensor_t *s, json_writer_t *w) {
+  for (size_t i = 0; i < SENSOR_PARAM_COUNT; i++) {
+    jw_int(w, SENSOR_PARAMS[i].name, SENSOR_PARAMS[i].get(s));
+  }
+}
+
+#endif  // SENSOR_PARAMS_H
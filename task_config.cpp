@@ -0,0 +1,152 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Task Report (task_config.cpp)
+ * =============================================================
+ *  Two uxTaskGetSystemState() samples `windowMs` apart; each
+ *  task's share is its run-time delta over the total delta, so
+ *  100% is one full core. Core load is 100% minus that core's
+ *  idle task. Tasks are matched by task number, which is never
+ *  reused, so a task created mid-window only counts its own time.
+ * =============================================================
+ */
+
+#include "task_config.h"
+#include "json_writer.h"
+#include "mem_track.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+#define TASK_REPORT_SLACK 8     // tasks that may appear between sizing and sampling
+
+#if configGENERATE_RUN_TIME_STATS
+#define TASK_REPORT_CPU 1
+#else
+#define TASK_REPORT_CPU 0
+#endif
+
+#if configUSE_TRACE_FACILITY
+
+typedef struct {
+  TaskStatus_t *tasks;
+  UBaseType_t count;
+  uint32_t total;
+} task_sample_t;
+
+static bool take_sample(task_sample_t *s) {
+  UBaseType_t cap = uxTaskGetNumberOfTasks() + TASK_REPORT_SLACK;
+  s->tasks = (TaskStatus_t *)mem_alloc(MEM_SYSTEM, cap * sizeof(TaskStatus_t));
+  if (!s->tasks) return false;
+  s->total = 0;
+#if TASK_REPORT_CPU
+  s->count = uxTaskGetSystemState(s->tasks, cap, &s->total);
+#else
+  s->count = uxTaskGetSystemState(s->tasks, cap, NULL);
+#endif
+  return s->count > 0;
+}
+
+static uint32_t run_delta(const task_sample_t *before, const TaskStatus_t *t) {
+#if TASK_REPORT_CPU
+  for (UBaseType_t i = 0; i < before->count; i++) {
+    if (before->tasks[i].xTaskNumber == t->xTaskNumber) {
+      return t->ulRunTimeCounter - before->tasks[i].ulRunTimeCounter;
+    }
+  }
+  return t->ulRunTimeCounter;
+#else
+  return 0;
+#endif
+}
+
+static int task_core(const TaskStatus_t *t) {
+#if configTASKLIST_INCLUDE_COREID
+  return t->xCoreID == tskNO_AFFINITY ? -1 : (int)t->xCoreID;
+#else
+  return -1;
+#endif
+}
+
+static const char *state_name(eTaskState st) {
+  switch (st) {
+    case eRunning:   return "running";
+    case eReady:     return "ready";
+    case eBlocked:   return "blocked";
+    case eSuspended: return "suspended";
+    default:         return "deleted";
+  }
+}
+
+esp_err_t task_report_send(httpd_req_t *req, uint32_t windowMs) {
+  if (windowMs > TASK_REPORT_MAX_MS) windowMs = TASK_REPORT_MAX_MS;
+
+  task_sample_t before = { NULL, 0, 0 }, after = { NULL, 0, 0 };
+  bool ok = take_sample(&before);
+  if (ok) {
+    vTaskDelay(pdMS_TO_TICKS(windowMs));
+    ok = take_sample(&after);
+  }
+  if (!ok) {
+    mem_free(MEM_SYSTEM, before.tasks);
+    mem_free(MEM_SYSTEM, after.tasks);
+    return httpd_resp_send_500(req);
+  }
+
+  bool cpu = TASK_REPORT_CPU && after.total > before.total;
+  uint32_t totalDelta = after.total - before.total;
+  float idle[2] = { -1, -1 };
+
+  char buf[512];
+  json_writer_t w;
+  jw_init(&w, buf, sizeof(buf), req);
+  jw_obj_open(&w);
+  jw_bool(&w, "success", true);
+  jw_uint(&w, "window_ms", windowMs);
+  jw_arr_open(&w, "tasks");
+  for (UBaseType_t i = 0; i < after.count; i++) {
+    const TaskStatus_t *t = &after.tasks[i];
+    int core = task_core(t);
+    float pct = cpu ? 100.0f * run_delta(&before, t) / totalDelta : 0;
+    if (cpu && !strncmp(t->pcTaskName, "IDLE", 4)) {
+      int idleCore = core >= 0 ? core : (t->pcTaskName[4] == '1');
+      idle[idleCore & 1] = pct;
+    }
+
+    jw_obj_open(&w);
+    jw_str(&w, "name", t->pcTaskName);
+    jw_uint(&w, "prio", t->uxCurrentPriority);
+    jw_int(&w, "core", core);
+    jw_str(&w, "state", state_name(t->eCurrentState));
+    jw_uint(&w, "stack_free", t->usStackHighWaterMark);  // bytes on ESP-IDF
+    if (cpu) jw_float(&w, "cpu", pct);
+    else jw_null(&w, "cpu");
+    jw_obj_close(&w);
+  }
+  jw_arr_close(&w);
+
+  // Load per core from its idle task; null without run-time stats
+  jw_arr_open(&w, "core_load");
+  for (int c = 0; c < portNUM_PROCESSORS && c < 2; c++) {
+    if (idle[c] >= 0) jw_float(&w, NULL, 100.0f - idle[c]);
+    else jw_null(&w, NULL);
+  }
+  jw_arr_close(&w);
+  jw_obj_close(&w);
+
+  mem_free(MEM_SYSTEM, before.tasks);
+  mem_free(MEM_SYSTEM, after.tasks);
+  return jw_finish(&w);
+}
+
+#else  // !configUSE_TRACE_FACILITY
+
+esp_err_t task_report_send(httpd_req_t *req, uint32_t windowMs) {
+  static const char msg[] = "{\"success\":false,\"error\":\"Task statistics are disabled in this build\"}";
+  return httpd_resp_send(req, msg, sizeof(msg) - 1);
+}
+
+#endif
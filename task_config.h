@@ -0,0 +1,90 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Task Layout (task_config.h)
+ * =============================================================
+ *  Every task this sketch creates takes its stack, priority and
+ *  core from here. The split:
+ *
+ *    core 1 (APP)  capture + publish: the stream server grabs
+ *                  frames and hands them to lwIP; Arduino loop();
+ *                  motion analysis below the stream's priority
+ *    core 0 (PRO)  network: WiFi driver and lwIP (IDF, prio 18+),
+ *                  the control server and its HTTP workers
+ *                  (downloads, thumbnails), events, jobs;
+ *                  storage tasks below all of them
+ *
+ *  A busy download or export therefore competes with WiFi on
+ *  core 0, never with the stream loop on core 1. The camera
+ *  driver's own task is created by esp32-camera on the core it
+ *  was built for; GET /tasks shows where everything landed.
+ * =============================================================
+ */
+#ifndef TASK_CONFIG_H
+#define TASK_CONFIG_H
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_http_server.h"
+
+#if CONFIG_FREERTOS_UNICORE
+#define CORE_CAPTURE   0
+#define CORE_NETWORK   0
+#else
+#define CORE_CAPTURE   1
+#define CORE_NETWORK   0
+#endif
+#define CORE_STORAGE   CORE_NETWORK
+
+//      task                         stack  prio  core
+// Capture / publish
+#define TASK_STREAM_STACK            4096
+#define TASK_STREAM_PRIO             6
+#define TASK_STREAM_CORE             CORE_CAPTURE
+
+// Network
+#define TASK_CONTROL_STACK           4096
+#define TASK_CONTROL_PRIO            4
+#define TASK_CONTROL_CORE            CORE_NETWORK
+
+#define TASK_HTTP_WORKER_STACK       4096     // runs control-server handlers, same budget
+#define TASK_HTTP_WORKER_PRIO        4
+#define TASK_HTTP_WORKER_CORE        CORE_NETWORK
+
+#define TASK_SD_READER_STACK         3072     // download read-ahead, paired with its sender
+#define TASK_SD_READER_PRIO          4
+#define TASK_SD_READER_CORE          CORE_NETWORK
+
+#define TASK_EVENTS_STACK            4096
+#define TASK_EVENTS_PRIO             3
+#define TASK_EVENTS_CORE             CORE_NETWORK
+
+#define TASK_JOBS_STACK              4096     // WiFi connect/scan, bulk delete, export, long bursts
+#define TASK_JOBS_PRIO               3
+#define TASK_JOBS_CORE               CORE_NETWORK
+
+// Storage
+#define TASK_SD_WRITER_STACK         4096
+#define TASK_SD_WRITER_PRIO          2
+#define TASK_SD_WRITER_CORE          CORE_STORAGE
+
+#define TASK_BURST_FLUSH_STACK       3072
+#define TASK_BURST_FLUSH_PRIO        2
+#define TASK_BURST_FLUSH_CORE        CORE_STORAGE
+
+#define TASK_MEDIA_MIGRATE_STACK     4096
+#define TASK_MEDIA_MIGRATE_PRIO      1
+#define TASK_MEDIA_MIGRATE_CORE      CORE_STORAGE
+
+// Analysis
+#define TASK_MOTION_STACK            4096     // DC-only JPEG decode + frame differencing
+#define TASK_MOTION_PRIO             2        // below the stream: it only gets spare cycles
+#define TASK_MOTION_CORE             CORE_CAPTURE
+
+// Longest /tasks sampling window
+#define TASK_REPORT_MAX_MS           5000
+
+// Per-task CPU use over `windowMs`, stack headroom, priority and core
+esp_err_t task_report_send(httpd_req_t *req, uint32_t windowMs);
+
+#endif  // TASK_CONFIG_H
@@ -0,0 +1,223 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Gallery Thumbnails (thumbs.cpp)
+ * =============================================================
+ *  Photos are decoded directly. For recordings the first frame
+ *  of the MJPEG file is used: the file starts with a boundary
+ *  line and a part header whose Content-Length tells us exactly
+ *  where the first JPEG starts and ends.
+ * =============================================================
+ */
+
+#include "thumbs.h"
+#include "media_store.h"
+#include "mem_track.h"
+#include "esp_camera.h"
+#include "esp_heap_caps.h"
+#include "img_converters.h"
+#include "FS.h"
+#include "SD_MMC.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#if defined(ARDUINO_ARCH_ESP32) && defined(CONFIG_ARDUHAL_ESP_LOG)
+#include "esp32-hal-log.h"
+#endif
+
+static SemaphoreHandle_t genLock = NULL;
+
+// Prefer PSRAM for the (large) source and decode buffers
+static uint8_t *alloc_big(size_t size) {
+  return (uint8_t *)mem_alloc_caps(MEM_THUMBS, size, MEM_PSRAM, MALLOC_CAP_DEFAULT);
+}
+
+static bool has_suffix(const char *s, const char *suffix) {
+  size_t ls = strlen(s), lx = strlen(suffix);
+  return ls >= lx && strcasecmp(s + ls - lx, suffix) == 0;
+}
+
+void thumb_path_for(const char *mediaPath, char *out, size_t outLen) {
+  const char *base = strrchr(mediaPath, '/');
+  base = base ? base + 1 : mediaPath;
+
+  // Same bucket layout as the media itself, so no cache dir grows unbounded
+  int bucket = media_bucket_of(base);
+  if (bucket >= 0) snprintf(out, outLen, THUMB_DIR "/b%03d/%s.jpg", bucket, base);
+  else snprintf(out, outLen, THUMB_DIR "/%s.jpg", base);
+}
+
+void thumb_invalidate(const char *mediaPath) {
+  char path[160];
+  thumb_path_for(mediaPath, path, sizeof(path));
+  if (SD_MMC.exists(path)) SD_MMC.remove(path);
+}
+
+// ==================================================================
+//  Source frame loading
+// ==================================================================
+static bool read_exact(File &file, size_t offset, size_t len, uint8_t **out) {
+  if (len == 0 || len > THUMB_MAX_SOURCE) return false;
+  uint8_t *buf = alloc_big(len);
+  if (!buf) return false;
+  if (!file.seek(offset) || file.read(buf, len) != len) {
+    mem_free(MEM_THUMBS, buf);
+    return false;
+  }
+  *out = buf;
+  return true;
+}
+
+// Locate the first JPEG part of an MJPEG recording
+static bool first_frame_bounds(File &file, size_t *offset, size_t *len) {
+  char head[256];
+  size_t n = file.read((uint8_t *)head, sizeof(head) - 1);
+  head[n] = '\0';
+
+  const char *cl = strstr(head, "Content-Length:");
+  const char *body = strstr(head, "\r\n\r\n");
+  if (!cl || !body || body < cl) return false;
+
+  *len = strtoul(cl + strlen("Content-Length:"), NULL, 10);
+  *offset = (body - head) + 4;
+  return *len > 0 && *offset + *len <= file.size();
+}
+
+static bool load_source(const char *mediaPath, uint8_t **buf, size_t *len) {
+  File file = SD_MMC.open(mediaPath, FILE_READ);
+  if (!file) return false;
+
+  bool ok = false;
+  if (has_suffix(mediaPath, ".mjpeg")) {
+    size_t offset;
+    if (first_frame_bounds(file, &offset, len)) {
+      ok = read_exact(file, offset, *len, buf);
+    }
+  } else {
+    *len = file.size();
+    ok = read_exact(file, 0, *len, buf);
+  }
+  file.close();
+  return ok;
+}
+
+// Read image dimensions from the SOF marker
+bool jpeg_dimensions(const uint8_t *buf, size_t len, uint16_t *w, uint16_t *h) {
+  if (len < 4 || buf[0] != 0xFF || buf[1] != 0xD8) return false;
+  size_t i = 2;
+  while (i + 9 < len) {
+    if (buf[i] != 0xFF) return false;
+    uint8_t marker = buf[i + 1];
+    if (marker == 0xFF) {  // fill byte
+      i++;
+      continue;
+    }
+    uint16_t segLen = (buf[i + 2] << 8) | buf[i + 3];
+    if (marker >= 0xC0 && marker <= 0xC2) {
+      *h = (buf[i + 5] << 8) | buf[i + 6];
+      *w = (buf[i + 7] << 8) | buf[i + 8];
+      return *w > 0 && *h > 0;
+    }
+    if (marker == 0xDA) return false;  // start of scan before SOF
+    i += 2 + segLen;
+  }
+  return false;
+}
+
+// ==================================================================
+//  Thumbnail generation (1/8 decode + re-encode)
+// ==================================================================
+static bool generate(const char *mediaPath, uint8_t **jpg, size_t *jpgLen) {
+  uint8_t *src = NULL;
+  size_t srcLen = 0;
+  if (!load_source(mediaPath, &src, &srcLen)) {
+    log_e("Thumb: cannot read source %s", mediaPath);
+    return false;
+  }
+
+  uint16_t w, h;
+  if (!jpeg_dimensions(src, srcLen, &w, &h) || w < 8 || h < 8) {
+    log_e("Thumb: not a baseline JPEG: %s", mediaPath);
+    mem_free(MEM_THUMBS, src);
+    return false;
+  }
+
+  // Decoder emits whole MCUs, so size the buffer for the rounded-up image
+  uint16_t tw = w / 8, th = h / 8;
+  size_t rgbLen = (size_t)((w + 15) / 8) * ((h + 15) / 8) * 2;
+  uint8_t *rgb = alloc_big(rgbLen);
+  if (!rgb) {
+    mem_free(MEM_THUMBS, src);
+    return false;
+  }
+
+  bool ok = jpg2rgb565(src, srcLen, rgb, JPG_SCALE_8X);
+  mem_free(MEM_THUMBS, src);
+  if (ok) {
+    ok = fmt2jpg(rgb, (size_t)tw * th * 2, tw, th, PIXFORMAT_RGB565,
+                 THUMB_JPEG_QUALITY, jpg, jpgLen);
+    if (ok) mem_adopt(MEM_THUMBS, *jpg);
+  }
+  mem_free(MEM_THUMBS, rgb);
+
+  if (!ok) log_e("Thumb: decode/encode failed for %s", mediaPath);
+  return ok;
+}
+
+static void store(const char *thumbPath, const uint8_t *jpg, size_t len) {
+  if (!SD_MMC.exists(THUMB_DIR)) SD_MMC.mkdir(THUMB_DIR);
+
+  // Bucket subdirectory, if any
+  char dir[160];
+  strlcpy(dir, thumbPath, sizeof(dir));
+  char *slash = strrchr(dir, '/');
+  if (slash && slash != dir + strlen(THUMB_DIR)) {
+    *slash = '\0';
+    if (!SD_MMC.exists(dir)) SD_MMC.mkdir(dir);
+  }
+
+  File file = SD_MMC.open(thumbPath, FILE_WRITE);
+  if (!file) return;
+  size_t written = file.write(jpg, len);
+  file.close();
+  if (written != len) SD_MMC.remove(thumbPath);  // never leave a truncated cache entry
+}
+
+// Cache hit: thumbnails are small, read in one go
+static bool read_cached(const char *thumbPath, uint8_t **jpg, size_t *len) {
+  File cached;
+  if (SD_MMC.exists(thumbPath)) cached = SD_MMC.open(thumbPath, FILE_READ);
+  if (!cached) return false;
+  size_t size = cached.size();
+  uint8_t *buf = size ? (uint8_t *)mem_alloc(MEM_THUMBS, size) : NULL;
+  bool ok = buf && cached.read(buf, size) == size;
+  cached.close();
+  if (!ok) {
+    mem_free(MEM_THUMBS, buf);
+    return false;
+  }
+  *jpg = buf;
+  *len = size;
+  return true;
+}
+
+void thumbs_init() {
+  if (!genLock) genLock = xSemaphoreCreateMutex();
+}
+
+bool thumb_load(const char *mediaPath, uint8_t **jpg, size_t *len) {
+  char thumbPath[160];
+  thumb_path_for(mediaPath, thumbPath, sizeof(thumbPath));
+  if (read_cached(thumbPath, jpg, len)) return true;
+
+  // One generation at a time: decode buffers are large, and two
+  // workers asking for the same item must not write one cache file
+  if (genLock) xSemaphoreTake(genLock, portMAX_DELAY);
+  bool ok = read_cached(thumbPath, jpg, len);   // made while we waited?
+  if (!ok && (ok = generate(mediaPath, jpg, len))) {
+    store(thumbPath, *jpg, *len);
+    log_i("Thumb: generated %s (%u bytes)", thumbPath, *len);
+  }
+  if (genLock) xSemaphoreGive(genLock);
+  return ok;
+}
@@ -0,0 +1,39 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Gallery Thumbnails (thumbs.h)
+ * =============================================================
+ *  Thumbnails are made lazily on first request with the JPEG
+ *  decoder's 1/8 scaling plus a re-encode, then cached on the
+ *  SD card under THUMB_DIR so later gallery opens only read a
+ *  few KB per item.
+ * =============================================================
+ */
+#ifndef THUMBS_H
+#define THUMBS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define THUMB_DIR           "/thumbs"
+#define THUMB_JPEG_QUALITY  70
+#define THUMB_MAX_SOURCE    (512 * 1024)  // Largest source frame we will decode
+
+// Create the generation lock (before the HTTP workers start)
+void thumbs_init();
+
+// Build the cache path for a media file ("/a.jpg" -> "/thumbs/a.jpg.jpg")
+void thumb_path_for(const char *mediaPath, char *out, size_t outLen);
+
+// Load the thumbnail for a media file, generating and caching it if
+// needed. On success *jpg is a heap buffer the caller releases with
+// mem_free(MEM_THUMBS, ...). Safe to call from several tasks.
+bool thumb_load(const char *mediaPath, uint8_t **jpg, size_t *len);
+
+// Width and height from a baseline JPEG's SOF marker
+bool jpeg_dimensions(const uint8_t *buf, size_t len, uint16_t *w, uint16_t *h);
+
+// Drop the cached thumbnail (call when a media file is rewritten or removed)
+void thumb_invalidate(const char *mediaPath);
+
+#endif  // THUMBS_H
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+TRINETRA - ESP32-CAM Surveillance System
+UI generator (tools/build_ui.py)
+
+Compresses ui/index.html and writes camera_index.h with:
+  index_html_gz[]      gzip bytes (PROGMEM)
+  index_html_gz_len    length of the array
+  INDEX_HTML_ETAG      quoted content hash, used for If-None-Match
+
+Edit ui/index.html, then run from the sketch directory:
+  python3 tools/build_ui.py
+"""
+
+import gzip
+import hashlib
+import os
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE = os.path.join(ROOT, "ui", "index.html")
+OUTPUT = os.path.join(ROOT, "camera_index.h")
+BYTES_PER_LINE = 16
+
+HEADER = """/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  Web Interface (camera_index.h) - GENERATED, DO NOT EDIT
+ * =============================================================
+ *  Source: ui/index.html, rebuilt by tools/build_ui.py.
+ *  Stored gzip-compressed; served with Content-Encoding: gzip
+ *  and validated by ETag.
+ *
+ *  {html_len} bytes of HTML -> {gz_len} bytes gzip
+ * =============================================================
+ */
+#ifndef CAMERA_INDEX_H
+#define CAMERA_INDEX_H
+#include <stddef.h>
+#include <pgmspace.h>
+
+#define INDEX_HTML_ETAG "\\"{etag}\\""
+
+const size_t index_html_gz_len = {gz_len};
+const unsigned char index_html_gz[] PROGMEM = {{
+"""
+
+FOOTER = """};
+
+#endif
+"""
+
+
+def main():
+    with open(SOURCE, "rb") as f:
+        html = f.read()
+
+    # mtime=0 keeps the output byte-identical for identical input
+    gz = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha256(gz).hexdigest()[:16]
+
+    lines = []
+    for i in range(0, len(gz), BYTES_PER_LINE):
+        chunk = gz[i:i + BYTES_PER_LINE]
+        lines.append("  " + ", ".join("0x%02x" % b for b in chunk) + ",")
+
+    out = HEADER.format(html_len=len(html), gz_len=len(gz), etag=etag)
+    out += "\n".join(lines) + "\n" + FOOTER
+
+    with open(OUTPUT, "w", newline="\n") as f:
+        f.write(out)
+
+    print("camera_index.h: %d -> %d bytes (%.0f%%), ETag %s"
+          % (len(html), len(gz), 100.0 * len(gz) / len(html), etag))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
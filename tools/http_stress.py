@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+"""
+TRINETRA - ESP32-CAM Surveillance System
+Concurrency stress test (tools/http_stress.py)
+
+Fires parallel requests at the control server and checks that every
+response is intact: downloads and thumbnails must match a reference
+copy byte for byte (and carry their own Content-Length and
+Content-Disposition), JSON must parse, captures must be whole JPEGs and
+the metrics text must be well-formed. Any mismatch means two requests
+shared state; the script then exits with status 1.
+
+Run against an idle camera (no recording, no file changes):
+  python3 tools/http_stress.py 192.168.4.1 --threads 6 --seconds 60
+"""
+
+import argparse
+import hashlib
+import json
+import random
+import sys
+import threading
+import time
+import urllib.error
+import urllib.parse
+import urllib.request
+from collections import defaultdict
+
+JSON_ENDPOINTS = ["/status", "/system-stats", "/state", "/sd-info", "/jobs", "/mem",
+                  "/tasks?ms=100", "/save-status"]
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.ok = defaultdict(int)
+        self.busy = defaultdict(int)
+        self.bad = defaultdict(list)
+        self.latency = defaultdict(list)
+
+    def record(self, kind, ms, error=None, busy=False):
+        with self.lock:
+            self.latency[kind].append(ms)
+            if busy:
+                self.busy[kind] += 1
+            elif error:
+                self.bad[kind].append(error)
+            else:
+                self.ok[kind] += 1
+
+
+def fetch(base, path, timeout):
+    with urllib.request.urlopen(base + path, timeout=timeout) as resp:
+        return resp.status, dict(resp.headers), resp.read()
+
+
+def reference(base, names, timeout):
+    """One sequential copy of each file and thumbnail to compare against."""
+    refs = {}
+    for f in names:
+        q = urllib.parse.quote(f["name"])
+        _, headers, body = fetch(base, "/download-file?name=" + q, timeout)
+        _, _, thumb = fetch(base, "/thumb?name=%s&s=%d" % (q, f["size"]), timeout)
+        refs[f["name"]] = {
+            "sha": hashlib.sha256(body).hexdigest(),
+            "len": len(body),
+            "disp": headers.get("Content-Disposition", ""),
+            "thumb": hashlib.sha256(thumb).hexdigest(),
+        }
+    return refs
+
+
+def check_download(base, f, ref, timeout):
+    q = urllib.parse.quote(f["name"])
+    status, headers, body = fetch(base, "/download-file?name=" + q, timeout)
+    if status != 200:
+        return "status %d" % status
+    if len(body) != ref["len"] or hashlib.sha256(body).hexdigest() != ref["sha"]:
+        return "%s: body differs (%d bytes, expected %d)" % (f["name"], len(body), ref["len"])
+    if headers.get("Content-Length") not in (None, str(ref["len"])):
+        return "%s: Content-Length %s" % (f["name"], headers.get("Content-Length"))
+    if headers.get("Content-Disposition", "") != ref["disp"]:
+        return "%s: Content-Disposition %r" % (f["name"], headers.get("Content-Disposition"))
+    return None
+
+
+def check_thumb(base, f, ref, timeout):
+    q = urllib.parse.quote(f["name"])
+    _, _, body = fetch(base, "/thumb?name=%s&s=%d" % (q, f["size"]), timeout)
+    if hashlib.sha256(body).hexdigest() != ref["thumb"]:
+        return "%s: thumbnail differs" % f["name"]
+    return None
+
+
+def check_json(base, path, timeout):
+    _, _, body = fetch(base, path, timeout)
+    try:
+        doc = json.loads(body)
+    except ValueError as e:
+        return "%s: invalid JSON (%s): %r" % (path, e, body[:80])
+    if isinstance(doc, dict) and doc.get("success") is False:
+        return "%s: %s" % (path, doc.get("error"))
+    return None
+
+
+def check_list(base, expected, timeout):
+    _, _, body = fetch(base, "/list-files", timeout)
+    try:
+        names = sorted(f["name"] for f in json.loads(body)["files"])
+    except (ValueError, KeyError) as e:
+        return "/list-files: bad listing (%s)" % e
+    if names != expected:
+        return "/list-files: %d names, expected %d" % (len(names), len(expected))
+    return None
+
+
+def check_capture(base, timeout):
+    _, headers, body = fetch(base, "/capture", timeout)
+    if not body.startswith(b"\xff\xd8") or b"\xff\xd9" not in body[-16:]:
+        return "/capture: not a complete JPEG (%d bytes)" % len(body)
+    return None
+
+
+def check_metrics(base, timeout):
+    _, _, body = fetch(base, "/metrics", timeout)
+    text = body.decode("utf-8", "replace")
+    if not text.endswith("\n"):
+        return "/metrics: truncated"
+    for line in text.splitlines():
+        if line.startswith("#"):
+            continue
+        parts = line.rsplit(" ", 1)
+        try:
+            float(parts[1])
+        except (IndexError, ValueError):
+            return "/metrics: bad line %r" % line[:80]
+    return None
+
+
+def worker(args, base, files, refs, listing, stats, stop):
+    rnd = random.Random()
+    ops = ["download", "thumb", "json", "list", "capture", "metrics"]
+    weights = [3, 3, 4, 1, 1, 1]
+    while not stop.is_set():
+        kind = rnd.choices(ops, weights)[0]
+        f = rnd.choice(files) if files else None
+        if kind in ("download", "thumb") and not f:
+            kind = "json"
+        start = time.monotonic()
+        try:
+            if kind == "download":
+                err = check_download(base, f, refs[f["name"]], args.timeout)
+            elif kind == "thumb":
+                err = check_thumb(base, f, refs[f["name"]], args.timeout)
+            elif kind == "json":
+                err = check_json(base, rnd.choice(JSON_ENDPOINTS), args.timeout)
+            elif kind == "list":
+                err = check_list(base, listing, args.timeout)
+            elif kind == "capture":
+                err = check_capture(base, args.timeout)
+            else:
+                err = check_metrics(base, args.timeout)
+            stats.record(kind, (time.monotonic() - start) * 1000, err)
+        except urllib.error.HTTPError as e:
+            stats.record(kind, (time.monotonic() - start) * 1000, busy=e.code == 503,
+                         error=None if e.code == 503 else "HTTP %d" % e.code)
+        except OSError as e:
+            # Refused/reset connections are socket limits, not corruption
+            stats.record(kind, (time.monotonic() - start) * 1000, busy=True)
+            if args.verbose:
+                print("  %s: %s" % (kind, e), file=sys.stderr)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("host", help="camera address, e.g. 192.168.4.1")
+    ap.add_argument("--threads", type=int, default=6)
+    ap.add_argument("--seconds", type=float, default=30)
+    ap.add_argument("--files", type=int, default=6, help="gallery files to download (smallest first)")
+    ap.add_argument("--timeout", type=float, default=30)
+    ap.add_argument("--verbose", action="store_true")
+    args = ap.parse_args()
+
+    base = args.host if args.host.startswith("http") else "http://" + args.host
+    _, _, body = fetch(base, "/list-files", args.timeout)
+    all_files = json.loads(body).get("files", [])
+    listing = sorted(f["name"] for f in all_files)
+    files = sorted((f for f in all_files if f["type"] == "photo"), key=lambda f: f["size"])[:args.files]
+    print("Reference copies of %d files..." % len(files))
+    refs = reference(base, files, args.timeout)
+
+    stats = Stats()
+    stop = threading.Event()
+    threads = [threading.Thread(target=worker, args=(args, base, files, refs, listing, stats, stop))
+               for _ in range(args.threads)]
+    print("%d threads for %.0f s..." % (args.threads, args.seconds))
+    for t in threads:
+        t.start()
+    time.sleep(args.seconds)
+    stop.set()
+    for t in threads:
+        t.join()
+
+    failed = 0
+    print("\n%-10s %7s %6s %6s %8s %8s" % ("kind", "ok", "busy", "bad", "p50 ms", "max ms"))
+    for kind in sorted(stats.latency):
+        lat = sorted(stats.latency[kind])
+        bad = stats.bad[kind]
+        failed += len(bad)
+        print("%-10s %7d %6d %6d %8.0f %8.0f" % (kind, stats.ok[kind], stats.busy[kind], len(bad),
+                                                 lat[len(lat) // 2], lat[-1]))
+    for kind in sorted(stats.bad):
+        for err in stats.bad[kind][:5]:
+            print("  %s: %s" % (kind, err))
+
+    print("\n%s" % ("FAIL: %d corrupted responses" % failed if failed else "PASS: every response intact"))
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,195 @@
+/*
+ * =============================================================
+ *  TRINETRA - ESP32-CAM Surveillance System
+ *  DC-only decoder benchmark (tools/jpeg_dc_bench.cpp)
+ * =============================================================
+ *  Host microbenchmark for jpeg_dc.cpp: decodes every frame of
+ *  the given .jpg files or .mjpeg recordings in a loop and prints
+ *  frames per second and MB/s of JPEG consumed.
+ *
+ *  Built against libjpeg it also times a full decode and libjpeg's
+ *  own 1/8-scale decode of the same frames, and checks the DC map
+ *  against the 8x8 block means of the full decode (luma differs
+ *  only by quantisation and rounding; max error should be a few
+ *  levels).
+ *
+ *    g++ -O2 -I. tools/jpeg_dc_bench.cpp jpeg_dc.cpp -o jpeg_dc_bench
+ *    g++ -O2 -I. -DWITH_LIBJPEG tools/jpeg_dc_bench.cpp jpeg_dc.cpp -ljpeg -o jpeg_dc_bench
+ *    ./jpeg_dc_bench video_00012.mjpeg --seconds 3
+ *
+ *  Host figures are for comparing the paths; on the device the
+ *  same ratio shows up in /status ("scene" -> "analysis_us").
+ * =============================================================
+ */
+
+#include "jpeg_dc.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#ifdef WITH_LIBJPEG
+#include <jpeglib.h>
+#endif
+
+typedef std::vector<uint8_t> bytes_t;
+
+static bool read_file(const char *path, bytes_t *out) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) out->insert(out->end(), chunk, chunk + n);
+  fclose(f);
+  return true;
+}
+
+// Every SOI..EOI span: one for a .jpg, one per part of a recording
+static void split_frames(const bytes_t &data, std::vector<bytes_t> *frames) {
+  size_t i = 0;
+  while (i + 3 < data.size()) {
+    if (data[i] != 0xFF || data[i + 1] != 0xD8 || data[i + 2] != 0xFF) {
+      i++;
+      continue;
+    }
+    size_t j = i + 2;
+    while (j + 1 < data.size() && !(data[j] == 0xFF && data[j + 1] == 0xD9)) j++;
+    if (j + 1 >= data.size()) break;
+    frames->push_back(bytes_t(data.begin() + i, data.begin() + j + 2));
+    i = j + 2;
+  }
+}
+
+static double now_s() {
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+typedef bool (*decode_fn)(const bytes_t &jpg, std::vector<uint8_t> *out, int *w, int *h);
+
+static jpeg_dc_t dcContext;
+
+static bool decode_dc(const bytes_t &jpg, std::vector<uint8_t> *out, int *w, int *h) {
+  uint16_t mw = 0, mh = 0;
+  if (!jpeg_dc_luma(&dcContext, jpg.data(), jpg.size(), out->data(), out->size(), &mw, &mh)) return false;
+  *w = mw;
+  *h = mh;
+  return true;
+}
+
+#ifdef WITH_LIBJPEG
+// Luma only (JCS_GRAYSCALE skips colour conversion), at 1/scale
+static bool decode_libjpeg(const bytes_t &jpg, std::vector<uint8_t> *out, int *w, int *h, int scale) {
+  jpeg_decompress_struct cinfo;
+  jpeg_error_mgr jerr;
+  cinfo.err = jpeg_std_error(&jerr);
+  jerr.error_exit = [](j_common_ptr) { throw 1; };
+  jerr.output_message = [](j_common_ptr) {};        // corrupt-data warnings
+  try {
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, jpg.data(), jpg.size());
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_GRAYSCALE;
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scale;
+    jpeg_start_decompress(&cinfo);
+    *w = cinfo.output_width;
+    *h = cinfo.output_height;
+    if ((size_t)*w * *h > out->size()) out->resize((size_t)*w * *h);
+    while (cinfo.output_scanline < cinfo.output_height) {
+      JSAMPROW row = out->data() + (size_t)cinfo.output_scanline * *w;
+      jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+    jpeg_finish_decompress(&cinfo);
+  } catch (int) {
+    jpeg_destroy_decompress(&cinfo);
+    return false;
+  }
+  jpeg_destroy_decompress(&cinfo);
+  return true;
+}
+
+static bool decode_full(const bytes_t &jpg, std::vector<uint8_t> *out, int *w, int *h) {
+  return decode_libjpeg(jpg, out, w, h, 1);
+}
+
+static bool decode_eighth(const bytes_t &jpg, std::vector<uint8_t> *out, int *w, int *h) {
+  return decode_libjpeg(jpg, out, w, h, 8);
+}
+
+// Largest |DC map - mean of the matching 8x8 block of the full decode|
+static int max_error(const std::vector<bytes_t> &frames) {
+  std::vector<uint8_t> map(1 << 20), full(1 << 22);
+  int worst = 0;
+  for (const bytes_t &f : frames) {
+    int mw, mh, fw, fh;
+    if (!decode_dc(f, &map, &mw, &mh) || !decode_full(f, &full, &fw, &fh)) continue;
+    for (int by = 0; by < mh && by * 8 + 8 <= fh; by++) {
+      for (int bx = 0; bx < mw && bx * 8 + 8 <= fw; bx++) {
+        int sum = 0;
+        for (int y = 0; y < 8; y++) {
+          for (int x = 0; x < 8; x++) sum += full[(size_t)(by * 8 + y) * fw + bx * 8 + x];
+        }
+        int err = abs(map[(size_t)by * mw + bx] - (sum + 32) / 64);
+        if (err > worst) worst = err;
+      }
+    }
+  }
+  return worst;
+}
+#endif
+
+static void run(const char *name, decode_fn fn, const std::vector<bytes_t> &frames, size_t totalBytes,
+                double seconds) {
+  std::vector<uint8_t> out(1 << 22);
+  int w = 0, h = 0;
+  size_t frameCount = 0, failed = 0, bytes = 0;
+  double start = now_s(), elapsed = 0;
+  do {
+    for (const bytes_t &f : frames) {
+      if (!fn(f, &out, &w, &h)) failed++;
+      frameCount++;
+    }
+    bytes += totalBytes;
+    elapsed = now_s() - start;
+  } while (elapsed < seconds);
+  printf("%-16s %10.0f fps %9.1f MB/s %8.1f us/frame  %dx%d out%s\n", name, frameCount / elapsed,
+         bytes / elapsed / 1e6, elapsed * 1e6 / frameCount, w, h,
+         failed ? "  (some frames failed)" : "");
+}
+
+int main(int argc, char **argv) {
+  double seconds = 2;
+  std::vector<bytes_t> frames;
+  size_t totalBytes = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--seconds") && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+      continue;
+    }
+    bytes_t data;
+    if (!read_file(argv[i], &data)) {
+      fprintf(stderr, "cannot read %s\n", argv[i]);
+      return 1;
+    }
+    split_frames(data, &frames);
+  }
+  if (frames.empty()) {
+    fprintf(stderr, "usage: %s file.jpg|file.mjpeg ... [--seconds N]\n", argv[0]);
+    return 1;
+  }
+  for (const bytes_t &f : frames) totalBytes += f.size();
+
+  jpeg_dc_reset(&dcContext);
+  printf("%zu frames, %.1f KB average\n", frames.size(), totalBytes / 1024.0 / frames.size());
+  run("dc-only", decode_dc, frames, totalBytes, seconds);
+  printf("%-16s %10u (of %zu frames)\n", "table builds", dcContext.tableBuilds, frames.size());
+#ifdef WITH_LIBJPEG
+  run("libjpeg 1/8", decode_eighth, frames, totalBytes, seconds);
+  run("libjpeg full", decode_full, frames, totalBytes, seconds);
+  printf("%-16s %10d levels\n", "max dc error", max_error(frames));
+#endif
+  return 0;
+}
@@ -40,6 +40,12 @@ uint8_t temprature_sens_read();
 
 // Board configuration (selects AI-Thinker + pin definitions)
 #include "board_config.h"
+#include "sd_stream.h"
+#include "media_store.h"
+#include "sd_writer.h"
+#include "json_writer.h"
+#include "mem_track.h"
+#include "mem_pool.h"
 
 // =======================
 // WiFi Manager - Preferences Storage
@@ -81,7 +87,6 @@ bool sdCardAvailable = false;
 // =======================
 void startCameraServer();
 void setupLedFlash();
-extern uint32_t photoCounter;  // Shared with app_httpd.cpp for unique filenames
 
 // =======================
 // Physical Button Configuration
@@ -130,25 +135,34 @@ void clearWiFiCredentials() {
   Serial.println("[WiFi] Credentials cleared");
 }
 
-// Scan for available WiFi networks (returns JSON)
-String scanNetworks() {
+// Scan for available WiFi networks (writes a JSON array). A writer
+// bound to a request streams every network; a buffer-only one stops
+// while the largest entry still fits (the driver lists the strongest
+// first). False when networks were left out.
+#define WIFI_SCAN_ENTRY_MAX 256   // escaped 32-byte SSID, rssi, secure, and the closing brackets
+
+bool scanNetworks(json_writer_t *w) {
   Serial.println("[WiFi] Scanning networks...");
   int n = WiFi.scanNetworks();
-  String json = "[";
-  
+  bool complete = true;
+
+  jw_arr_open(w);
   for (int i = 0; i < n; i++) {
-    if (i > 0) json += ",";
-    json += "{";
-    json += "\"ssid\":\"" + WiFi.SSID(i) + "\",";
-    json += "\"rssi\":" + String(WiFi.RSSI(i)) + ",";
-    json += "\"secure\":" + String(WiFi.encryptionType(i) != WIFI_AUTH_OPEN ? "true" : "false");
-    json += "}";
+    if (!w->req && w->cap - w->len < WIFI_SCAN_ENTRY_MAX) {
+      complete = false;
+      break;
+    }
+    jw_obj_open(w);
+    jw_str(w, "ssid", WiFi.SSID(i).c_str());  // escaped: SSIDs may hold quotes
+    jw_int(w, "rssi", WiFi.RSSI(i));
+    jw_bool(w, "secure", WiFi.encryptionType(i) != WIFI_AUTH_OPEN);
+    jw_obj_close(w);
   }
-  json += "]";
-  
+  jw_arr_close(w);
+
   WiFi.scanDelete();
   Serial.printf("[WiFi] Found %d networks\n", n);
-  return json;
+  return complete;
 }
 
 // Try to connect to a WiFi network
@@ -184,16 +198,15 @@ bool connectToWiFi(const char* ssid, const char* password, int timeoutSeconds =
   }
 }
 
-// Get current WiFi status as JSON
-String getWiFiStatus() {
-  String json = "{";
-  json += "\"connected\":" + String(wifiConnected ? "true" : "false") + ",";
-  json += "\"ssid\":\"" + (wifiConnected ? WiFi.SSID() : savedSSID) + "\",";
-  json += "\"ip\":\"" + (wifiConnected ? WiFi.localIP().toString() : String("")) + "\",";
-  json += "\"rssi\":" + String(wifiConnected ? WiFi.RSSI() : 0) + ",";
-  json += "\"savedSSID\":\"" + savedSSID + "\"";
-  json += "}";
-  return json;
+// Get current WiFi status (writes a JSON object)
+void getWiFiStatus(json_writer_t *w) {
+  jw_obj_open(w);
+  jw_bool(w, "connected", wifiConnected);
+  jw_str(w, "ssid", (wifiConnected ? WiFi.SSID() : savedSSID).c_str());
+  jw_str(w, "ip", wifiConnected ? WiFi.localIP().toString().c_str() : "");
+  jw_int(w, "rssi", wifiConnected ? WiFi.RSSI() : 0);
+  jw_str(w, "savedSSID", savedSSID.c_str());
+  jw_obj_close(w);
 }
 
 // =======================
@@ -227,6 +240,19 @@ void initSDCard() {
   }
   Serial.printf("[SD] Total: %lluMB\n", SD_MMC.totalBytes() / (1024 * 1024));
   Serial.printf("[SD] Used:  %lluMB\n", SD_MMC.usedBytes()  / (1024 * 1024));
+
+  // Size the download read-ahead buffers for this card
+  sd_stream_init();
+  Serial.printf("[SD] Stream chunk: %uKB\n", (unsigned)(sd_stream_chunk_size() / 1024));
+
+  // Bucketed media layout; continues numbering after the files already on the card
+  media_store_init();
+  Serial.printf("[SD] Next photo: %lu, next video: %lu\n",
+                (unsigned long)media_max_counter("trinetra_") + 1,
+                (unsigned long)media_max_counter("video_") + 1);
+
+  // Photos are persisted in the background (write-behind queue)
+  if (!sd_writer_init()) Serial.println("[SD] Writer task failed to start");
 }
 
 // =======================
@@ -270,34 +296,15 @@ void buttonCapturePhoto() {
     return;
   }
 
-  // Build filename and save
-  char filename[64];
-  photoCounter++;
-  snprintf(filename, sizeof(filename), "/trinetra_%05lu.jpg", (unsigned long)photoCounter);
-
-  File file = SD_MMC.open(filename, FILE_WRITE);
-  if (!file) {
-    Serial.println("[BTN] Failed to open file on SD");
-    esp_camera_fb_return(fb);
-    return;
-  }
-
+  // Build filename and queue the JPEG; the SD write happens in the background
+  char filename[40];
   size_t written = 0;
-  if (fb->format == PIXFORMAT_JPEG) {
-    written = file.write(fb->buf, fb->len);
-  } else {
-    uint8_t *jpg_buf = NULL;
-    size_t jpg_len = 0;
-    if (frame2jpg(fb, 80, &jpg_buf, &jpg_len)) {
-      written = file.write(jpg_buf, jpg_len);
-      free(jpg_buf);
-    }
-  }
-  file.close();
+  bool queued = media_next_name("trinetra_", ".jpg", filename, sizeof(filename)) &&
+                sd_writer_submit_fb(fb, filename, NULL, &written);
   esp_camera_fb_return(fb);
 
-  if (written > 0) {
-    Serial.printf("[BTN] Photo saved: %s (%u bytes)\n", filename, (unsigned)written);
+  if (queued) {
+    Serial.printf("[BTN] Photo queued: %s (%u bytes)\n", filename, (unsigned)written);
     // Success: double-blink confirmation
 #if defined(LED_GPIO_NUM)
     delay(100);
@@ -310,7 +317,7 @@ void buttonCapturePhoto() {
     ledcWrite(LED_GPIO_NUM, 0);
 #endif
   } else {
-    Serial.println("[BTN] Write to SD failed");
+    Serial.println("[BTN] Save queue full or out of memory");
   }
 }
 
@@ -402,6 +409,9 @@ void setup() {
   Serial.println("[BTN] Shutter button ready on GPIO " + String(BUTTON_GPIO_NUM));
 #endif
 
+  // ----- Buffer pools (after the camera has its frame buffers) -----
+  mem_pool_init();
+
   // ----- Initialize SD Card -----
   initSDCard();
 
@@ -515,6 +525,7 @@ void setup() {
 void loop() {
   dnsServer.processNextRequest();  // Handle DNS for captive portal redirection
   ArduinoOTA.handle();              // Handle OTA updates
+  mem_track_poll();                 // Largest-block watermarks and low-memory alert
   
   // Auto-reconnect to saved WiFi if connection is lost
   static unsigned long lastReconnectAttempt = 0;